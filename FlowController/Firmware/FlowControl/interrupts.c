@@ -3,6 +3,7 @@
 #include "src/LED.h"
 #include "src/command.h"
 #include "src/buffer_c.h"
+#include "src/valveseq.h"
 
 /************************************************************************
 *					INTERRUPT VECTOR
@@ -203,6 +204,11 @@ __interrupt void Timer0_A0_ISR (void)
       Timer.i2c.flag = true;
     }
   }
+
+  /** Wake VSEQ_Run when the next valve edge is due */
+  if(VSEQ_Tick()){
+    __bic_SR_register_on_exit(LPM0_bits);
+  }
 }
 
 
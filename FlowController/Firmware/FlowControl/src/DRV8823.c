@@ -148,6 +148,45 @@ eDRV8823Status_t DRV8823_Set_SingleChannel(sDRV8823_t *ic,
     return result;
 }
 
+eDRV8823Status_t DRV8823_Load(sDRV8823_t *ic, uint16_t word)
+{
+    eDRV8823Status_t result = DRV8823_FAIL;
+
+    /** Enable the SPI */
+    BSP_SPI_Enable(&ic->SpiChan);
+
+    /** Low byte first, as in DRV8823_Set */
+    Ring8_Put(&ic->SpiChan.Tx, (uint8_t)(word & 0x00FF));
+    Ring8_Put(&ic->SpiChan.Tx, (uint8_t)((word >> 8) & 0x00FF));
+
+    /** Send the word with the Chip Select held */
+    DRV8823_SetCS(ic);
+    if (BSP_SPI_SendBytes(&ic->SpiChan) == BSP_OK)
+    {
+        if (DRV8823_WORD_IS_CD(word))
+        {
+            ic->Last.dataCD = word;
+        }
+        else
+        {
+            ic->Last.dataAB = word;
+        }
+        result = DRV8823_OK;
+    }
+    DRV8823_ClearCS(ic);
+
+    /** Disable the SPI */
+    BSP_SPI_Disable(&ic->SpiChan);
+
+    return result;
+}
+
+void DRV8823_Strobe(sDRV8823_t *ic)
+{
+    DRV8823_StrobeIC(ic);
+    return;
+}
+
 void DRV8823_SetSleepMode(sDRV8823_t *ic)
 {
     /* Set Sleep Mode Pin */
@@ -232,20 +271,20 @@ STATIC eDRV8823Status_t DRV8823_Set(sDRV8823_t *ic,
     uint8_t lb = 0u;
     uint8_t hb = 0u;
 
-    /** Split the Low and High Bytes of AB Send value, save to circular SPI buffer */
+    /** Split the Low and High Bytes of AB Send value, save to SPI ring buffer */
     if ((chan == DRV8823_CHAN_A) || (chan == DRV8823_CHAN_B) || (chan == DRV8823_CHAN_AB))
     {
         lb = ic->Send.dataAB & 0x00FF;
         hb = (ic->Send.dataAB >> 8) & 0x00FF;
-        Buffer8_put(&ic->SpiChan.Tx, lb);
-        Buffer8_put(&ic->SpiChan.Tx, hb);
+        Ring8_Put(&ic->SpiChan.Tx, lb);
+        Ring8_Put(&ic->SpiChan.Tx, hb);
     }
     else if ((chan == DRV8823_CHAN_C) || (chan == DRV8823_CHAN_D) || (chan == DRV8823_CHAN_CD))
     {
         lb = ic->Send.dataCD & 0x00FF;
         hb = (ic->Send.dataCD >> 8) & 0x00FF;
-        Buffer8_put(&ic->SpiChan.Tx, lb);
-        Buffer8_put(&ic->SpiChan.Tx, hb);
+        Ring8_Put(&ic->SpiChan.Tx, lb);
+        Ring8_Put(&ic->SpiChan.Tx, hb);
     }
 
     /** Clear the Sleep & Reset Lines */
@@ -301,31 +340,7 @@ STATIC eDRV8823Status_t DRV8823_Set(sDRV8823_t *ic,
 STATIC uint16_t DRV8823_CreateChannelMsg(eDRV8823Chan_t chan,
                                          sDRV8823DataField_t *data)
 {
-    uint16_t output = 0;
-    uint16_t temp = 0;
-
-    output |= data->Enable;
-
-    temp = data->Phase << 1;
-    output |= temp;
-
-    temp = data->Current << 2;
-    output |= temp;
-
-    temp = data->Decay << 5;
-    output |= temp;
-
-    if (chan == DRV8823_CHAN_B || chan == DRV8823_CHAN_D)
-    {
-        output = output << 6;
-    }
-
-    if (chan == DRV8823_CHAN_C || chan == DRV8823_CHAN_D)
-    {
-        output |= 1 << 12;
-    }
-
-    return output;
+    return DRV8823_CHAN_WORD(chan, data->Decay, data->Current, data->Phase, data->Enable);
 }
 
 /** @brief DRV8823 Set Reset Line
@@ -54,6 +54,16 @@ STATIC uint16_t DRV8823_ChanD_Command(sDRV8823DataField_t *X);
 #define DRV8823_RESET_DELAY_MS (SYS_DRV8823_RESET_DELAY_MS)
 #define DRV8823_WAKEUP_DELAY_MS (SYS_DRV8823_WAKEUP_DELAY_MS)
 
+/** Channel field for the SPI message, see DRV8823_CreateChannelMsg */
+#define DRV8823_CHAN_UPPER(chan) (((chan) & (DRV8823_CHAN_B | DRV8823_CHAN_D)) ? 6u : 0u)
+#define DRV8823_CHAN_WORD(chan, decay, current, phase, enable)               \
+    ((uint16_t)(((((decay) & 0x1u) << 5) | (((current) & 0x7u) << 2) |      \
+                 (((phase) & 0x1u) << 1) | ((enable) & 0x1u))               \
+                << DRV8823_CHAN_UPPER(chan)) |                              \
+     (((chan) & DRV8823_CHAN_CD) ? 0x1000u : 0x0000u))
+#define DRV8823_CHAN_ENABLE(chan) ((uint16_t)(0x0001u << DRV8823_CHAN_UPPER(chan)))
+#define DRV8823_WORD_IS_CD(word) (((word) & 0x1000u) != 0u)
+
 /************************************************************************
 *							Structs & Enums
 ************************************************************************/
@@ -187,6 +197,30 @@ eDRV8823Status_t DRV8823_Set_AllChannels(sDRV8823_t *ic, sDRV8823SetVal_t *outpu
  */
 eDRV8823Status_t DRV8823_SendValue_AndWait_ForStrobe(eDRV8823Chan_t Chan, sDRV8823_t *ic);
 
+/** @brief DRV8823 Load Word
+ *
+ *  Shift a prebuilt 16-bit word (see DRV8823_CHAN_WORD) into the IC
+ *  without strobing it to the outputs.  Bit 12 of the word selects the
+ *  A&B or C&D register.  Used to load several ICs that share a strobe
+ *  line before latching them together with DRV8823_Strobe.
+ *
+ *  @param *ic Pointer to DRV8823 data structure
+ *  @param word Word to send
+ *
+ *  @return result
+ */
+eDRV8823Status_t DRV8823_Load(sDRV8823_t *ic, uint16_t word);
+
+/** @brief DRV8823 Strobe
+ *
+ *  Strobe the loaded words into the outputs
+ *
+ *  @param *ic Pointer to DRV8823 data structure
+ *
+ *  @return None
+ */
+void DRV8823_Strobe(sDRV8823_t *ic);
+
 /** @brief DRV8823 Prep IC
  * 
  *  @param *ic Pointer to DRV8823 data structure
@@ -439,10 +439,9 @@ void BSP_I2C_SetMode(sI2C_t *I2C, uint8_t mode)
 eBSPStatus_t BSP_I2C_SendBytes(sI2C_t *I2C)
 {
   eBSPStatus_t result = BSP_FAIL;
-  uint16_t i;
-  uint16_t len = I2C->Tx.size;
+  uint16_t len = Ring8_Count(&I2C->Tx);
   /** check for a valid transmit length */
-  if (I2C->Tx.size < 1)
+  if (len < 1)
   {
     result = BSP_OK;
   }
@@ -452,16 +451,13 @@ eBSPStatus_t BSP_I2C_SendBytes(sI2C_t *I2C)
     {
 #ifdef BSP_I2C_B0
     case EUSCI_B0_BASE:
-      EUSCI_B0.Tx.ByteCnt = I2C->Tx.size;
+      EUSCI_B0.Tx.ByteCnt = len;
 
       /** Clear the Bus Transmit Buffer */
       ClearBusBufferForTransmit(&EUSCI_B0);
 
       /** Transfer I2C buffer to EUSCI buffer */
-      for (i = 0; i < len; i++)
-      {
-        Buffer8_get(&I2C->Tx, &EUSCI_B0.Tx.buf[i]);
-      }
+      Ring8_Read(&I2C->Tx, EUSCI_B0.Tx.buf, len);
 
       /** Set the mode */
       BSP_I2C_SetMode(I2C, EUSCI_B_I2C_TRANSMIT_MODE);
@@ -494,16 +490,13 @@ eBSPStatus_t BSP_I2C_SendBytes(sI2C_t *I2C)
 #endif
 #ifdef BSP_I2C_B1
     case EUSCI_B1_BASE:
-      EUSCI_B1.Tx.ByteCnt = I2C->Tx.size;
+      EUSCI_B1.Tx.ByteCnt = len;
 
       /** Clear the Bus Transmit Buffer */
       ClearBusBufferForTransmit(&EUSCI_B1);
 
       /** Transfer I2C buffer to EUSCI buffer */
-      for (i = 0; i < len; i++)
-      {
-        Buffer8_get(&I2C->Tx, &EUSCI_B1.Tx.buf[i]);
-      }
+      Ring8_Read(&I2C->Tx, EUSCI_B1.Tx.buf, len);
 
       /** Set the mode */
       BSP_I2C_SetMode(I2C, EUSCI_B_I2C_TRANSMIT_MODE);
@@ -541,7 +534,7 @@ eBSPStatus_t BSP_I2C_SendBytes(sI2C_t *I2C)
     }
   }
   /** Clear the send buffer */
-  Buffer8_Clear(&I2C->Tx);
+  Ring8_Clear(&I2C->Tx);
 
   return result;
 }
@@ -552,7 +545,7 @@ eBSPStatus_t BSP_I2C_ReceiveBytes(sI2C_t *I2C, uint16_t len, uint32_t timeout)
   uint16_t i;
 
   /** Clear the I2C Buffer */
-  Buffer8_Clear(&I2C->Rx);
+  Ring8_Clear(&I2C->Rx);
 
   /** Set the mode */
   BSP_I2C_SetMode(I2C, EUSCI_B_I2C_RECEIVE_MODE);
@@ -610,7 +603,7 @@ eBSPStatus_t BSP_I2C_ReceiveBytes(sI2C_t *I2C, uint16_t len, uint32_t timeout)
   {
     for (i = BSP_BUS_BUFFER_LENGTH; i > 0; --i)
     {
-      Buffer8_put(&I2C->Rx, EUSCI_B0.Rx.buf[i - 1]);
+      Ring8_Put(&I2C->Rx, EUSCI_B0.Rx.buf[i - 1]);
     }
     result = BSP_OK;
   }
@@ -649,10 +642,10 @@ eBSPStatus_t BSP_SPI_SendBytes(sSPI_t *SPI)
 {
   eBSPStatus_t result = BSP_FAIL;
   uint16_t i;
-  uint16_t len = SPI->Tx.size;
+  uint16_t len = Ring8_Count(&SPI->Tx);
 
   /** check for a valid transmit length */
-  if (SPI->Tx.size < 1)
+  if (len < 1)
   {
     result = BSP_OK;
   }
@@ -672,10 +665,7 @@ eBSPStatus_t BSP_SPI_SendBytes(sSPI_t *SPI)
       ClearEUSCI(&EUSCI_B0);
 
       /** Populate the EUSCI Buffer */
-      for (i = 0; i < len; i++)
-      {
-        Buffer8_get(&SPI->Tx, &EUSCI_B0.Tx.buf[i]);
-      }
+      Ring8_Read(&SPI->Tx, EUSCI_B0.Tx.buf, len);
       EUSCI_B0.Rx.ByteCnt = len - 1;
 
       /** Send the data */
@@ -701,10 +691,7 @@ eBSPStatus_t BSP_SPI_SendBytes(sSPI_t *SPI)
       ClearEUSCI(&EUSCI_B1);
 
       /** Populate the EUSCI Buffer */
-      for (i = 0; i < len; i++)
-      {
-        Buffer8_get(&SPI->Tx, &EUSCI_B1.Tx.buf[i]);
-      }
+      Ring8_Read(&SPI->Tx, EUSCI_B1.Tx.buf, len);
       EUSCI_B1.Rx.ByteCnt = len;
 
       /** Send the data */
@@ -729,7 +716,7 @@ eBSPStatus_t BSP_SPI_SendBytes(sSPI_t *SPI)
   }
 
   /** Clear the send buffer */
-  Buffer8_Clear(&SPI->Tx);
+  Ring8_Clear(&SPI->Tx);
 
   switch (SPI->baseAddress)
   {
@@ -755,7 +742,7 @@ eBSPStatus_t BSP_SPI_ReceiveBytes(sSPI_t *SPI, uint16_t len)
   uint16_t i;
 
   /** Clear the SPI Buffer */
-  Buffer8_Clear(&SPI->Rx);
+  Ring8_Clear(&SPI->Rx);
 
   /** Clear the interrupt temp buffer, send start, and wait for completion */
   switch (SPI->baseAddress)
@@ -776,7 +763,7 @@ eBSPStatus_t BSP_SPI_ReceiveBytes(sSPI_t *SPI, uint16_t len)
       ;
     for (i = BSP_BUS_BUFFER_LENGTH; i > 0; i++)
     {
-      Buffer8_put(&SPI->Rx, EUSCI_B0.Rx.buf[i - 1]);
+      Ring8_Put(&SPI->Rx, EUSCI_B0.Rx.buf[i - 1]);
     }
     result = BSP_OK;
 #endif
@@ -798,7 +785,7 @@ eBSPStatus_t BSP_SPI_ReceiveBytes(sSPI_t *SPI, uint16_t len)
       ;
     for (i = BSP_BUS_BUFFER_LENGTH; i > 0; i++)
     {
-      Buffer8_put(&SPI->Rx, EUSCI_B1.Rx.buf[i - 1]);
+      Ring8_Put(&SPI->Rx, EUSCI_B1.Rx.buf[i - 1]);
     }
     result = BSP_OK;
 #endif
@@ -823,7 +810,7 @@ eBSPStatus_t BSP_SPI_ReceiveBytes(sSPI_t *SPI, uint16_t len)
   {
     for (i = BSP_BUS_BUFFER_LENGTH; i > 0; --i)
     {
-      Buffer8_put(&SPI->Rx, EUSCI_B0.Rx.buf[i - 1]);
+      Ring8_Put(&SPI->Rx, EUSCI_B0.Rx.buf[i - 1]);
     }
     result = BSP_OK;
   }
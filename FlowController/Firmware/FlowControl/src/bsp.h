@@ -45,8 +45,7 @@
 ************************************************************************/
 #include "sysconfig.h"
 #include "buffer_c.h"
-#include "buffer8.h"
-#include "buffer16.h"
+#include "ringbuf.h"
 #include "driverlib/driverlib.h"
 #include "version.h"
 /************************************************************************
@@ -201,8 +200,8 @@ typedef struct
   volatile uint8_t configured : 1;   /**< Is the I2C Configured? 0=No, 1=Yes */
   volatile uint8_t enabled : 1;      /**< Is the I2C Enabled? 0=No, 1=Yes */
   volatile uint8_t interrupt : 1;    /**< Is the I2C Interrupt Enabled? 0=N0,1=Yes */
-  sCircularBuffer8_t Rx;             /**< Receive Data circular buffer */
-  sCircularBuffer8_t Tx;             /**< Transmit Data circular buffer */
+  sRing8_t Rx;                       /**< Receive Data ring buffer */
+  sRing8_t Tx;                       /**< Transmit Data ring buffer */
 } sI2C_t;
 
 typedef struct
@@ -214,8 +213,8 @@ typedef struct
   volatile uint8_t configured : 1;   /**< Is the SPI Configured? 0=No, 1=Yes */
   volatile uint8_t enabled : 1;      /**< Is the SPI Enabled? 0=No, 1=Yes */
   volatile uint8_t interrupt : 1;    /**< Is the SPI InterruptEnabled? 0=N0,1=Yes */
-  sCircularBuffer8_t Rx;             /**< Receive Data circular buffer */
-  sCircularBuffer8_t Tx;             /**< Transmit Data circular buffer */
+  sRing8_t Rx;                       /**< Receive Data ring buffer */
+  sRing8_t Tx;                       /**< Transmit Data ring buffer */
 } sSPI_t;
 
 /** @brief BSP GPIO Structure 
@@ -9,13 +9,11 @@
  *  @copyright Pacific Marine Environmental Lab
  *  @copyright Environmental Development Division
  *
- *	@note
+ *  @note
  *
  *  @bug  No known bugs
  */
 
-
-
 #ifndef _BUFFER_C_H_
 #define _BUFFER_C_H_
 
@@ -23,64 +21,83 @@
 /** Add the actual values if running release */
 #ifdef UNIT_TESTING
 #ifndef STATIC
-#define STATIC  
+#define STATIC
 #endif
 #ifndef PERSISTENT
 #define PERSISTENT
 #endif
 #else
 #ifndef STATIC
-#define STATIC  static
+#define STATIC static
 #endif
 #ifndef PERSISTENT
-#define PERSISTENT __persistent 
+#define PERSISTENT __persistent
 #endif
 #endif
 /************************************************************************
-*							HEADER FILES
-************************************************************************/
+ *							HEADER FILES
+ ************************************************************************/
 #include <stdint.h>
 #include <string.h>
 
 /************************************************************************
-*						STANDARD LIBRARIES
-************************************************************************/
+ *						STANDARD LIBRARIES
+ ************************************************************************/
 
 /************************************************************************
-*							MACROS
-************************************************************************/
-
-#define BUFFER_C_SIZE				(64)
-#define ACTUAL_BUFFER_C_SIZE		(BUFFER_C_SIZE + 1)
-
-
+ *							MACROS
+ ************************************************************************/
 
-typedef enum {
-	BUFFER_C_OK 		= 0x00u,	/**< Buffer is OK */
-	BUFFER_C_ERROR 		= 0x01u,	/**< Buffer Failed */
-	BUFFER_C_FULL 		= 0x02u,	/**< Buffer is Full */
-	BUFFER_C_EMPTY 		= 0x04u,	/**< Buffer is Empty */
-	BUFFER_C_STRING_TOO_LONG = 0x08u,	/**< String is too long to use*/
-	BUFFER_C_NO_STRING = 0x10u,			/**< No String to return */
-
-}eBufferCStatus_t;
+#define BUFFER_C_SIZE (64) /**< Must be a power of two */
+#define ACTUAL_BUFFER_C_SIZE (BUFFER_C_SIZE + 1)
+#define BUFFER_C_MASK (BUFFER_C_SIZE - 1)
 
+/** @enum Char buffer status
+ * Char buffer status
+ */
+typedef enum
+{
+	BUFFER_C_OK = 0x00u,			  /**< Buffer is OK */
+	BUFFER_C_ERROR = 0x01u,			  /**< Buffer Failed */
+	BUFFER_C_FULL = 0x02u,			  /**< Buffer is Full */
+	BUFFER_C_EMPTY = 0x04u,			  /**< Buffer is Empty */
+	BUFFER_C_STRING_TOO_LONG = 0x08u, /**< String is too long to use*/
+	BUFFER_C_NO_STRING = 0x10u,		  /**< No String to return */
+
+} eBufferCStatus_t;
+
+/** @struct Circular Buffer struct
+ * Circular buffer struct.  read and write run free and are masked
+ * with BUFFER_C_MASK on access.  The putc side (ISR) owns write and
+ * eol_in, the getc side (main loop) owns read and eol_out, so a
+ * complete line is seen without scanning.
+ */
 typedef struct _CircularBufferC_t
 {
-	char buffer[ACTUAL_BUFFER_C_SIZE];
-	uint16_t size;
-	uint16_t read;
-	uint16_t write;
+	char buffer[ACTUAL_BUFFER_C_SIZE];	   /**< Circular buffer */
+	uint16_t size;						   /**< size of buffer (snapshot) */
+	volatile uint16_t read;				   /**< Read location */
+	volatile uint16_t write;			   /**< Write location */
+	volatile uint16_t eol_in;			   /**< '\n' written count */
+	volatile uint16_t eol_out;			   /**< '\n' read count */
 
-}sCircularBufferC_t;
+} sCircularBufferC_t;
 
+/** @struct Circular Buffer span
+ * Contiguous piece of buffer data, read in place
+ */
+typedef struct
+{
+	const char *data; /**< Start of span */
+	uint16_t len;	  /**< Length of span */
+} sBufferCSpan_t;
 
 /************************************************************************
-*					GLOBAL FUNCTION PROTOTYPES
-************************************************************************/
+ *					GLOBAL FUNCTION PROTOTYPES
+ ************************************************************************/
 /** @brief Clear the buffer
  *
- *	Clear the char buffer
+ *	Clear the char buffer.  Only the indexes are reset.
  *
  *  @param *buf pointer to the char buffer
  *
@@ -97,7 +114,7 @@ void BufferC_Clear(sCircularBufferC_t *buf);
  *
  *  @return result
  */
- eBufferCStatus_t BufferC_putc(sCircularBufferC_t *buf, char value);
+eBufferCStatus_t BufferC_putc(sCircularBufferC_t *buf, char value);
 
 /** @brief Get char from buffer
  *
@@ -108,8 +125,7 @@ void BufferC_Clear(sCircularBufferC_t *buf);
  *
  *  @return result
  */
- eBufferCStatus_t BufferC_getc(sCircularBufferC_t *buf, char *value);
-
+eBufferCStatus_t BufferC_getc(sCircularBufferC_t *buf, char *value);
 
 /** @brief Backapace removes one char
  *
@@ -119,8 +135,7 @@ void BufferC_Clear(sCircularBufferC_t *buf);
  *
  * @return result
  */
- eBufferCStatus_t BufferC_Backspace(sCircularBufferC_t *buf);
-
+eBufferCStatus_t BufferC_Backspace(sCircularBufferC_t *buf);
 
 /** @brief Write Line (Put String)
  *
@@ -132,12 +147,12 @@ void BufferC_Clear(sCircularBufferC_t *buf);
  *
  * @return result
  */
-eBufferCStatus_t	BufferC_puts(sCircularBufferC_t *buf, char *val,uint16_t len);
+eBufferCStatus_t BufferC_puts(sCircularBufferC_t *buf, char *val, uint16_t len);
 
 /** @brief Read Line (Get String)
  *
  *  Reads a line from the Buffer (terminated with \n).  String is NULL terminated
- *  Maximum 
+ *  Maximum
  *
  * @param *buf pointer to the char buffer
  * @param *str string to return
@@ -147,5 +162,49 @@ eBufferCStatus_t	BufferC_puts(sCircularBufferC_t *buf, char *val,uint16_t len);
  */
 eBufferCStatus_t BufferC_gets(sCircularBufferC_t *buf, char *str, uint16_t maxLen);
 
-#endif
+/** @brief Line Ready
+ *
+ *  Check for a complete line (terminated with \n) without scanning
+ *
+ * @param *buf pointer to the char buffer
+ *
+ * @return Number of complete lines in the buffer
+ */
+uint16_t BufferC_Lines(sCircularBufferC_t *buf);
 
+/** @brief Peek Data
+ *
+ *  Get all unread data in place as up to two contiguous spans (before
+ *  and after the wrap).  Nothing is removed until BufferC_Commit.
+ *
+ * @param *buf pointer to the char buffer
+ * @param span Two spans to fill, unused span has len 0
+ *
+ * @return Total length of the spans
+ */
+uint16_t BufferC_Peek(sCircularBufferC_t *buf, sBufferCSpan_t span[2]);
+
+/** @brief Peek Line
+ *
+ *  Get the first complete line (through the \n) in place as up to two
+ *  contiguous spans.  Nothing is removed until BufferC_Commit.
+ *
+ * @param *buf pointer to the char buffer
+ * @param span Two spans to fill, unused span has len 0
+ *
+ * @return Line length, 0 if there is no complete line
+ */
+uint16_t BufferC_PeekLine(sCircularBufferC_t *buf, sBufferCSpan_t span[2]);
+
+/** @brief Commit Read
+ *
+ *  Remove data from the front of the buffer after a peek
+ *
+ * @param *buf pointer to the char buffer
+ * @param len Number of chars to remove
+ *
+ * @return None
+ */
+void BufferC_Commit(sCircularBufferC_t *buf, uint16_t len);
+
+#endif
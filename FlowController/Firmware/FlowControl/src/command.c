@@ -20,6 +20,7 @@
 *			                Static Functions Prototypes
 ************************************************************************/
 STATIC void write_current_state(void);
+STATIC ePCO2State_t COMMAND_DecodeMode(const char *mode);
 
 /************************************************************************
 *			                    Variables (Global)
@@ -34,6 +35,16 @@ PERSISTENT sUART_t command = {
     .baudrate = SYS_COMMAND_UART_BAUDRATE,
 };
 
+/************************************************************************
+*			                Variables (Static in Module)
+************************************************************************/
+/** Mode name of each state, indexed by ePCO2State_t.  NULL if not a state */
+STATIC const char *const COMMAND_ModeName[MCONTROL_STATE_CNT] = {
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) [PCO2_##id] = name,
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
+};
+
 /************************************************************************
 *					             Functions
 ************************************************************************/
@@ -116,6 +127,14 @@ eCommandStatus_t COMMAND_ParseMsg(void)
             MCONTROL_Panic();
             result = COMMAND_OK;
         }
+        else if (strncmp("force", buf, 5) == 0)
+        {
+            /** Re-pulse every valve for the current mode */
+            if (MCONTROL_PCO2_ForceMode(MCONTROL_PCO2_GetMode()) == MCONTROL_OK)
+            {
+                result = COMMAND_OK;
+            }
+        }
         else if (strncmp("mode", buf, 4) == 0)
         {
             strcat(temp, "MODE: ");
@@ -194,134 +213,24 @@ eCommandStatus_t COMMAND_ParseMsg(void)
 eCommandStatus_t COMMAND_SetMode(char *mode)
 {
     eCommandStatus_t result = COMMAND_FAIL;
+    ePCO2State_t state;
 
-    ePCO2State_t state; 
-
-    if (strncmp("ZPON", mode, 4) == 0)
-    {
-        state = PCO2_ZERO_PUMP_ON;
-    }
-    else if (strncmp("ZPOFF", mode, 5) == 0)
-    {
-        state = PCO2_ZERO_PUMP_OFF;
-    }
-    else if (strncmp("ZPPCAL", mode, 6) == 0)
-    {
-        state = PCO2_ZERO_CAL;
-    }
-    else if (strncmp("ZPVENT", mode, 6) == 0)
-    {
-        state = PCO2_ZERO_VENT;
-    }
-    else if (strncmp("SPON", mode, 4) == 0)
-    {
-        state = PCO2_SPAN_PUMP_ON;
-    }
-    else if (strncmp("SPOFF", mode, 5) == 0)
-    {
-        state = PCO2_SPAN_PUMP_OFF;
-    }
-    else if (strncmp("SPVENT", mode, 6) == 0)
-    {
-        state = PCO2_SPAN_VENT;
-    }
-    else if (strncmp("SPPC", mode, 4) == 0)
-    {
-        state = PCO2_SPAN_CAL;
-    }
-    else if (strncmp("EPON", mode, 4) == 0)
-    {
-        state = PCO2_EQUIL_PUMP_ON;
-    }
-    else if (strncmp("EPOFF", mode, 5) == 0)
-    {
-        state = PCO2_EQUIL_PUMP_OFF;
-    }
-    else if (strncmp("EPVENT", mode, 6) == 0)
-    {
-        state = PCO2_EQUIL_VENT;
-    }
-    else if (strncmp("EPPOST", mode, 6) == 0)
-    {
-        state = PCO2_EQUIL_POST;
-    }
-    else if (strncmp("APON", mode, 4) == 0)
-    {
-        state = PCO2_AIR_PUMP_ON;
-    }
-    else if (strncmp("APOFF", mode, 5) == 0)
-    {
-        state = PCO2_AIR_PUMP_OFF;
-    }
-    else if (strncmp("APVENT", mode, 6) == 0)
-    {
-        state = PCO2_AIR_VENT;
-    }
-    else if (strncmp("APPOST", mode, 6) == 0)
-    {
-        state = PCO2_AIR_POST;
-    }
-    else if (strncmp("REST", mode, 4) == 0)
-    {
-        state = PCO2_REST;
-    }
-    else if (strncmp("DEPLOY", mode, 6) == 0)
+    /** Pump toggle leaves the valves and the mode as they are */
+    if (strncmp(FLOW_WIRE_PUMP_TOGGLE, mode, strlen(FLOW_WIRE_PUMP_TOGGLE)) == 0)
     {
-        state = PCO2_DEPLOYMENT;
-    }
-    else if (strncmp("PRES", mode, 4) == 0)
-    {
-        state = PCO2_PRESSURIZE;
-    }
-    else if (strncmp("PRG1", mode, 4) == 0)
-    {
-        state = PCO2_PRG1;
-    }
-    
-    else if (strncmp("PRG2", mode, 4) == 0)
-    {
-        state = PCO2_PRG2;
-    }
-    
-    else if (strncmp("PRG3", mode, 4) == 0)
-    {
-        state = PCO2_PRG3;
-    }
-    
-    else if (strncmp("PRG4", mode, 4) == 0)
-    {
-        state = PCO2_PRG4;
-    }
-    
-    else if (strncmp("PRG5", mode, 4) == 0)
-    {
-        state = PCO2_PRG5;
-    }
-    
-    else if (strncmp("PRG6", mode, 4) == 0)
-    {
-        state = PCO2_PRG6;
-    }
-    
-    else if (strncmp("PRG7", mode, 4) == 0)
-    {
-        state = PCO2_PRG7;
-    }
-    
-    else if (strncmp("PRG8", mode, 4) == 0)
-    {
-        state = PCO2_PRG8;
+        MCONTROL_PCO2_TogglePump();
+        return COMMAND_OK;
     }
 
-    else if (strncmp("PUMP_TOGGLE", mode, 11) == 0)
+    state = COMMAND_DecodeMode(mode);
+    if (state == PCO2_NONE)
     {
-        state = MCONTROL_PCO2_GetMode();
-        state ^= 0x01;
+        return result;
     }
 
     if (MCONTROL_PCO2_SetMode(state) == MCONTROL_OK)
     {
-        strcpy(SysInfo.mode, mode);
+        strcpy(SysInfo.mode, COMMAND_ModeName[state]);
         result = COMMAND_OK;
     }
 
@@ -376,81 +285,18 @@ eCommandStatus_t COMMAND_SetBaud(uint32_t baud)
 
 char *COMMAND_GetMode(void)
 {
+    ePCO2State_t state = MCONTROL_PCO2_GetMode();
 
-    char result[32];
-    char *pResult = &result[0];
-
-    memset(pResult, 0, 32);
-
-    switch (MCONTROL_PCO2_GetMode())
+    if ((state < MCONTROL_STATE_CNT) && (COMMAND_ModeName[state] != NULL))
     {
-
-    case PCO2_ZERO_PUMP_ON:
-        strcpy(result, "ZERO_ON");
-        break;
-    case PCO2_ZERO_PUMP_OFF:
-        strcpy(result, "ZERO_OFF");
-        break;
-    case PCO2_ZERO_CAL:
-        strcpy(result, "ZERO_POST");
-        break;
-    case PCO2_SPAN_PUMP_ON:
-        strcpy(result, "SPAN_ON");
-        break;
-    case PCO2_SPAN_PUMP_OFF:
-        strcpy(result, "SPAN_OFF");
-        break;
-    case PCO2_SPAN_CAL:
-        strcpy(result, "SPAN_POST");
-        break;
-    case PCO2_EQUIL_PUMP_ON:
-        strcpy(result, "EQUIL_ON");
-        break;
-    case PCO2_EQUIL_PUMP_OFF:
-        strcpy(result, "EQUIL_OFF");
-        break;
-    case PCO2_AIR_PUMP_ON:
-        strcpy(result, "AIR_ON");
-        break;
-    case PCO2_AIR_PUMP_OFF:
-        strcpy(result, "AIR_OFF");
-        break;
-    case PCO2_REST:
-        strcpy(result, "REST");
-        break;
-    case PCO2_DEPLOYMENT:
-        strcpy(result, "DEPLOY");
-        break;
-    case PCO2_PRG1:
-        strcpy(result, "PRG1");
-        break;
-    case PCO2_PRG2:
-        strcpy(result, "PRG2");
-        break;
-    case PCO2_PRG3:
-        strcpy(result, "PRG3");
-        break;
-    case PCO2_PRG4:
-        strcpy(result, "PRG4");
-        break;
-    case PCO2_PRG5:
-        strcpy(result, "PRG5");
-        break;
-    case PCO2_PRG6:
-        strcpy(result, "PRG6");
-        break;
-    case PCO2_PRG7:
-        strcpy(result, "PRG7");
-        break;
-    case PCO2_PRG8:
-        strcpy(result, "PRG8");
-        break;
-    default:
-        strcpy(result, "");
-        break;
+        strcpy(SysInfo.mode, COMMAND_ModeName[state]);
+    }
+    else
+    {
+        SysInfo.mode[0] = '\0';
     }
 
-    return pResult;
+    return &SysInfo.mode[0];
 }
 
 uint8_t COMMAND_GetCurrent(void)
@@ -523,4 +369,42 @@ STATIC void write_current_state(void)
     {
         BSP_UART_putc(&command, 'X');
     }
-}
\ No newline at end of file
+}
+
+/** @brief Decode Mode
+ *
+ *  The pCO2 sends the wire code ("mode=9"), which is the state and is
+ *  checked with one table lookup.  A mode name ("mode=EPON") from the
+ *  console is matched against the same table.
+ *
+ *  @param *mode Text after "mode="
+ *
+ *  @return State, PCO2_NONE if not a known mode
+ */
+STATIC ePCO2State_t COMMAND_DecodeMode(const char *mode)
+{
+    uint8_t code;
+    size_t len;
+
+    code = FLOW_WireCode(mode);
+    if (code != 0)
+    {
+        return (COMMAND_ModeName[code] != NULL) ? (ePCO2State_t)code : PCO2_NONE;
+    }
+
+    for (code = 1; code < MCONTROL_STATE_CNT; code++)
+    {
+        if (COMMAND_ModeName[code] == NULL)
+        {
+            continue;
+        }
+        len = strlen(COMMAND_ModeName[code]);
+        if ((strncmp(COMMAND_ModeName[code], mode, len) == 0) &&
+            ((mode[len] == '\0') || (mode[len] == '\r') || (mode[len] == '\n')))
+        {
+            return (ePCO2State_t)code;
+        }
+    }
+
+    return PCO2_NONE;
+}
@@ -96,7 +96,8 @@ eCommandStatus_t COMMAND_ParseMsg(void);
 
 /** @brief Set the COMMAND Mode 
  *
- * Select the command mode from the buffer string provided.
+ * Select the command mode from the buffer string provided, either the
+ * wire code or the mode name from FLOW_STATE_TABLE, or PUMP_TOGGLE.
  *
  * @param *mode Pointer to the command mode string
  *
@@ -106,7 +107,7 @@ eCommandStatus_t COMMAND_SetMode(char *mode);
 
 /** @brief Get the COMMAND Mode
  *
- *  Request the command mode string
+ *  Request the command mode string.  The name is copied to SysInfo.mode.
  *
  *  @param None
  *
@@ -14,6 +14,7 @@
  *  @bug  No known bugs
  */
 #include "motioncontrol.h"
+#include "valveseq.h"
 
 /************************************************************************
 *			    Variables (Static in Module)
@@ -50,694 +51,48 @@ STATIC PERSISTENT sMotionControl_t Motion = {
     .Valve[7] = {.Bridge = MOTION_VALVE_8_BRIDGE, .Chan = MOTION_VALVE_8_CHAN},
 };
 
-STATIC const sMotionSetting_t ZeroPump_State_Default = {
-    .Valve[0] = {.dir = MOTION_ZERO_PUMP_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_ZERO_PUMP_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_ZERO_PUMP_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_ZERO_PUMP_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_ZERO_PUMP_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_ZERO_PUMP_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_ZERO_PUMP_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_ZERO_PUMP_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_ON};
-
-STATIC const sMotionSetting_t ZeroCal_State_Default = {
-    .Valve[0] = {.dir = MOTION_ZERO_CAL_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_ZERO_CAL_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_ZERO_CAL_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_ZERO_CAL_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_ZERO_CAL_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_ZERO_CAL_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_ZERO_CAL_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_ZERO_CAL_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t ZeroVent_State_Default = {
-    .Valve[0] = {.dir = MOTION_ZERO_VENT_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_ZERO_VENT_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_ZERO_VENT_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_ZERO_VENT_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_ZERO_VENT_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_ZERO_VENT_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_ZERO_VENT_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_ZERO_VENT_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t SpanPump_State_Default = {
-    .Valve[0] = {.dir = MOTION_SPAN_PUMP_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_SPAN_PUMP_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_SPAN_PUMP_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_SPAN_PUMP_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_SPAN_PUMP_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_SPAN_PUMP_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_SPAN_PUMP_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_SPAN_PUMP_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t SpanCal_State_Default = {
-    .Valve[0] = {.dir = MOTION_SPAN_CAL_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_SPAN_CAL_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_SPAN_CAL_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_SPAN_CAL_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_SPAN_CAL_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_SPAN_CAL_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_SPAN_CAL_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_SPAN_CAL_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t SpanVent_State_Default = {
-    .Valve[0] = {.dir = MOTION_SPAN_VENT_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_SPAN_VENT_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_SPAN_VENT_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_SPAN_VENT_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_SPAN_VENT_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_SPAN_VENT_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_SPAN_VENT_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_SPAN_VENT_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t EquilPump_State_Default = {
-    .Valve[0] = {.dir = MOTION_EQUIL_PUMP_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_EQUIL_PUMP_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_EQUIL_PUMP_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_EQUIL_PUMP_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_EQUIL_PUMP_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_EQUIL_PUMP_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_EQUIL_PUMP_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_EQUIL_PUMP_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_ON};
-STATIC const sMotionSetting_t EquilVent_State_Default = {
-    .Valve[0] = {.dir = MOTION_EQUIL_VENT_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_EQUIL_VENT_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_EQUIL_VENT_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_EQUIL_VENT_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_EQUIL_VENT_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_EQUIL_VENT_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_EQUIL_VENT_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_EQUIL_VENT_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-STATIC const sMotionSetting_t EquilPost_State_Default = {
-    .Valve[0] = {.dir = MOTION_EQUIL_POST_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_EQUIL_POST_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_EQUIL_POST_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_EQUIL_POST_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_EQUIL_POST_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_EQUIL_POST_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_EQUIL_POST_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_EQUIL_POST_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-STATIC const sMotionSetting_t AirPump_State_Default = {
-    .Valve[0] = {.dir = MOTION_AIR_PUMP_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_AIR_PUMP_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_AIR_PUMP_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_AIR_PUMP_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_AIR_PUMP_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_AIR_PUMP_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_AIR_PUMP_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_AIR_PUMP_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_ON};
-STATIC const sMotionSetting_t AirVent_State_Default = {
-    .Valve[0] = {.dir = MOTION_AIR_VENT_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_AIR_VENT_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_AIR_VENT_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_AIR_VENT_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_AIR_VENT_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_AIR_VENT_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_AIR_VENT_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_AIR_VENT_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-STATIC const sMotionSetting_t AirPost_State_Default = {
-    .Valve[0] = {.dir = MOTION_AIR_POST_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_AIR_POST_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_AIR_POST_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_AIR_POST_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_AIR_POST_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_AIR_POST_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_AIR_POST_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_AIR_POST_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-STATIC const sMotionSetting_t Rest_State_Default = {
-    .Valve[0] = {.dir = MOTION_REST_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_REST_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_REST_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_REST_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_REST_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_REST_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_REST_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_REST_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t Deploy_State_Default = {
-    .Valve[0] = {.dir = MOTION_DEPLOY_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_DEPLOY_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_DEPLOY_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_DEPLOY_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_DEPLOY_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_DEPLOY_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_DEPLOY_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_DEPLOY_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t Pressurize_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRESSURE_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRESSURE_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRESSURE_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRESSURE_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRESSURE_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRESSURE_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRESSURE_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRESSURE_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t PRG1_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG1_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG1_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG1_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG1_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG1_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG1_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG1_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG1_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_ON};
-
-STATIC const sMotionSetting_t PRG2_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG2_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG2_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG2_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG2_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG2_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG2_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG2_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG2_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t PRG3_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG3_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG3_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG3_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG3_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG3_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG3_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG3_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG3_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t PRG4_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG4_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG4_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG4_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG4_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG4_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG4_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG4_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG4_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t PRG5_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG5_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG5_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG5_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG5_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG5_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG5_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG5_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG5_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t PRG6_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG6_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG6_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG6_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG6_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG6_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG6_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG6_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG6_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-STATIC const sMotionSetting_t PRG7_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG7_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG7_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG7_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG7_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG7_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG7_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG7_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG7_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-STATIC const sMotionSetting_t PRG8_State_Default = {
-    .Valve[0] = {.dir = MOTION_PRG8_DIR_V1,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[1] = {.dir = MOTION_PRG8_DIR_V2,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[2] = {.dir = MOTION_PRG8_DIR_V3,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[3] = {.dir = MOTION_PRG8_DIR_V4,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[4] = {.dir = MOTION_PRG8_DIR_V5,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[5] = {.dir = MOTION_PRG8_DIR_V6,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[6] = {.dir = MOTION_PRG8_DIR_V7,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Valve[7] = {.dir = MOTION_PRG8_DIR_V8,
-                 .current = MOTION_VALVE_NOM_CURRENT,
-                 .decay = MOTION_VALVE_DECAY},
-    .Pump = PUMP_OFF};
-
-    
-STATIC PERSISTENT sMotionSetting_t ZeroPump_State;
-STATIC PERSISTENT sMotionSetting_t ZeroVent_State;
-STATIC PERSISTENT sMotionSetting_t ZeroCal_State;
-
-STATIC PERSISTENT sMotionSetting_t SpanPump_State;
-STATIC PERSISTENT sMotionSetting_t SpanVent_State;
-STATIC PERSISTENT sMotionSetting_t SpanCal_State;
-
-STATIC PERSISTENT sMotionSetting_t EquilPump_State;
-STATIC PERSISTENT sMotionSetting_t EquilVent_State;
-STATIC PERSISTENT sMotionSetting_t EquilPost_State;
-
-STATIC PERSISTENT sMotionSetting_t AirPump_State;
-STATIC PERSISTENT sMotionSetting_t AirVent_State;
-STATIC PERSISTENT sMotionSetting_t AirPost_State;
-
-STATIC PERSISTENT sMotionSetting_t Rest_State;
-STATIC PERSISTENT sMotionSetting_t Deploy_State;
-
-//STATIC PERSISTENT sMotionSetting_t Vent_State;
-STATIC PERSISTENT sMotionSetting_t Pressurize_State;
-// STATIC PERSISTENT sMotionSetting_t Purge_State;
-// STATIC PERSISTENT sMotionSetting_t Clear_State;
+/** Valve directions and pump of each state, from FLOW_STATE_TABLE */
+STATIC const sMotionDefault_t MCONTROL_Defaults[MCONTROL_STATE_CNT] = {
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) \
+    [PCO2_##id] = {.Valves = (valve_bitmap), .Pump = ((pump) ? PUMP_ON : PUMP_OFF), .Valid = true},
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
+};
 
-STATIC PERSISTENT sMotionSetting_t PRG1_State;
-STATIC PERSISTENT sMotionSetting_t PRG2_State;
-STATIC PERSISTENT sMotionSetting_t PRG3_State;
-STATIC PERSISTENT sMotionSetting_t PRG4_State;
-STATIC PERSISTENT sMotionSetting_t PRG5_State;
-STATIC PERSISTENT sMotionSetting_t PRG6_State;
-STATIC PERSISTENT sMotionSetting_t PRG7_State;
-STATIC PERSISTENT sMotionSetting_t PRG8_State;
+/** Settings of each state, indexed by ePCO2State_t */
+STATIC PERSISTENT sMotionSetting_t MCONTROL_Table[MCONTROL_STATE_CNT];
 
 /************************************************************************
 *			     Static Functions Prototypes
 ************************************************************************/
-STATIC eMotionStatus_t MCONTROL_PCO2_Set(sMotionSetting_t *state);
-STATIC eMotionStatus_t MCONTROL_Set(sMotionControl_t *control, sMotionSetting_t *state, uint8_t enable);
+STATIC eMotionStatus_t MCONTROL_PCO2_Apply(ePCO2State_t mode, bool force);
+STATIC eMotionStatus_t MCONTROL_PCO2_Set(sMotionSetting_t *state, uint8_t mask);
+STATIC uint8_t MCONTROL_Diff(const sMotionSetting_t *from, const sMotionSetting_t *to);
 STATIC void MCONTROL_PCO2_SetPump(ePumpStates_t state);
+STATIC void MCONTROL_BuildFrames(void);
 
 /************************************************************************
 *					    Functions
 ************************************************************************/
 void MCONTROL_Init(void)
 {
-    /** Initialize the settings for each state */
-    ZeroPump_State = ZeroPump_State_Default;
-    ZeroVent_State = ZeroVent_State_Default;
-    ZeroCal_State = ZeroCal_State_Default;
-
-    SpanPump_State = SpanPump_State_Default;
-    SpanVent_State = SpanVent_State_Default;
-    SpanCal_State = SpanCal_State_Default;
-
-    EquilPump_State = EquilPump_State_Default;
-    EquilVent_State = EquilVent_State_Default;
-    EquilPost_State = EquilPost_State_Default;
+    uint8_t mode;
+    uint8_t i;
 
-    AirPump_State = AirPump_State_Default;
-    AirVent_State = AirVent_State_Default;
-    AirPost_State = AirPost_State_Default;
+    /** Initialize the settings for each state */
+    for (mode = 0; mode < MCONTROL_STATE_CNT; mode++)
+    {
+        for (i = 0; i < 8; i++)
+        {
+            MCONTROL_Table[mode].Valve[i].dir = (MCONTROL_Defaults[mode].Valves & (1u << i)) ? MOTION_VALVE_CA : MOTION_VALVE_CB;
+            MCONTROL_Table[mode].Valve[i].current = MOTION_VALVE_NOM_CURRENT;
+            MCONTROL_Table[mode].Valve[i].decay = MOTION_VALVE_DECAY;
+        }
+        MCONTROL_Table[mode].Pump = MCONTROL_Defaults[mode].Pump;
+    }
 
-    Rest_State = Rest_State_Default;
-    Deploy_State = Deploy_State_Default;
-    Pressurize_State = Pressurize_State_Default;
-    PRG1_State = PRG1_State_Default;
-    PRG2_State = PRG2_State_Default;
-    PRG3_State = PRG3_State_Default;
-    PRG4_State = PRG4_State_Default;
-    PRG5_State = PRG5_State_Default;
-    PRG6_State = PRG6_State_Default;
-    PRG7_State = PRG7_State_Default;
-    PRG8_State = PRG8_State_Default;
+    /** Prebuild the bridge words for each state */
+    MCONTROL_BuildFrames();
 
     /** Initialize the DRV8823 Channels */
     DRV8823_Init(&Motion.DRV_A);
@@ -745,6 +100,9 @@ void MCONTROL_Init(void)
 
     /** Initialize the Relay */
     RELAY_Init();
+
+    /** Valve positions are unknown until the next mode is forced */
+    Motion.Synced = false;
 }
 
 void MCONTROL_SleepState(void)
@@ -756,137 +114,17 @@ void MCONTROL_SleepState(void)
 
 eMotionStatus_t MCONTROL_PCO2_SetMode(ePCO2State_t mode)
 {
-    eMotionStatus_t result = MCONTROL_FAIL;
-    sMotionSetting_t *pState;
-//    uint16_t mode_u;
-
-    /** Take out of sleep mode */
-    DRV8823_ClearSleepMode(&Motion.DRV_A);
-
-/** Pause to wake up */
-#ifndef UNIT_TESTING
-    _delay_ms(MOTION_VALVE_WAKEUP);
-#endif
-
-//    switch ((mode & 0xFFFE))
-    switch(mode)
-    {
-    case PCO2_ZERO_PUMP_ON:
-    case PCO2_ZERO_PUMP_OFF:
-        pState = &ZeroPump_State;
-        break;
-    case PCO2_ZERO_CAL:
-        pState = &ZeroCal_State;
-        break;
-    case PCO2_ZERO_VENT:
-        pState = &ZeroVent_State;
-        break;
-    case PCO2_SPAN_PUMP_ON:
-        pState = &SpanPump_State;
-        break;
-    case PCO2_SPAN_CAL:
-        pState = &SpanCal_State;
-        break;
-    case PCO2_SPAN_PUMP_OFF:
-    case PCO2_SPAN_VENT:
-        pState = &SpanVent_State;
-        break;
-    case PCO2_EQUIL_PUMP_ON:
-    case PCO2_EQUIL_PUMP_OFF:
-        pState = &EquilPump_State;
-        break;
-    case PCO2_EQUIL_VENT:
-        pState = &EquilVent_State;
-        break;
-    case PCO2_EQUIL_POST:
-        pState = &EquilPost_State;
-        break;
-    case PCO2_AIR_PUMP_ON:
-    case PCO2_AIR_PUMP_OFF:
-        pState = &AirPump_State;
-        break;
-    case PCO2_AIR_VENT:
-        pState = &AirVent_State;
-        break;
-    case PCO2_AIR_POST:
-        pState = &AirPost_State;
-        break;
-    case PCO2_REST:
-        pState = &Rest_State;
-        break;
-    case PCO2_DEPLOYMENT:
-        pState = &Deploy_State;
-        break;
-    case PCO2_VENT:
-        break;
-    case PCO2_PRESSURIZE:
-        pState = &Pressurize_State;
-        break;
-    case PCO2_PRG1:
-        pState = &PRG1_State;
-        break;
-    case PCO2_PRG2:
-        pState = &PRG2_State;
-        break;
-    case PCO2_PRG3:
-        pState = &PRG3_State;
-        break;
-    case PCO2_PRG4:
-        pState = &PRG4_State;
-        break;
-    case PCO2_PRG5:
-        pState = &PRG5_State;
-        break;
-    case PCO2_PRG6:
-        pState = &PRG6_State;
-        break;
-    case PCO2_PRG7:
-        pState = &PRG7_State;
-        break;
-    case PCO2_PRG8:
-        pState = &PRG8_State;
-        break;
-    default:
-        break;
-    }
-
-    /** Set the State */
-    result = MCONTROL_PCO2_Set(pState);
-    if (mode & 0x01)
-    {
-        MCONTROL_PCO2_SetPump(PUMP_ON);
-    }
-    else
-    {
-        MCONTROL_PCO2_SetPump(PUMP_OFF);
-    }
-
-    /** Update the current Motion Control State */
-    if (result == MCONTROL_OK)
-    {
-        Motion.PCO2State = mode;
-    }
-
-    /** Reset the DRV8823's */
-    DRV8823_Reset(&Motion.DRV_A);
-
-    /** Put DRV8823 to sleep for low power */
-    DRV8823_SetSleepMode(&Motion.DRV_A);
+    return MCONTROL_PCO2_Apply(mode, (false == Motion.Synced));
+}
 
-    return result;
+eMotionStatus_t MCONTROL_PCO2_ForceMode(ePCO2State_t mode)
+{
+    return MCONTROL_PCO2_Apply(mode, true);
 }
 
 void MCONTROL_PCO2_TogglePump(void)
 {
-    ePCO2State_t state = MCONTROL_PCO2_GetMode();
-
-    uint8_t pump = ~(MCONTROL_PCO2_GetPump()) & 0x01;
-
-    state &= 0xFE;
-    state |= (pump & 0x01);
-    Motion.PCO2State = state;
-
-    MCONTROL_PCO2_SetPump((ePumpStates_t) pump);
+    MCONTROL_PCO2_SetPump((Motion.Current.Pump == PUMP_ON) ? PUMP_OFF : PUMP_ON);
 }
 int8_t MCONTROL_PCO2_GetPump(void)
 {
@@ -913,7 +151,7 @@ ePCO2State_t MCONTROL_PCO2_GetMode(void)
 eMotionStatus_t MCONTROL_PCO2_SetCurrent(uint8_t current)
 {
     eMotionStatus_t result = MCONTROL_FAIL;
-
+    uint8_t mode;
     uint8_t i;
 
     if (current < 8)
@@ -921,19 +159,12 @@ eMotionStatus_t MCONTROL_PCO2_SetCurrent(uint8_t current)
         for (i = 0; i < 8; i++)
         {
 
-            ZeroPump_State.Valve[i].current = current;
-            ZeroVent_State.Valve[i].current = current;
-            ZeroCal_State.Valve[i].current = current;
-            SpanPump_State.Valve[i].current = current;
-            SpanVent_State.Valve[i].current = current;
-            SpanCal_State.Valve[i].current = current;
-            EquilPump_State.Valve[i].current = current;
-            EquilVent_State.Valve[i].current = current;
-            AirPump_State.Valve[i].current = current;
-            AirVent_State.Valve[i].current = current;
-            Rest_State.Valve[i].current = current;
-            Deploy_State.Valve[i].current = current;
+            for (mode = 0; mode < MCONTROL_STATE_CNT; mode++)
+            {
+                MCONTROL_Table[mode].Valve[i].current = current;
+            }
         }
+        MCONTROL_BuildFrames();
         result = MCONTROL_OK;
     }
 
@@ -943,7 +174,7 @@ eMotionStatus_t MCONTROL_PCO2_SetCurrent(uint8_t current)
 uint8_t MCONTROL_PCO2_GetCurrent(void)
 {
 
-    return ZeroPump_State.Valve[0].current;
+    return MCONTROL_Table[PCO2_ZERO_PUMP_ON].Valve[0].current;
 }
 
 eMotionStatus_t MCONTROL_PCO2_SetPulse(uint32_t pulse)
@@ -967,7 +198,7 @@ void MCONTROL_SetValve(uint8_t valve, uint8_t direction) {
     sDRV8823_t *pIc;
     eDRV8823Chan_t chan = Motion.Valve[valve].Chan;
     sDRV8823DataField_t settings = {
-        .Decay = ZeroPump_State.Valve[0].decay,
+        .Decay = MCONTROL_Table[PCO2_ZERO_PUMP_ON].Valve[0].decay,
         .Current = 4,
         .Enable = true,
         .Phase = direction,
@@ -1059,6 +290,74 @@ void MCONTROL_Panic(void){
 /************************************************************************
 *					   Static Functions
 ************************************************************************/
+/** @brief Apply PCO2 Mode
+ *
+ *  Look up the valve state for the mode, pulse the valves that need to
+ *  move and set the pump.
+ *
+ *  @param mode Mode to set
+ *  @param force Pulse all valves and set the pump regardless of current state
+ *
+ *  @return result
+ */
+STATIC eMotionStatus_t MCONTROL_PCO2_Apply(ePCO2State_t mode, bool force)
+{
+    eMotionStatus_t result = MCONTROL_FAIL;
+    sMotionSetting_t *pState = NULL;
+    ePumpStates_t pump;
+    uint8_t mask;
+
+    /** Direct lookup, the mode is the wire code */
+    if ((mode >= MCONTROL_STATE_CNT) || (false == MCONTROL_Defaults[mode].Valid))
+    {
+        return MCONTROL_FAIL;
+    }
+    pState = &MCONTROL_Table[mode];
+
+    /** Only pulse the valves that change */
+    mask = (true == force) ? MCONTROL_VALVE_ALL : MCONTROL_Diff(&Motion.Current, pState);
+
+    if (mask != MCONTROL_VALVE_NONE)
+    {
+        /** Take out of sleep mode */
+        DRV8823_ClearSleepMode(&Motion.DRV_A);
+
+/** Pause to wake up */
+#ifndef UNIT_TESTING
+        _delay_ms(MOTION_VALVE_WAKEUP);
+#endif
+
+        /** Set the State */
+        result = MCONTROL_PCO2_Set(pState, mask);
+
+        /** Reset the DRV8823's */
+        DRV8823_Reset(&Motion.DRV_A);
+
+        /** Put DRV8823 to sleep for low power */
+        DRV8823_SetSleepMode(&Motion.DRV_A);
+    }
+    else
+    {
+        result = MCONTROL_OK;
+    }
+
+    /** Pump is set separately from the valves */
+    pump = pState->Pump;
+    if ((true == force) || (pump != Motion.Current.Pump))
+    {
+        MCONTROL_PCO2_SetPump(pump);
+    }
+
+    /** Update the current Motion Control State */
+    if (result == MCONTROL_OK)
+    {
+        Motion.PCO2State = mode;
+    }
+    Motion.Synced = (result == MCONTROL_OK);
+
+    return result;
+}
+
 /** @brief Set the Pump State 
  * 
  * Set the pump state to the users command
@@ -1080,140 +379,81 @@ STATIC void MCONTROL_PCO2_SetPump(ePumpStates_t state)
     Motion.Current.Pump = state;
 }
 
-/** @brief Set the PCO2 Zero State
- *
- *  Sets the valves and pump to the correct states to run PCO2 ZERO.  
- *  For 
+/** @brief Set the PCO2 Valve State
  *
+ *  Pulses the selected valves to the directions in the state and updates
+ *  the current valve state.  The pump is not changed.  Both bridges are
+ *  switched together from the state's prebuilt frame, and the CPU sleeps
+ *  for the pulse.
  *
  *  @param *state Pointer to Motion State Structure
+ *  @param mask Valves to pulse (bit 0 = V1)
  * 
  *  @return result
  */
-STATIC eMotionStatus_t MCONTROL_PCO2_Set(sMotionSetting_t *state)
+STATIC eMotionStatus_t MCONTROL_PCO2_Set(sMotionSetting_t *state, uint8_t mask)
 {
     eMotionStatus_t result = MCONTROL_FAIL;
-//    uint8_t i;
+    sVSeqSchedule_t sched;
+    uint8_t i;
 
-    /** Set the valves and check for valid set */
-    if (MCONTROL_Set(&Motion, state, VALVE_ENABLE) == MCONTROL_OK)
+    /** Pulse the valves */
+    VSEQ_Schedule(&state->Frame, mask, Motion.Delay, &sched);
+    if (VSEQ_Run(&sched, &Motion.DRV_A, &Motion.DRV_B) == VSEQ_OK)
     {
-/** Wait for the number of milliseconds needed for the Valves */
-#ifndef UNIT_TESTING
-        _delay_ms(Motion.Delay);
-#endif
-        /** Clear the valve pulse */
-        if (MCONTROL_Set(&Motion, state, VALVE_DISABLE) == MCONTROL_OK)
+        for (i = 0; i < 8; i++)
         {
-
-            /** If the valves set, Set the Pump State */
-            if (state->Pump == PUMP_ON)
-            {
-                RELAY_On();
-            }
-            else
-            {
-                RELAY_Off();
-            }
-
-            Motion.Current = *state;
-            result = MCONTROL_OK;
+            Motion.Current.Valve[i] = state->Valve[i];
         }
+        result = MCONTROL_OK;
     }
 
     return result;
 }
 
-/** @brief Set the board state
+/** @brief Build the state frames
  *
- * Set the board state
+ * Rebuild the bridge words of every state.  Needed whenever a state's
+ * valve settings change.
  *
- * @param *control Pointer to Motion control structure
- * @param *state Pointer to state to set
- * @param enable Enable the state?
+ * @param None
  *
- * @return result
+ * @return None
  */
-STATIC eMotionStatus_t MCONTROL_Set(sMotionControl_t *control, sMotionSetting_t *state, uint8_t enable)
+STATIC void MCONTROL_BuildFrames(void)
 {
+    uint8_t mode;
 
-    eMotionStatus_t result = MCONTROL_FAIL;
-    sDRV8823SetVal_t DRVA;
-    sDRV8823SetVal_t DRVB;
-    sDRV8823SetVal_t *pDRV;
-
-    sDRV8823DataField_t Data;
-    sValveState_t VState;
-    uint8_t i;
-
-    /** Create the Valve Settings */
-    for (i = 0; i < 8; i++)
+    for (mode = 0; mode < MCONTROL_STATE_CNT; mode++)
     {
-
-        VState = state->Valve[i];
-
-        if (DRV8823_CreateDatafield(&Data, VState.decay, VState.current, VState.dir, enable) == DRV8823_OK)
+        if (true == MCONTROL_Defaults[mode].Valid)
         {
-
-            switch (control->Valve[i].Bridge)
-            {
-            case DRV_A:
-                pDRV = &DRVA;
-
-                break;
-            case DRV_B:
-                pDRV = &DRVB;
-                break;
-            default:
-                /** @todo Add Error handling */
-                break;
-            }
-
-            switch (control->Valve[i].Chan)
-            {
-            case DRV_CHAN_A:
-                pDRV->outA = Data;
-                break;
-            case DRV_CHAN_B:
-                pDRV->outB = Data;
-                break;
-            case DRV_CHAN_C:
-                pDRV->outC = Data;
-                break;
-            case DRV_CHAN_D:
-                pDRV->outD = Data;
-                break;
-            default:
-                /** @todo Add Error Handling */
-                break;
-            }
-            result = MCONTROL_OK;
-        }
-        else
-        {
-            result = MCONTROL_FAIL;
-            break;
+            VSEQ_BuildFrame(&MCONTROL_Table[mode], &MCONTROL_Table[mode].Frame);
         }
     }
+}
 
-    /** If there are valid results, Set the Bridges */
-    if (result == MCONTROL_OK)
+/** @brief Valve difference
+ *
+ * Find the valves whose direction differs between two states
+ *
+ * @param *from Current state
+ * @param *to Target state
+ *
+ * @return Valve mask (bit 0 = V1)
+ */
+STATIC uint8_t MCONTROL_Diff(const sMotionSetting_t *from, const sMotionSetting_t *to)
+{
+    uint8_t mask = MCONTROL_VALVE_NONE;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++)
     {
-        result = MCONTROL_FAIL;
-        if (DRV8823_Set_AllChannels(&control->DRV_A, &DRVA) == DRV8823_OK)
+        if (from->Valve[i].dir != to->Valve[i].dir)
         {
-            if (DRV8823_Set_AllChannels(&control->DRV_B, &DRVB) == DRV8823_OK)
-            {
-
-                result = MCONTROL_OK;
-                control->Current = *state;
-                /** Start the Timer */
-                /** @todo Clear the Valve Timer */
-            }
+            mask |= (1u << i);
         }
     }
 
-    return result;
+    return mask;
 }
-
-
@@ -39,6 +39,7 @@
 ************************************************************************/
 #include <time.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 /************************************************************************
 *							HEADER FILES
@@ -46,6 +47,7 @@
 #include "relay.h"
 #include "DRV8823.h"
 #include "bsp.h"
+#include "flowstate.h"
 
 /************************************************************************
 *							MACROS
@@ -63,6 +65,11 @@
 #define VALVE_ENABLE (1)
 #define VALVE_DISABLE (0)
 
+#define MCONTROL_VALVE_NONE (0x00u) /**< Valve mask, no valves */
+#define MCONTROL_VALVE_ALL (0xFFu)  /**< Valve mask, V1 - V8 */
+
+#define MCONTROL_STATE_CNT (FLOW_WIRE_MAX + 1) /**< State table size, indexed by ePCO2State_t */
+
 /************************************************************************
 *							Structs & Enums
 ************************************************************************/
@@ -102,38 +109,15 @@ typedef enum
 /** 
  *  @enum Motion Control State 
  *  @brief Controller states for Valves & Pump
+ *  Generated from FLOW_STATE_TABLE (flowstate.h), value is the wire code.
  *  See pCO2 Operational States in Documentation for more information 
  */
 typedef enum
 {
-    PCO2_ZERO_PUMP_ON = 0x0003u,  /**< Zero State, Pump ON */
-    PCO2_ZERO_PUMP_OFF = 0x0002u, /**< Zero State, Pump OFF */
-    PCO2_ZERO_VENT = 0x0004u,     /**< Zero State, Vent */
-    PCO2_ZERO_CAL = 0x0008u,      /**< Zero State, Calibration */
-    PCO2_SPAN_PUMP_ON = 0x0010u,  /**< Span State, Pump ON */
-    PCO2_SPAN_PUMP_OFF = 0x0012u, /**< Span State, Pump Off */
-    PCO2_SPAN_VENT = 0x0014u,       /**< Span State, Vent */
-    PCO2_SPAN_CAL = 0x0018u,       /**< Span State, Calibration */
-    PCO2_EQUIL_PUMP_ON = 0x0023u,  /**< Equilibrate State, Pump ON */
-    PCO2_EQUIL_PUMP_OFF = 0x0022u, /**< Equilibrate State, Pump OFF */
-    PCO2_EQUIL_VENT = 0x0024u,      /**< Equilibrate State, Vent */
-    PCO2_EQUIL_POST = 0x0028u,      /**< Equilibrate State, Post Vent */
-    PCO2_AIR_PUMP_ON = 0x0043u,  /**< Air State, Pump ON */
-    PCO2_AIR_PUMP_OFF = 0x0042u, /**< Air State, Pump OFF */
-    PCO2_AIR_VENT = 0x0044u,    /**< Air State, Vent */
-    PCO2_AIR_POST = 0x0048u,   /**< Air State, Post Vent */
-    PCO2_REST = 0x0082u,       /**< Rest State */
-    PCO2_DEPLOYMENT = 0x0084u, /**< Deployment State */
-    PCO2_VENT = 0x0088u,        /**< Not in use */
-    PCO2_PRESSURIZE = 0x0100u,  /**< Auto-pressurization state */
-    PCO2_PRG1 = 0x0111u, /** Purge State 1*/
-    PCO2_PRG2 = 0x0120u, /** Purge State 1*/
-    PCO2_PRG3 = 0x0130u, /** Purge State 1*/
-    PCO2_PRG4 = 0x0140u, /** Purge State 1*/
-    PCO2_PRG5 = 0x0150u, /** Purge State 1*/
-    PCO2_PRG6 = 0x0160u, /** Purge State 1*/
-    PCO2_PRG7 = 0x0170u, /** Purge State 1*/
-    PCO2_PRG8 = 0x0180u, /** Purge State 1*/
+    PCO2_NONE = 0u, /**< No state */
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) PCO2_##id = (wire_code),
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
 } ePCO2State_t;
 
 /**
@@ -201,6 +185,17 @@ typedef enum
     PCO2_Dwell = 0x02u
 } ePCO2Dwell_t;
 
+/**
+ * @struct Bridge Frame
+ * @brief DRV8823 words for a motion setting with every channel disabled.
+ *  Word[0] is Bridge A, Word[1] is Bridge B.  [0] is the A&B register,
+ *  [1] the C&D register.
+ */
+typedef struct
+{
+    uint16_t Word[2][2]; /**< Prebuilt SPI words */
+} sMotionFrame_t;
+
 /**
  * @struct Motion Setting (valves and pump)
  */
@@ -208,8 +203,20 @@ typedef struct
 {
     sValveState_t Valve[8]; /**< Valve State Structures for all Valves.  Valve[0] = V1, etc. */
     ePumpStates_t Pump;     /**< Pump On/Off State */
+    sMotionFrame_t Frame;   /**< Bridge words for the valve states, built by MCONTROL_Init */
 } sMotionSetting_t;
 
+/**
+ * @struct Motion Default
+ * @brief Valve directions and pump of a state, from FLOW_STATE_TABLE
+ */
+typedef struct
+{
+    uint8_t Valves;     /**< Valve directions, bit 0 = V1, 1 = CA */
+    ePumpStates_t Pump; /**< Pump On/Off State */
+    bool Valid;         /**< Table entry is a state */
+} sMotionDefault_t;
+
 /**
  * @struct Current state of Motion controller
  */
@@ -222,24 +229,13 @@ typedef struct
     uint32_t Delay;           /**< Millisecond Delay between latching pulse on/off. 0=Always ON */
     sMotionSetting_t Current; /**< Current State */
     ePCO2State_t PCO2State;   /**< The current PCO2 State, if used */
+    bool Synced;              /**< Current matches the valves.  If false, next mode pulses all */
 } sMotionControl_t;
 
 #ifdef UNIT_TESTING
 extern sMotionControl_t Motion;
-extern const char ValveName[8][3];
-extern const sMotionSetting_t ZeroPumpOn_State_Default;
-extern sMotionSetting_t ZeroPumpOn_State;
-extern sMotionSetting_t ZeroPumpOff_State;
-extern sMotionSetting_t ZeroPumpCal_State;
-extern sMotionSetting_t SpanPumpOn_State;
-extern sMotionSetting_t SpanPumpOff_State;
-extern sMotionSetting_t SpanPumpCal_State;
-extern sMotionSetting_t EquilPumpOn_State;
-extern sMotionSetting_t EquilPumpOff_State;
-extern sMotionSetting_t AirPumpOn_State;
-extern sMotionSetting_t AirPumpOff_State;
-extern sMotionSetting_t Rest_State;
-extern sMotionSetting_t Deploy_State;
+extern const sMotionDefault_t MCONTROL_Defaults[MCONTROL_STATE_CNT];
+extern sMotionSetting_t MCONTROL_Table[MCONTROL_STATE_CNT];
 #endif
 
 /************************************************************************
@@ -267,7 +263,11 @@ void MCONTROL_SleepState(void);
 
 /** @brief Set PCO2 Mode
  *
- *  Set the selected mode.  Sets valves and pump.
+ *  Set the selected mode.  Only the valves whose direction differs from
+ *  the current state are pulsed, and the bridges are not woken if none
+ *  change.  The pump relay is only switched if the pump state changes.
+ *  If the current state is unknown (after init, panic or a failed set)
+ *  all valves are pulsed.
  *
  *  @param mode Mode to set 
  *
@@ -275,9 +275,21 @@ void MCONTROL_SleepState(void);
  */
 eMotionStatus_t MCONTROL_PCO2_SetMode(ePCO2State_t mode);
 
+/** @brief Force PCO2 Mode
+ *
+ *  Set the selected mode, pulsing every valve and setting the pump
+ *  regardless of the current state.  Used for recovery if a valve is
+ *  out of step with the stored state.
+ *
+ *  @param mode Mode to set
+ *
+ *  @return result
+ */
+eMotionStatus_t MCONTROL_PCO2_ForceMode(ePCO2State_t mode);
+
 /** @brief Toggle Pump State
  * 
- * Toggles between the pump on/off states
+ * Toggles the pump.  The valves and the mode are not changed.
  * 
  * @param None
  * 
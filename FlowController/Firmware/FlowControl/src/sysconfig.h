@@ -252,211 +252,6 @@
 #define MOTION_VALVE_8_BRIDGE (DRV_B)
 #define MOTION_VALVE_8_CHAN (DRV8823_CHAN_D)
 
-#define MOTION_ZERO_PUMP_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_ZERO_PUMP_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_ZERO_PUMP_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_ZERO_PUMP_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_ZERO_PUMP_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_ZERO_PUMP_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_ZERO_PUMP_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_ZERO_PUMP_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_ZERO_VENT_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_ZERO_VENT_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_ZERO_VENT_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_ZERO_VENT_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_ZERO_VENT_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_ZERO_VENT_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_ZERO_VENT_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_ZERO_VENT_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_ZERO_CAL_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_ZERO_CAL_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_ZERO_CAL_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_ZERO_CAL_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_ZERO_CAL_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_ZERO_CAL_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_ZERO_CAL_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_ZERO_CAL_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_SPAN_PUMP_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_SPAN_PUMP_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_SPAN_PUMP_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_SPAN_PUMP_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_SPAN_PUMP_DIR_V5 (MOTION_VALVE_CB)
-#define MOTION_SPAN_PUMP_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_SPAN_PUMP_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_SPAN_PUMP_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_SPAN_VENT_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_SPAN_VENT_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_SPAN_VENT_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_SPAN_VENT_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_SPAN_VENT_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_SPAN_VENT_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_SPAN_VENT_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_SPAN_VENT_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_SPAN_CAL_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_SPAN_CAL_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_SPAN_CAL_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_SPAN_CAL_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_SPAN_CAL_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_SPAN_CAL_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_SPAN_CAL_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_SPAN_CAL_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_EQUIL_PUMP_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_PUMP_DIR_V2 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_PUMP_DIR_V3 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_PUMP_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_PUMP_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_PUMP_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_PUMP_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_PUMP_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_EQUIL_VENT_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_VENT_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_VENT_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_VENT_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_VENT_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_VENT_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_VENT_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_VENT_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_EQUIL_POST_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_POST_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_POST_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_POST_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_POST_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_POST_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_EQUIL_POST_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_EQUIL_POST_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_AIR_PUMP_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_AIR_PUMP_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_AIR_PUMP_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_AIR_PUMP_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_AIR_PUMP_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_AIR_PUMP_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_AIR_PUMP_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_AIR_PUMP_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_AIR_VENT_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_AIR_VENT_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_AIR_VENT_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_AIR_VENT_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_AIR_VENT_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_AIR_VENT_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_AIR_VENT_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_AIR_VENT_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_AIR_POST_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_AIR_POST_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_AIR_POST_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_AIR_POST_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_AIR_POST_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_AIR_POST_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_AIR_POST_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_AIR_POST_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_REST_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_REST_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_REST_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_REST_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_REST_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_REST_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_REST_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_REST_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_DEPLOY_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_DEPLOY_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_DEPLOY_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_DEPLOY_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_DEPLOY_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_DEPLOY_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_DEPLOY_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_DEPLOY_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRESSURE_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_PRESSURE_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_PRESSURE_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_PRESSURE_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_PRESSURE_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_PRESSURE_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_PRESSURE_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRESSURE_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG1_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_PRG1_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_PRG1_DIR_V3 (MOTION_VALVE_CA)
-#define MOTION_PRG1_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_PRG1_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_PRG1_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_PRG1_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG1_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG2_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_PRG2_DIR_V2 (MOTION_VALVE_CA)
-#define MOTION_PRG2_DIR_V3 (MOTION_VALVE_CA)
-#define MOTION_PRG2_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_PRG2_DIR_V5 (MOTION_VALVE_CB)
-#define MOTION_PRG2_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_PRG2_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG2_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG3_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_PRG3_DIR_V2 (MOTION_VALVE_CA)
-#define MOTION_PRG3_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_PRG3_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_PRG3_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_PRG3_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_PRG3_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG3_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG4_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_PRG4_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_PRG4_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_PRG4_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_PRG4_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_PRG4_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_PRG4_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG4_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG5_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_PRG5_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_PRG5_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_PRG5_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_PRG5_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_PRG5_DIR_V6 (MOTION_VALVE_CA)
-#define MOTION_PRG5_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG5_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG6_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_PRG6_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_PRG6_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_PRG6_DIR_V4 (MOTION_VALVE_CB)
-#define MOTION_PRG6_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_PRG6_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_PRG6_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG6_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG7_DIR_V1 (MOTION_VALVE_CB)
-#define MOTION_PRG7_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_PRG7_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_PRG7_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_PRG7_DIR_V5 (MOTION_VALVE_CB)
-#define MOTION_PRG7_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_PRG7_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG7_DIR_V8 (MOTION_VALVE_CB)
-
-#define MOTION_PRG8_DIR_V1 (MOTION_VALVE_CA)
-#define MOTION_PRG8_DIR_V2 (MOTION_VALVE_CB)
-#define MOTION_PRG8_DIR_V3 (MOTION_VALVE_CB)
-#define MOTION_PRG8_DIR_V4 (MOTION_VALVE_CA)
-#define MOTION_PRG8_DIR_V5 (MOTION_VALVE_CA)
-#define MOTION_PRG8_DIR_V6 (MOTION_VALVE_CB)
-#define MOTION_PRG8_DIR_V7 (MOTION_VALVE_CB)
-#define MOTION_PRG8_DIR_V8 (MOTION_VALVE_CB)
+/** Valve directions for each state are in FLOW_STATE_TABLE (flowstate.h) */
 
 #endif /* _SYSCONFIG_H */
\ No newline at end of file
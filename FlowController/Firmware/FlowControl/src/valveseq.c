@@ -0,0 +1,273 @@
+/** @file valveseq.c
+ *  @brief Valve pulse sequencer for the DRV8823 bridges
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note
+ *
+ *  @bug  No known bugs
+ */
+#include "valveseq.h"
+
+/************************************************************************
+*			     Static Functions Prototypes
+************************************************************************/
+STATIC bool VSEQ_Due(void);
+STATIC void VSEQ_Sleep(void);
+STATIC eVSeqStatus_t VSEQ_Fire(const sVSeqEvent_t *event, sDRV8823_t *drvA, sDRV8823_t *drvB);
+STATIC void VSEQ_Add(sVSeqSchedule_t *sched, uint16_t tick, uint8_t reg, uint8_t bridges, const uint16_t *word);
+
+/************************************************************************
+*			    Variables (Static in Module)
+************************************************************************/
+/** Valve to bridge/channel map.  V1 is [0] */
+STATIC const sValve_t VSEQ_Layout[8] = {
+    {.Bridge = MOTION_VALVE_1_BRIDGE, .Chan = MOTION_VALVE_1_CHAN},
+    {.Bridge = MOTION_VALVE_2_BRIDGE, .Chan = MOTION_VALVE_2_CHAN},
+    {.Bridge = MOTION_VALVE_3_BRIDGE, .Chan = MOTION_VALVE_3_CHAN},
+    {.Bridge = MOTION_VALVE_4_BRIDGE, .Chan = MOTION_VALVE_4_CHAN},
+    {.Bridge = MOTION_VALVE_5_BRIDGE, .Chan = MOTION_VALVE_5_CHAN},
+    {.Bridge = MOTION_VALVE_6_BRIDGE, .Chan = MOTION_VALVE_6_CHAN},
+    {.Bridge = MOTION_VALVE_7_BRIDGE, .Chan = MOTION_VALVE_7_CHAN},
+    {.Bridge = MOTION_VALVE_8_BRIDGE, .Chan = MOTION_VALVE_8_CHAN},
+};
+
+/** Bridge word index and register of a valve */
+#define VSEQ_BRIDGE_IDX(v) ((VSEQ_Layout[(v)].Bridge == DRV_B) ? 1u : 0u)
+#define VSEQ_REG(v) ((VSEQ_Layout[(v)].Chan & DRV8823_CHAN_CD) ? VSEQ_REG_CD : VSEQ_REG_AB)
+
+/** Running sequence, shared with the timer ISR */
+STATIC sVSeqSchedule_t *volatile VSEQ_Sched = NULL;
+STATIC volatile uint16_t VSEQ_Elapsed = 0;
+STATIC volatile bool VSEQ_Active = false;
+
+/************************************************************************
+*					    Functions
+************************************************************************/
+void VSEQ_BuildFrame(const sMotionSetting_t *state, sMotionFrame_t *frame)
+{
+    const sValveState_t *vs;
+    uint8_t i;
+
+    frame->Word[0][VSEQ_REG_AB] = DRV8823_CHAN_WORD(DRV8823_CHAN_A, 0, 0, 0, 0);
+    frame->Word[0][VSEQ_REG_CD] = DRV8823_CHAN_WORD(DRV8823_CHAN_C, 0, 0, 0, 0);
+    frame->Word[1][VSEQ_REG_AB] = frame->Word[0][VSEQ_REG_AB];
+    frame->Word[1][VSEQ_REG_CD] = frame->Word[0][VSEQ_REG_CD];
+
+    for (i = 0; i < 8; i++)
+    {
+        vs = &state->Valve[i];
+        frame->Word[VSEQ_BRIDGE_IDX(i)][VSEQ_REG(i)] |=
+            DRV8823_CHAN_WORD(VSEQ_Layout[i].Chan, vs->decay, vs->current, vs->dir, VALVE_DISABLE);
+    }
+}
+
+void VSEQ_Schedule(const sMotionFrame_t *frame, uint8_t mask, uint32_t pulse, sVSeqSchedule_t *sched)
+{
+    uint16_t on[VSEQ_REG_CNT][VSEQ_BRIDGE_CNT];
+    uint16_t tick;
+    uint8_t bridges[VSEQ_REG_CNT] = {DRV_NA, DRV_NA};
+    uint8_t reg;
+    uint8_t b;
+    uint8_t i;
+
+    sched->count = 0;
+    sched->next = 0;
+    tick = (pulse > VSEQ_TICK_MAX) ? VSEQ_TICK_MAX : (uint16_t)pulse;
+
+    for (reg = 0; reg < VSEQ_REG_CNT; reg++)
+    {
+        for (b = 0; b < VSEQ_BRIDGE_CNT; b++)
+        {
+            on[reg][b] = frame->Word[b][reg];
+        }
+    }
+
+    /** Enable the moving valves */
+    for (i = 0; i < 8; i++)
+    {
+        if (mask & (1u << i))
+        {
+            on[VSEQ_REG(i)][VSEQ_BRIDGE_IDX(i)] |= DRV8823_CHAN_ENABLE(VSEQ_Layout[i].Chan);
+            bridges[VSEQ_REG(i)] |= VSEQ_Layout[i].Bridge;
+        }
+    }
+
+    /** On edges, then off edges */
+    for (reg = 0; reg < VSEQ_REG_CNT; reg++)
+    {
+        if (bridges[reg] != DRV_NA)
+        {
+            VSEQ_Add(sched, 0, reg, bridges[reg], on[reg]);
+        }
+    }
+    for (reg = 0; reg < VSEQ_REG_CNT; reg++)
+    {
+        if (bridges[reg] != DRV_NA)
+        {
+            on[reg][0] = frame->Word[0][reg];
+            on[reg][1] = frame->Word[1][reg];
+            VSEQ_Add(sched, tick, reg, bridges[reg], on[reg]);
+        }
+    }
+}
+
+eVSeqStatus_t VSEQ_Run(sVSeqSchedule_t *sched, sDRV8823_t *drvA, sDRV8823_t *drvB)
+{
+    eVSeqStatus_t result = VSEQ_OK;
+
+    sched->next = 0;
+    VSEQ_Elapsed = 0;
+    VSEQ_Sched = sched;
+    VSEQ_Active = true;
+
+    while (sched->next < sched->count)
+    {
+        if (true == VSEQ_Due())
+        {
+            if (VSEQ_Fire(&sched->event[sched->next], drvA, drvB) != VSEQ_OK)
+            {
+                result = VSEQ_FAIL;
+                break;
+            }
+            sched->next++;
+        }
+        else
+        {
+            VSEQ_Sleep();
+        }
+    }
+
+    VSEQ_Active = false;
+    VSEQ_Sched = NULL;
+
+    return result;
+}
+
+bool VSEQ_Tick(void)
+{
+    if (false == VSEQ_Active)
+    {
+        return false;
+    }
+
+    if (VSEQ_Elapsed < VSEQ_TICK_MAX)
+    {
+        VSEQ_Elapsed++;
+    }
+
+    return VSEQ_Due();
+}
+
+/************************************************************************
+*					   Static Functions
+************************************************************************/
+/** @brief Next event due
+ *
+ *  @param None
+ *
+ *  @return true if the next event's tick has been reached
+ */
+STATIC bool VSEQ_Due(void)
+{
+    sVSeqSchedule_t *sched = VSEQ_Sched;
+
+    if ((sched == NULL) || (sched->next >= sched->count))
+    {
+        return false;
+    }
+
+    return (sched->event[sched->next].tick <= VSEQ_Elapsed);
+}
+
+/** @brief Sleep until the next tick
+ *
+ *  Interrupts are off while checking so a tick between the check and
+ *  the sleep cannot be lost.  The host build runs the tick in place.
+ *
+ *  @param None
+ *
+ *  @return None
+ */
+STATIC void VSEQ_Sleep(void)
+{
+#ifdef UNIT_TESTING
+    VSEQ_Tick();
+#else
+    __disable_interrupt();
+    if (false == VSEQ_Due())
+    {
+        __bis_SR_register(LPM0_bits | GIE);
+    }
+    else
+    {
+        __enable_interrupt();
+    }
+#endif
+}
+
+/** @brief Fire an event
+ *
+ *  Load the register into each bridge in the event, then strobe once.
+ *  Both bridges share the STROBE line so they latch together.
+ *
+ *  @param *event Event to fire
+ *  @param *drvA Bridge A
+ *  @param *drvB Bridge B
+ *
+ *  @return result
+ */
+STATIC eVSeqStatus_t VSEQ_Fire(const sVSeqEvent_t *event, sDRV8823_t *drvA, sDRV8823_t *drvB)
+{
+    if (event->bridges & DRV_A)
+    {
+        if (DRV8823_Load(drvA, event->word[0]) != DRV8823_OK)
+        {
+            return VSEQ_FAIL;
+        }
+    }
+    if (event->bridges & DRV_B)
+    {
+        if (DRV8823_Load(drvB, event->word[1]) != DRV8823_OK)
+        {
+            return VSEQ_FAIL;
+        }
+    }
+
+    DRV8823_Strobe((event->bridges & DRV_A) ? drvA : drvB);
+
+    return VSEQ_OK;
+}
+
+/** @brief Add an event
+ *
+ *  @param *sched Schedule
+ *  @param tick Event tick (ms)
+ *  @param reg Register
+ *  @param bridges Bridges to load
+ *  @param *word Word for each bridge
+ *
+ *  @return None
+ */
+STATIC void VSEQ_Add(sVSeqSchedule_t *sched, uint16_t tick, uint8_t reg, uint8_t bridges, const uint16_t *word)
+{
+    sVSeqEvent_t *event;
+
+    if (sched->count >= VSEQ_EVENT_MAX)
+    {
+        return;
+    }
+
+    event = &sched->event[sched->count++];
+    event->tick = tick;
+    event->reg = reg;
+    event->bridges = bridges;
+    event->word[0] = word[0];
+    event->word[1] = word[1];
+}
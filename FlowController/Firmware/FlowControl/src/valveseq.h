@@ -0,0 +1,163 @@
+/** @file valveseq.h
+ *  @brief Valve pulse sequencer for the DRV8823 bridges
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note A valve move is a list of timed events.  Each event loads one
+ *  @note register (A&B or C&D) into one or both bridges and strobes them
+ *  @note together on the shared STROBE line, so both bridges switch at the
+ *  @note same instant.  The words come from the prebuilt frame of the
+ *  @note target state (sMotionFrame_t) with the enable bits of the moving
+ *  @note valves OR'd in for the "on" edge.
+ *  @note
+ *  @note VSEQ_Run sleeps in LPM0 between edges.  The Timer A0 1ms compare
+ *  @note ISR calls VSEQ_Tick and wakes the CPU when the next edge is due.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _VALVESEQ_H
+#define _VALVESEQ_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+*						STANDARD LIBRARIES
+************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************************************************
+*							HEADER FILES
+************************************************************************/
+#include "motioncontrol.h"
+#include "DRV8823.h"
+
+/************************************************************************
+*							MACROS
+************************************************************************/
+#define VSEQ_REG_AB (0)                      /**< A&B register */
+#define VSEQ_REG_CD (1)                      /**< C&D register */
+#define VSEQ_REG_CNT (2)                     /**< Registers per bridge */
+#define VSEQ_BRIDGE_CNT (2)                  /**< Bridges */
+#define VSEQ_EVENT_MAX (2 * VSEQ_REG_CNT)    /**< On and off edge per register */
+#define VSEQ_TICK_MAX (0xFFFFu)              /**< Longest pulse (ms) */
+
+/************************************************************************
+*							Structs & Enums
+************************************************************************/
+/**
+ *  @enum Sequencer Result Status
+ */
+typedef enum
+{
+    VSEQ_OK = 0,  /**< Sequence ran */
+    VSEQ_FAIL = 1 /**< A bridge write failed */
+} eVSeqStatus_t;
+
+/**
+ * @struct Sequencer Event
+ * @brief One strobe of one register
+ */
+typedef struct
+{
+    uint16_t tick;                  /**< Milliseconds after the start of the sequence */
+    uint8_t reg;                    /**< VSEQ_REG_AB or VSEQ_REG_CD */
+    uint8_t bridges;                /**< Bridges to load before the strobe (DRV_A | DRV_B) */
+    uint16_t word[VSEQ_BRIDGE_CNT]; /**< Word for Bridge A and Bridge B */
+} sVSeqEvent_t;
+
+/**
+ * @struct Sequencer Schedule
+ * @brief Events in tick order
+ */
+typedef struct
+{
+    sVSeqEvent_t event[VSEQ_EVENT_MAX]; /**< Events */
+    uint8_t count;                      /**< Number of events */
+    uint8_t next;                       /**< Next event to fire */
+} sVSeqSchedule_t;
+
+#ifdef UNIT_TESTING
+extern volatile uint16_t VSEQ_Elapsed;
+extern volatile bool VSEQ_Active;
+#endif
+
+/************************************************************************
+*					    Function Prototypes
+************************************************************************/
+/** @brief Build Frame
+ *
+ *  Build the bridge words for a motion setting with every channel
+ *  disabled.  Valve to bridge/channel mapping is MOTION_VALVE_x_BRIDGE
+ *  and MOTION_VALVE_x_CHAN.
+ *
+ *  @param *state Motion setting
+ *  @param *frame Frame to fill
+ *
+ *  @return None
+ */
+void VSEQ_BuildFrame(const sMotionSetting_t *state, sMotionFrame_t *frame);
+
+/** @brief Build Schedule
+ *
+ *  Build the events to pulse the masked valves to the frame's directions.
+ *  A register with no masked valve in either bridge is not written, and
+ *  a bridge with no masked valve in a register is not loaded for it.
+ *  The on edges are at tick 0 and the off edges at tick pulse.
+ *
+ *  @param *frame Frame of the target state
+ *  @param mask Valves to pulse (bit 0 = V1)
+ *  @param pulse Pulse length (ms), limited to VSEQ_TICK_MAX
+ *  @param *sched Schedule to fill
+ *
+ *  @return None
+ */
+void VSEQ_Schedule(const sMotionFrame_t *frame, uint8_t mask, uint32_t pulse, sVSeqSchedule_t *sched);
+
+/** @brief Run Schedule
+ *
+ *  Fire the events as they come due, sleeping between them.  Stops at
+ *  the first failed bridge write.
+ *
+ *  @param *sched Schedule to run
+ *  @param *drvA Bridge A
+ *  @param *drvB Bridge B
+ *
+ *  @return result
+ */
+eVSeqStatus_t VSEQ_Run(sVSeqSchedule_t *sched, sDRV8823_t *drvA, sDRV8823_t *drvB);
+
+/** @brief Sequencer Tick
+ *
+ *  Called from the 1ms timer ISR.  Does nothing unless a sequence is
+ *  running.
+ *
+ *  @param None
+ *
+ *  @return true if the next event is due and the CPU should wake
+ */
+bool VSEQ_Tick(void);
+
+#endif // _VALVESEQ_H
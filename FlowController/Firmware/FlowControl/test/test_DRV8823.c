@@ -1,7 +1,6 @@
 #include "unity.h"
 #include "DRV8823.h"
 #include "mock_bsp.h"
-#include "mock_buffer8.h"
 
 sSPI_t spi = {
     .param = {
@@ -276,11 +275,8 @@ void test_DRV8823_CreateChannelMsg_should_CreateCorrectField_for_ChanD(void){
 
 
 void set_drv8823_valid(sDRV8823_t *ic, eBSPStatus_t result){
-    /** Add to the SPI Send Buffer */
-    Buffer8_put_IgnoreAndReturn(BUFFER_8_OK);
-    Buffer8_put_IgnoreAndReturn(BUFFER_8_OK);
-    Buffer8_put_IgnoreAndReturn(BUFFER_8_OK);
-    Buffer8_put_IgnoreAndReturn(BUFFER_8_OK);
+    /** Start from an empty SPI Send Buffer (the send is mocked) */
+    Ring8_Clear(&ic->SpiChan.Tx);
 
     /** Clear the Reset & Sleep Pins */
     BSP_GPIO_SetPin_Expect(&ic->nReset);
@@ -429,4 +425,38 @@ void test_DRV8823_CreateDatafield_should_Fail_and_NotUpdate_for_Invalid(void){
     decay = 2;
     TEST_ASSERT_EQUAL(DRV8823_FAIL, DRV8823_CreateDatafield(&output,decay,current,dir,enable));
     TEST_ASSERT_NOT_EQUAL(decay, output.Decay);
-}
\ No newline at end of file
+}
+void test_DRV8823_Load_should_SendWord_without_Strobe(void){
+    Ring8_Clear(&DRV8823_a.SpiChan.Tx);
+
+    BSP_SPI_Enable_Expect(&DRV8823_a.SpiChan);
+    BSP_GPIO_SetPin_Expect(&DRV8823_a.cs);
+    BSP_SPI_SendBytes_ExpectAndReturn(&DRV8823_a.SpiChan, BSP_OK);
+    BSP_GPIO_ClearPin_Expect(&DRV8823_a.cs);
+    BSP_SPI_Disable_Expect(&DRV8823_a.SpiChan);
+
+    TEST_ASSERT_EQUAL(DRV8823_OK, DRV8823_Load(&DRV8823_a, 0x14D3));
+    TEST_ASSERT_EQUAL(2, Ring8_Count(&DRV8823_a.SpiChan.Tx));
+    TEST_ASSERT_EQUAL_HEX16(0x14D3, DRV8823_a.Last.dataCD);
+    TEST_ASSERT_EQUAL_HEX16(0x0FFF, DRV8823_a.Last.dataAB);
+}
+
+void test_DRV8823_Load_should_ReturnInvalid_for_FailedSPI(void){
+    Ring8_Clear(&DRV8823_a.SpiChan.Tx);
+
+    BSP_SPI_Enable_Expect(&DRV8823_a.SpiChan);
+    BSP_GPIO_SetPin_Expect(&DRV8823_a.cs);
+    BSP_SPI_SendBytes_ExpectAndReturn(&DRV8823_a.SpiChan, BSP_FAIL);
+    BSP_GPIO_ClearPin_Expect(&DRV8823_a.cs);
+    BSP_SPI_Disable_Expect(&DRV8823_a.SpiChan);
+
+    TEST_ASSERT_EQUAL(DRV8823_FAIL, DRV8823_Load(&DRV8823_a, 0x0411));
+    TEST_ASSERT_EQUAL_HEX16(0x0FFF, DRV8823_a.Last.dataAB);
+}
+
+void test_DRV8823_CHAN_WORD_should_PlaceField_for_Channel(void){
+    TEST_ASSERT_EQUAL_HEX16(0x0013, DRV8823_CHAN_WORD(DRV8823_CHAN_A, 0, 4, 1, 1));
+    TEST_ASSERT_EQUAL_HEX16(0x14C0, DRV8823_CHAN_WORD(DRV8823_CHAN_D, 0, 4, 1, 1));
+    TEST_ASSERT_EQUAL_HEX16(0x0040, DRV8823_CHAN_ENABLE(DRV8823_CHAN_B));
+    TEST_ASSERT_EQUAL_HEX16(0x0001, DRV8823_CHAN_ENABLE(DRV8823_CHAN_C));
+}
@@ -10,7 +10,6 @@
 #include "mock_timer_a.h"
 #include "mock_timer_b.h"
 
-#include "buffer8.h"
 #include "sysconfig.h"
 
 
@@ -732,7 +731,7 @@ void test_BSP_I2C_SendMultiBytes_should_StartMultipleByteTransfer(void){
     sI2C_t Test = {.baseAddress = EUSCI_B0_BASE};
     /** Populate the tx buffer */
     for(i=0;i<16;i++){
-        Buffer8_put(&Test.Tx,i*2);
+        Ring8_Put(&Test.Tx,i*2);
     }
 
     EUSCI_B_I2C_setMode_Expect(EUSCI_B0_BASE,EUSCI_B_I2C_TRANSMIT_MODE);
@@ -796,7 +795,7 @@ void test_BSP_SendBytes_should_PrepAndSend_Data(void){
     uint8_t i;
 
     for(i=0;i<128;i++){
-        Buffer8_put(&Test.Tx,i);
+        Ring8_Put(&Test.Tx,i);
     }
     // DisableInterruptCalled(interruptMask,mask,result);
     EUSCI_B_SPI_enable_Expect(baseAddr);
@@ -828,7 +827,7 @@ void test_BSP_ReceiveBytes_should_PrepSendAndReceive_Data(void){
     uint8_t i;
 
     for(i=0;i<128;i++){
-        Buffer8_put(&Test.Tx,i);
+        Ring8_Put(&Test.Tx,i);
     }
 
     // DisableInterruptCalled(interruptMask,mask,result);
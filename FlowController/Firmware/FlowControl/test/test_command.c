@@ -36,7 +36,7 @@ void tearDown(void)
 }
 
 void test_COMMAND_SetMode_should_AcceptValidString_and_SetValveMode_and_UpdateInfo(void){
-    char mode[] = "ZERO_ON";
+    char mode[] = "ZPON";
 
     MCONTROL_PCO2_SetMode_ExpectAndReturn(PCO2_ZERO_PUMP_ON,MCONTROL_OK);
     TEST_ASSERT_EQUAL(COMMAND_OK,COMMAND_SetMode(&mode[0]));
@@ -104,30 +104,30 @@ void test_COMMAND_GetMode_should_ReturnValidString(void){
     
     
     MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_ZERO_PUMP_ON);
-    TEST_ASSERT_EQUAL_STRING("ZERO_ON",COMMAND_GetMode());
+    TEST_ASSERT_EQUAL_STRING("ZPON",COMMAND_GetMode());
 
     MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_ZERO_PUMP_OFF);
-    TEST_ASSERT_EQUAL_STRING("ZERO_OFF",COMMAND_GetMode());
+    TEST_ASSERT_EQUAL_STRING("ZPOFF",COMMAND_GetMode());
 
-    MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_ZERO_CAL);
-    TEST_ASSERT_EQUAL_STRING("ZERO_POST",COMMAND_GetMode());
+    MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_ZERO_PUMP_POST);
+    TEST_ASSERT_EQUAL_STRING("ZPPCAL",COMMAND_GetMode());
 
     MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_SPAN_PUMP_ON);
-    TEST_ASSERT_EQUAL_STRING("SPAN_ON",COMMAND_GetMode());
+    TEST_ASSERT_EQUAL_STRING("SPON",COMMAND_GetMode());
 
     MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_SPAN_PUMP_OFF);
-    TEST_ASSERT_EQUAL_STRING("SPAN_OFF",COMMAND_GetMode());
+    TEST_ASSERT_EQUAL_STRING("SPOFF",COMMAND_GetMode());
 
-    MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_SPAN_CAL);
-    TEST_ASSERT_EQUAL_STRING("SPAN_POST",COMMAND_GetMode());
+    MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_SPAN_PUMP_POST);
+    TEST_ASSERT_EQUAL_STRING("SPPCAL",COMMAND_GetMode());
 
     MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_EQUIL_PUMP_ON);
-    TEST_ASSERT_EQUAL_STRING("EQUIL_ON",COMMAND_GetMode());
+    TEST_ASSERT_EQUAL_STRING("EPON",COMMAND_GetMode());
 
     MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_AIR_PUMP_OFF);
-    TEST_ASSERT_EQUAL_STRING("AIR_OFF",COMMAND_GetMode());
+    TEST_ASSERT_EQUAL_STRING("APOFF",COMMAND_GetMode());
 
-    MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_DEPLOYMENT);
+    MCONTROL_PCO2_GetMode_ExpectAndReturn(PCO2_DEPLOY);
     TEST_ASSERT_EQUAL_STRING("DEPLOY",COMMAND_GetMode());
 
 
@@ -0,0 +1,186 @@
+#include "unity.h"
+#include "flowstate.h"
+#include "command.h"
+#include "motioncontrol.h"
+#include "buffer_c.h"
+#include "mock_bsp.h"
+#include "mock_relay.h"
+#include "mock_DRV8823.h"
+#include "mock_valveseq.h"
+
+#define TEST_MSG_LEN (32)
+
+sBSPSystemInfo_t SysInfo;
+
+/** Every state as the pCO2 encodes it */
+typedef struct
+{
+    const char *wire;
+    ePCO2State_t state;
+    uint8_t valves;
+    uint8_t pump;
+    const char *name;
+    const char *record;
+} sTestState_t;
+
+static const sTestState_t States[] = {
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) \
+    {FLOW_STATE_WIRE(wire_code), PCO2_##id, (valve_bitmap), (pump), name, record},
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
+};
+
+#define TEST_STATE_CNT (sizeof(States) / sizeof(States[0]))
+
+/** Reply stand-in: keep the ACK/NACK, the first character sent */
+static char Reply;
+
+static void Uart_Putc(sUART_t *UART, char val, int cmock_num_calls)
+{
+    (void)UART;
+    (void)cmock_num_calls;
+    if (Reply == 0)
+    {
+        Reply = val;
+    }
+}
+
+/** Send a message down the command UART and parse it */
+static eCommandStatus_t Send(const char *msg)
+{
+    char str[TEST_MSG_LEN];
+
+    strncpy(str, msg, TEST_MSG_LEN - 1);
+    str[TEST_MSG_LEN - 1] = '\0';
+
+    Reply = 0;
+    BufferC_Clear(&command.buf);
+    BufferC_puts(&command.buf, str, strlen(str));
+
+    return COMMAND_ParseMsg();
+}
+
+static uint8_t Valves(void)
+{
+    uint8_t valves = 0;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++)
+    {
+        if (MCONTROL_PCO2_GetDir(i) == MOTION_VALVE_CA)
+        {
+            valves |= (1u << i);
+        }
+    }
+    return valves;
+}
+
+void setUp(void)
+{
+    memset(&SysInfo, 0, sizeof(SysInfo));
+
+    DRV8823_Init_Ignore();
+    DRV8823_ClearSleepMode_Ignore();
+    DRV8823_SetSleepMode_Ignore();
+    DRV8823_Reset_Ignore();
+    VSEQ_BuildFrame_Ignore();
+    VSEQ_Schedule_Ignore();
+    VSEQ_Run_IgnoreAndReturn(VSEQ_OK);
+    RELAY_Init_Ignore();
+    RELAY_On_Ignore();
+    RELAY_Off_Ignore();
+    BSP_UART_puts_Ignore();
+    BSP_UART_putc_StubWithCallback(Uart_Putc);
+
+    MCONTROL_Init();
+}
+
+void tearDown(void)
+{
+}
+
+void test_FlowState_should_RoundTrip_EveryState(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < TEST_STATE_CNT; i++)
+    {
+        TEST_ASSERT_EQUAL_MESSAGE(COMMAND_OK, Send(States[i].wire), States[i].name);
+        TEST_ASSERT_EQUAL_MESSAGE(UART_ACK, Reply, States[i].name);
+        TEST_ASSERT_EQUAL_MESSAGE(States[i].state, MCONTROL_PCO2_GetMode(), States[i].name);
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE(States[i].valves, Valves(), States[i].name);
+        TEST_ASSERT_EQUAL_MESSAGE(States[i].pump, MCONTROL_PCO2_GetPump(), States[i].name);
+        TEST_ASSERT_EQUAL_STRING(States[i].name, COMMAND_GetMode());
+    }
+}
+
+void test_FlowState_should_Have_UniqueWireCodes_in_Range(void)
+{
+    uint8_t seen[FLOW_WIRE_MAX + 1] = {0};
+    uint8_t i;
+
+    for (i = 0; i < TEST_STATE_CNT; i++)
+    {
+        TEST_ASSERT_TRUE(States[i].state > PCO2_NONE);
+        TEST_ASSERT_TRUE(States[i].state <= FLOW_WIRE_MAX);
+        TEST_ASSERT_EQUAL_MESSAGE(0, seen[States[i].state], States[i].name);
+        seen[States[i].state] = 1;
+
+        /** The code fits the digits the decoder reads */
+        TEST_ASSERT_TRUE(strlen(States[i].wire) <= (strlen(FLOW_STATE_WIRE()) + FLOW_WIRE_DIGITS));
+    }
+}
+
+void test_FlowState_should_Keep_pCO2_RecordNames(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < TEST_STATE_CNT; i++)
+    {
+        TEST_ASSERT_TRUE_MESSAGE(strlen(States[i].record) <= 6, States[i].name);
+    }
+
+    /** Existing data files use the old prefixes */
+    TEST_ASSERT_EQUAL_STRING("EPPC", States[PCO2_EQUIL_PUMP_POST - 1].record);
+    TEST_ASSERT_EQUAL_STRING("DPLY", States[PCO2_DEPLOY - 1].record);
+    TEST_ASSERT_EQUAL_STRING("ZPON", States[PCO2_ZERO_PUMP_ON - 1].record);
+}
+
+void test_FlowState_should_Accept_ModeNames(void)
+{
+    uint8_t i;
+    char msg[TEST_MSG_LEN];
+
+    for (i = 0; i < TEST_STATE_CNT; i++)
+    {
+        sprintf(msg, "mode=%s\r\n", States[i].name);
+        TEST_ASSERT_EQUAL_MESSAGE(COMMAND_OK, Send(msg), States[i].name);
+        TEST_ASSERT_EQUAL_MESSAGE(States[i].state, MCONTROL_PCO2_GetMode(), States[i].name);
+    }
+}
+
+void test_FlowState_should_Nack_UnknownModes(void)
+{
+    const char *bad[] = {"mode=0\r\n", "mode=28\r\n", "mode=123\r\n", "mode=ZPONX\r\n", "mode=ZZZ\r\n"};
+    uint8_t i;
+
+    TEST_ASSERT_EQUAL(COMMAND_OK, Send("mode=17\r\n"));
+
+    for (i = 0; i < (sizeof(bad) / sizeof(bad[0])); i++)
+    {
+        TEST_ASSERT_EQUAL_MESSAGE(COMMAND_FAIL, Send(bad[i]), bad[i]);
+        TEST_ASSERT_EQUAL(UART_NACK, Reply);
+        TEST_ASSERT_EQUAL(PCO2_REST, MCONTROL_PCO2_GetMode());
+    }
+}
+
+void test_FlowState_should_TogglePump_and_KeepMode(void)
+{
+    TEST_ASSERT_EQUAL(COMMAND_OK, Send("mode=9\r\n"));
+    TEST_ASSERT_EQUAL(PUMP_ON, MCONTROL_PCO2_GetPump());
+
+    TEST_ASSERT_EQUAL(COMMAND_OK, Send("mode=" FLOW_WIRE_PUMP_TOGGLE "\r\n"));
+    TEST_ASSERT_EQUAL(PUMP_OFF, MCONTROL_PCO2_GetPump());
+    TEST_ASSERT_EQUAL(PCO2_EQUIL_PUMP_ON, MCONTROL_PCO2_GetMode());
+    TEST_ASSERT_EQUAL_HEX8(0x36, Valves());
+}
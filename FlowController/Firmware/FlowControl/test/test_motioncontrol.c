@@ -1,272 +1,229 @@
 #include "unity.h"
 #include "motioncontrol.h"
-// #include "mock_motioncontrol.h"
 #include "mock_DRV8823.h"
 #include "mock_relay.h"
-// #include "DRV8823.h"
-// extern sMotionSetting_t ZeroPumpOn_State_Default;
-
-STATIC PERSISTENT sMotionControl_t Test = {
-    .DRV_A = {
-        .Strobe = {.port = SYS_MCONTROL_STROBE_PORT, .pin = SYS_MCONTROL_STROBE_PIN, .mode=0},
-        .nReset = {.port = SYS_MCONTROL_NRESET_PORT, .pin = SYS_MCONTROL_NRESET_PIN, .mode=0},
-        .nSleep = {.port = SYS_MCONTROL_NSLEEP_PORT, .pin = SYS_MCONTROL_NSLEEP_PIN, .mode=0},
-        .cs = {.port = SYS_MCONTROL_BRIDGE_A_CS_PORT, .pin = SYS_MCONTROL_BRIDGE_A_CS_PIN, .mode=0},
-        .SpiChan = { .param = {
-                        .selectClockSource = EUSCI_B_SPI_CLOCKSOURCE_SMCLK,
-                        .clockSourceFrequency = SYS_MCONTROL_SPI_CLK_FREQ,
-                        .desiredSpiClock = SYS_MCONTROL_SPI_BAUD,
-                        .msbFirst = SYS_MCONTROL_SPI_MSBFIRST,
-                        .clockPhase = SYS_MCONTROL_SPI_CLK_PHASE,
-                        .clockPolarity = SYS_MCONTROL_SPI_CLK_POL,
-                        .spiMode = SYS_MCONTROL_SPI_MODE
-                        },
-                    .baseAddress = SYS_MCONTROL_BRIDGE_A_SPI_BASE,
-                    .slaveAddress = 0,
-                    .mode = 0,
-                    .configured = 0,
-                    .enabled = 0,
-                    .interrupt = 0}
-    },
-    .DRV_B = {
-        .Strobe = {.port = SYS_MCONTROL_STROBE_PORT, .pin = SYS_MCONTROL_STROBE_PIN, .mode=0},
-        .nReset = {.port = SYS_MCONTROL_NRESET_PORT, .pin = SYS_MCONTROL_NRESET_PIN, .mode=0},
-        .nSleep = {.port = SYS_MCONTROL_NSLEEP_PORT, .pin = SYS_MCONTROL_NSLEEP_PIN, .mode=0},
-        .cs = {.port = SYS_MCONTROL_BRIDGE_B_CS_PORT, .pin = SYS_MCONTROL_BRIDGE_B_CS_PIN, .mode=0},
-        .SpiChan = { .param = {
-                        .selectClockSource = EUSCI_B_SPI_CLOCKSOURCE_SMCLK,
-                        .clockSourceFrequency = SYS_MCONTROL_SPI_CLK_FREQ,
-                        .desiredSpiClock = SYS_MCONTROL_SPI_BAUD,
-                        .msbFirst = SYS_MCONTROL_SPI_MSBFIRST,
-                        .clockPhase = SYS_MCONTROL_SPI_CLK_PHASE,
-                        .clockPolarity = SYS_MCONTROL_SPI_CLK_POL,
-                        .spiMode = SYS_MCONTROL_SPI_MODE
-                        },
-                    .baseAddress = SYS_MCONTROL_BRIDGE_A_SPI_BASE,
-                    .slaveAddress = 0,
-                    .mode = 0,
-                    .configured = 0,
-                    .enabled = 0,
-                    .interrupt = 0}
-    }
-};
-void setUp(void)
+#include "mock_valveseq.h"
+#include "mock_bsp.h"
+
+/** Valve bitmap and pump of each state, indexed by wire code */
+typedef struct
 {
-    // State[0] = (sMotionState_t){.V1={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.V2={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.V3={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.V4={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.V5={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.V6={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.V7={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.V8={.Dir=HBRIDGE_FWD,.State=HBRIDGE_ON,.time_ms=50}};
-    // State[0] = (sMotionState_t){.Pump={.State=PUMP_ON}};
-    // State[0] = (sMotionState_t){.next=&State[1]};
+    uint8_t valves;
+    uint8_t pump;
+} sTestState_t;
+
+static const sTestState_t Expected[MCONTROL_STATE_CNT] = {
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) [wire_code] = {(valve_bitmap), (pump)},
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
+};
 
-}
+static const sMotionFrame_t *ScheduleFrame;
+static uint8_t ScheduleMask;
+static uint8_t ScheduleCount;
 
-void tearDown(void)
+static void Vseq_Schedule(const sMotionFrame_t *frame, uint8_t mask, uint32_t pulse, sVSeqSchedule_t *sched, int num_calls)
 {
+    ScheduleFrame = frame;
+    ScheduleMask = mask;
+    ScheduleCount++;
 }
 
-// void test_MCONTROL_SetState_should_ReturnValid(void){ 
-//         // printf("%u,%u\n",State[0].V1.Dir,State[0].V1.State);   
-//         // printf("%d and %d\n",State[0].next,&State[1]);
-//         TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_SetState(&State[0]));
-// }
-
-void test_MCONTROL_Init_should_Initialize_the_HBridgeICs(void){
-
-    DRV8823_Init_Expect(&Motion.DRV_A);
-    DRV8823_Init_Expect(&Motion.DRV_B);
+/** Init, valve positions unknown */
+static void mcontrol_init(void)
+{
+    VSEQ_BuildFrame_Ignore();
+    DRV8823_Init_Ignore();
     RELAY_Init_Ignore();
-    
     MCONTROL_Init();
-
 }
 
-
-
-void run_mcontrol_set(uint8_t enable, eMotionStatus_t result1,eMotionStatus_t result2,eMotionStatus_t result3){
-    DRV8823_ClearSleepMode_Ignore();
-    DRV8823_CreateDatafield_IgnoreAndReturn(result1);
-    DRV8823_Set_AllChannels_IgnoreAndReturn(result2);
-    DRV8823_Set_AllChannels_IgnoreAndReturn(result3);
-    DRV8823_Reset_Ignore();
-    DRV8823_SetSleepMode_Ignore();
-
+/** One valve pulse through the bridges */
+static void expect_pulse(eVSeqStatus_t result)
+{
+    DRV8823_ClearSleepMode_Expect(&Motion.DRV_A);
+    VSEQ_Run_IgnoreAndReturn(result);
+    DRV8823_Reset_Expect(&Motion.DRV_A);
+    DRV8823_SetSleepMode_Expect(&Motion.DRV_A);
 }
 
-void test_MCONTROL_Set_should_SetDRV8823_with_CorrectValues(void){
-    sMotionSetting_t state = { .Valve[0] = {.dir = 0, .current = 1u, .decay =1},
-                               .Valve[1] = {.dir = 0, .current = 2u, .decay =1},
-                               .Valve[2] = {.dir = 0, .current = 3u, .decay =1},
-                               .Valve[3] = {.dir = 0, .current = 4u, .decay =1},                             
-                               .Valve[4] = {.dir = 1, .current = 5u, .decay =0},
-                               .Valve[5] = {.dir = 1, .current = 6u, .decay =0},
-                               .Valve[6] = {.dir = 1, .current = 7u, .decay =0},
-                               .Valve[7] = {.dir = 1, .current = 0u, .decay =0},         
-                               .Pump = PUMP_ON };
-
-    /** Setup the Valve Addresses */
-    Test.Valve[0].Bridge = DRV_A;
-    Test.Valve[0].Chan = DRV_CHAN_A;
-    Test.Valve[1].Bridge = DRV_A;
-    Test.Valve[1].Chan = DRV_CHAN_B;
-    Test.Valve[2].Bridge = DRV_A;
-    Test.Valve[2].Chan = DRV_CHAN_C;
-    Test.Valve[3].Bridge = DRV_A;
-    Test.Valve[3].Chan = DRV_CHAN_D;
-    Test.Valve[4].Bridge = DRV_B;
-    Test.Valve[4].Chan = DRV_CHAN_A;
-    Test.Valve[5].Bridge = DRV_B;
-    Test.Valve[5].Chan = DRV_CHAN_B;
-    Test.Valve[6].Bridge = DRV_B;
-    Test.Valve[6].Chan = DRV_CHAN_C;
-    Test.Valve[7].Bridge = DRV_B;
-    Test.Valve[7].Chan = DRV_CHAN_D;
-
-
-    sDRV8823SetVal_t OutputA = { .outA = {.Phase=0,.Current=1,.Decay=1},
-                                .outB = {.Phase=0,.Current=2,.Decay=1},
-                                .outC = {.Phase=0,.Current=3,.Decay=1},
-                                .outD = {.Phase=0,.Current=4,.Decay=1}};
-    sDRV8823SetVal_t OutputB = { .outA = {.Phase=1,.Current=5,.Decay=0},
-                                .outB = {.Phase=1,.Current=6,.Decay=0},
-                                .outC = {.Phase=1,.Current=7,.Decay=0},
-                                .outD = {.Phase=1,.Current=0,.Decay=0}};
-
-    uint8_t enable = 1;
-    // DRV8823_CreateDatafield_IgnoreAndReturn(DRV8823_OK);
-    // DRV8823_Set_AllChannels_IgnoreAndReturn(DRV8823_OK);
-    // DRV8823_Set_AllChannels_IgnoreAndReturn(DRV8823_OK);
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK,DRV8823_OK);
-
-    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_Set(&Test,&state));
-    TEST_ASSERT_EQUAL_MEMORY(&state,&Test.Current,sizeof(state));
-
-    printf("State: Valve[0]= %u, %u, %u\n",state.Valve[0].dir,state.Valve[0].current,state.Valve[0].decay);
-    printf("DRVer: Valve[0]= %u, %u, %u\n",Test.Valve[0].State.dir,Test.Valve[0].State.current,Test.Valve[0].State.decay);
-    
-
-    // TEST_ASSERT_EQUAL_MEMORY(&OutputA,&Test.DRV_A.Send,sizeof(OutputA));
-    // TEST_ASSERT_EQUAL_MEMORY(&state.Valve[0],&Test.Valve[0].State,sizeof(state.Valve[0]));
-
+static void expect_pump(uint8_t pump)
+{
+    if (pump)
+    {
+        RELAY_On_Expect();
+    }
+    else
+    {
+        RELAY_Off_Expect();
+    }
 }
 
-
-
-
-
-
-
-
-void test_MCONTROL_PCO2_Setstate_Zero_PumpOn_should_Call_the_CorrectFunction(void){
-    ePCO2Dwell_t pco2State = PCO2_Normal;
-    ePumpStates_t pumpState = PUMP_ON;
-    uint8_t enable =1;
-    // MCONTROL_Set_IgnoreAndReturn(MCONTROL_OK);
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK,DRV8823_OK);
-    RELAY_On_Ignore();
-    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_Set(&ZeroPumpOn_State_Default,pco2State,pumpState));
+void setUp(void)
+{
+    ScheduleFrame = NULL;
+    ScheduleMask = MCONTROL_VALVE_NONE;
+    ScheduleCount = 0;
+    VSEQ_Schedule_StubWithCallback(Vseq_Schedule);
 }
 
-
-void test_MCONTROL_PCO2_Set_should_Fail_if_MControlSet_Fails(void){
-    ePCO2Dwell_t pco2State = PCO2_Normal;
-    ePumpStates_t pumpState = PUMP_ON;
-    uint8_t enable =1;
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_FAIL);
-    TEST_ASSERT_EQUAL(MCONTROL_FAIL, MCONTROL_PCO2_Set(&ZeroPumpOn_State_Default,pco2State,pumpState));
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_FAIL, DRV8823_OK);
-    TEST_ASSERT_EQUAL(MCONTROL_FAIL, MCONTROL_PCO2_Set(&ZeroPumpOn_State_Default,pco2State,pumpState));
-
-    run_mcontrol_set(enable, DRV8823_FAIL, DRV8823_OK, DRV8823_OK);
-    TEST_ASSERT_EQUAL(MCONTROL_FAIL, MCONTROL_PCO2_Set(&ZeroPumpOn_State_Default,pco2State,pumpState));
-
-
+void tearDown(void)
+{
 }
 
+void test_MCONTROL_Init_should_Initialize_the_HBridgeICs(void){
 
-// void setmode()
-
-void test_MCONTROL_PCO2_SetMode_should_Set_CorrectMode_and_ReturnValid(void){
-    DRV8823_Init_Ignore();
+    VSEQ_BuildFrame_Ignore();
+    DRV8823_Init_Expect(&Motion.DRV_A);
+    DRV8823_Init_Expect(&Motion.DRV_B);
     RELAY_Init_Expect();
-    MCONTROL_Init();
-
-    uint8_t enable = 1;
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_On_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_ZERO_PUMP_ON));
 
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_ZERO_PUMP_OFF));
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_ZERO_CAL));
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_On_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_SPAN_PUMP_ON));
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_SPAN_PUMP_OFF));
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_SPAN_CAL));
-
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_On_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_EQUIL_PUMP_ON));
+    MCONTROL_Init();
 
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_EQUIL_PUMP_OFF));
+    TEST_ASSERT_FALSE(Motion.Synced);
+    TEST_ASSERT_EQUAL(MOTION_VALVE_CA, MCONTROL_Table[PCO2_EQUIL_PUMP_ON].Valve[1].dir);
+    TEST_ASSERT_EQUAL(MOTION_VALVE_CB, MCONTROL_Table[PCO2_EQUIL_PUMP_ON].Valve[0].dir);
+    TEST_ASSERT_EQUAL(PUMP_ON, MCONTROL_Table[PCO2_EQUIL_PUMP_ON].Pump);
+}
 
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_On_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_AIR_PUMP_ON));
+void test_MCONTROL_PCO2_SetMode_should_Set_CorrectMode_and_ReturnValid(void){
+    uint8_t prev = PCO2_ZERO_PUMP_ON;
+    uint8_t mode;
+    uint8_t mask;
+
+    mcontrol_init();
+
+    /** First mode after init pulses every valve */
+    expect_pulse(VSEQ_OK);
+    expect_pump(Expected[prev].pump);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(prev));
+    TEST_ASSERT_EQUAL_HEX8(MCONTROL_VALVE_ALL, ScheduleMask);
+
+    /** Then only the valves that change */
+    for (mode = PCO2_ZERO_PUMP_OFF; mode <= FLOW_WIRE_MAX; mode++)
+    {
+        mask = Expected[prev].valves ^ Expected[mode].valves;
+        ScheduleCount = 0;
+        if (mask != MCONTROL_VALVE_NONE)
+        {
+            expect_pulse(VSEQ_OK);
+        }
+        if (Expected[prev].pump != Expected[mode].pump)
+        {
+            expect_pump(Expected[mode].pump);
+        }
+
+        TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(mode));
+        TEST_ASSERT_EQUAL(mode, MCONTROL_PCO2_GetMode());
+        if (mask != MCONTROL_VALVE_NONE)
+        {
+            TEST_ASSERT_EQUAL(1, ScheduleCount);
+            TEST_ASSERT_EQUAL_HEX8(mask, ScheduleMask);
+            TEST_ASSERT_EQUAL_PTR(&MCONTROL_Table[mode].Frame, ScheduleFrame);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(0, ScheduleCount);
+        }
+        prev = mode;
+    }
+}
 
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_AIR_PUMP_OFF));
+void test_MCONTROL_PCO2_SetMode_should_Load_Only_Changed_Channels(void){
+    mcontrol_init();
+    expect_pulse(VSEQ_OK);
+    expect_pump(0);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_REST));
+
+    /** REST 0x10 to ZPVENT 0x18, V4 only */
+    expect_pulse(VSEQ_OK);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_ZERO_VENT));
+    TEST_ASSERT_EQUAL_HEX8(0x08, ScheduleMask);
+    TEST_ASSERT_EQUAL(MOTION_VALVE_CA, MCONTROL_PCO2_GetDir(3));
+
+    /** ZPVENT 0x18 to EPON 0x36, V1, V2, V3 and V6 and the pump */
+    ScheduleCount = 0;
+    expect_pulse(VSEQ_OK);
+    expect_pump(1);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_EQUIL_PUMP_ON));
+    TEST_ASSERT_EQUAL_HEX8(0x2E, ScheduleMask);
+    TEST_ASSERT_EQUAL(1, ScheduleCount);
+}
 
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_REST));
+void test_MCONTROL_PCO2_SetMode_should_Pulse_Nothing_for_a_Repeated_Mode(void){
+    mcontrol_init();
+    expect_pulse(VSEQ_OK);
+    expect_pump(1);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_EQUIL_PUMP_ON));
+
+    /** No bridge or relay calls are expected */
+    ScheduleCount = 0;
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_EQUIL_PUMP_ON));
+    TEST_ASSERT_EQUAL(0, ScheduleCount);
+
+    /** Same valves, pump only */
+    expect_pump(0);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_EQUIL_PUMP_OFF));
+    TEST_ASSERT_EQUAL(0, ScheduleCount);
+    TEST_ASSERT_EQUAL(PCO2_EQUIL_PUMP_OFF, MCONTROL_PCO2_GetMode());
+}
 
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_OK);
-    RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_OK,MCONTROL_PCO2_SetMode(PCO2_DEPLOYMENT));
+void test_MCONTROL_PCO2_ForceMode_should_Pulse_Every_Channel(void){
+    mcontrol_init();
+    expect_pulse(VSEQ_OK);
+    expect_pump(0);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_REST));
+
+    ScheduleCount = 0;
+    expect_pulse(VSEQ_OK);
+    expect_pump(0);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_ForceMode(PCO2_REST));
+    TEST_ASSERT_EQUAL(1, ScheduleCount);
+    TEST_ASSERT_EQUAL_HEX8(MCONTROL_VALVE_ALL, ScheduleMask);
+    TEST_ASSERT_EQUAL_PTR(&MCONTROL_Table[PCO2_REST].Frame, ScheduleFrame);
 }
 
+void test_MCONTROL_PCO2_SetMode_should_Pulse_Every_Channel_after_a_Failed_Set(void){
+    mcontrol_init();
+    expect_pulse(VSEQ_OK);
+    expect_pump(0);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_REST));
+
+    expect_pulse(VSEQ_FAIL);
+    TEST_ASSERT_EQUAL(MCONTROL_FAIL, MCONTROL_PCO2_SetMode(PCO2_ZERO_VENT));
+    TEST_ASSERT_EQUAL(PCO2_REST, MCONTROL_PCO2_GetMode());
+    TEST_ASSERT_FALSE(Motion.Synced);
+
+    expect_pulse(VSEQ_OK);
+    expect_pump(0);
+    TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetMode(PCO2_ZERO_VENT));
+    TEST_ASSERT_EQUAL_HEX8(MCONTROL_VALVE_ALL, ScheduleMask);
+    TEST_ASSERT_TRUE(Motion.Synced);
+}
 
 void test_MCONTROL_PCO2_SetMode_should_NOTSet_Mode_and_Fail_for_Invalid(void){
-    uint8_t enable =1;
-    run_mcontrol_set(enable, DRV8823_OK, DRV8823_OK, DRV8823_FAIL);
-    // RELAY_Off_Expect();
-    TEST_ASSERT_EQUAL(MCONTROL_FAIL,MCONTROL_PCO2_SetMode(PCO2_DEPLOYMENT));
+    mcontrol_init();
+    Motion.PCO2State = PCO2_REST;
+
+    TEST_ASSERT_EQUAL(MCONTROL_FAIL,MCONTROL_PCO2_SetMode(PCO2_NONE));
+    TEST_ASSERT_EQUAL(MCONTROL_FAIL,MCONTROL_PCO2_SetMode((ePCO2State_t)MCONTROL_STATE_CNT));
+    TEST_ASSERT_EQUAL(MCONTROL_FAIL,MCONTROL_PCO2_ForceMode(PCO2_NONE));
+    TEST_ASSERT_EQUAL(0, ScheduleCount);
+    TEST_ASSERT_EQUAL(PCO2_REST, MCONTROL_PCO2_GetMode());
 }
 
 
 void test_MCONTROL_PCO2_SetCurrent_should_AcceptValidValues_and_ReturnValid(void){
-    
-    uint8_t i;
 
+    uint8_t i;
 
+    VSEQ_BuildFrame_Ignore();
     for(i=0;i<7;i++){
         TEST_ASSERT_EQUAL(MCONTROL_OK, MCONTROL_PCO2_SetCurrent(i));
-        TEST_ASSERT_EQUAL(i,ZeroPumpOn_State.Valve[0].current);
-        TEST_ASSERT_EQUAL(i,EquilPumpOn_State.Valve[5].current);
-        TEST_ASSERT_EQUAL(i,Deploy_State.Valve[7].current);
+        TEST_ASSERT_EQUAL(i,MCONTROL_Table[PCO2_ZERO_PUMP_ON].Valve[0].current);
+        TEST_ASSERT_EQUAL(i,MCONTROL_Table[PCO2_EQUIL_PUMP_ON].Valve[5].current);
+        TEST_ASSERT_EQUAL(i,MCONTROL_Table[PCO2_DEPLOY].Valve[7].current);
+        TEST_ASSERT_EQUAL(i,MCONTROL_PCO2_GetCurrent());
     }
 }
 
@@ -317,4 +274,4 @@ void test_MCONTROL_PCO2_GetPulse_should_ReturnDelayPulseMS(void){
 
     Motion.Delay = 564;
     TEST_ASSERT_EQUAL(564,MCONTROL_PCO2_GetPulse());
-}
\ No newline at end of file
+}
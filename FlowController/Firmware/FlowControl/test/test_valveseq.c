@@ -0,0 +1,248 @@
+#include "unity.h"
+#include "valveseq.h"
+#include "mock_DRV8823.h"
+
+/** Valve bitmap of each state */
+enum
+{
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) TEST_##id = (valve_bitmap),
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
+};
+
+#define TEST_VALVE(P, n) {.dir = ((TEST_##P >> ((n) - 1)) & 1u), .current = MOTION_VALVE_NOM_CURRENT, .decay = MOTION_VALVE_DECAY}
+#define TEST_STATE(P)                                                   \
+    {.Valve = {TEST_VALVE(P, 1), TEST_VALVE(P, 2), TEST_VALVE(P, 3), TEST_VALVE(P, 4), \
+               TEST_VALVE(P, 5), TEST_VALVE(P, 6), TEST_VALVE(P, 7), TEST_VALVE(P, 8)}}
+
+#define TEST_PULSE (50)
+#define TEST_EMIT_MAX (8)
+
+sDRV8823_t DrvA;
+sDRV8823_t DrvB;
+
+sMotionSetting_t Rest = TEST_STATE(REST);
+sMotionSetting_t ZeroPump = TEST_STATE(ZERO_PUMP_ON);
+sMotionSetting_t ZeroVent = TEST_STATE(ZERO_VENT);
+sMotionSetting_t SpanPump = TEST_STATE(SPAN_PUMP_ON);
+sMotionSetting_t EquilPump = TEST_STATE(EQUIL_PUMP_ON);
+
+/** Golden transitions.  Words worked by hand from the DRV8823 datasheet */
+/** field layout and the MOTION_VALVE_x map (current 4, no decay): */
+/**   A&B: V5 low, V2 high (Bridge A)   V7 low, V4 high (Bridge B) */
+/**   C&D: V6 low, V1 high (Bridge A)   V3 low, V8 high (Bridge B) */
+typedef struct
+{
+    sMotionSetting_t *to;
+    uint8_t mask;
+    uint8_t count;
+    sVSeqEvent_t event[VSEQ_EVENT_MAX];
+} sTestTransition_t;
+
+static const sTestTransition_t Golden[] = {
+    /** Rest -> Zero Pump: nothing moves */
+    {&ZeroPump, 0x00, 0, {{0}}},
+    /** Zero Pump -> Zero Vent: V4 to A */
+    {&ZeroVent, 0x08, 2,
+     {{0, VSEQ_REG_AB, DRV_B, {0x0412, 0x04D0}},
+      {TEST_PULSE, VSEQ_REG_AB, DRV_B, {0x0412, 0x0490}}}},
+    /** Zero Vent -> Span Pump: V1, V6 to A, V5 to B, all on Bridge A */
+    {&SpanPump, 0x31, 4,
+     {{0, VSEQ_REG_AB, DRV_A, {0x0411, 0x0490}},
+      {0, VSEQ_REG_CD, DRV_A, {0x14D3, 0x1410}},
+      {TEST_PULSE, VSEQ_REG_AB, DRV_A, {0x0410, 0x0490}},
+      {TEST_PULSE, VSEQ_REG_CD, DRV_A, {0x1492, 0x1410}}}},
+    /** Span Pump -> Equil Pump: V1 - V5, both bridges */
+    {&EquilPump, 0x1F, 4,
+     {{0, VSEQ_REG_AB, DRV_A | DRV_B, {0x04D3, 0x0450}},
+      {0, VSEQ_REG_CD, DRV_A | DRV_B, {0x1452, 0x1413}},
+      {TEST_PULSE, VSEQ_REG_AB, DRV_A | DRV_B, {0x0492, 0x0410}},
+      {TEST_PULSE, VSEQ_REG_CD, DRV_A | DRV_B, {0x1412, 0x1412}}}},
+    /** Forced into Equil Pump: every valve */
+    {&EquilPump, 0xFF, 4,
+     {{0, VSEQ_REG_AB, DRV_A | DRV_B, {0x04D3, 0x0451}},
+      {0, VSEQ_REG_CD, DRV_A | DRV_B, {0x1453, 0x1453}},
+      {TEST_PULSE, VSEQ_REG_AB, DRV_A | DRV_B, {0x0492, 0x0410}},
+      {TEST_PULSE, VSEQ_REG_CD, DRV_A | DRV_B, {0x1412, 0x1412}}}},
+};
+
+#define TEST_GOLDEN_CNT (sizeof(Golden) / sizeof(Golden[0]))
+
+/** Bridge stand-in: rebuilds the events from the loads and strobes */
+static sVSeqEvent_t Emitted[TEST_EMIT_MAX];
+static uint8_t EmitCount;
+static sVSeqEvent_t Pending;
+static uint8_t StrobeCount;
+static uint8_t FailOnLoad;
+static uint8_t LoadCount;
+
+static eDRV8823Status_t Drv_Load(sDRV8823_t *ic, uint16_t word, int cmock_num_calls)
+{
+    uint8_t b = (ic == &DrvB) ? 1 : 0;
+    (void)cmock_num_calls;
+
+    TEST_ASSERT_TRUE(VSEQ_Active);
+    if (++LoadCount == FailOnLoad)
+    {
+        return DRV8823_FAIL;
+    }
+    Pending.bridges |= (b == 1) ? DRV_B : DRV_A;
+    Pending.word[b] = word;
+    Pending.reg = DRV8823_WORD_IS_CD(word) ? VSEQ_REG_CD : VSEQ_REG_AB;
+    return DRV8823_OK;
+}
+
+static void Drv_Strobe(sDRV8823_t *ic, int cmock_num_calls)
+{
+    (void)ic;
+    (void)cmock_num_calls;
+
+    StrobeCount++;
+    Pending.tick = VSEQ_Elapsed;
+    if (EmitCount < TEST_EMIT_MAX)
+    {
+        Emitted[EmitCount++] = Pending;
+    }
+    memset(&Pending, 0, sizeof(Pending));
+}
+
+static void Assert_Event(const sVSeqEvent_t *exp, const sVSeqEvent_t *act, bool loadedOnly)
+{
+    TEST_ASSERT_EQUAL_UINT16(exp->tick, act->tick);
+    TEST_ASSERT_EQUAL(exp->reg, act->reg);
+    TEST_ASSERT_EQUAL_HEX8(exp->bridges, act->bridges);
+    if ((false == loadedOnly) || (exp->bridges & DRV_A))
+    {
+        TEST_ASSERT_EQUAL_HEX16(exp->word[0], act->word[0]);
+    }
+    if ((false == loadedOnly) || (exp->bridges & DRV_B))
+    {
+        TEST_ASSERT_EQUAL_HEX16(exp->word[1], act->word[1]);
+    }
+}
+
+void setUp(void)
+{
+    VSEQ_BuildFrame(&Rest, &Rest.Frame);
+    VSEQ_BuildFrame(&ZeroPump, &ZeroPump.Frame);
+    VSEQ_BuildFrame(&ZeroVent, &ZeroVent.Frame);
+    VSEQ_BuildFrame(&SpanPump, &SpanPump.Frame);
+    VSEQ_BuildFrame(&EquilPump, &EquilPump.Frame);
+
+    memset(Emitted, 0, sizeof(Emitted));
+    memset(&Pending, 0, sizeof(Pending));
+    EmitCount = 0;
+    StrobeCount = 0;
+    FailOnLoad = 0;
+    LoadCount = 0;
+
+    DRV8823_Load_StubWithCallback(Drv_Load);
+    DRV8823_Strobe_StubWithCallback(Drv_Strobe);
+}
+
+void tearDown(void)
+{
+}
+
+void test_VSEQ_BuildFrame_should_PackEveryValve_Disabled(void)
+{
+    TEST_ASSERT_EQUAL_HEX16(0x0492, EquilPump.Frame.Word[0][VSEQ_REG_AB]);
+    TEST_ASSERT_EQUAL_HEX16(0x1412, EquilPump.Frame.Word[0][VSEQ_REG_CD]);
+    TEST_ASSERT_EQUAL_HEX16(0x0410, EquilPump.Frame.Word[1][VSEQ_REG_AB]);
+    TEST_ASSERT_EQUAL_HEX16(0x1412, EquilPump.Frame.Word[1][VSEQ_REG_CD]);
+}
+
+void test_VSEQ_BuildFrame_should_Match_CreateChannelMsg_Layout(void)
+{
+    sMotionSetting_t state = TEST_STATE(REST);
+    sMotionFrame_t frame;
+    uint8_t i;
+
+    /** Decay and full current on every valve, all in direction A */
+    for (i = 0; i < 8; i++)
+    {
+        state.Valve[i].decay = 1;
+        state.Valve[i].current = 7;
+        state.Valve[i].dir = MOTION_VALVE_CA;
+    }
+    VSEQ_BuildFrame(&state, &frame);
+
+    /** Same as the CreateChannelMsg test vectors with Enable cleared */
+    TEST_ASSERT_EQUAL_HEX16(0x0FBE, frame.Word[0][VSEQ_REG_AB]);
+    TEST_ASSERT_EQUAL_HEX16(0x1FBE, frame.Word[0][VSEQ_REG_CD]);
+    TEST_ASSERT_EQUAL_HEX16(0x0FBE, frame.Word[1][VSEQ_REG_AB]);
+    TEST_ASSERT_EQUAL_HEX16(0x1FBE, frame.Word[1][VSEQ_REG_CD]);
+}
+
+void test_VSEQ_Schedule_should_Match_GoldenTable(void)
+{
+    sVSeqSchedule_t sched;
+    uint8_t t;
+    uint8_t i;
+
+    for (t = 0; t < TEST_GOLDEN_CNT; t++)
+    {
+        VSEQ_Schedule(&Golden[t].to->Frame, Golden[t].mask, TEST_PULSE, &sched);
+
+        TEST_ASSERT_EQUAL(Golden[t].count, sched.count);
+        for (i = 0; i < sched.count; i++)
+        {
+            Assert_Event(&Golden[t].event[i], &sched.event[i], false);
+        }
+    }
+}
+
+void test_VSEQ_Run_should_Emit_GoldenSequence_on_Timer(void)
+{
+    sVSeqSchedule_t sched;
+    uint8_t t;
+    uint8_t i;
+
+    for (t = 0; t < TEST_GOLDEN_CNT; t++)
+    {
+        EmitCount = 0;
+        StrobeCount = 0;
+
+        VSEQ_Schedule(&Golden[t].to->Frame, Golden[t].mask, TEST_PULSE, &sched);
+        TEST_ASSERT_EQUAL(VSEQ_OK, VSEQ_Run(&sched, &DrvA, &DrvB));
+
+        /** One strobe per event, both bridges latched together */
+        TEST_ASSERT_EQUAL(Golden[t].count, StrobeCount);
+        TEST_ASSERT_EQUAL(Golden[t].count, EmitCount);
+        for (i = 0; i < EmitCount; i++)
+        {
+            Assert_Event(&Golden[t].event[i], &Emitted[i], true);
+        }
+        TEST_ASSERT_FALSE(VSEQ_Active);
+    }
+}
+
+void test_VSEQ_Run_should_Stop_on_FailedLoad(void)
+{
+    sVSeqSchedule_t sched;
+
+    /** Bridge B load of the C&D on edge fails */
+    FailOnLoad = 4;
+    VSEQ_Schedule(&EquilPump.Frame, 0x1F, TEST_PULSE, &sched);
+
+    TEST_ASSERT_EQUAL(VSEQ_FAIL, VSEQ_Run(&sched, &DrvA, &DrvB));
+    TEST_ASSERT_EQUAL(1, StrobeCount);
+    TEST_ASSERT_EQUAL(1, sched.next);
+    TEST_ASSERT_FALSE(VSEQ_Active);
+}
+
+void test_VSEQ_Tick_should_DoNothing_when_Idle(void)
+{
+    VSEQ_Elapsed = 7;
+    TEST_ASSERT_FALSE(VSEQ_Tick());
+    TEST_ASSERT_EQUAL_UINT16(7, VSEQ_Elapsed);
+}
+
+void test_VSEQ_Schedule_should_Limit_Pulse(void)
+{
+    sVSeqSchedule_t sched;
+
+    VSEQ_Schedule(&ZeroVent.Frame, 0x08, 100000ul, &sched);
+    TEST_ASSERT_EQUAL(2, sched.count);
+    TEST_ASSERT_EQUAL_UINT16(VSEQ_TICK_MAX, sched.event[1].tick);
+}
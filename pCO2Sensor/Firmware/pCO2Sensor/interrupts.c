@@ -1,6 +1,8 @@
 #include "msp430fr5994.h"
 #include "sysinfo.h"
 #include "logging.h"
+#include "LI8x0.h"
+#include "i2cq.h"
 /************************************************************************
  *					INTERRUPT VECTOR
  ************************************************************************/
@@ -16,6 +18,12 @@ __interrupt void Port_1(void)
   case P1IV_P1IFG1:
     break; /* Vector 4 - Interrupt on Pin 1, Pin 1 */
   case P1IV_P1IFG2:
+    /** Feed the watchdog while the main loop sleeps on a timer */
+    if (BSP_WD_Tick == true)
+    {
+      BSP_Hit_WD();
+    }
+
     /** Timer 1 Counter */
     if (sysinfo.timer1.tFlag == true)
     {
@@ -43,6 +51,34 @@ __interrupt void Port_1(void)
         sysinfo.timer2.tCounter--;
       }
     }
+
+    /** Timer 3 Counter*/
+    if (sysinfo.timer3.tFlag == true)
+    {
+      if (sysinfo.timer3.tCounter <= 0)
+      {
+        sysinfo.timer3.tFlag = false;
+        __low_power_mode_off_on_exit();
+      }
+      else
+      {
+        sysinfo.timer3.tCounter--;
+      }
+    }
+
+    /** Rx Wait Counter */
+    if (sysinfo.rxTimer.tFlag == true)
+    {
+      if (sysinfo.rxTimer.tCounter <= 0)
+      {
+        sysinfo.rxTimer.tFlag = false;
+        __low_power_mode_off_on_exit();
+      }
+      else
+      {
+        sysinfo.rxTimer.tCounter--;
+      }
+    }
     break; /* Vector 6 - Interrupt on Pin 1, Pin 2 */
   case P1IV_P1IFG3:
 
@@ -53,7 +89,16 @@ __interrupt void Port_1(void)
     __low_power_mode_off_on_exit();
     break; /* Vector 10 - Interrupt on Pin 1, Pin 4 */
   case P1IV_P1IFG5:
-    /** nIRQ2 - 8Hz Pin, used at the Sample Timer Counter */
+    /** nIRQ2 - 16Hz Pin (AMBIQ_RTC_SQW_SETTING), used at the Sample Timer Counter */
+    /** Also times out stuck I2C queue transfers */
+    if (true == I2CQ_Tick(&I2CQ_B0))
+    {
+      __low_power_mode_off_on_exit();
+    }
+    if (true == I2CQ_Tick(&I2CQ_B1))
+    {
+      __low_power_mode_off_on_exit();
+    }
     if (sysinfo.sampleTimer.tFlag == true)
     {
       if (sysinfo.sampleTimer.tCounter <= 0)
@@ -230,8 +275,23 @@ __interrupt void USCI_A0_ISR(void)
       }
     }
 
-    /** Increment the Buffer index */
-    pConsoleRxBuffer++;
+    /** Raise the line events and wake the main loop */
+    if (*pConsoleRxBuffer == '\n')
+    {
+      ConsoleRxEvent |= SYS_RX_EVENT_LINE;
+      __low_power_mode_off_on_exit();
+    }
+    else if ((ConsoleRxEvent & SYS_RX_EVENT_BYTE) == 0)
+    {
+      ConsoleRxEvent |= SYS_RX_EVENT_BYTE;
+      __low_power_mode_off_on_exit();
+    }
+
+    /** Increment the Buffer index, holding the last slot for the NULL */
+    if (pConsoleRxBuffer < &ConsoleRxBuffer[SYSTEM_CONSOLE_RX_BUFFER_LEN - 1])
+    {
+      pConsoleRxBuffer++;
+    }
 
     /** Null the buffer before next write */
     *pConsoleRxBuffer = NULL;
@@ -314,8 +374,23 @@ __interrupt void USCI_A1_ISR(void)
       TA1R = 0x00;
     }
 
-    /** Increment the Buffer index */
-    pCommandRxBuffer++;
+    /** Raise the line events and wake the main loop */
+    if (*pCommandRxBuffer == '\n')
+    {
+      CommandRxEvent |= SYS_RX_EVENT_LINE;
+      __low_power_mode_off_on_exit();
+    }
+    else if ((CommandRxEvent & SYS_RX_EVENT_BYTE) == 0)
+    {
+      CommandRxEvent |= SYS_RX_EVENT_BYTE;
+      __low_power_mode_off_on_exit();
+    }
+
+    /** Increment the Buffer index, holding the last slot for the NULL */
+    if (pCommandRxBuffer < &CommandRxBuffer[SYSTEM_COMMAND_RX_BUFFER_LEN - 1])
+    {
+      pCommandRxBuffer++;
+    }
 
     /** Null the buffer before next write */
     *pCommandRxBuffer = NULL;
@@ -340,6 +415,12 @@ __interrupt void USCI_A2_ISR(void)
   case USCI_NONE:
     break;
   case USCI_UART_UCRXIFG:
+    /** Streaming frames go to the frame ring */
+    if (true == LicorStreamActive)
+    {
+      LI8x0_Stream_RxChar(UCA2RXBUF);
+      break;
+    }
     *pLicorRxBuffer = UCA2RXBUF;
     if (*pLicorRxBuffer == '\n')
     {
@@ -367,6 +448,17 @@ __interrupt void USCI_B0_ISR(void)
 {
   static uint8_t rxCount = 0;
   static uint8_t txCount = 1;
+
+  /** Queued transfers own the bus while they run */
+  if (true == I2CQ_Busy(&I2CQ_B0))
+  {
+    if (true == I2CQ_ISR(&I2CQ_B0))
+    {
+      __low_power_mode_off_on_exit();
+    }
+    return;
+  }
+
   switch (__even_in_range(UCB0IV, USCI_I2C_UCBIT9IFG))
   {
   case USCI_NONE:
@@ -435,6 +527,17 @@ __interrupt void USCI_B1_ISR(void)
 {
   static uint8_t rxCount = 0;
   static uint8_t txCount = 1;
+
+  /** Queued transfers own the bus while they run */
+  if (true == I2CQ_Busy(&I2CQ_B1))
+  {
+    if (true == I2CQ_ISR(&I2CQ_B1))
+    {
+      __low_power_mode_off_on_exit();
+    }
+    return;
+  }
+
   switch (__even_in_range(UCB1IV, USCI_I2C_UCBIT9IFG))
   {
   case USCI_NONE:
@@ -519,9 +622,10 @@ __interrupt void USCI_B2_ISR(void)
 #pragma vector = TIMER0_A0_VECTOR
 __interrupt void Timer0_A0_ISR(void)
 {
-  /** Watchdog Wakeup Timer */
+  /** Watchdog Timer.  Idle sleeps until the RTC alarm or a port */
+  /** wakes it, so the tick only feeds the watchdog and stays in LPM3 */
   if (SysMode == SYS_Watchdog)
   {
-    __low_power_mode_off_on_exit();
+    BSP_Hit_WD();
   }
 }
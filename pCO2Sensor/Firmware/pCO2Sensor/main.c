@@ -22,6 +22,7 @@ void sensor_init(void);
 void Reset_ISR(uint16_t value);
 
 uint16_t rst_value = 0;
+bool warm_resume = false;
 
 int main(void)
 {
@@ -39,8 +40,8 @@ int main(void)
 
   while (1)
   {
-    /** Initialize the board */
-    BSP_Init_Board();
+    /** Initialize the board, or restore only what LPM3 parked */
+    warm_resume = BSP_Resume_Board();
 
     if ( rst_value > 0)
     {
@@ -113,24 +114,27 @@ void main_enter_lpm(void)
   /** Put the board in Low Power Mode */
   BSP_Low_Power_Mode();
 
-  /** Restart the timer */
-  if (SysMode == SYS_Watchdog)
-  {
-    TA0R = 0;
-  }
-  else
-  {
-    TA0R = TA0CCR0 - 100; /** Hits the WD soon */
-    SysMode = SYS_Watchdog;
-  }
+  /** Feed the watchdog now and restart the tick from here */
+  BSP_Hit_WD();
+  TA0R = 0;
 
-  /** Start the WD Timer Wakeup timer */
+  /** Start the WD Timer tick.  It feeds the watchdog from the ISR */
+  /** without waking, so the next wake is the task alarm or a port */
   TA0CCTL0 = CCIE;
   __bis_SR_register(GIE);
 
-  /** Go into low power mode */
-  __low_power_mode_3();
-  __no_operation();
+  /** Go into low power mode until something other than the tick */
+  /** needs the main loop */
+  do
+  {
+    __disable_interrupt();
+    if (SysMode == SYS_Watchdog)
+    {
+      __bis_SR_register(LPM3_bits | GIE);
+      __no_operation();
+    }
+    __enable_interrupt();
+  } while (SysMode == SYS_Watchdog);
   rst_value = SYSRSTIV;
 }
 
@@ -152,15 +156,9 @@ void main_mode_console(void)
   /** Initialize the drivers */
   common_init();
 
-  /** Go to sleep LPM0 and wait for wakeup*/
-  uint16_t counter = 5000;
+  /** Go to sleep LPM0 and wait for the first key (or timeout) */
   BSP_Hit_WD();
-  do
-  {
-
-    _delay_ms(1);
-  } while ((pConsoleRxBuffer == &ConsoleRxBuffer[0]) &&
-           (counter-- > 0));
+  CONSOLEIO_WaitEvent(&ConsoleRxEvent, SYS_RX_EVENT_BYTE, CONSOLE_HOTKEY_TIMEOUT_SEC);
   BSP_Hit_WD();
 
   if ((pConsoleRxBuffer == &ConsoleRxBuffer[0]))
@@ -270,8 +268,12 @@ void common_init(void)
   /** Start the interrupts */
   __bis_SR_register(GIE);
   
-  /** Set the 1 Second Timer */
-  AM08X5_SetIRQ();
+  /** Set the 1 Second Timer.  The RTC keeps its oscillator, offset */
+  /** and IRQ setup through an MCU sleep, so only a cold start sends it */
+  if (warm_resume == false)
+  {
+    AM08X5_SetIRQ();
+  }
   AM08X5_TimerSet(&RTC.timer, NULL);
 
   /** Suppress Command Timeout Flag */
@@ -319,49 +321,49 @@ void Reset_ISR(uint16_t value)
   {
 
   case SYSRSTIV_LPM5WU: /* SYSRSTIV : Port LPM5 Wake Up */
-    Error("Reset From - LPM5 Wake Up", LOG_Priority_High);
+    Error(ERROR_MSG_01020001, value);
     break;
   case SYSRSTIV_SECYV: /* SYSRSTIV : Security violation */
-    Error("Reset From - Security Violation", LOG_Priority_High);
+    Error(ERROR_MSG_01020002, value);
     break;
   case SYSRSTIV_SVSHIFG: /* SYSRSTIV : SVSHIFG */
-    Error("No reset", LOG_Priority_High);
+    Error(ERROR_MSG_01020004, value);
     break;
   case SYSRSTIV_DOBOR: /* SYSRSTIV : Do BOR */
-    Error("Reset From - BOR", LOG_Priority_High);
+    Error(ERROR_MSG_01020008, value);
     break;
   case SYSRSTIV_WDTTO: /* SYSRSTIV : WDT Time out */
-    Error("Reset From - Watchdog Timeout", LOG_Priority_High);
+    Error(ERROR_MSG_01020010, value);
     break;
   case SYSRSTIV_WDTKEY: /* SYSRSTIV : WDTKEY violation */
-    Error("Reset From - WD Key Violation", LOG_Priority_High);
+    Error(ERROR_MSG_01020020, value);
     break;
   case SYSRSTIV_FRCTLPW: /* SYSRSTIV : FRAM Key violation */
-    Error("Reset From - FRAM Key Violation", LOG_Priority_High);
+    Error(ERROR_MSG_01020040, value);
     break;
   case SYSRSTIV_UBDIFG: /* SYSRSTIV : FRAM Uncorrectable bit Error */
-    Error("Reset From - FRAM Uncorrectable Bit Error", LOG_Priority_High);
+    Error(ERROR_MSG_01020080, value);
     break;
   case SYSRSTIV_PERF: /* SYSRSTIV : peripheral/config area fetch */
-    Error("Reset From - Peripheral/config area fetch", LOG_Priority_High);
+    Error(ERROR_MSG_01020100, value);
     break;
   case SYSRSTIV_CSPW: /* SYSRSTIV : CS Password violation */
-    Error("Reset From - CS Password violation", LOG_Priority_High);
+    Error(ERROR_MSG_01020200, value);
     break;
   case SYSRSTIV_MPUSEGPIFG: /* SYSRSTIV : MPUSEGPIFG violation */
-    Error("Reset From - MPUSEGPIFG violation", LOG_Priority_High);
+    Error(ERROR_MSG_01020400, value);
     break;
   case SYSRSTIV_MPUSEGIIFG: /* SYSRSTIV : MPUSEGIIFG violation */
-    Error("Reset From - MPUSEGIIFG violation", LOG_Priority_High);
+    Error(ERROR_MSG_01020800, value);
     break;
   case SYSRSTIV_MPUSEG1IFG: /* SYSRSTIV : MPUSEG1IFG violation */
-    Error("Reset From - MPUSEG1IFG violtaion", LOG_Priority_High);
+    Error(ERROR_MSG_01021000, value);
     break;
   case SYSRSTIV_MPUSEG2IFG: /* SYSRSTIV : MPUSEG2IFG violation */
-    Error("Reset From - MPUSEG2IFG violation", LOG_Priority_High);
+    Error(ERROR_MSG_01022000, value);
     break;
   case SYSRSTIV_MPUSEG3IFG: /* SYSRSTIV : MPUSEG3IFG violation */
-    Error("Reset From - MPUSEG3IFG violation", LOG_Priority_High);
+    Error(ERROR_MSG_01024000, value);
     break;
     case SYSRSTIV_BOR: /* SYSRSTIV : BOR */
   case SYSRSTIV_DOPOR: /* SYSRSTIV : Do POR */
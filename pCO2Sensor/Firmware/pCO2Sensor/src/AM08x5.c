@@ -36,6 +36,10 @@ PERSISTENT sAM08X5_t RTC = {.I2C = {.param = {.selectClockSource = AMBIQ_RTC_I2C
                                 .period = AMBIQ_RTC_TIMER_PERIOD},
                             .cal = {.freq = AMBIQ_RTC_CLK_FREQ}};
 
+STATIC const uint8_t AM08X5_TimeAddr = HUNDREDTHS_REG;                          /**< Queued time read start register */
+STATIC uint8_t AM08X5_TimeRegs[AM08X5_TIME_REG_CNT];                            /**< Queued time read registers */
+STATIC sI2CQDone_t AM08X5_TimeDone = {.busy = false, .result = I2CQ_PENDING};   /**< Queued time read completion */
+
 /************************************************************************
  *					   Static Functions Prototypes
  ************************************************************************/
@@ -49,6 +53,7 @@ STATIC void AM08X5_ClearReg(uint8_t addr, uint8_t mask);
 STATIC void AM08X5_SetReg(uint8_t addr, uint8_t mask);
 STATIC eAM08X5Status_t AM08X5_osc_sel(uint8_t osc);
 STATIC void AM08X5_get_time(void);
+STATIC void AM08X5_decode_time(uint8_t *regs);
 void set_battery_switch(void);
 STATIC uint8_t bcd2dec(uint8_t bcdno);
 STATIC uint8_t dec2bcd(uint8_t decno);
@@ -73,6 +78,7 @@ eAM08X5Status_t AM08X5_Initialize(void)
 
   /** Initialize the I2C */
   BSP_I2C_Init(&RTC.I2C);
+  I2CQ_Init(AMBIQ_RTC_I2C_QUEUE);
 
   /** Initialize the IRQ Lines */
   BSP_GPIO_Init(&RTC.nIRQ1.pin);
@@ -97,18 +103,18 @@ void AM08X5_SetIRQ(void)
   /** Set the oscillator */
   if (AM08X5_osc_sel(0) == AM08X5_FAIL)
   {
-    Error(ERROR_MSG_00202000, LOG_Priority_High);
+    Error(ERROR_MSG_00202000, 0);
   }
 
   /** Apply the offset */
   if (AM08X5_OffsetCalculation(RTC.cal.freq) == AM08X5_FAIL)
   {
-    Error(ERROR_MSG_00202001, LOG_Priority_High);
+    Error(ERROR_MSG_00202001, 0);
   }
 
   if (AM08X5_ConfigSquareWave(2, AMBIQ_RTC_SQW_SETTING) == AM08X5_FAIL)
   {
-    Error(ERROR_MSG_00202002, LOG_Priority_High);
+    Error(ERROR_MSG_00202002, 0);
   }
 
   /** Set IRQ Pins */
@@ -139,6 +145,11 @@ void AM08X5_GetTime(sTimeReg_t *t)
   *t = RTC.time.time;
 }
 
+uint32_t AM08X5_GetEpoch(void)
+{
+  return (uint32_t)AM08X5_calculate_epoch(&RTC.time.time);
+}
+
 void AM08X5_GetTimestamp_ISO8601(char *str)
 {
   /** Read the time */
@@ -151,18 +162,78 @@ void AM08X5_GetTimestamp_ISO8601(char *str)
           RTC.time.time.second);
 }
 
+eAM08X5Status_t AM08X5_GetTime_Start(void)
+{
+  sI2CQXfer_t xfer = {.addr = RTC.I2C.slaveAddress >> 1,
+                      .tx = &AM08X5_TimeAddr,
+                      .txLen = 1,
+                      .rx = AM08X5_TimeRegs,
+                      .rxLen = AM08X5_TIME_REG_CNT,
+                      .done = I2CQ_Done,
+                      .ctx = &AM08X5_TimeDone};
+
+  /** Already on its way */
+  if (true == AM08X5_TimeDone.busy)
+  {
+    return AM08X5_OK;
+  }
+
+  AM08X5_TimeDone.busy = true;
+  AM08X5_TimeDone.result = I2CQ_PENDING;
+  if (I2CQ_OK != I2CQ_Submit(AMBIQ_RTC_I2C_QUEUE, &xfer))
+  {
+    AM08X5_TimeDone.busy = false;
+    return AM08X5_FAIL;
+  }
+
+  return AM08X5_OK;
+}
+
+eAM08X5Status_t AM08X5_GetTime_Finish(sTimeReg_t *t)
+{
+  eAM08X5Status_t result = AM08X5_FAIL;
+
+  if (I2CQ_DONE == I2CQ_Wait(AMBIQ_RTC_I2C_QUEUE, &AM08X5_TimeDone))
+  {
+    AM08X5_decode_time(AM08X5_TimeRegs);
+    result = AM08X5_OK;
+  }
+  else
+  {
+    /** Not queued, NACK'd or timed out.  Read it the slow way */
+    I2CQ_Flush(AMBIQ_RTC_I2C_QUEUE);
+    if (AM08X5_TimeDone.result != I2CQ_PENDING)
+    {
+      Error(ERROR_MSG_00200800, AM08X5_TimeDone.result);
+      BSP_I2C_Fault(&RTC.I2C, I2CQ_Fault(AM08X5_TimeDone.result));
+    }
+    AM08X5_get_time();
+  }
+
+  AM08X5_TimeDone.busy = false;
+  AM08X5_TimeDone.result = I2CQ_PENDING;
+
+  *t = RTC.time.time;
+  return result;
+}
+
 void AM08X5_GetTimestamp_ISO8601_w_hundredths(char *str)
 {
   /** Read the time */
   AM08X5_get_time();
 
-  sprintf(str, "20%02u-%02u-%02uT%02u:%02u:%02u.%01uZ", RTC.time.time.year,
-          RTC.time.time.month,
-          RTC.time.time.date,
-          RTC.time.time.hour,
-          RTC.time.time.minute,
-          RTC.time.time.second,
-          RTC.time.time.hundredth / 10);
+  AM08X5_Format_ISO8601_w_hundredths(&RTC.time.time, str);
+}
+
+void AM08X5_Format_ISO8601_w_hundredths(sTimeReg_t *t, char *str)
+{
+  sprintf(str, "20%02u-%02u-%02uT%02u:%02u:%02u.%01uZ", t->year,
+          t->month,
+          t->date,
+          t->hour,
+          t->minute,
+          t->second,
+          t->hundredth / 10);
 }
 
 void AM08X5_GetTimestamp(char *str, AM08X5_Datestamp_t ds, AM08X5_Timestamp_t ts)
@@ -391,7 +462,7 @@ eAM08X5Status_t AM08X5_OffsetCalculation(float frequency)
   /* Set Oscillator Selection to 1 (RC on power off) */
   if (AM08X5_osc_sel(0) == AM08X5_FAIL)
   {
-    Error(ERROR_MSG_00202000, LOG_Priority_High);
+    Error(ERROR_MSG_00202000, 0);
   }
 
   /* Write Oscillator Status Control Register (0x1D) */
@@ -500,13 +571,13 @@ void AM08X5_CrystalCal_Set(void)
   /** Turn Square Wave off on Pin FOUT/nIRQ1 */
   if (AM08X5_ConfigSquareWave(AM08X5_SQW_OUT_OFF, SQFS_CENTURY) == AM08X5_FAIL)
   {
-    Error(ERROR_MSG_00202002, LOG_Priority_High);
+    Error(ERROR_MSG_00202002, 0);
   }
 
   /** Configure 32.768kHz Square Wave on Pin FOUT/nIRQ1 */
   if (AM08X5_ConfigSquareWave(AM08X5_CRYSTAL_CONFIG_PIN, SQFS_32768) == AM08X5_FAIL)
   {
-    Error(ERROR_MSG_00202002, LOG_Priority_High);
+    Error(ERROR_MSG_00202002, 0);
   }
 }
 
@@ -514,7 +585,7 @@ void AM08X5_CrystalCal_Clear(void)
 {
   if (AM08X5_ConfigSquareWave(AM08X5_SQW_OUT_OFF, SQFS_CENTURY) == AM08X5_FAIL)
   {
-    Error(ERROR_MSG_00202002, LOG_Priority_High);
+    Error(ERROR_MSG_00202002, 0);
   }
 }
 
@@ -583,12 +654,12 @@ void AM08X5_AlarmSet_Next(sAM08X5Alarm_t *t)
       }
       else
       {
-        Error(ERROR_MSG_00200002, LOG_Priority_Low);
+        Error(ERROR_MSG_00200002, 0);
       }
     }
     else
     {
-      Error(ERROR_MSG_00200004, LOG_Priority_Low);
+      Error(ERROR_MSG_00200004, 0);
     }
     t->repeatCycles--;
   }
@@ -839,7 +910,7 @@ eAM08X5Status_t AM08X5_add_time_struct(sTimeReg_t *t1, sTimeReg_t *t2, sTimeReg_
       }
       break;
     default:
-      Error(ERROR_MSG_00200010, LOG_Priority_Med);
+      Error(ERROR_MSG_00200010, 0);
       break;
     }
     temp = t3->month / 13;
@@ -1132,7 +1203,7 @@ STATIC eAM08X5Status_t AM08X5_ConfigSquareWave(uint8_t pin, eAM08X5_SQFS_t sqfs)
   else
   {
     /** Error */
-    Error(ERROR_MSG_00200020, LOG_Priority_Med);
+    Error(ERROR_MSG_00200020, 0);
   }
 
   /** Write the SQW Register */
@@ -1223,16 +1294,16 @@ STATIC void AM08X5_BurstWrite(uint8_t addr, uint8_t *data, uint8_t length)
   }
 
   /** Check length isn't too long */
-  if (BUFFER_8_SIZE < length)
+  if (BSP_BUS_BUFFER_LENGTH < length)
   {
     /** Report size error */
-    Error(ERROR_MSG_00200080, LOG_Priority_Med);
+    Error(ERROR_MSG_00200080, 0);
   }
   /** Transfer address and data to structure */
   if (BSP_I2C_SendData(&RTC.I2C, addr, data, length) != BSP_OK)
   {
     /** Report send error */
-    Error(ERROR_MSG_00200400, LOG_Priority_Med);
+    Error(ERROR_MSG_00200400, 0);
   }
 }
 
@@ -1375,27 +1446,44 @@ eAM08X5Status_t AM08X5_osc_sel(uint8_t osc)
  */
 void AM08X5_get_time(void)
 {
-  uint8_t temp_buff[8];
-  uint8_t addr = HUNDREDTHS_REG;
-  uint8_t i;
-  for (i = 0; i < 8; i++)
+  uint8_t regs[AM08X5_TIME_REG_CNT];
+  uint8_t addr;
+
+  for (addr = HUNDREDTHS_REG; addr < ALARM_HUNDRS_REG; addr++)
   {
-    temp_buff[i] = AM08X5_ReadReg(addr++);
+    regs[addr] = AM08X5_ReadReg_BCD(addr);
   }
+  regs[CONTROL_1_REG] = AM08X5_ReadReg_BCD(CONTROL_1_REG);
+  regs[STATUS_REG] = AM08X5_ReadReg_BCD(STATUS_REG);
+
+  AM08X5_decode_time(regs);
+
+  return;
+}
 
+/** @brief Decode Time Registers
+ *
+ *  Populate the RTC struct from the raw registers, indexed by register
+ *  address from HUNDREDTHS_REG through CONTROL_1_REG.
+ *
+ *  @param *regs Raw register values
+ *
+ *  @return None
+ */
+STATIC void AM08X5_decode_time(uint8_t *regs)
+{
   /** Convert the time registers */
-  RTC.time.time.hundredth = temp_buff[0];
-  RTC.time.time.second = temp_buff[1];
-  RTC.time.time.minute = temp_buff[2];
-  RTC.time.time.hour = temp_buff[3];
-  RTC.time.time.date = temp_buff[4];
-  RTC.time.time.month = temp_buff[5];
-  RTC.time.time.year = temp_buff[6];
-  RTC.time.time.weekday = temp_buff[7];
+  RTC.time.time.hundredth = bcd2dec(regs[0]);
+  RTC.time.time.second = bcd2dec(regs[1]);
+  RTC.time.time.minute = bcd2dec(regs[2]);
+  RTC.time.time.hour = bcd2dec(regs[3]);
+  RTC.time.time.date = bcd2dec(regs[4]);
+  RTC.time.time.month = bcd2dec(regs[5]);
+  RTC.time.time.year = bcd2dec(regs[6]);
+  RTC.time.time.weekday = bcd2dec(regs[7]);
 
   /** Get the current hours format mode 12:24. */
-  temp_buff[0] = AM08X5_ReadReg(CONTROL_1_REG);
-  if ((temp_buff[0] & 0x40) == 0)
+  if ((regs[CONTROL_1_REG] & 0x40) == 0)
   {
     /* 24-hour mode */
     RTC.time.time.mode = 2;
@@ -1414,8 +1502,7 @@ void AM08X5_get_time(void)
   }
 
   /* Get the century bit. */
-  temp_buff[0] = AM08X5_ReadReg(STATUS_REG);
-  RTC.time.time.century = (temp_buff[0] & 0x80) ? 1 : 0;
+  RTC.time.time.century = (regs[STATUS_REG] & 0x80) ? 1 : 0;
 
   return;
 }
@@ -1683,7 +1770,7 @@ STATIC eAM08X5Status_t AM08X5_set_alarm(sTimeReg_t *t, uint8_t repeat, uint8_t i
   }
   else
   {
-    Error(ERROR_MSG_00200040, LOG_Priority_Med);
+    Error(ERROR_MSG_00200040, 0);
   }
 
   /** Set the Alarm Registers */
@@ -1732,7 +1819,7 @@ STATIC time_t AM08X5_calculate_epoch(sTimeReg_t *t)
 
   te.tm_year = t->year + 2000;
   te.tm_year -= 1900;
-  te.tm_mon = t->month;
+  te.tm_mon = t->month - 1;
   te.tm_mday = t->date;
   te.tm_hour = t->hour;
   te.tm_min = t->minute;
@@ -53,13 +53,14 @@
 #include "sysconfig.h"
 #include "logging.h"
 #include "errorlist.h"
-#include "buffer8.h"
+#include "i2cq.h"
 /************************************************************************
  *							MACROS
  ************************************************************************/
 /** AM08X5 Specific Settings */
 #define AM08X5_TIMEOUT (SYSTEM_RTC_TIMEOUT_MS)
 #define AM08X5_REGISTER_LENGTH (255)
+#define AM08X5_TIME_REG_CNT (CONTROL_1_REG + 1) /**< Hundredths through Control 1 */
 
 /** Registers in RTC */
 #define HUNDREDTHS_REG (0x00)
@@ -326,6 +327,39 @@ void AM08X5_GetRegisterValue(uint8_t reg, char *temp);
  */
 void AM08X5_GetTime(sTimeReg_t *t);
 
+/** @brief Start Time Read
+ *
+ * Queue a burst read of the time, status and control registers on the
+ * RTC I2C queue and return.  Collect it with AM08X5_GetTime_Finish.
+ *
+ * @param None
+ *
+ * @return result
+ */
+eAM08X5Status_t AM08X5_GetTime_Start(void);
+
+/** @brief Finish Time Read
+ *
+ * Wait for the read queued by AM08X5_GetTime_Start and decode it.  If it
+ * was not queued or failed, the time is read directly instead.
+ *
+ * @param *t Pointer to time struct
+ *
+ * @return AM08X5_OK if the queued read was used
+ */
+eAM08X5Status_t AM08X5_GetTime_Finish(sTimeReg_t *t);
+
+/** @brief Get Last Epoch
+ *
+ * Epoch of the last time read from the RTC.  No bus access, so it is
+ * safe on error paths, including RTC bus errors.
+ *
+ * @param None
+ *
+ * @return Epoch time (seconds)
+ */
+uint32_t AM08X5_GetEpoch(void);
+
 /** @brief Get Timestamp in ISO8601 Format
  *
  * Get the current timestamp in ISO8601 format.
@@ -348,6 +382,17 @@ void AM08X5_GetTimestamp_ISO8601(char *str);
  */
 void AM08X5_GetTimestamp_ISO8601_w_hundredths(char *str);
 
+/** @brief Format Timestamp in ISO8601 Format w/hundredths of seconds
+ *
+ * Same as AM08X5_GetTimestamp_ISO8601_w_hundredths for a time already read.
+ *
+ * @param *t Pointer to time struct
+ * @param *str Pointer to the timestamp string to write to
+ *
+ * @return None
+ */
+void AM08X5_Format_ISO8601_w_hundredths(sTimeReg_t *t, char *str);
+
 /** @brief Get Timestamp
  *
  * Get the current timestamp
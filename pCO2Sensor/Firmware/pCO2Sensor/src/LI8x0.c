@@ -21,7 +21,16 @@
  ************************************************************************/
 
 STATIC PERSISTENT char LicorBuffer[LICOR_BUFFER_LEN];
-STATIC char LicorSubstr[256];
+STATIC PERSISTENT char LicorSubstr[LICOR_SUBSTR_LEN];
+STATIC PERSISTENT char LicorCfgMsg[LICOR_CFG_MSG_LEN];
+
+/** Streaming frames, filled by the Licor UART ISR */
+RINGBUF_DECLARE(LicorFrames, sLicorFrame_t, LICOR_FRAME_CNT)
+STATIC PERSISTENT sLicorFrames_t LicorFrames;
+STATIC PERSISTENT sLicorFrame_t LicorFrame;
+STATIC volatile uint16_t LicorFramePos = 0;
+STATIC volatile bool LicorFrameDrop = false;
+STATIC volatile sLicorStreamStats_t LicorStreamStats;
 
 PERSISTENT sLicor_t Licor1;
 PERSISTENT sLicor_t *pLicor1 = &Licor1;
@@ -48,6 +57,54 @@ STATIC PERSISTENT sLicor_t Licor1 = {
     .type = LICOR_LI820,
 };
 
+/** Settings LI8x0_Config keeps the Licor at */
+STATIC const sLicorTags_t LicorCfgDesired = {
+    .rs232 = {.co2 = true,
+              .co2abs = false,
+              .h2o = true,
+              .h2oabs = false,
+              .celltemp = true,
+              .cellpres = true,
+              .ivolt = true,
+              .echo = false,
+              .strip = false,
+              .flowrate = false,
+              .raw = {.co2 = true, .co2ref = true, .h2o = true, .h2oref = true}},
+    .cfg = {.outrate = 0.0f,
+            .heater = false,
+            .pcomp = true,
+            .filter = 0,
+            .bench = 14,
+            .span = 0,
+            .alarms = {.enabled = false}},
+};
+
+/** Tags LI8x0_Config checks, grouped by level 2 */
+STATIC const sLicorCfgTag_t LicorCfgTags[] = {
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_FLOWRATE, LICOR_XML_LVL4_NONE, LICOR_CFG_FLOW, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_CO2, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_CELLTEMP, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_CELLPRES, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_IVOLT, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_CO2ABS, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_ECHO, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_STRIP, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_H2O, LICOR_XML_LVL4_NONE, LICOR_CFG_H2O, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_H2OABS, LICOR_XML_LVL4_NONE, LICOR_CFG_H2O, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_RAW, LICOR_XML_LVL4_H2O, LICOR_CFG_H2O, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_RAW, LICOR_XML_LVL4_H2OREF, LICOR_CFG_H2O, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_RS232, LICOR_XML_LVL3_RAW, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_CFG, LICOR_XML_LVL3_OUTRATE, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_FLOAT},
+    {LICOR_XML_LVL2_CFG, LICOR_XML_LVL3_HEATER, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_CFG, LICOR_XML_LVL3_PCOMP, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+    {LICOR_XML_LVL2_CFG, LICOR_XML_LVL3_FILTER, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_UINT},
+    {LICOR_XML_LVL2_CFG, LICOR_XML_LVL3_BENCH, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_UINT},
+    {LICOR_XML_LVL2_CFG, LICOR_XML_LVL3_SPAN, LICOR_XML_LVL4_NONE, LICOR_CFG_ALL, LICOR_CFG_UINT},
+    {LICOR_XML_LVL2_CFG, LICOR_XML_LVL3_ALARMS, LICOR_XML_LVL4_ENABLED, LICOR_CFG_ALL, LICOR_CFG_BOOL},
+};
+
+#define LICOR_CFG_TAG_CNT (sizeof(LicorCfgTags) / sizeof(LicorCfgTags[0]))
+
 /************************************************************************
  *					   Static Functions Prototypes
  ************************************************************************/
@@ -99,6 +156,11 @@ STATIC eLicorStatus_t LI8X0_Read(char *sendstr, uint16_t mstimeout);
 STATIC void add_bool_to_string(char *sstr, bool val);
 STATIC uint16_t add_cr_lf_and_tab_to_string(char *sstr, uint8_t numCrLf, uint8_t numTabs);
 STATIC eLicorStatus_t LI8x0_WaitForACK(char *sstr);
+STATIC void LI8x0_CopySubstr(const char *src, uint32_t len);
+STATIC float LI8x0_CfgGet(const sLicorTags_t *tags, const sLicorCfgTag_t *tag);
+STATIC void LI8x0_CfgSet(sLicorTags_t *tags, const sLicorCfgTag_t *tag, float val);
+STATIC uint16_t LI8x0_CreateString_Config(char *msg, const bool *send);
+STATIC eLicorStatus_t LI8x0_SetOutrate(float period);
 
 /************************************************************************
  *					         Functions
@@ -189,217 +251,66 @@ void LI8x0_CreateAndSendString(sLicorXML_t *pXML, char *setval, uint16_t svlen)
 eLicorStatus_t LI8x0_Config(void)
 {
     eLicorStatus_t result = LICOR_FAIL;
-    eLicorStatus_t t_result = LICOR_FAIL;
     char sstr[80];
+    bool send[LICOR_CFG_TAG_CNT];
+    bool force = false;
+    uint8_t type = (uint8_t)(1u << Licor1.type);
+    uint16_t cnt = 0;
+    uint16_t len;
+    uint16_t i;
+    float want;
 
     Log("LICOR Config Start", LOG_Priority_High);
-    sLicorXML_t XML = {.LVL1 = (eLicorXMLLvl1_t)Licor1.type};
-    sLicorXML_t *pXML = &XML;
 
-    /** SHUT THE OUTRATE OFF FIRST */
-    /* outrate = 0 */
-    XML.LVL2 = LICOR_XML_LVL2_CFG;
-    XML.LVL3 = LICOR_XML_LVL3_OUTRATE;
-    LI8x0_CreateAndSendString(pXML, "0.0", 3);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
+    /** Read all current settings in one query */
+    if (LICOR_OK != LI8x0_GetInfo())
     {
-        return result;
+        Log("LICOR Config Query Failed, Sending All", LOG_Priority_High);
+        force = true;
     }
 
-    /* **** RS232 **** */
-    XML.LVL2 = LICOR_XML_LVL2_RS232;
-    XML.LVL4 = LICOR_XML_LVL4_NONE;
-
-    /* FlowRate = Off */
-    if ((LICOR_LI830 == Licor1.type) || (LICOR_LI850 == Licor1.type))
+    /** Only send the tags that differ */
+    for (i = 0; i < LICOR_CFG_TAG_CNT; i++)
     {
-        XML.LVL3 = LICOR_XML_LVL3_FLOWRATE;
-        LI8x0_CreateAndSendString(pXML, "FALSE", 5);
-        t_result = LI8x0_WaitForACK(sstr);
-        if (LICOR_FAIL == t_result)
+        send[i] = false;
+        if (LicorCfgTags[i].types & type)
         {
-            return result;
+            want = LI8x0_CfgGet(&LicorCfgDesired, &LicorCfgTags[i]);
+            if ((true == force) ||
+                (fabsf(want - LI8x0_CfgGet(&pLicor1->readconfig, &LicorCfgTags[i])) > 0.01f))
+            {
+                send[i] = true;
+                cnt++;
+            }
         }
     }
 
-    /* Co2 = On */
-    XML.LVL3 = LICOR_XML_LVL3_CO2;
-    LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
-    {
-        return result;
-    }
-    /* celltemp = On */
-    XML.LVL3 = LICOR_XML_LVL3_CELLTEMP;
-    LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
-    {
-        return result;
-    }
-
-    /* cellpres = On */
-    XML.LVL3 = LICOR_XML_LVL3_CELLPRES;
-    LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
-    {
-        return result;
-    }
-
-    /* ivolt = On */
-    XML.LVL3 = LICOR_XML_LVL3_IVOLT;
-    LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
-    {
-        return result;
-    }
-
-    /* co2abs = On */
-    XML.LVL3 = LICOR_XML_LVL3_CO2ABS;
-    LI8x0_CreateAndSendString(pXML, "FALSE", 5);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
+    if (cnt == 0)
     {
-        return result;
-    }
-
-    /* echo = Off */
-    XML.LVL3 = LICOR_XML_LVL3_ECHO;
-    LI8x0_CreateAndSendString(pXML, "FALSE", 5);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
-    {
-        return result;
+        Log("LICOR Config Unchanged", LOG_Priority_High);
+        return LICOR_OK;
     }
 
-    /* strip = Off */
-    XML.LVL3 = LICOR_XML_LVL3_STRIP;
-    LI8x0_CreateAndSendString(pXML, "FALSE", 4);
-    t_result = LI8x0_WaitForACK(sstr);
-    if (LICOR_FAIL == t_result)
+    /** All changes in one message, one ACK */
+    len = LI8x0_CreateString_Config(LicorCfgMsg, send);
+    LI8x0_ReadPrep();
+    BSP_UART_puts(&pLicor1->UART, LicorCfgMsg, len);
+    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
     {
         return result;
     }
 
-    /* h2o = Ignored if LI820 or LI830 */
-    if ((LICOR_LI840 == Licor1.type) || (LICOR_LI850 == Licor1.type))
-    {
-        /* h2oabs = On */
-        XML.LVL3 = LICOR_XML_LVL3_H2O;
-        LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-        t_result = LI8x0_WaitForACK(sstr);
-        if (LICOR_FAIL == t_result)
-        {
-            return result;
-        }
-        /* h2oabs = Off */
-        XML.LVL3 = LICOR_XML_LVL3_CO2ABS;
-        LI8x0_CreateAndSendString(pXML, "FALSE", 5);
-        t_result = LI8x0_WaitForACK(sstr);
-        if (LICOR_FAIL == t_result)
-        {
-            return result;
-        }
-        /* raw_h20 = On */
-        XML.LVL3 = LICOR_XML_LVL3_RAW;
-        XML.LVL4 = LICOR_XML_LVL4_H2O;
-        LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-        t_result = LI8x0_WaitForACK(sstr);
-        if (LICOR_FAIL == t_result)
-        {
-            return result;
-        }
-        /* raw_h20ref = On */
-        XML.LVL4 = LICOR_XML_LVL4_H2O;
-        LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-        t_result = LI8x0_WaitForACK(sstr);
-        if (LICOR_FAIL == t_result)
-        {
-            return result;
-        }
-    }
-
-    /* raw_co2 = On */
-    XML.LVL3 = LICOR_XML_LVL3_RAW;
-    XML.LVL4 = LICOR_XML_LVL4_NONE;
-    if ((Licor1.type == LICOR_LI830) || (Licor1.type == LICOR_LI850))
-    {
-        LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-        t_result = LI8x0_WaitForACK(sstr);
-        if (LICOR_FAIL == t_result)
-        {
-            return result;
-        }
-    }
-    else
+    /** Licor now matches for the tags sent */
+    for (i = 0; i < LICOR_CFG_TAG_CNT; i++)
     {
-        LI8x0_CreateAndSendString(pXML, "TRUE", 4);
-        t_result = LI8x0_WaitForACK(sstr);
-        if (LICOR_FAIL == t_result)
+        if (true == send[i])
         {
-            return result;
+            want = LI8x0_CfgGet(&LicorCfgDesired, &LicorCfgTags[i]);
+            LI8x0_CfgSet(&pLicor1->readconfig, &LicorCfgTags[i], want);
+            LI8x0_CfgSet(&pLicor1->sysconfig, &LicorCfgTags[i], want);
         }
     }
 
-    /* **** CFG **** */
-    XML.LVL2 = LICOR_XML_LVL2_CFG;
-    XML.LVL4 = LICOR_XML_LVL4_NONE;
-
-    /* heater = Off */
-    XML.LVL3 = LICOR_XML_LVL3_HEATER;
-    LI8x0_CreateAndSendString(pXML, "FALSE", 5);
-    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
-    {
-        return result;
-    }
-    /* pcomp = On */
-    XML.LVL3 = LICOR_XML_LVL3_PCOMP;
-    LI8x0_CreateAndSendString(pXML, "True", 4);
-    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
-    {
-        return result;
-    }
-    /* filter = 0 */
-    XML.LVL3 = LICOR_XML_LVL3_FILTER;
-    LI8x0_CreateAndSendString(pXML, "0.0", 3);
-    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
-    {
-        return result;
-    }
-    /* outrate = 0 */
-    XML.LVL3 = LICOR_XML_LVL3_OUTRATE;
-    LI8x0_CreateAndSendString(pXML, "0.0", 3);
-    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
-    {
-        return result;
-    }
-    /* bench = 14 */
-    XML.LVL3 = LICOR_XML_LVL3_BENCH;
-    LI8x0_CreateAndSendString(pXML, "14", 2);
-    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
-    {
-        return result;
-    }
-    /* span = SPAN */
-    XML.LVL3 = LICOR_XML_LVL3_SPAN;
-    LI8x0_CreateAndSendString(pXML, "0.0", 3);
-    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
-    {
-        return result;
-    }
-    /* alarm_enabled = Off */
-    XML.LVL3 = LICOR_XML_LVL3_ALARMS;
-    XML.LVL4 = LICOR_XML_LVL4_ENABLED;
-    LI8x0_CreateAndSendString(pXML, "FALSE", 5);
-    if (LICOR_FAIL == LI8x0_WaitForACK(sstr))
-    {
-        return result;
-    }
-
     Log("LICOR Config Complete", LOG_Priority_High);
     result = LICOR_OK;
     return result;
@@ -732,6 +643,7 @@ eLicorStatus_t LI8x0_Sample_Read(sLicorData_t *data)
                        .LVL4 = LICOR_XML_LVL4_NONE};
     sLicorXML_t *pXML = &XML;
     uint32_t i;
+    eBSPClkProfile_t clk = BSP_Clock_GetProfile();
 
     /** Wait for response */
     i = 2000000;
@@ -740,6 +652,8 @@ eLicorStatus_t LI8x0_Sample_Read(sLicorData_t *data)
         _delay_us(1);
     } while ((i-- > 0) && (LicorRxFlag != true));
 
+    /** Only the parse runs at full speed */
+    BSP_Clock_SetProfile(BSP_CLK_FULL);
     if (LI8x0_IsAck(pXML, (char *)LicorRxBuffer, strlen((char *)LicorRxBuffer)) == LICOR_OK)
     {
         /** Read Response */
@@ -752,9 +666,158 @@ eLicorStatus_t LI8x0_Sample_Read(sLicorData_t *data)
             }
         }
     }
+    BSP_Clock_SetProfile(clk);
     return result;
 }
 
+eLicorStatus_t LI8x0_Stream_Start(float period)
+{
+    eLicorStatus_t result = LICOR_FAIL;
+
+    LicorStreamActive = false;
+    if (LICOR_OK != LI8x0_SetOutrate(period))
+    {
+        Log("LICOR Stream Start Failed", LOG_Priority_High);
+        return result;
+    }
+
+    /** ISR is idle on the ring until LicorStreamActive is set */
+    LicorFrames_Clear(&LicorFrames);
+    LicorFramePos = 0;
+    LicorFrameDrop = false;
+    memset((void *)&LicorStreamStats, 0, sizeof(LicorStreamStats));
+    LicorStreamActive = true;
+
+    Log("LICOR Stream Start", LOG_Priority_Med);
+    result = LICOR_OK;
+    return result;
+}
+
+eLicorStatus_t LI8x0_Stream_Stop(void)
+{
+    eLicorStatus_t result = LICOR_FAIL;
+    char sstr[80];
+
+    LicorStreamActive = false;
+    if (LICOR_OK == LI8x0_SetOutrate(0.0f))
+    {
+        result = LICOR_OK;
+    }
+    else
+    {
+        Log("LICOR Stream Stop Failed", LOG_Priority_High);
+    }
+
+    sprintf(sstr, "LICOR Stream %u frames, %u read, %u skipped, %u overrun",
+            LicorStreamStats.frames, LicorStreamStats.read,
+            LicorStreamStats.skipped, LicorStreamStats.overrun);
+    Log(sstr, LOG_Priority_Med);
+
+    return result;
+}
+
+bool LI8x0_Stream_RxChar(char c)
+{
+    uint16_t w = LicorFrames.write;
+    volatile sLicorFrame_t *slot = &LicorFrames.buffer[w & (LICOR_FRAME_CNT - 1u)];
+    bool published = false;
+
+    if (c == '\r')
+    {
+        return published;
+    }
+
+    /** A frame is only started in a free slot */
+    if ((LicorFramePos == 0) && (false == LicorFrameDrop) && (LicorFrames_Free(&LicorFrames) == 0))
+    {
+        LicorFrameDrop = true;
+    }
+
+    if (c == '\n')
+    {
+        if (true == LicorFrameDrop)
+        {
+            LicorStreamStats.overrun++;
+        }
+        else if (LicorFramePos > 0)
+        {
+            slot->str[LicorFramePos] = 0;
+            slot->len = LicorFramePos;
+            slot->seq = ++LicorStreamStats.frames;
+            RINGBUF_BARRIER();
+            LicorFrames.write = (uint16_t)(w + 1u);
+            published = true;
+        }
+        LicorFramePos = 0;
+        LicorFrameDrop = false;
+        return published;
+    }
+
+    if (false == LicorFrameDrop)
+    {
+        if (LicorFramePos < (LICOR_FRAME_LEN - 1))
+        {
+            slot->str[LicorFramePos++] = c;
+        }
+        else
+        {
+            LicorFrameDrop = true;
+        }
+    }
+
+    return published;
+}
+
+eLicorStatus_t LI8x0_Stream_Read(sLicorData_t *data)
+{
+    eLicorStatus_t result = LICOR_FAIL;
+    const char str_data[] = "DATA";
+    uint32_t sIdx = 0;
+    uint32_t eIdx = 0;
+    uint16_t cnt = 0;
+    uint16_t i;
+    eBSPClkProfile_t clk;
+
+    /** Keep only the newest frame */
+    while (true == LicorFrames_Get(&LicorFrames, &LicorFrame))
+    {
+        cnt++;
+    }
+    if (cnt == 0)
+    {
+        return result;
+    }
+    LicorStreamStats.skipped += cnt - 1;
+
+    /** Only the parse runs at full speed */
+    clk = BSP_Clock_GetProfile();
+    BSP_Clock_SetProfile(BSP_CLK_FULL);
+    for (i = 0; i < LicorFrame.len; i++)
+    {
+        LicorFrame.str[i] = toupper(LicorFrame.str[i]);
+    }
+
+    if (LI8X0_FindSubstring(LicorFrame.str, (char *)str_data, strlen(str_data), &sIdx, &eIdx) == LICOR_OK)
+    {
+        LI8x0_CopySubstr(&LicorFrame.str[sIdx], (eIdx - sIdx));
+        if (LI8x0_ParseData(LicorSubstr, strlen(LicorSubstr), &pLicor1->sysconfig) == LICOR_OK)
+        {
+            *data = Licor1.sysconfig.data;
+            LicorStreamStats.read++;
+            LicorStreamStats.lastSeq = LicorFrame.seq;
+            result = LICOR_OK;
+        }
+    }
+    BSP_Clock_SetProfile(clk);
+
+    return result;
+}
+
+void LI8x0_Stream_GetStats(sLicorStreamStats_t *stats)
+{
+    *stats = LicorStreamStats;
+}
+
 void LI8x0_Clear_Data(sLicorData_t *data)
 {
     data->cellpres = NAN;
@@ -2113,7 +2176,7 @@ STATIC eLicorStatus_t LI8x0_ValidateXML(sLicorXML_t *XML)
 
         if (LI8x0_Validate_NoH2O(XML) != LICOR_OK)
         {
-            Error(ERROR_MSG_00800800, LOG_Priority_Med);
+            Error(ERROR_MSG_00800800, 0);
             return result;
         }
     }
@@ -2124,7 +2187,7 @@ STATIC eLicorStatus_t LI8x0_ValidateXML(sLicorXML_t *XML)
     }
     else
     {
-        Error(ERROR_MSG_00800080, LOG_Priority_Med);
+        Error(ERROR_MSG_00800080, 0);
     }
 #endif
 
@@ -2152,12 +2215,12 @@ STATIC eLicorStatus_t LI8x0_ValidateXML(sLicorXML_t *XML)
         }
         else
         {
-            Error(ERROR_MSG_00800020, LOG_Priority_Med);
+            Error(ERROR_MSG_00800020, 0);
             result = LICOR_FAIL;
         }
         break;
     default:
-        Error(ERROR_MSG_00800002, LOG_Priority_Med);
+        Error(ERROR_MSG_00800002, 0);
         break;
     }
 
@@ -2412,7 +2475,7 @@ STATIC eLicorStatus_t LI8x0_ValidXML_Level2(sLicorXML_t *XML)
         printf("\nLevel 2: %s", ERROR_MSG_00800080);
 #endif
 #endif
-        Error(ERROR_MSG_00800080, LOG_Priority_Med);
+        Error(ERROR_MSG_00800080, 0);
     }
 
     return result;
@@ -2654,7 +2717,7 @@ STATIC eLicorStatus_t LI8x0_ValidXML_Level3(sLicorXML_t *XML)
         printf("\nLevel 3: %s", ERROR_MSG_00800200);
 #endif
 #endif
-        Error(ERROR_MSG_00800200, LOG_Priority_Med);
+        Error(ERROR_MSG_00800200, 0);
     }
 
     return result;
@@ -2699,7 +2762,7 @@ STATIC eLicorStatus_t LI8x0_Level1Str(eLicorXMLLvl1_t LVL,
     case LICOR_XML_LVL1_NONE:
         break;
     default:
-        Error(ERROR_MSG_00800002, LOG_Priority_Med);
+        Error(ERROR_MSG_00800002, 0);
         result = LICOR_FAIL;
         break;
     }
@@ -2789,7 +2852,7 @@ STATIC eLicorStatus_t LI8x0_Level2Str(eLicorXMLLvl2_t LVL,
         strcpy(temp, "ERROR>");
         break;
     default:
-        Error(ERROR_MSG_00800004, LOG_Priority_Med);
+        Error(ERROR_MSG_00800004, 0);
         result = LICOR_FAIL;
         break;
     }
@@ -3004,7 +3067,7 @@ STATIC eLicorStatus_t LI8x0_Level3Str(eLicorXMLLvl3_t LVL,
         break;
 
     default:
-        Error(ERROR_MSG_00800008, LOG_Priority_Med);
+        Error(ERROR_MSG_00800008, 0);
         result = LICOR_FAIL;
         break;
     }
@@ -3160,7 +3223,7 @@ STATIC eLicorStatus_t LI8x0_Level4Str(eLicorXMLLvl4_t LVL,
         strcpy(temp, "VOLTAGE>");
         break;
     default:
-        Error(ERROR_MSG_00800010, LOG_Priority_Med);
+        Error(ERROR_MSG_00800010, 0);
         result = LICOR_FAIL;
         break;
     }
@@ -3293,63 +3356,63 @@ STATIC eLicorStatus_t LI8x0_ParseString(char *str, uint16_t slen, sLicorTags_t *
     /** Search for Data */
     if (LI8X0_FindSubstring(str, (char *)str_data, strlen(str_data), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParseData(LicorSubstr, strlen(str_data), tags);
     }
 
     /** Search for Auxdata */
     if (LI8X0_FindSubstring(str, (char *)str_auxdata, strlen(str_auxdata), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParseAuxdata(LicorSubstr, strlen(str_auxdata), tags);
     }
 
     /** Search for RS232 */
     if (LI8X0_FindSubstring(str, (char *)str_rs232, strlen(str_rs232), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParseRS232(LicorSubstr, strlen(str_rs232), tags);
     }
 
     /** Search for CFG */
     if (LI8X0_FindSubstring(str, (char *)str_cfg, strlen(str_cfg), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParseCFG(LicorSubstr, strlen(str_cfg), tags);
     }
 
     /** Search for CAL */
     if (LI8X0_FindSubstring(str, (char *)str_cal, strlen(str_cal), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParseCal(LicorSubstr, strlen(str_cal), tags);
     }
 
     /** Search for POLY */
     if (LI8X0_FindSubstring(str, (char *)str_poly, strlen(str_poly), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParsePoly(LicorSubstr, strlen(str_poly), tags);
     }
 
     /** Search for PUMP */
     if (LI8X0_FindSubstring(str, (char *)str_pump, strlen(str_pump), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParsePump(LicorSubstr, strlen(str_pump), tags);
     }
 
     /** Search for SOURCE */
     if (LI8X0_FindSubstring(str, (char *)str_source, strlen(str_source), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParseSource(LicorSubstr, strlen(str_source), tags);
     }
 
     /** Search for TECH */
     if (LI8X0_FindSubstring(str, (char *)str_tech, strlen(str_tech), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         LI8x0_ParseTech(LicorSubstr, strlen(str_tech), tags);
     }
 
@@ -3480,7 +3543,7 @@ STATIC eLicorStatus_t LI8x0_ParseData(char *str, uint16_t slen, sLicorTags_t *ta
     /** Search for raw */
     if (LI8X0_FindSubstring(str, (char *)str_raw, strlen(str_raw), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         /** Search for raw co2 */
         if (LI8X0_FindSubstring(LicorSubstr, (char *)str_raw_co2, strlen(str_raw_co2), &sIdx, &eIdx) == LICOR_OK)
         {
@@ -3606,6 +3669,8 @@ STATIC eLicorStatus_t LI8x0_ParseRS232(char *str, uint16_t slen, sLicorTags_t *t
     const char str_raw_co2ref[] = "CO2REF";
     const char str_raw_h2o[] = "H2O";
     const char str_raw_h2oref[] = "H2OREF";
+    const char str_echo[] = "ECHO";
+    const char str_strip[] = "STRIP";
 
     uint32_t sIdx = 0;
     uint32_t eIdx = 0;
@@ -3739,10 +3804,29 @@ STATIC eLicorStatus_t LI8x0_ParseRS232(char *str, uint16_t slen, sLicorTags_t *t
         tags->rs232.flowrate = temp;
     }
 
+    /** Search for echo */
+    if (LI8X0_FindSubstring(str, (char *)str_echo, strlen(str_echo), &sIdx, &eIdx) == LICOR_OK)
+    {
+        tags->rs232.echo = (strncmp("TRUE", &str[sIdx], (eIdx - sIdx)) == 0);
+    }
+
+    /** Search for strip */
+    if (LI8X0_FindSubstring(str, (char *)str_strip, strlen(str_strip), &sIdx, &eIdx) == LICOR_OK)
+    {
+        tags->rs232.strip = (strncmp("TRUE", &str[sIdx], (eIdx - sIdx)) == 0);
+    }
+
     /** Search for raw */
     if (LI8X0_FindSubstring(str, (char *)str_raw, strlen(str_raw), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        /** LI-830/850 report raw as a single bool */
+        if (str[sIdx] != '<')
+        {
+            temp = (strncmp("TRUE", &str[sIdx], (eIdx - sIdx)) == 0);
+            tags->rs232.raw.co2 = temp;
+            tags->rs232.raw.co2ref = temp;
+        }
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         /** Search for raw co2 */
         if (LI8X0_FindSubstring(LicorSubstr, (char *)str_raw_co2, strlen(str_raw_co2), &sIdx, &eIdx) == LICOR_OK)
         {
@@ -3819,6 +3903,7 @@ STATIC eLicorStatus_t LI8x0_ParseCFG(char *str, uint16_t slen, sLicorTags_t *tag
     eLicorStatus_t result = LICOR_FAIL;
 
     const char str_heater[] = "HEATER";
+    const char str_outrate[] = "OUTRATE";
     const char str_pcomp[] = "PCOMP";
     const char str_filter[] = "FILTER";
     const char str_bench[] = "BENCH";
@@ -3875,6 +3960,14 @@ STATIC eLicorStatus_t LI8x0_ParseCFG(char *str, uint16_t slen, sLicorTags_t *tag
         memset(tempVal, 0, 16);
     }
 
+    /** Search for OUTRATE */
+    if (LI8X0_FindSubstring(str, (char *)str_outrate, strlen(str_outrate), &sIdx, &eIdx) == LICOR_OK)
+    {
+        strncpy(tempVal, &str[sIdx], (eIdx - sIdx));
+        tags->cfg.outrate = atof(tempVal);
+        memset(tempVal, 0, 16);
+    }
+
     /** Search for BENCH */
     if (LI8X0_FindSubstring(str, (char *)str_bench, strlen(str_bench), &sIdx, &eIdx) == LICOR_OK)
     {
@@ -3887,14 +3980,14 @@ STATIC eLicorStatus_t LI8x0_ParseCFG(char *str, uint16_t slen, sLicorTags_t *tag
     if (LI8X0_FindSubstring(str, (char *)str_span, strlen(str_span), &sIdx, &eIdx) == LICOR_OK)
     {
         strncpy(tempVal, &str[sIdx], (eIdx - sIdx));
-        tags->cfg.span = atoi("123");
+        tags->cfg.span = atoi(tempVal);
         memset(tempVal, 0, 16);
     }
 
     /** Search for ALARMS */
     if (LI8X0_FindSubstring(str, (char *)str_alarms, strlen(str_alarms), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         /** Search for raw co2 */
         if (LI8X0_FindSubstring(LicorSubstr, (char *)str_alarms_logic, strlen(str_alarms_logic), &sIdx, &eIdx) == LICOR_OK)
         {
@@ -3976,7 +4069,7 @@ STATIC eLicorStatus_t LI8x0_ParseCFG(char *str, uint16_t slen, sLicorTags_t *tag
     /** Search for DACS */
     if (LI8X0_FindSubstring(str, (char *)str_dacs, strlen(str_dacs), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
 
         if (LI8x0_ParseDACS(LicorSubstr, strlen(str), tags) == LICOR_OK)
         {
@@ -4353,7 +4446,7 @@ STATIC eLicorStatus_t LI8x0_ParsePoly(char *str, uint16_t slen, sLicorTags_t *ta
     /** Search for POLY CO2 */
     if (LI8X0_FindSubstring(str, (char *)str_poly_co2, strlen(str_poly_co2), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         /** Search for A1 */
         if (LI8X0_FindSubstring(LicorSubstr, (char *)str_poly_a1, strlen(str_poly_a1), &sIdx, &eIdx) == LICOR_OK)
         {
@@ -4388,7 +4481,7 @@ STATIC eLicorStatus_t LI8x0_ParsePoly(char *str, uint16_t slen, sLicorTags_t *ta
     /** Search for POLY H2O */
     if (LI8X0_FindSubstring(str, (char *)str_poly_h2o, strlen(str_poly_h2o), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
         /** Search for A1 */
         if (LI8X0_FindSubstring(LicorSubstr, (char *)str_poly_a1, strlen(str_poly_a1), &sIdx, &eIdx) == LICOR_OK)
         {
@@ -4417,7 +4510,7 @@ STATIC eLicorStatus_t LI8x0_ParsePoly(char *str, uint16_t slen, sLicorTags_t *ta
     /** Search for POLY PRES */
     if (LI8X0_FindSubstring(str, (char *)str_poly_pres, strlen(str_poly_pres), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
 
         /** Search for A0 */
         if (LI8X0_FindSubstring(LicorSubstr, (char *)str_poly_a0, strlen(str_poly_a0), &sIdx, &eIdx) == LICOR_OK)
@@ -4574,7 +4667,7 @@ STATIC eLicorStatus_t LI8x0_ParseTech(char *str, uint16_t slen, sLicorTags_t *ta
     /** Search for TECH PUMP */
     if (LI8X0_FindSubstring(str, (char *)str_tech_pump, strlen(str_tech_pump), &sIdx, &eIdx) == LICOR_OK)
     {
-        strncpy(LicorSubstr, &str[sIdx], (eIdx - sIdx));
+        LI8x0_CopySubstr(&str[sIdx], (eIdx - sIdx));
 
         if (LI8x0_ParseTechPump(LicorSubstr, strlen(str), tags) == LICOR_OK)
         {
@@ -4915,16 +5008,331 @@ STATIC eLicorStatus_t LI8x0_WaitForACK(char *sstr)
     }
 
     /** Verify ACK */
-    strcpy(sstr, (char *)LicorRxBuffer);
-    for (i = 0; i < 80; i++)
-    {
-        sstr[i] = toupper(sstr[i]);
-    }
-    if (LI8x0_IsAck(pXML, sstr, strlen(sstr) == LICOR_OK))
+    memset(sstr, 0, 80);
+    strncpy(sstr, (char *)LicorRxBuffer, 79);
+    if (LI8x0_IsAck(pXML, sstr, strlen(sstr)) == LICOR_OK)
     {
         result = LICOR_OK;
     }
     LI8x0_ReadPrep();
 
     return result;
-}
\ No newline at end of file
+}
+
+/** @brief Get Config Tag Value
+ *
+ * Get the value of a config tag from a tag structure
+ *
+ * @param *tags Pointer to Tag Structure
+ * @param *tag Pointer to Config Tag
+ *
+ * @return Value (bools are 0/1)
+ */
+STATIC float LI8x0_CfgGet(const sLicorTags_t *tags, const sLicorCfgTag_t *tag)
+{
+    float val = 0.0f;
+
+    switch (tag->LVL3)
+    {
+    case LICOR_XML_LVL3_FLOWRATE:
+        val = tags->rs232.flowrate;
+        break;
+    case LICOR_XML_LVL3_CO2:
+        val = tags->rs232.co2;
+        break;
+    case LICOR_XML_LVL3_CELLTEMP:
+        val = tags->rs232.celltemp;
+        break;
+    case LICOR_XML_LVL3_CELLPRES:
+        val = tags->rs232.cellpres;
+        break;
+    case LICOR_XML_LVL3_IVOLT:
+        val = tags->rs232.ivolt;
+        break;
+    case LICOR_XML_LVL3_CO2ABS:
+        val = tags->rs232.co2abs;
+        break;
+    case LICOR_XML_LVL3_ECHO:
+        val = tags->rs232.echo;
+        break;
+    case LICOR_XML_LVL3_STRIP:
+        val = tags->rs232.strip;
+        break;
+    case LICOR_XML_LVL3_H2O:
+        val = tags->rs232.h2o;
+        break;
+    case LICOR_XML_LVL3_H2OABS:
+        val = tags->rs232.h2oabs;
+        break;
+    case LICOR_XML_LVL3_RAW:
+        switch (tag->LVL4)
+        {
+        case LICOR_XML_LVL4_H2O:
+            val = tags->rs232.raw.h2o;
+            break;
+        case LICOR_XML_LVL4_H2OREF:
+            val = tags->rs232.raw.h2oref;
+            break;
+        default:
+            val = tags->rs232.raw.co2;
+            break;
+        }
+        break;
+    case LICOR_XML_LVL3_OUTRATE:
+        val = tags->cfg.outrate;
+        break;
+    case LICOR_XML_LVL3_HEATER:
+        val = tags->cfg.heater;
+        break;
+    case LICOR_XML_LVL3_PCOMP:
+        val = tags->cfg.pcomp;
+        break;
+    case LICOR_XML_LVL3_FILTER:
+        val = tags->cfg.filter;
+        break;
+    case LICOR_XML_LVL3_BENCH:
+        val = tags->cfg.bench;
+        break;
+    case LICOR_XML_LVL3_SPAN:
+        val = tags->cfg.span;
+        break;
+    case LICOR_XML_LVL3_ALARMS:
+        val = tags->cfg.alarms.enabled;
+        break;
+    default:
+        break;
+    }
+
+    return val;
+}
+
+/** @brief Set Config Tag Value
+ *
+ * Set the value of a config tag in a tag structure
+ *
+ * @param *tags Pointer to Tag Structure
+ * @param *tag Pointer to Config Tag
+ * @param val Value to set (bools are 0/1)
+ *
+ * @return None
+ */
+STATIC void LI8x0_CfgSet(sLicorTags_t *tags, const sLicorCfgTag_t *tag, float val)
+{
+    bool b = (val != 0.0f);
+
+    switch (tag->LVL3)
+    {
+    case LICOR_XML_LVL3_FLOWRATE:
+        tags->rs232.flowrate = b;
+        break;
+    case LICOR_XML_LVL3_CO2:
+        tags->rs232.co2 = b;
+        break;
+    case LICOR_XML_LVL3_CELLTEMP:
+        tags->rs232.celltemp = b;
+        break;
+    case LICOR_XML_LVL3_CELLPRES:
+        tags->rs232.cellpres = b;
+        break;
+    case LICOR_XML_LVL3_IVOLT:
+        tags->rs232.ivolt = b;
+        break;
+    case LICOR_XML_LVL3_CO2ABS:
+        tags->rs232.co2abs = b;
+        break;
+    case LICOR_XML_LVL3_ECHO:
+        tags->rs232.echo = b;
+        break;
+    case LICOR_XML_LVL3_STRIP:
+        tags->rs232.strip = b;
+        break;
+    case LICOR_XML_LVL3_H2O:
+        tags->rs232.h2o = b;
+        break;
+    case LICOR_XML_LVL3_H2OABS:
+        tags->rs232.h2oabs = b;
+        break;
+    case LICOR_XML_LVL3_RAW:
+        switch (tag->LVL4)
+        {
+        case LICOR_XML_LVL4_H2O:
+            tags->rs232.raw.h2o = b;
+            break;
+        case LICOR_XML_LVL4_H2OREF:
+            tags->rs232.raw.h2oref = b;
+            break;
+        default:
+            tags->rs232.raw.co2 = b;
+            tags->rs232.raw.co2ref = b;
+            break;
+        }
+        break;
+    case LICOR_XML_LVL3_OUTRATE:
+        tags->cfg.outrate = val;
+        break;
+    case LICOR_XML_LVL3_HEATER:
+        tags->cfg.heater = b;
+        break;
+    case LICOR_XML_LVL3_PCOMP:
+        tags->cfg.pcomp = b;
+        break;
+    case LICOR_XML_LVL3_FILTER:
+        tags->cfg.filter = (uint8_t)val;
+        break;
+    case LICOR_XML_LVL3_BENCH:
+        tags->cfg.bench = (uint8_t)val;
+        break;
+    case LICOR_XML_LVL3_SPAN:
+        tags->cfg.span = (uint8_t)val;
+        break;
+    case LICOR_XML_LVL3_ALARMS:
+        tags->cfg.alarms.enabled = b;
+        break;
+    default:
+        break;
+    }
+}
+
+/** @brief Create Config String
+ *
+ * Create one XML message holding every selected config tag, e.g.
+ * <LI830><RS232><CO2>TRUE</CO2></RS232><CFG><HEATER>FALSE</HEATER></CFG></LI830>
+ *
+ * @param *msg Pointer to message (LICOR_CFG_MSG_LEN)
+ * @param *send Tags to include (one per LicorCfgTags entry)
+ *
+ * @return Message length
+ */
+STATIC uint16_t LI8x0_CreateString_Config(char *msg, const bool *send)
+{
+    char sstr[40];
+    char estr[40];
+    char lvl1[16];
+    char lvl2[16];
+    char val[16];
+    uint16_t slen = 0;
+    uint16_t elen = 0;
+    eLicorXMLLvl2_t group = LICOR_XML_LVL2_NONE;
+    const sLicorCfgTag_t *tag;
+    float want;
+    uint16_t i;
+
+    memset(msg, 0, LICOR_CFG_MSG_LEN);
+    memset(sstr, 0, 40);
+    memset(estr, 0, 40);
+    memset(lvl1, 0, 16);
+    memset(lvl2, 0, 16);
+
+    /** Level 1 */
+    LI8x0_Level1Str((eLicorXMLLvl1_t)Licor1.type, sstr, &slen, lvl1, &elen);
+    strcat(msg, sstr);
+
+    for (i = 0; i < LICOR_CFG_TAG_CNT; i++)
+    {
+        if (false == send[i])
+        {
+            continue;
+        }
+        tag = &LicorCfgTags[i];
+
+        /** Open a new level 2 group */
+        if (tag->LVL2 != group)
+        {
+            strcat(msg, lvl2);
+            memset(sstr, 0, 40);
+            memset(lvl2, 0, 16);
+            LI8x0_Level2Str(tag->LVL2, sstr, &slen, lvl2, &elen);
+            strcat(msg, sstr);
+            group = tag->LVL2;
+        }
+
+        /** Level 3 and 4 tags */
+        memset(sstr, 0, 40);
+        memset(estr, 0, 40);
+        LI8x0_Level3Str(tag->LVL3, sstr, &slen, estr, &elen);
+        LI8x0_Level4Str(tag->LVL4, sstr, &slen, estr, &elen);
+
+        /** Value */
+        memset(val, 0, 16);
+        want = LI8x0_CfgGet(&LicorCfgDesired, tag);
+        switch (tag->kind)
+        {
+        case LICOR_CFG_BOOL:
+            strcpy(val, (want != 0.0f) ? "TRUE" : "FALSE");
+            break;
+        case LICOR_CFG_UINT:
+            sprintf(val, "%u", (uint16_t)want);
+            break;
+        case LICOR_CFG_FLOAT:
+        default:
+            sprintf(val, "%0.1f", want);
+            break;
+        }
+
+        strcat(msg, sstr);
+        strcat(msg, val);
+        strcat(msg, estr);
+    }
+
+    strcat(msg, lvl2);
+    strcat(msg, lvl1);
+
+    return strlen(msg);
+}
+
+/** @brief Copy Substring
+ *
+ * Copy a tag's contents to LicorSubstr, bounded and null terminated.
+ * The source may already be in LicorSubstr (nested tags).
+ *
+ * @param *src Pointer to start of the tag contents
+ * @param len Length of the tag contents
+ *
+ * @return None
+ */
+STATIC void LI8x0_CopySubstr(const char *src, uint32_t len)
+{
+    if (len >= LICOR_SUBSTR_LEN)
+    {
+        len = LICOR_SUBSTR_LEN - 1;
+    }
+    memmove(LicorSubstr, src, len);
+    LicorSubstr[len] = 0;
+}
+
+/** @brief Set Licor Output Rate
+ *
+ * Set <outrate> and wait for the ACK.  A frame already on the wire may
+ * arrive before the ACK, so a few lines are checked.
+ *
+ * @param period Output period (seconds, 0 = polled)
+ *
+ * @return result
+ */
+STATIC eLicorStatus_t LI8x0_SetOutrate(float period)
+{
+    eLicorStatus_t result = LICOR_FAIL;
+    sLicorXML_t XML = {.LVL1 = (eLicorXMLLvl1_t)Licor1.type,
+                       .LVL2 = LICOR_XML_LVL2_CFG,
+                       .LVL3 = LICOR_XML_LVL3_OUTRATE,
+                       .LVL4 = LICOR_XML_LVL4_NONE};
+    char sstr[80];
+    char val[16];
+    uint8_t i;
+
+    memset(val, 0, 16);
+    sprintf(val, "%0.1f", period);
+    LI8x0_CreateAndSendString(&XML, val, strlen(val));
+
+    for (i = 0; i < 3; i++)
+    {
+        if (LICOR_OK == LI8x0_WaitForACK(sstr))
+        {
+            pLicor1->readconfig.cfg.outrate = period;
+            result = LICOR_OK;
+            break;
+        }
+    }
+
+    return result;
+}
@@ -51,12 +51,17 @@
  ************************************************************************/
 #include "bsp.h"
 #include "sysinfo.h"
-#include "AM08X5.h"
+#include "AM08x5.h"
 #include "logging.h"
 #include "errorlist.h"
+#include "ringbuf.h"
 /************************************************************************
  *							MACROS
  ************************************************************************/
+/** Licor types a config tag applies to (bit = 1 << eLicor_t) */
+#define LICOR_CFG_ALL (0x1Eu)
+#define LICOR_CFG_FLOW ((1u << LICOR_LI830) | (1u << LICOR_LI850))
+#define LICOR_CFG_H2O ((1u << LICOR_LI840) | (1u << LICOR_LI850))
 
 /************************************************************************
  *							Structs & Enums
@@ -500,6 +505,54 @@ typedef struct
     char error[128];         /**< Error, includes a message */
 } sLicorTags_t;
 
+/**
+ *  @enum Licor Config Value Type
+ *  @brief How a config tag value is written
+ */
+typedef enum
+{
+    LICOR_CFG_BOOL = 0u,  /**< TRUE/FALSE */
+    LICOR_CFG_UINT = 1u,  /**< Integer */
+    LICOR_CFG_FLOAT = 2u  /**< One decimal place */
+} eLicorCfgType_t;
+
+/**
+ * @struct Licor Config Tag
+ * @brief One tag LI8x0_Config keeps set
+ */
+typedef struct
+{
+    eLicorXMLLvl2_t LVL2;  /**< Level 2 (RS232 or CFG) */
+    eLicorXMLLvl3_t LVL3;  /**< Level 3 */
+    eLicorXMLLvl4_t LVL4;  /**< Level 4 */
+    uint8_t types;         /**< Licor types the tag applies to */
+    eLicorCfgType_t kind;  /**< Value type */
+} sLicorCfgTag_t;
+
+/**
+ * @struct Licor Stream Frame
+ * @brief One line received while streaming
+ */
+typedef struct
+{
+    uint16_t len;               /**< Frame length (no CR/LF) */
+    uint16_t seq;               /**< Frame number since stream start */
+    char str[LICOR_FRAME_LEN];  /**< Frame, null terminated */
+} sLicorFrame_t;
+
+/**
+ * @struct Licor Stream Statistics
+ * @brief Frame counts since stream start
+ */
+typedef struct
+{
+    uint16_t frames;   /**< Frames received */
+    uint16_t read;     /**< Frames parsed into a sample */
+    uint16_t skipped;  /**< Frames replaced by a newer one before read */
+    uint16_t overrun;  /**< Frames dropped, ring full or frame too long */
+    uint16_t lastSeq;  /**< Number of the last frame read */
+} sLicorStreamStats_t;
+
 /**
  * @struct Licor Power State
  * @brief Licor Power State
@@ -527,7 +580,7 @@ typedef struct
 #ifdef UNIT_TESTING
 extern sLicor_t *pLicor1;
 extern char LicorBuffer[LICOR_BUFFER_LEN];
-extern char *pLicorRxBuffer;
+extern volatile char *pLicorRxBuffer;
 #endif
 /************************************************************************
  *					   Functions Prototypes
@@ -572,11 +625,14 @@ eLicorStatus_t LI8x0_Init(void);
 
 /** @brief Configure the Licor LI-8x0
  *
- * Configure the Licor to the user settings
+ * Configure the Licor to the user settings.  The current settings are
+ * read with one query (LI8x0_GetInfo) and only the RS232/CFG tags that
+ * differ are sent, merged into one message with one ACK.  If the query
+ * fails, every tag is sent.
  *
  * @param None
  *
- * @return None
+ * @return result
  */
 eLicorStatus_t LI8x0_Config(void);
 
@@ -776,6 +832,59 @@ eLicorStatus_t LI8x0_Sample_Query(void);
  * @return result
  */
 eLicorStatus_t LI8x0_Sample_Read(sLicorData_t *data);
+
+/** @brief Start Licor Streaming
+ *
+ * Set the Licor <outrate> and route the Licor UART to the frame ring.
+ * Replaces LI8x0_Sample_Query/LI8x0_Sample_Read until LI8x0_Stream_Stop.
+ *
+ * @param period Output period (seconds)
+ *
+ * @return result
+ */
+eLicorStatus_t LI8x0_Stream_Start(float period);
+
+/** @brief Stop Licor Streaming
+ *
+ * Route the Licor UART back to LicorRxBuffer and set <outrate> to 0
+ * (polled).
+ *
+ * @param None
+ *
+ * @return result
+ */
+eLicorStatus_t LI8x0_Stream_Stop(void);
+
+/** @brief Licor Stream Receive Character
+ *
+ * Called from the Licor UART ISR while streaming.  Builds the frame in
+ * the next free ring slot and publishes it on '\n'.  If the ring is full
+ * or the frame does not fit, the frame is dropped and counted.
+ *
+ * @param c Received character
+ *
+ * @return true if a frame was published
+ */
+bool LI8x0_Stream_RxChar(char c);
+
+/** @brief Read Licor Stream
+ *
+ * Parse the newest complete frame.  Older unread frames are discarded
+ * and counted as skipped.
+ *
+ * @param *data Pointer to data structure
+ *
+ * @return LICOR_OK if a new data frame was read
+ */
+eLicorStatus_t LI8x0_Stream_Read(sLicorData_t *data);
+
+/** @brief Get Licor Stream Statistics
+ *
+ * @param *stats Pointer to statistics structure
+ *
+ * @return None
+ */
+void LI8x0_Stream_GetStats(sLicorStreamStats_t *stats);
 /** @brief Read Licor Sample
  *
  * Read Licor Data after sample
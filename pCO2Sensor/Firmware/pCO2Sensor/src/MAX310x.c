@@ -75,7 +75,7 @@ eMAX310XStatus_t MAX310X_Init(sMAX310X_t *Max)
     {
         if (timeout == 0)
         {
-            Error(ERROR_MSG_01010040, LOG_Priority_High);
+            Error(ERROR_MSG_01010040, 0);
             return result;
         }
         _delay_ms(1);
@@ -191,7 +191,7 @@ eMAX310XStatus_t MAX310X_SetBaudrate(sMAX310X_t *Max, uint32_t baudrate)
         break;
     default:
 #ifndef UNIT_TESTING
-        Error(ERROR_MSG_1020, LOG_Priority_Low);
+        Error(ERROR_MSG_1020, 0);
 #endif
         return result;
         break;
@@ -270,7 +270,7 @@ void MAX310X_Wakeup(sMAX310X_t *Max)
         {
             if (timeout == 0)
             {
-                Error(ERROR_MSG_01010041, LOG_Priority_High);
+                Error(ERROR_MSG_01010041, 0);
                 return;
             }
             _delay_ms(1);
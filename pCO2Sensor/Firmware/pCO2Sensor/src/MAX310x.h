@@ -52,7 +52,6 @@
  *							HEADER FILES
  ************************************************************************/
 #include "bsp.h"
-#include "buffer8.h"
 #include "logging.h"
 #include "errorlist.h"
 
@@ -16,10 +16,14 @@
 #include "bsp.h"
 // #include "errors.h"
 #include "logging.h"
+#include "i2cq.h"
 /************************************************************************
  *			                Static Functions Prototypes
  ************************************************************************/
 STATIC eBSPStatus_t CalculateUartBaudRegs(sUART_t *UART);
+STATIC void BSP_Init_Ports(void);
+STATIC const sI2CBusPins_t *BSP_I2C_Pins(sI2C_t *I2C);
+STATIC void BSP_I2C_Failed(sI2C_t *I2C);
 
 /************************************************************************
  *			                    Variables (Global)
@@ -32,10 +36,28 @@ sEUSCI_t EUSCI_B0 = {.baseAddress = EUSCI_B0_BASE, .timeout = 0, .direction = 0,
 sEUSCI_t EUSCI_B1 = {.baseAddress = EUSCI_B1_BASE, .timeout = 0, .direction = 0, .busy = false, .complete = false}; /**< EUSCI B1 Bus (RH/Temp I2C Bus) */
 sEUSCI_t EUSCI_B2 = {.baseAddress = EUSCI_B2_BASE, .timeout = 0, .direction = 0, .busy = false, .complete = false}; /**< EUSCI B2 Bus (MAX310X I2C Bus) */
 sEUSCI_t EUSCI_B3 = {.baseAddress = EUSCI_B3_BASE, .timeout = 0, .direction = 0, .busy = false, .complete = false}; /**< EUSCI B3 Bus (Not Used) */
+sI2CQ_t I2CQ_B0 = {.Reg = I2CQ_REGS(0)};                                                                             /**< EUSCI B0 Transfer Queue (AMBIQ RTC) */
+sI2CQ_t I2CQ_B1 = {.Reg = I2CQ_REGS(1)};                                                                             /**< EUSCI B1 Transfer Queue (RH/Temp) */
+
+/** I2C pins, for bus recovery */
+STATIC const sI2CBusPins_t BSP_I2C_B0_Pins = {.sdaPort = I2C_B0_SDA_PORT,
+                                              .sdaPin = I2C_B0_SDA_PIN,
+                                              .sclPort = I2C_B0_SCL_PORT,
+                                              .sclPin = I2C_B0_SCL_PIN,
+                                              .function = I2C_B0_FUNCTION};
+STATIC const sI2CBusPins_t BSP_I2C_B1_Pins = {.sdaPort = I2C_B1_SDA_PORT,
+                                              .sdaPin = I2C_B1_SDA_PIN,
+                                              .sclPort = I2C_B1_SCL_PORT,
+                                              .sclPin = I2C_B1_SCL_PIN,
+                                              .function = I2C_B1_FUNCTION};
 
 sCounters_t Timer = {.timer = {.ms = 0, .flag = true},
                      .spi = {.ms = 0, .flag = true},
                      .i2c = {.ms = 0, .flag = true}};
+
+/** Set while BSP_Sleep_While lets the RTC tick feed the watchdog */
+volatile bool BSP_WD_Tick = false;
+
 /************************************************************************
  *			                Variables (Static in Module)
  ************************************************************************/
@@ -57,11 +79,73 @@ STATIC const uint8_t BAUD_BRS[] = {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x1
                                    0xB7, 0xBB, 0xDD, 0xED, 0xEE, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFF};
 STATIC const uint8_t BAUD_BRS_LEN = SIZE_OF(BAUD_BRS);
 
+/** Hardware configuration state, cleared on every reset */
+STATIC eBSPHwState_t BSP_HwState = BSP_HW_COLD;
+
+/** Clock profiles */
+STATIC const sClkProfile_t BSP_ClkProfiles[BSP_CLK_PROFILE_LEN] = {
+    {.mclkDiv = CLK_IDLE_MCLK_DIV, .mclkDivide = CLK_IDLE_MCLK_DIVIDE},
+    {.mclkDiv = CLK_NORMAL_MCLK_DIV, .mclkDivide = CLK_NORMAL_MCLK_DIVIDE},
+    {.mclkDiv = CLK_FULL_MCLK_DIV, .mclkDivide = CLK_FULL_MCLK_DIVIDE}};
+STATIC eBSPClkProfile_t BSP_ClkProfile = BSP_CLK_NORMAL;
+
 /************************************************************************
  *					                   Functions
  ************************************************************************/
 /**********************************> INIT <***********************************/
 void BSP_Init_Board(void)
+{
+  /** Configure the pins */
+  BSP_Init_Ports();
+
+  /** Start the clocks */
+  if (BSP_SYSCLK_Init() == BSP_FAIL)
+  {
+    Error(ERROR_MSG_01010100, 0);
+    BSP_HwState = BSP_HW_COLD;
+  }
+  else
+  {
+    BSP_HwState = BSP_HW_READY;
+  }
+
+  /** Start the timers */
+  BSP_Timer_Init(NULL, NULL);
+
+  return;
+}
+
+bool BSP_Resume_Board(void)
+{
+  if (BSP_HwState == BSP_HW_COLD)
+  {
+    BSP_Init_Board();
+    return false;
+  }
+
+  if (BSP_HwState == BSP_HW_SLEEP)
+  {
+    /** Only the pins were parked for LPM3 */
+    BSP_Init_Ports();
+
+    /** HFXT restarts on request after LPM3, wait for it to settle */
+    if (SysClk.HX.Freq > 0)
+    {
+      if (CS_turnOnHFXTWithTimeout(SysClk.HX.Drive, SysClk.HX.timeout) != STATUS_SUCCESS)
+      {
+        Error(ERROR_MSG_01010100, 0);
+        BSP_HwState = BSP_HW_COLD;
+        BSP_Init_Board();
+        return false;
+      }
+    }
+    BSP_HwState = BSP_HW_READY;
+  }
+
+  return true;
+}
+
+STATIC void BSP_Init_Ports(void)
 {
   uint16_t pinMask = (GPIO_PIN0 + GPIO_PIN1 + GPIO_PIN2 + GPIO_PIN3 +
                       GPIO_PIN4 + GPIO_PIN5 + GPIO_PIN6 + GPIO_PIN7 +
@@ -213,15 +297,6 @@ void BSP_Init_Board(void)
   PMM_unlockLPM5();
 #endif
 
-  /** Start the clocks */
-  if (BSP_SYSCLK_Init() == BSP_FAIL)
-  {
-    Error(ERROR_MSG_01010100, LOG_Priority_High);
-  }
-
-  /** Start the timers */
-  BSP_Timer_Init(NULL, NULL);
-
   return;
 }
 /***********************************> CLK <***********************************/
@@ -240,6 +315,7 @@ eBSPStatus_t BSP_SYSCLK_Init(void)
 
   /** Initialize SMCLK */
   CS_initClockSignal(CS_SMCLK, SysClk.SMCLK.ClkSrc, SysClk.SMCLK.divider);
+  BSP_ClkProfile = BSP_CLK_NORMAL;
 
   /** Initialize MODCLK */
   CS_initClockSignal(CS_MODOSC, SysClk.MODOSC.ClkSrc, SysClk.MODOSC.divider);
@@ -262,9 +338,39 @@ eBSPStatus_t BSP_SYSCLK_Init(void)
   return result;
 }
 
+eBSPStatus_t BSP_Clock_SetProfile(eBSPClkProfile_t profile)
+{
+  if (profile >= BSP_CLK_PROFILE_LEN)
+  {
+    return BSP_FAIL;
+  }
+
+  if (profile != BSP_ClkProfile)
+  {
+    /** SMCLK stays put, so the bus dividers stay valid */
+    CS_initClockSignal(CS_MCLK, SysClk.MCLK.ClkSrc, BSP_ClkProfiles[profile].mclkDiv);
+    BSP_ClkProfile = profile;
+  }
+
+  return BSP_OK;
+}
+
+eBSPClkProfile_t BSP_Clock_GetProfile(void) { return BSP_ClkProfile; }
+
+uint32_t BSP_Clock_MCLK(void)
+{
+  return (uint32_t)SysClk.HX.Freq / BSP_ClkProfiles[BSP_ClkProfile].mclkDivide;
+}
+
 /***********************************> LPM <***********************************/
 void BSP_Low_Power_Mode(void)
 {
+  /** Pins are parked, clocks and timers are left alone */
+  if (BSP_HwState == BSP_HW_READY)
+  {
+    BSP_HwState = BSP_HW_SLEEP;
+  }
+
   /** Set Input Pins */
   GPIO_setAsInputPin(GPIO_PORT_P2, GPIO_PIN7);
   GPIO_setAsInputPinWithPullUpResistor(GPIO_PORT_P2, GPIO_PIN6);
@@ -518,18 +624,54 @@ void BSP_Low_Current_Mode_OFF(void)
 }
 void _delay_ms(uint32_t ms)
 {
-
-  while (ms-- > 0)
+  /** __delay_cycles needs a constant, so one loop per profile */
+  switch (BSP_ClkProfile)
   {
-    __delay_cycles(3634);
+  case BSP_CLK_IDLE:
+    while (ms-- > 0)
+    {
+      __delay_cycles(BSP_DELAY_MS_CYCLES(CLK_IDLE_MCLK_DIVIDE));
+    }
+    break;
+  case BSP_CLK_FULL:
+    while (ms-- > 0)
+    {
+      __delay_cycles(BSP_DELAY_MS_CYCLES(CLK_FULL_MCLK_DIVIDE));
+    }
+    break;
+  case BSP_CLK_NORMAL:
+  default:
+    while (ms-- > 0)
+    {
+      __delay_cycles(BSP_DELAY_MS_CYCLES(CLK_NORMAL_MCLK_DIVIDE));
+    }
+    break;
   }
 }
 
 void _delay_us(uint32_t us)
 {
-  while (us-- > 0)
+  switch (BSP_ClkProfile)
   {
-    __delay_cycles(4);
+  case BSP_CLK_IDLE:
+    while (us-- > 0)
+    {
+      __delay_cycles(BSP_DELAY_US_CYCLES(CLK_IDLE_MCLK_DIVIDE));
+    }
+    break;
+  case BSP_CLK_FULL:
+    while (us-- > 0)
+    {
+      __delay_cycles(BSP_DELAY_US_CYCLES(CLK_FULL_MCLK_DIVIDE));
+    }
+    break;
+  case BSP_CLK_NORMAL:
+  default:
+    while (us-- > 0)
+    {
+      __delay_cycles(BSP_DELAY_US_CYCLES(CLK_NORMAL_MCLK_DIVIDE));
+    }
+    break;
   }
 }
 
@@ -559,7 +701,7 @@ void BSP_GPIO_Init(sGPIO_t *IO)
     }
     else
     {
-      Error(ERROR_MSG_01010020, LOG_Priority_High);
+      Error(ERROR_MSG_01010020, 0);
     }
   }
 
@@ -653,7 +795,7 @@ eBSPStatus_t BSP_UART_Init(sUART_t *UART)
   UART->param.uartMode = EUSCI_A_UART_MODE;
   if (CalculateUartBaudRegs(UART) != BSP_OK)
   {
-    Error(ERROR_MSG_01010021, LOG_Priority_High);
+    Error(ERROR_MSG_01010021, 0);
     result = BSP_FAIL;
     return result;
   }
@@ -665,7 +807,7 @@ eBSPStatus_t BSP_UART_Init(sUART_t *UART)
   {
     UART->configured = false;
     result = BSP_FAIL;
-    Error(ERROR_MSG_01010022, LOG_Priority_High);
+    Error(ERROR_MSG_01010022, 0);
   }
   else
   {
@@ -690,7 +832,7 @@ eBSPStatus_t BSP_UART_SetBaudrate(sUART_t *UART, uint32_t baudrate)
     {
       UART->configured = false;
       result = BSP_FAIL;
-      Error(ERROR_MSG_01010022, LOG_Priority_High);
+      Error(ERROR_MSG_01010022, 0);
     }
     else
     {
@@ -700,7 +842,7 @@ eBSPStatus_t BSP_UART_SetBaudrate(sUART_t *UART, uint32_t baudrate)
   }
   else
   {
-    Error(ERROR_MSG_01010023, LOG_Priority_High);
+    Error(ERROR_MSG_01010023, 0);
   }
 
   return result;
@@ -825,30 +967,47 @@ void BSP_I2C_SetMode(sI2C_t *I2C, uint8_t mode)
   EUSCI_B_I2C_setMode(I2C->baseAddress, mode);
 }
 
-void BSP_I2C_Reset(sI2C_t *I2C)
+eBSPStatus_t BSP_I2C_Reset(sI2C_t *I2C)
 {
+  eBSPStatus_t result = BSP_OK;
+  const sI2CBusPins_t *pins = BSP_I2C_Pins(I2C);
+
+  /** Hold the eUSCI in reset while the pins are GPIO */
   BSP_I2C_Disable(I2C);
-  GPIO_setAsPeripheralModuleFunctionOutputPin(I2C_B0_SDA_PORT,
-                                              I2C_B0_SDA_PIN,
-                                              GPIO_PRIMARY_MODULE_FUNCTION);
+  if ((pins != NULL) && (I2CBUS_OK != I2CBUS_Recover(pins)))
+  {
+    result = BSP_FAIL;
+  }
+  BSP_I2C_Enable(I2C, EUSCI_B_I2C_TRANSMIT_MODE);
 
-  GPIO_setAsPeripheralModuleFunctionOutputPin(I2C_B0_SCL_PORT,
-                                              I2C_B0_SCL_PIN,
-                                              GPIO_PRIMARY_MODULE_FUNCTION);
-  GPIO_setAsOutputPin(I2C_B0_SDA_PORT, I2C_B0_SDA_PIN);
-  GPIO_setOutputLowOnPin(I2C_B0_SDA_PORT, I2C_B0_SDA_PIN);
-  GPIO_setOutputHighOnPin(I2C_B0_SDA_PORT, I2C_B0_SDA_PIN);
-  GPIO_setOutputLowOnPin(I2C_B0_SDA_PORT, I2C_B0_SDA_PIN);
-  _delay_ms(50);
+  return result;
+}
 
-  GPIO_setAsPeripheralModuleFunctionOutputPin(I2C_B0_SDA_PORT,
-                                              I2C_B0_SDA_PIN,
-                                              I2C_B0_FUNCTION);
+eBSPStatus_t BSP_I2C_Fault(sI2C_t *I2C, eI2CFault_t fault)
+{
+  const sI2CBusPins_t *pins = BSP_I2C_Pins(I2C);
 
-  GPIO_setAsPeripheralModuleFunctionOutputPin(I2C_B0_SCL_PORT,
-                                              I2C_B0_SCL_PIN,
-                                              I2C_B0_FUNCTION);
-  BSP_I2C_Enable(I2C, EUSCI_B_I2C_TRANSMIT_MODE);
+  /** A held line is what needs fixing, whatever the transfer saw */
+  if ((pins != NULL) && (true == I2CBUS_Stuck(pins)))
+  {
+    fault = I2C_FAULT_STUCK;
+  }
+  I2CBUS_Count(&I2C->faults, fault);
+
+  /** The bus itself is fine after a NACK or lost arbitration */
+  if ((fault == I2C_FAULT_NACK) || (fault == I2C_FAULT_ARBLOST))
+  {
+    return BSP_OK;
+  }
+
+  if (BSP_OK == BSP_I2C_Reset(I2C))
+  {
+    I2C->faults.recovered++;
+    return BSP_OK;
+  }
+
+  I2C->faults.unrecovered++;
+  return BSP_FAIL;
 }
 
 /***********************************> ??? <***********************************/
@@ -863,17 +1022,21 @@ void BSP_I2C_put(sI2C_t *I2C, uint8_t val)
   /** Send Single Byte */
   if (EUSCI_B_I2C_masterSendSingleByteWithTimeout(I2C->baseAddress, val, 1000000) == false)
   {
-    Error(ERROR_MSG_01010030, LOG_Priority_High);
-    Error("Restarting", LOG_Priority_High);
-    PMMCTL0 |= PMMSWPOR;
+    Error(ERROR_MSG_01010030, 0);
+    BSP_I2C_Failed(I2C);
+    return;
   }
 
   /** Wait for Tx or timeout */
   uint8_t timeout = 5;
-  while (EUSCI_B_I2C_isBusBusy(I2C->baseAddress) && timeout > 0)
+  while (EUSCI_B_I2C_isBusBusy(I2C->baseAddress) && timeout-- > 0)
   {
     _delay_ms(10);
   }
+  if (EUSCI_B_I2C_isBusBusy(I2C->baseAddress))
+  {
+    BSP_I2C_Failed(I2C);
+  }
 
   return;
 }
@@ -919,7 +1082,7 @@ void BSP_I2C_puts(sI2C_t *I2C, uint8_t *val, uint16_t len)
                                                                        I2C_B0_TxData[0],
                                                                        10000))
     {
-      BSP_I2C_Reset(I2C);
+      BSP_I2C_Failed(I2C);
     }
     else
     {
@@ -939,6 +1102,10 @@ void BSP_I2C_puts(sI2C_t *I2C, uint8_t *val, uint16_t len)
   {
     _delay_ms(10);
   }
+  if (EUSCI_B_I2C_isBusBusy(I2C->baseAddress))
+  {
+    BSP_I2C_Failed(I2C);
+  }
 
   return;
 }
@@ -988,12 +1155,23 @@ eBSPStatus_t BSP_I2C_gets(sI2C_t *I2C, uint8_t *val, uint16_t len)
   I2C_B0_MaxCount = len;
   __delay_cycles(10000);
 
-  /** Start Receive */
+  /** Start Receive.  A held bus never gets its STOP out */
   EUSCI_B_I2C_masterReceiveStart(I2C->baseAddress);
-  while (EUSCI_B_I2C_masterIsStopSent(I2C->baseAddress) != EUSCI_B_I2C_STOP_SEND_COMPLETE)
-    ;
-  /** Wait for Count to go to zero, with timeout.  Restart System if timeout */
-  uint16_t cnt = 50;
+  uint16_t cnt = BSP_I2C_STOP_WAIT_US / 10;
+  while ((EUSCI_B_I2C_masterIsStopSent(I2C->baseAddress) != EUSCI_B_I2C_STOP_SEND_COMPLETE) &&
+         (cnt > 0))
+  {
+    _delay_us(10);
+    cnt--;
+  }
+  if (cnt == 0)
+  {
+    BSP_I2C_Failed(I2C);
+    return result;
+  }
+
+  /** Wait for Count to go to zero, with timeout */
+  cnt = 50;
   while ((I2C_B0_MaxCount != 0) && (cnt > 0))
   {
     _delay_ms(1);
@@ -1007,6 +1185,10 @@ eBSPStatus_t BSP_I2C_gets(sI2C_t *I2C, uint8_t *val, uint16_t len)
     /** Copy the data */
     memcpy(val, I2C_B0_RxData, len);
   }
+  else
+  {
+    BSP_I2C_Failed(I2C);
+  }
 
   return result;
 }
@@ -1040,6 +1222,52 @@ eBSPStatus_t BSP_I2C_GetData(sI2C_t *I2C, uint8_t reg, uint8_t *data, uint8_t le
   return result;
 }
 
+/** @brief I2C Bus Pins
+ *
+ *  @param *I2C pointer to the I2C struct
+ *
+ *  @return Pins of the bus, NULL if not known
+ */
+STATIC const sI2CBusPins_t *BSP_I2C_Pins(sI2C_t *I2C)
+{
+  switch (I2C->baseAddress)
+  {
+  case EUSCI_B0_BASE:
+    return &BSP_I2C_B0_Pins;
+  case EUSCI_B1_BASE:
+    return &BSP_I2C_B1_Pins;
+  default:
+    return NULL;
+  }
+}
+
+/** @brief I2C Transfer Failed
+ *
+ *  Classify and count the fault and recover the bus.  Only a bus that
+ *  cannot be recovered restarts the system.
+ *
+ *  @param *I2C pointer to the I2C struct
+ *
+ *  @return None
+ */
+STATIC void BSP_I2C_Failed(sI2C_t *I2C)
+{
+  const sI2CBusPins_t *pins = BSP_I2C_Pins(I2C);
+  eI2CFault_t fault = I2C_FAULT_TIMEOUT;
+
+  if (pins != NULL)
+  {
+    fault = I2CBUS_Classify(HWREG16(I2C->baseAddress + OFS_UCBxIFG), pins);
+  }
+
+  if (BSP_OK != BSP_I2C_Fault(I2C, fault))
+  {
+    sysinfo.I2CFailures++;
+    Error(ERROR_MSG_01010031, fault);
+    PMMCTL0 |= PMMSWPOR;
+  }
+}
+
 /***********************************> SPI <***********************************/
 void BSP_SPI_Init(sSPI_t *SPI)
 {
@@ -1146,6 +1374,27 @@ void BSP_Hit_WD(void)
   GPIO_setOutputLowOnPin(WATCHDOG_PORT, WATCHDOG_PIN);
 }
 
+void BSP_Sleep_While(volatile bool *pFlag)
+{
+  BSP_Hit_WD();
+  BSP_WD_Tick = true;
+  while (*pFlag == true)
+  {
+#ifndef UNIT_TESTING
+    /** Check and sleep with interrupts off so a wakeup is not lost */
+    __disable_interrupt();
+    if (*pFlag == true)
+    {
+      __bis_SR_register(LPM3_bits | GIE);
+      __no_operation();
+    }
+    __enable_interrupt();
+#endif
+  }
+  BSP_WD_Tick = false;
+  BSP_Hit_WD();
+}
+
 /*********************************> Analog <*********************************/
 eBSPStatus_t BSP_ANALOG_Init(sAnalog_t *Analog)
 {
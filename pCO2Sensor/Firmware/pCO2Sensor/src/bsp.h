@@ -48,10 +48,10 @@
  ************************************************************************/
 #include "sysconfig.h"
 #include "buffer_c.h"
-#include "buffer8.h"
 #include "driverlib/driverlib.h"
 #include "version.h"
 #include "sysinfo.h"
+#include "i2cbus.h"
 /************************************************************************
  *							MACROS
  ************************************************************************/
@@ -61,6 +61,13 @@
 #define BSP_LF_FREQ (32768)
 #define BSP_HF_FREQ (8000000)
 
+/** Busy-wait cycles per ms/us at an MCLK divide, less the loop overhead */
+#define BSP_DELAY_MS_CYCLES(div) ((HFXT_FREQ / 1000u / (div)) - 52u)
+#define BSP_DELAY_US_CYCLES(div) (((HFXT_FREQ + (500000u * (div))) / 1000000u) / (div))
+
+/** Longest a blocking I2C read waits for its STOP before the bus is recovered */
+#define BSP_I2C_STOP_WAIT_US (50000u)
+
 #define BSP_CONSOLE_UART_BASE_ADDR (EUSCI_A1_BASE)
 #define BSP_COMMAND_UART_BASE_ADDR (EUSCI_A0_BASE)
 
@@ -100,6 +107,39 @@ typedef enum
   BSP_FAIL = 1u
 } eBSPStatus_t;
 
+/**
+ *  @enum BSP Hardware State
+ *  @brief How much of the board configuration is still valid
+ */
+typedef enum
+{
+  BSP_HW_COLD = 0u,  /**< Reset or failure, full init required */
+  BSP_HW_SLEEP = 1u, /**< Pins parked for LPM3, clocks/timers valid */
+  BSP_HW_READY = 2u  /**< Fully configured */
+} eBSPHwState_t;
+
+/**
+ *  @enum BSP Clock Profile
+ *  @brief MCLK settings selected per system phase
+ */
+typedef enum
+{
+  BSP_CLK_IDLE = 0u,   /**< Low MCLK for UART and I2C bound phases */
+  BSP_CLK_NORMAL = 1u, /**< Default clocks set by BSP_SYSCLK_Init */
+  BSP_CLK_FULL = 2u,   /**< Full speed for parsing and compute bursts */
+  BSP_CLK_PROFILE_LEN = 3u
+} eBSPClkProfile_t;
+
+/**
+ *  @struct BSP Clock Profile Struct
+ *  MCLK divider for one profile.  SMCLK is not part of a profile
+ */
+typedef struct
+{
+  const uint16_t mclkDiv;   /**< MCLK CS divider setting */
+  const uint8_t mclkDivide; /**< MCLK divide ratio */
+} sClkProfile_t;
+
 /**
  *  @struct BSP Clock Peripheral Struct
  *  SYSCLK Perihperal clock sources and settings
@@ -194,8 +234,7 @@ typedef struct
   volatile uint8_t configured : 1;   /**< Is the I2C Configured? 0=No, 1=Yes */
   volatile uint8_t enabled : 1;      /**< Is the I2C Enabled? 0=No, 1=Yes */
   volatile uint8_t interrupt : 1;    /**< Is the I2C Interrupt Enabled? 0=N0,1=Yes */
-  sCircularBuffer8_t Rx;             /**< Receive Data circular buffer */
-  sCircularBuffer8_t Tx;             /**< Transmit Data circular buffer */
+  sI2CFaults_t faults;               /**< Faults talking to this device */
 } sI2C_t;
 
 /**
@@ -211,8 +250,6 @@ typedef struct
   volatile uint8_t configured : 1;   /**< Is the SPI Configured? 0=No, 1=Yes */
   volatile uint8_t enabled : 1;      /**< Is the SPI Enabled? 0=No, 1=Yes */
   volatile uint8_t interrupt : 1;    /**< Is the SPI InterruptEnabled? 0=N0,1=Yes */
-  sCircularBuffer8_t Rx;             /**< Receive Data circular buffer */
-  sCircularBuffer8_t Tx;             /**< Transmit Data circular buffer */
 } sSPI_t;
 
 /**
@@ -309,6 +346,7 @@ extern sEUSCI_t EUSCI_B1;
 extern sEUSCI_t EUSCI_B2;
 extern sEUSCI_t EUSCI_B3;
 extern sCounters_t Timer;
+extern volatile bool BSP_WD_Tick;
 
 /************************************************************************
  *					    Function Prototypes
@@ -324,6 +362,18 @@ extern sCounters_t Timer;
  */
 void BSP_Init_Board(void);
 
+/** @brief Resume the Board
+ *
+ *  Restore the board after a wake.  Clocks and timers hold their settings
+ *  through LPM3, so a warm resume only restores the pins parked by
+ *  BSP_Low_Power_Mode.  Cold boot and failures fall back to BSP_Init_Board.
+ *
+ *  @param None
+ *
+ *  @return true if the resume was warm
+ */
+bool BSP_Resume_Board(void);
+
 /***********************************> CLK <***********************************/
 /** @brief Initialize the System Clock
  *
@@ -335,6 +385,34 @@ void BSP_Init_Board(void);
  */
 eBSPStatus_t BSP_SYSCLK_Init(void);
 
+/** @brief Set the Clock Profile
+ *
+ * Switch MCLK to the profile.  SMCLK is left alone, so the UART, I2C
+ * and SPI dividers do not change.  _delay_ms/_delay_us follow the
+ * active profile.
+ *
+ * @param profile Clock profile
+ *
+ * @return result
+ */
+eBSPStatus_t BSP_Clock_SetProfile(eBSPClkProfile_t profile);
+
+/** @brief Get the Clock Profile
+ *
+ * @param None
+ *
+ * @return Active clock profile
+ */
+eBSPClkProfile_t BSP_Clock_GetProfile(void);
+
+/** @brief Get the MCLK Frequency
+ *
+ * @param None
+ *
+ * @return MCLK frequency (Hz) for the active profile
+ */
+uint32_t BSP_Clock_MCLK(void);
+
 /** @brief Put Board in Low Power Mode
  *
  * Puts the board in lowest power mode until next command
@@ -609,13 +687,26 @@ void BSP_I2C_Init(sI2C_t *I2C);
 
 /** @brief BSP I2C Reset
  *
- * Reset the I2C port
+ * Reset the I2C port.  The bus is recovered (I2CBUS_Recover) with the
+ * eUSCI held in reset, so a slave left holding SDA is freed.
  *
  * @param *I2C pointer to the I2c struct to reset
  *
- * @return None
+ * @return BSP_OK if the bus lines are free
+ */
+eBSPStatus_t BSP_I2C_Reset(sI2C_t *I2C);
+
+/** @brief BSP I2C Fault
+ *
+ * Count a failed transfer against the device and, if the bus is held or
+ * the transfer never finished, recover it.
+ *
+ * @param *I2C pointer to the I2c struct of the device
+ * @param fault Fault type
+ *
+ * @return BSP_OK if the bus is usable
  */
-void BSP_I2C_Reset(sI2C_t *I2C);
+eBSPStatus_t BSP_I2C_Fault(sI2C_t *I2C, eI2CFault_t fault);
 
 /** @brief BSP I2C Enable
  *
@@ -862,4 +953,17 @@ void BSP_Init_WD(void);
  * @return None
  */
 void BSP_Hit_WD(void);
+
+/** @brief Sleep while flag is set
+ *
+ * Enter LPM3 until an ISR clears the flag.  The eUSCI modules request
+ * SMCLK on a start edge, so the UARTs still receive while asleep.  The
+ * 1 second RTC tick hits the watchdog for the duration of the wait
+ * (BSP_WD_Tick), so only a wait in progress keeps the watchdog fed.
+ *
+ * @param *pFlag Timer flag cleared by its ISR
+ *
+ * @return None
+ */
+void BSP_Sleep_While(volatile bool *pFlag);
 #endif // _BSP_H
@@ -1 +0,0 @@
-#include "buffer32.h"
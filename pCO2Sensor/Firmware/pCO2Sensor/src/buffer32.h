@@ -1,5 +0,0 @@
-#ifndef _BUFFER32_H
-#define _BUFFER32_H
-
-
-#endif // _BUFFER32_H
@@ -19,10 +19,11 @@
 /*******************************************************************************
  *					STATIC FUNCTIONS PROTOTYPES
  *******************************************************************************/
-STATIC uint16_t BufferC_Scan(sCircularBufferC_t *buf, char val);
 STATIC void BufferC_Size(sCircularBufferC_t *buf);
-STATIC uint16_t BufferC_NextIndex(uint16_t idx);
-STATIC uint16_t BufferC_PrevIndex(uint16_t idx);
+STATIC void BufferC_Spans(sCircularBufferC_t *buf, uint16_t len, sBufferCSpan_t span[2]);
+
+/** Index math relies on a power of two size */
+typedef char BufferC_SizeCheck[((BUFFER_C_SIZE & BUFFER_C_MASK) == 0) ? 1 : -1];
 /*******************************************************************************
  *					GLOBAL FUNCTIONS
  *******************************************************************************/
@@ -30,7 +31,9 @@ void BufferC_Clear(sCircularBufferC_t *buf)
 {
 	buf->read = 0;
 	buf->write = 0;
-	memset(buf, 0, ACTUAL_BUFFER_C_SIZE);
+	buf->size = 0;
+	buf->eol_in = 0;
+	buf->eol_out = 0;
 
 	return;
 }
@@ -38,21 +41,24 @@ void BufferC_Clear(sCircularBufferC_t *buf)
 eBufferCStatus_t BufferC_putc(sCircularBufferC_t *buf, char val)
 {
 	eBufferCStatus_t result = BUFFER_C_ERROR;
+	uint16_t write = buf->write;
 
-	/** Determine the index to write to */
-	uint16_t NextWrite = BufferC_NextIndex(buf->write);
-
-	/** If the next index is equal to the read index, the buffer is full */
-	if (NextWrite == buf->read)
+	/** If every slot holds unread data, the buffer is full */
+	if ((uint16_t)(write - buf->read) >= BUFFER_C_SIZE)
 	{
 		result = BUFFER_C_FULL;
 	}
 	else
 	{
 		/** Write the value to the buffer */
-		buf->buffer[buf->write] = val;
+		buf->buffer[write & BUFFER_C_MASK] = val;
+		/** Count the line end */
+		if ('\n' == val)
+		{
+			buf->eol_in++;
+		}
 		/** Update the index to the next value */
-		buf->write = NextWrite;
+		buf->write = write + 1;
 		/** Update the buffer size */
 		BufferC_Size(buf);
 		/** Update the result */
@@ -70,11 +76,13 @@ eBufferCStatus_t BufferC_getc(sCircularBufferC_t *buf, char *value)
 	if (buf->read != buf->write)
 	{
 		/** Read the buffer Value */
-		*value = buf->buffer[buf->read];
-		/** Clear the current buffer value */
-		buf->buffer[buf->read] = 0;
+		*value = buf->buffer[buf->read & BUFFER_C_MASK];
+		if ('\n' == *value)
+		{
+			buf->eol_out++;
+		}
 		/** Update the Index */
-		buf->read = BufferC_NextIndex(buf->read);
+		buf->read++;
 		/** Update the buffer size */
 		BufferC_Size(buf);
 		/** Update the result */
@@ -97,8 +105,11 @@ eBufferCStatus_t BufferC_Backspace(sCircularBufferC_t *buf)
 	}
 	else
 	{
-		buf->write = BufferC_PrevIndex(buf->write);
-		buf->buffer[buf->write] = 0;
+		buf->write--;
+		if ('\n' == buf->buffer[buf->write & BUFFER_C_MASK])
+		{
+			buf->eol_in--;
+		}
 		BufferC_Size(buf);
 		result = BUFFER_C_OK;
 	}
@@ -130,8 +141,8 @@ eBufferCStatus_t BufferC_puts(sCircularBufferC_t *buf, char *str, uint16_t len)
 eBufferCStatus_t BufferC_gets(sCircularBufferC_t *buf, char *str, uint16_t maxLen)
 {
 	eBufferCStatus_t result = BUFFER_C_ERROR;
-	uint16_t len = BufferC_Scan(buf, '\n');
-	uint16_t i;
+	sBufferCSpan_t span[2];
+	uint16_t len = BufferC_PeekLine(buf, span);
 
 	if (len == 0)
 	{
@@ -143,53 +154,94 @@ eBufferCStatus_t BufferC_gets(sCircularBufferC_t *buf, char *str, uint16_t maxLe
 	}
 	else
 	{
-		for (i = 0; i < len; i++)
-		{
-			BufferC_getc(buf, str++);
-		}
-		str[i] = 0;
+		memcpy(str, span[0].data, span[0].len);
+		memcpy(&str[span[0].len], span[1].data, span[1].len);
+		str[len] = 0;
+		BufferC_Commit(buf, len);
 		result = BUFFER_C_OK;
 	}
 	return result;
 }
 
-/*******************************************************************************
- *					STATIC FUNCTIONS
- *******************************************************************************/
-/** @brief Scan buffer for value
- *
- * Scans the buffer for a specified value, returns the number of characters from
- * start of string through location of specified value.
- *
- * @param *buf Pointer to the Circular Buffer
- * @param val Value to scan for
- *
- * @return len Length of string
- */
-STATIC uint16_t BufferC_Scan(sCircularBufferC_t *buf, char val)
+uint16_t BufferC_Lines(sCircularBufferC_t *buf)
 {
-	uint16_t CountIdx = 0;
-	uint16_t ReadIdx = buf->read;
-	uint16_t WriteIdx = buf->write;
+	return (uint16_t)(buf->eol_in - buf->eol_out);
+}
 
-	while (ReadIdx != WriteIdx)
+uint16_t BufferC_Peek(sCircularBufferC_t *buf, sBufferCSpan_t span[2])
+{
+	uint16_t len = (uint16_t)(buf->write - buf->read);
+
+	BufferC_Spans(buf, len, span);
+	return len;
+}
+
+uint16_t BufferC_PeekLine(sCircularBufferC_t *buf, sBufferCSpan_t span[2])
+{
+	uint16_t len = 0;
+	const char *eol;
+
+	/** No complete line, nothing to search */
+	if (buf->eol_in == buf->eol_out)
+	{
+		BufferC_Spans(buf, 0, span);
+		return 0;
+	}
+
+	BufferC_Peek(buf, span);
+	eol = memchr(span[0].data, '\n', span[0].len);
+	if (NULL != eol)
 	{
-		CountIdx++;
-		if (buf->buffer[ReadIdx] == val)
+		len = (uint16_t)(eol - span[0].data) + 1;
+	}
+	else
+	{
+		eol = memchr(span[1].data, '\n', span[1].len);
+		if (NULL != eol)
 		{
-			break;
+			len = span[0].len + (uint16_t)(eol - span[1].data) + 1;
 		}
-		ReadIdx = BufferC_NextIndex(ReadIdx);
 	}
 
-	if (ReadIdx == WriteIdx)
+	BufferC_Spans(buf, len, span);
+	return len;
+}
+
+void BufferC_Commit(sCircularBufferC_t *buf, uint16_t len)
+{
+	sBufferCSpan_t span[2];
+	uint16_t avail = (uint16_t)(buf->write - buf->read);
+	uint16_t lines = 0;
+	uint8_t i;
+	const char *p;
+	const char *end;
+
+	if (len > avail)
 	{
-		CountIdx = 0;
+		len = avail;
 	}
 
-	return CountIdx;
+	/** Count the line ends being consumed */
+	BufferC_Spans(buf, len, span);
+	for (i = 0; i < 2; i++)
+	{
+		p = span[i].data;
+		end = span[i].data + span[i].len;
+		while ((p < end) && (NULL != (p = memchr(p, '\n', (size_t)(end - p)))))
+		{
+			lines++;
+			p++;
+		}
+	}
+
+	buf->eol_out += lines;
+	buf->read += len;
+	BufferC_Size(buf);
 }
 
+/*******************************************************************************
+ *					STATIC FUNCTIONS
+ *******************************************************************************/
 /** @brief Compute the buffer size
  *
  * Computes the size of the allocated buffer and saves it
@@ -201,55 +253,32 @@ STATIC uint16_t BufferC_Scan(sCircularBufferC_t *buf, char val)
  */
 STATIC void BufferC_Size(sCircularBufferC_t *buf)
 {
-	if (buf->write == buf->read)
-	{
-		buf->size = 0;
-	}
-	else if (buf->write > buf->read)
-	{
-		buf->size = (buf->write - buf->read);
-	}
-	else
-	{
-		buf->size = BUFFER_C_SIZE - buf->read + buf->write + 1;
-	}
+	buf->size = (uint16_t)(buf->write - buf->read);
 }
 
-/** @brief Compute the next index
+/** @brief Split into spans
  *
- * Computes the next index value for the buffer
+ * Split len chars from the read index into the part before the end of
+ * the buffer and the part wrapped to the start
  *
- * @param idx Index to increment
+ * @param *buf Pointer to the Circular Buffer
+ * @param len Number of chars
+ * @param span Two spans to fill
  *
- * @return Compensated Index
+ * @return None
  */
-STATIC uint16_t BufferC_NextIndex(uint16_t idx)
+STATIC void BufferC_Spans(sCircularBufferC_t *buf, uint16_t len, sBufferCSpan_t span[2])
 {
+	uint16_t idx = buf->read & BUFFER_C_MASK;
+	uint16_t first = BUFFER_C_SIZE - idx;
 
-	if (++idx == ACTUAL_BUFFER_C_SIZE)
+	if (first > len)
 	{
-		idx = 0;
+		first = len;
 	}
-	return idx;
-}
 
-/** @brief Compute the previous index
- *
- * Computes the previous index value for the buffer
- *
- * @param idx Index to decrement
- *
- * @return Compensated Index
- */
-STATIC uint16_t BufferC_PrevIndex(uint16_t idx)
-{
-	if (idx == 0)
-	{
-		idx = ACTUAL_BUFFER_C_SIZE - 1;
-	}
-	else
-	{
-		idx--;
-	}
-	return idx;
-}
\ No newline at end of file
+	span[0].data = &buf->buffer[idx];
+	span[0].len = first;
+	span[1].data = &buf->buffer[0];
+	span[1].len = len - first;
+}
@@ -48,8 +48,9 @@
  *							MACROS
  ************************************************************************/
 
-#define BUFFER_C_SIZE (4096)
+#define BUFFER_C_SIZE (4096) /**< Must be a power of two */
 #define ACTUAL_BUFFER_C_SIZE (BUFFER_C_SIZE + 1)
+#define BUFFER_C_MASK (BUFFER_C_SIZE - 1)
 
 /** @enum Char buffer status
  * Char buffer status
@@ -66,23 +67,37 @@ typedef enum
 } eBufferCStatus_t;
 
 /** @struct Circular Buffer struct
- * Circular buffer struct
+ * Circular buffer struct.  read and write run free and are masked
+ * with BUFFER_C_MASK on access.  The putc side (ISR) owns write and
+ * eol_in, the getc side (main loop) owns read and eol_out, so a
+ * complete line is seen without scanning.
  */
 typedef struct _CircularBufferC_t
 {
-	char buffer[ACTUAL_BUFFER_C_SIZE]; /**< Circular buffer */
-	uint16_t size;					   /**< size of buffer */
-	uint16_t read;					   /**< Read location */
-	uint16_t write;					   /**< Write location */
+	char buffer[ACTUAL_BUFFER_C_SIZE];	   /**< Circular buffer */
+	uint16_t size;						   /**< size of buffer (snapshot) */
+	volatile uint16_t read;				   /**< Read location */
+	volatile uint16_t write;			   /**< Write location */
+	volatile uint16_t eol_in;			   /**< '\n' written count */
+	volatile uint16_t eol_out;			   /**< '\n' read count */
 
 } sCircularBufferC_t;
 
+/** @struct Circular Buffer span
+ * Contiguous piece of buffer data, read in place
+ */
+typedef struct
+{
+	const char *data; /**< Start of span */
+	uint16_t len;	  /**< Length of span */
+} sBufferCSpan_t;
+
 /************************************************************************
  *					GLOBAL FUNCTION PROTOTYPES
  ************************************************************************/
 /** @brief Clear the buffer
  *
- *	Clear the char buffer
+ *	Clear the char buffer.  Only the indexes are reset.
  *
  *  @param *buf pointer to the char buffer
  *
@@ -147,4 +162,49 @@ eBufferCStatus_t BufferC_puts(sCircularBufferC_t *buf, char *val, uint16_t len);
  */
 eBufferCStatus_t BufferC_gets(sCircularBufferC_t *buf, char *str, uint16_t maxLen);
 
+/** @brief Line Ready
+ *
+ *  Check for a complete line (terminated with \n) without scanning
+ *
+ * @param *buf pointer to the char buffer
+ *
+ * @return Number of complete lines in the buffer
+ */
+uint16_t BufferC_Lines(sCircularBufferC_t *buf);
+
+/** @brief Peek Data
+ *
+ *  Get all unread data in place as up to two contiguous spans (before
+ *  and after the wrap).  Nothing is removed until BufferC_Commit.
+ *
+ * @param *buf pointer to the char buffer
+ * @param span Two spans to fill, unused span has len 0
+ *
+ * @return Total length of the spans
+ */
+uint16_t BufferC_Peek(sCircularBufferC_t *buf, sBufferCSpan_t span[2]);
+
+/** @brief Peek Line
+ *
+ *  Get the first complete line (through the \n) in place as up to two
+ *  contiguous spans.  Nothing is removed until BufferC_Commit.
+ *
+ * @param *buf pointer to the char buffer
+ * @param span Two spans to fill, unused span has len 0
+ *
+ * @return Line length, 0 if there is no complete line
+ */
+uint16_t BufferC_PeekLine(sCircularBufferC_t *buf, sBufferCSpan_t span[2]);
+
+/** @brief Commit Read
+ *
+ *  Remove data from the front of the buffer after a peek
+ *
+ * @param *buf pointer to the char buffer
+ * @param len Number of chars to remove
+ *
+ * @return None
+ */
+void BufferC_Commit(sCircularBufferC_t *buf, uint16_t len);
+
 #endif
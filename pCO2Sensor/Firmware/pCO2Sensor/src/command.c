@@ -63,6 +63,16 @@ void COMMAND_Process(void)
     found = NOT_FOUND;
     commandTable = CONSOLECMD_GetTable();
 
+    /** Registry settings first, as the pco2 config entries were */
+    if (true == CONSOLECMD_Param(&Command, pbuf, &result))
+    {
+      if (CONSOLECMD_OK != result)
+      {
+        Error(ERROR_MSG_01010011, 0);
+      }
+      found = IS_FOUND;
+    }
+
     while ((NULL != commandTable[cmdIdx].name) &&
            (NOT_FOUND == found) &&
            (cmdIdx < CONSOLECMD_INDEX_LEN))
@@ -76,7 +86,7 @@ void COMMAND_Process(void)
         result = commandTable[cmdIdx].execute(&Command, pbuf);
         if (CONSOLECMD_OK != result)
         {
-          Error(ERROR_MSG_01010011, LOG_Priority_Low);
+          Error(ERROR_MSG_01010011, 0);
         }
         found = IS_FOUND;
       }
@@ -151,15 +161,8 @@ void COMMAND_TerminalMode(void)
     }
     CONSOLEIO_SendStr(&Command, CONSOLE_PROMPT);
 
-    /** Wait for a command (or timeout) */
-    uint16_t count = COMMAND_TIMEOUT_SEC;
-    do
-    {
-      BSP_Hit_WD();
-      _delay_ms(1000);
-    } while ((strstr((char *)&CommandRxBuffer[0], "\r\n") == NULL) &&
-             (--count > 0));
-    if (count == 0)
+    /** Sleep until a full line arrives (or timeout) */
+    if (false == CONSOLEIO_WaitEvent(&CommandRxEvent, SYS_RX_EVENT_LINE, COMMAND_TIMEOUT_SEC))
     {
       break;
     }
@@ -216,6 +219,7 @@ void COMMAND_ClearBuffer(void)
 {
   memset((char *)&CommandRxBuffer[0], 0, SYSTEM_COMMAND_RX_BUFFER_LEN);
   pCommandRxBuffer = &CommandRxBuffer[0];
+  CommandRxEvent = 0;
 }
 /************************************************************************
  *					   Static Functions
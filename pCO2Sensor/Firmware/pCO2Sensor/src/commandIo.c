@@ -24,7 +24,7 @@ eCommandIoStatus_t COMMANDIO_Init(sUART_t *Command)
 
     if (BSP_OK != BSP_UART_Init(Command))
     {
-        Error(ERROR_MSG_0010, LOG_Priority_High);
+        Error(ERROR_MSG_0010, 0);
         return result;
     }
 
@@ -52,6 +52,17 @@ void CONSOLE_Process(void)
     found = NOT_FOUND;
     commandTable = CONSOLECMD_GetTable();
 
+    /** Registry settings first, as the pco2 config entries were */
+    if (true == CONSOLECMD_Param(&Console, pbuf, &result))
+    {
+      if (CONSOLECMD_OK != result)
+      {
+        Error(ERROR_MSG_01010011, 0);
+        __delay_cycles(500);
+      }
+      found = IS_FOUND;
+    }
+
     while ((NULL != commandTable[cmdIdx].name) &&
            (NOT_FOUND == found) &&
            (cmdIdx < CONSOLECMD_INDEX_LEN))
@@ -64,7 +75,7 @@ void CONSOLE_Process(void)
         result = commandTable[cmdIdx].execute(&Console, pbuf);
         if (CONSOLECMD_OK != result)
         {
-          Error(ERROR_MSG_01010011, LOG_Priority_Low);
+          Error(ERROR_MSG_01010011, 0);
           __delay_cycles(500);
         }
         found = IS_FOUND;
@@ -112,7 +123,7 @@ void CONSOLE_ProcessHotkey(void)
         result = commandTable[cmdIdx].execute(&Console, pbuf);
         if (CONSOLECMD_OK != result)
         {
-          Error(ERROR_MSG_01010012, LOG_Priority_Low);
+          Error(ERROR_MSG_01010012, 0);
         }
         found = IS_FOUND;
       }
@@ -173,14 +184,8 @@ void CONSOLE_TerminalMode(void)
     }
     CONSOLEIO_SendStr(&Console, CONSOLE_PROMPT);
 
-    /** Wait for a command (or timeout) */
-    uint16_t count = 3000;
-    do
-    {
-      BSP_Hit_WD();
-      _delay_ms(100);
-    } while ((strstr((char *)&ConsoleRxBuffer[0], "\r\n") == NULL) &&
-             (count-- > 0));
+    /** Sleep until a full line arrives (or timeout) */
+    CONSOLEIO_WaitEvent(&ConsoleRxEvent, SYS_RX_EVENT_LINE, CONSOLE_TIMEOUT_SEC);
 
     /** If timeout, return and go back to sleep */
     if (pConsoleRxBuffer == &ConsoleRxBuffer[0])
@@ -218,6 +223,7 @@ void CONSOLE_ClearBuffer(void)
 {
   memset((char *)&ConsoleRxBuffer[0], 0, SYSTEM_CONSOLE_RX_BUFFER_LEN);
   pConsoleRxBuffer = &ConsoleRxBuffer[0];
+  ConsoleRxEvent = 0;
 }
 /************************************************************************
  *					   Static Functions
@@ -55,6 +55,8 @@
 /************************************************************************
 *							MACROS
 ************************************************************************/
+#define CONSOLE_TIMEOUT_SEC (300)        /**< Terminal idle timeout */
+#define CONSOLE_HOTKEY_TIMEOUT_SEC (5)    /**< Wait for first key after wakeup */
 #define CONSOLE_PROMPT ("> ")
 #define PARAM_SEPARATER (' ')
 #define STR_ENDLINE ("\r\n")
@@ -27,30 +27,24 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_Report(sUART_t *pUART, const char buffer[]
 STATIC eConsoleCmdStatus_t CONSOLECMD_CShow(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_gps(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_idata(sUART_t *pUART, const char buffer[]);
+STATIC eConsoleCmdStatus_t CONSOLECMD_ibin(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_sdata(sUART_t *pUART, const char buffer[]);
+STATIC void CONSOLECMD_SdataRecord(sUART_t *pUART, const sSdLogRecord_t *rec);
 #endif
 STATIC eConsoleCmdStatus_t CONSOLECMD_time(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_SetBaudrate(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_Log(sUART_t *pUART, const char buffer[]);
+STATIC eConsoleCmdStatus_t CONSOLECMD_ErrLog(sUART_t *pUART, const char buffer[]);
+STATIC eConsoleCmdStatus_t CONSOLECMD_ErrClr(sUART_t *pUART, const char buffer[]);
 #ifdef INCLUDE_SCHEDULER_COMMANDS
 STATIC eConsoleCmdStatus_t CONSOLECMD_Tasks(sUART_t *pUART, const char buffer[]);
 #endif
 STATIC eConsoleCmdStatus_t CONSOLECMD_Startup(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_I2CFailures(sUART_t *pUART, const char buffer[]);
+STATIC eConsoleCmdStatus_t CONSOLECMD_I2CFaults(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_SerialNum(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_Sample(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_Span(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_Span2(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_SpanDiff(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_Equil(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_Warmup(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_SpanFlowOn( sUART_t *pUART, const char buffer[] );
-STATIC eConsoleCmdStatus_t CONSOLECMD_Purge(sUART_t *pUART, const char buffer[] );
-STATIC eConsoleCmdStatus_t CONSOLECMD_PumpOn(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_PumpOff(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_SampleCO2(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_Vent(sUART_t *pUART, const char buffer[]);
-STATIC eConsoleCmdStatus_t CONSOLECMD_Heater(sUART_t *pUART, const char buffer[]);
+STATIC eConsoleCmdStatus_t CONSOLECMD_Set(sUART_t *pUART, const char buffer[]);
+STATIC eConsoleCmdStatus_t CONSOLECMD_Sequence(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_TakeSample(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_TakeSample_with_Purge(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_TakeSample_Quiet(sUART_t *pUART, const char buffer[]);
@@ -125,6 +119,8 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_HOTKEY_SamplingMode(sUART_t *pUART, const
 STATIC eConsoleCmdStatus_t CONSOLECMD_HOTKEY_SamplingSchedule(sUART_t *pUART, const char buffer[]);
 STATIC eConsoleCmdStatus_t CONSOLECMD_HOTKEY_ReturnToSleep(sUART_t *pUART, const char buffer[]);
 STATIC bool is_write_cmd(const char buffer[]);
+STATIC void CONSOLECMD_ParamFail(sUART_t *pUART, const char *token, eParamStatus_t status);
+STATIC bool CONSOLECMD_ArgU32(const char buffer[], const char *key, uint32_t *value);
 
 STATIC bool verify_test_mode(sUART_t *pUART, eConsoleSubmode_t mode);
 /************************************************************************
@@ -146,10 +142,13 @@ STATIC const sConsoleCommandTable_t mConsoleCommandTable[] =
 #endif
         {"startup", &CONSOLECMD_Startup, HELP("Display System Startup Count")},
         {"i2cfail", &CONSOLECMD_I2CFailures, HELP("Display I2C Failure Restarts")},
+        {"i2cfault", &CONSOLECMD_I2CFaults, HELP("Display I2C Fault Counters")},
         {"sreset", &CONSOLECMD_SReset, HELP("Software Reset")},
         {"time", &CONSOLECMD_time, HELP("Sensor Date & Time (yy mm dd hh mm ss")},
         {"baud", &CONSOLECMD_SetBaudrate, HELP("Set CMD Baudrate")},
         {"log", &CONSOLECMD_Log, HELP("Set the Log Level (debug or info)")},
+        {"errlog", &CONSOLECMD_ErrLog, HELP("Display the Error History (oldest first)")},
+        {"errclr", &CONSOLECMD_ErrClr, HELP("Clear the Error History")},
         /** TELOS Compliant Commands */
 #ifdef INCLUDE_TELOS_COMMANDS
         {"", NULL, HELP("\r\n*** TELOS COMPLIANT COMMANDS ***")},
@@ -157,29 +156,19 @@ STATIC const sConsoleCommandTable_t mConsoleCommandTable[] =
         {"gps", &CONSOLECMD_gps, HELP("GPS Data (-2 for PCO2 Sensor)")},
         {"time", &CONSOLECMD_time, HELP("Sensor Date & Time (yy mm dd hh mm ss")},
         {"idata", &CONSOLECMD_idata, HELP("Iridium Data")},
-        {"sdata", &CONSOLECMD_sdata, HELP("Sensor Raw Data")},
+        {"ibin", &CONSOLECMD_ibin, HELP("Iridium Data, binary SBD message in hex")},
+        {"sdata", &CONSOLECMD_sdata, HELP("Sensor Raw Data (from=<run>|since=<epoch> count=<n> for history)")},
         {"who", &CONSOLECMD_SerialNum, HELP("Serial Number")},
 #endif
         /** pCO2 Individual Configuration Commands (Compatible with MApCO2) */
         {"", NULL, HELP("\r\n*** PCO2 CONFIG (MApCO2 Compatible) ***")},
-        {"span", &CONSOLECMD_Span, HELP("Span Gas Concentration (ppm)")},
-        {"span2", &CONSOLECMD_Span2, HELP("Span Gas Concentration (ppm)")},
-        {"spandiff", &CONSOLECMD_SpanDiff, HELP("Span Pressure Difference (kPa)")},
-        {"equil", &CONSOLECMD_Equil, HELP("Length of Equilibration Pump (sec)")},
-        {"warmup", &CONSOLECMD_Warmup, HELP("Length of LICOR Warmup (sec)")},
-        {"pumpon", &CONSOLECMD_PumpOn, HELP("Length of pump on during cycle (sec)")},
-        {"pumpoff", &CONSOLECMD_PumpOff, HELP("Length of pump off during a cycle (sec)")},
-        {"spanflow", &CONSOLECMD_SpanFlowOn, HELP("Span Flow ON duration (sec)")},
-        {"purge", &CONSOLECMD_Purge, HELP("Purge duration (sec)")},
-        {"sampleco2", &CONSOLECMD_SampleCO2, HELP("Length of data sample in cycle (sec)")},
-        {"vent", &CONSOLECMD_Vent, HELP("Legth of delay between open/close vent (sec)")},
-        {"heater", &CONSOLECMD_Heater, HELP("Licor Heater OFF or ON")},
+        {"set", &CONSOLECMD_Set, HELP("Set several, all or none (set a=1 b=2 ...)")},
+        {"seq", &CONSOLECMD_Sequence, HELP("Run sequence (Z=zero S=span E=equil A=air P=purge)")},
         {"o2int", &CONSOLECMD_O2Interval, HELP("Set interval between O2 cal (days)")},
         {"o2time", &CONSOLECMD_O2Time, HELP("Time of day for O2 Cal (hh:mm:ss)")},
         
 
         /** Individual Status Commands */
-        {"sample", &CONSOLECMD_Sample, HELP("Data Sampling Interval (Hz)")},
 
         /** Commands to start Logging */
         {"", NULL, HELP("\r\n*** LOGGING COMMANDS ***")},
@@ -318,6 +307,7 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_Help(sUART_t *pUART, const char buffer[])
 {
   uint32_t i;
   uint32_t tableLength;
+  const sParam_t *param;
   eConsoleCmdStatus_t result = CONSOLECMD_OK;
 
   IGNORE_UNUSED_VARIABLE(buffer);
@@ -335,6 +325,24 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_Help(sUART_t *pUART, const char buffer[])
 #endif
   }
 
+  /** Registry settings (name= value) */
+  CONSOLEIO_SendStr(pUART, "\r\n*** PCO2 SETTINGS (MApCO2 Compatible) ***\r\n");
+  for (i = 0u; i < PARAM_Count(); i++)
+  {
+    param = PARAM_Entry(i);
+    CONSOLEIO_SendStr(pUART, (char *)param->name);
+#if CONSOLE_COMMAND_MAX_HELP_LENGTH > 0
+    CONSOLEIO_SendStr(pUART, "\r\t\t: ");
+    CONSOLEIO_SendStr(pUART, (char *)param->help);
+    if ('\0' != param->unit[0])
+    {
+      sprintf(sendstr, " (%s)", param->unit);
+      CONSOLEIO_SendStr(pUART, sendstr);
+    }
+#endif
+    CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+  }
+
   return result;
 }
 
@@ -435,9 +443,7 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_Report(sUART_t *pUART, const char buffer[]
   char temp[64];
   memset(temp, 0, 64);
 
-  float temp_f = 0.0;
-  uint32_t temp_u32 = 0;
-  uint8_t temp_u8 = 0;
+  uint16_t i;
 
   sTimeReg_t runtime;
 
@@ -462,52 +468,17 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_Report(sUART_t *pUART, const char buffer[]
   sprintf(temp, "time= %s\r\n", timestamp);
   strcat(sendstr, temp);
 
-  temp_f = PCO2_GetSpan();
-  sprintf(temp, "span= %f\r\n", temp_f);
-  strcat(sendstr, temp);
-
-  temp_f = PCO2_GetSpanDiff();
-  sprintf(temp, "spandiff= %f\r\n", temp_f);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetEquil();
-  sprintf(temp, "equil= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetWarmup();
-  sprintf(temp, "warmup= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetSpanFlowON();
-  sprintf(temp, "spanflow= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetPurge();
-  sprintf(temp, "purge= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetPumpON();
-  sprintf(temp, "pumpon= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetPumpOFF();
-  sprintf(temp, "pumpoff= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetSampleCO2();
-  sprintf(temp, "sampleco2= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u32 = PCO2_GetVent();
-  sprintf(temp, "vent= %lu\r\n", temp_u32);
-  strcat(sendstr, temp);
-
-  temp_u8 = PCO2_GetHeater();
-  sprintf(temp, "heater= %d\r\n", temp_u8);
-  strcat(sendstr, temp);
+  /** Settings, registry order */
+  for (i = 0; i < PARAM_Count(); i++)
+  {
+    PARAM_Format(PARAM_Entry(i), temp);
+    strcat(temp, STR_ENDLINE);
+    strcat(sendstr, temp);
+  }
 
-  temp_u8 = PCO2_GetSample();
-  sprintf(temp, "sample= %d\r\n", temp_u8);
+  char seq[PCO2_SEQ_LEN];
+  PCO2_GetSequence(seq);
+  sprintf(temp, "seq= %s\r\n", seq);
   strcat(sendstr, temp);
 
   char temp2[16];
@@ -1337,6 +1308,44 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_Log(sUART_t *pUART, const char buffer[])
   result = CONSOLECMD_OK;
   return result;
 }
+
+STATIC eConsoleCmdStatus_t CONSOLECMD_ErrLog(sUART_t *pUART, const char buffer[])
+{
+  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
+  sErrLogEntry_t entry;
+  char str[100];
+  uint16_t i;
+
+  IGNORE_UNUSED_VARIABLE(buffer);
+  CONSOLEIO_SendStr(pUART, "RUN,EPOCH,ID,ARG,TEXT");
+  CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+
+  for (i = 0; true == ERRLOG_Get(&ErrorLog, i, &entry); i++)
+  {
+    BSP_Hit_WD();
+    sprintf(str, "%u,%lu,%08lX,%lu,%s", entry.run, entry.epoch,
+            ERRLOG_Id((eErrorCode_t)entry.code), entry.arg,
+            ERRLOG_Text((eErrorCode_t)entry.code));
+    CONSOLEIO_SendStr(pUART, str);
+    CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+  }
+
+  result = CONSOLECMD_OK;
+  return result;
+}
+
+STATIC eConsoleCmdStatus_t CONSOLECMD_ErrClr(sUART_t *pUART, const char buffer[])
+{
+  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
+
+  IGNORE_UNUSED_VARIABLE(buffer);
+  ERRLOG_Clear(&ErrorLog);
+  CONSOLEIO_SendStr(pUART, "Error History Cleared");
+  CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+
+  result = CONSOLECMD_OK;
+  return result;
+}
 #ifdef INCLUDE_TELOS_COMMANDS
 STATIC eConsoleCmdStatus_t CONSOLECMD_idata(sUART_t *pUART, const char buffer[])
 {
@@ -1352,19 +1361,158 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_idata(sUART_t *pUART, const char buffer[])
   return result;
 }
 
-STATIC eConsoleCmdStatus_t CONSOLECMD_sdata(sUART_t *pUART, const char buffer[])
+STATIC eConsoleCmdStatus_t CONSOLECMD_ibin(sUART_t *pUART, const char buffer[])
 {
   eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  
-  PCO2_Get_sdata();
-  
-  /** Request sData from PCO2 module */
+  uint8_t *msg = (uint8_t *)&TELOS_IRID_BUF[SYS_IRIDIUM_BUFFER_HEADER_LENGTH];
+  uint16_t i;
+
   IGNORE_UNUSED_VARIABLE(buffer);
 
+  /** Pack behind the Iridium header */
+  TELOS_IRID_BUF_Len = PCO2_Pack_idata(msg, SYS_IRIDIUM_MSG_BUFFER_LENGTH);
+  if (0u == TELOS_IRID_BUF_Len)
+  {
+    return result;
+  }
+
+  for (i = 0; i < TELOS_IRID_BUF_Len; i++)
+  {
+    sprintf(&sendstr[2u * i], "%02X", msg[i]);
+  }
+  strcat(sendstr, STR_ENDLINE);
+  CONSOLEIO_SendStr(pUART, sendstr);
+
+  result = CONSOLECMD_OK;
+  return result;
+}
+
+STATIC eConsoleCmdStatus_t CONSOLECMD_sdata(sUART_t *pUART, const char buffer[])
+{
+  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
+  const sSdLogRecord_t *rec;
+  uint32_t from = 0;
+  uint32_t count = 1;
+  uint16_t idx = 0;
+  uint16_t i;
+  bool found;
+  char str[48];
+
+  /** No arguments, the last run as before */
+  if (NULL == strchr(buffer, '='))
+  {
+    PCO2_Get_sdata();
+    result = CONSOLECMD_OK;
+    return result;
+  }
+
+  /** Page of the history: from=<run> or since=<epoch>, count=<n> */
+  if (true == CONSOLECMD_ArgU32(buffer, "from=", &from))
+  {
+    if (from > 0xFFFFu)
+    {
+      return result;
+    }
+    found = SDLOG_FindRun(&SdataLog, (uint16_t)from, &idx);
+  }
+  else if (true == CONSOLECMD_ArgU32(buffer, "since=", &from))
+  {
+    found = SDLOG_FindEpoch(&SdataLog, from, &idx);
+  }
+  else
+  {
+    return result;
+  }
+
+  if ((NULL != strstr(buffer, "count=")) &&
+      ((false == CONSOLECMD_ArgU32(buffer, "count=", &count)) || (0u == count)))
+  {
+    return result;
+  }
+
+  if (false == found)
+  {
+    CONSOLEIO_SendStr(pUART, "- Not Found");
+    CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+    result = CONSOLECMD_OK;
+    return result;
+  }
+
+  CONSOLEIO_SendStr(pUART, "H,RUN,EPOCH,CRC,xCO2(sw),xCO2(air)\r\n");
+  CONSOLEIO_SendStr(pUART, "M,RUN,State,N,CO2(ppm),CO2_SD(ppm),Li_Temp(C),Li_Pres(kPa),RH(%),RH_T(C),O2(%)\r\n");
+  CONSOLEIO_SendStr(pUART, "S,RUN,State,IDX,CO2(0.1ppm),Li_Temp(0.01C),Li_Pres(0.01kPa),RH(0.01%)\r\n");
+
+  for (i = 0; (i < count) && (NULL != (rec = SDLOG_Get(&SdataLog, idx))); i++, idx++)
+  {
+    CONSOLECMD_SdataRecord(pUART, rec);
+  }
+
+  /** Where the next page starts */
+  rec = SDLOG_Get(&SdataLog, idx);
+  if (NULL != rec)
+  {
+    sprintf(str, "NEXT,%u", rec->run);
+  }
+  else
+  {
+    sprintf(str, "END");
+  }
+  CONSOLEIO_SendStr(pUART, str);
+  CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+
   result = CONSOLECMD_OK;
   return result;
 }
 
+/** @brief Send sdata History Record
+ *
+ *  A record that fails its CRC is sent as its H line only.
+ *
+ *  @param *pUART Pointer to UART
+ *  @param *rec Record
+ *
+ *  @return None
+ */
+STATIC void CONSOLECMD_SdataRecord(sUART_t *pUART, const sSdLogRecord_t *rec)
+{
+  const sSdLogMode_t *mode;
+  const sSdLogSample_t *s;
+  bool valid = SDLOG_Valid(rec);
+  uint8_t m;
+  uint16_t i;
+  char str[128];
+
+  BSP_Hit_WD();
+  sprintf(str, "H,%u,%lu,%s,%.3f,%.3f", rec->run, rec->epoch,
+          (true == valid) ? "OK" : "BAD", rec->sw_xco2, rec->air_xco2);
+  CONSOLEIO_SendStr(pUART, str);
+  CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+  if (false == valid)
+  {
+    return;
+  }
+
+  for (m = 0; m < SDLOG_MODES; m++)
+  {
+    BSP_Hit_WD();
+    mode = &rec->mode[m];
+    sprintf(str, "M,%u,%s,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f",
+            rec->run, SDLOG_ModeName(m), mode->n, mode->co2, mode->co2_sd,
+            mode->temp, mode->pres, mode->rh, mode->rh_temp, mode->o2);
+    CONSOLEIO_SendStr(pUART, str);
+    CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+
+    for (i = 0; i < mode->kept; i++)
+    {
+      s = &mode->sample[i];
+      sprintf(str, "S,%u,%s,%u,%u,%d,%u,%u", rec->run, SDLOG_ModeName(m),
+              i, s->co2, s->temp, s->pres, s->rh);
+      CONSOLEIO_SendStr(pUART, str);
+      CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+    }
+  }
+}
+
 #endif
 
 
@@ -1414,6 +1562,33 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_I2CFailures(sUART_t *pUART, const char buf
   return result;
 }
 
+STATIC eConsoleCmdStatus_t CONSOLECMD_I2CFaults(sUART_t *pUART, const char buffer[])
+{
+  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
+  const char *names[] = {"RTC", "RH"};
+  const sI2CFaults_t *faults[] = {&RTC.I2C.faults, &SHT35.I2C.faults};
+  char str[40];
+  uint8_t i;
+  uint8_t f;
+
+  IGNORE_UNUSED_VARIABLE(buffer);
+  for (i = 0; i < SIZE_OF(faults); i++)
+  {
+    CONSOLEIO_SendStr(pUART, (char *)names[i]);
+    for (f = 0; f < I2C_FAULT_CNT; f++)
+    {
+      sprintf(str, " %s=%u", I2CBUS_FaultName((eI2CFault_t)f), faults[i]->count[f]);
+      CONSOLEIO_SendStr(pUART, str);
+    }
+    sprintf(str, " RECOVERED=%u FAILED=%u", faults[i]->recovered, faults[i]->unrecovered);
+    CONSOLEIO_SendStr(pUART, str);
+    CONSOLEIO_SendStr(pUART, STR_ENDLINE);
+  }
+
+  result = CONSOLECMD_OK;
+  return result;
+}
+
 STATIC eConsoleCmdStatus_t CONSOLECMD_SerialNum(sUART_t *pUART, const char buffer[])
 {
   eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
@@ -1452,297 +1627,50 @@ STATIC eConsoleCmdStatus_t CONSOLECMD_SerialNum(sUART_t *pUART, const char buffe
   return result;
 }
 
-STATIC eConsoleCmdStatus_t CONSOLECMD_Sample(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint8_t sample = 0;
-
-  /** Get the Sample */
-  sample = PCO2_GetSample();
-  sprintf(sendstr, "sample= %u\r\n", sample);
-
-  /** Send the sample */
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_Span(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-
-  float span = 0.0;
-
-  /** Check for write command */
-  if (true == is_write_cmd(buffer))
-  {
-    span = atof(&buffer[2]);
-    PCO2_SetSpan(span);
-  }
-
-  memset(sendstr, 0, 64);
-  span = PCO2_GetSpan();
-
-  sprintf(sendstr, "span= %.2f\r\n", span);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_Span2(sUART_t *pUART, const char buffer[])
+STATIC eConsoleCmdStatus_t CONSOLECMD_Set(sUART_t *pUART, const char buffer[])
 {
   eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
+  eParamStatus_t status;
+  sParamSet_t set;
+  uint8_t i;
 
-  float span = 0.0;
-
-  /** Check for write command */
-  if (true == is_write_cmd(buffer))
-  {
-    span = atof(&buffer[2]);
-    PCO2_SetSpan2(span);
-  }
-
-  memset(sendstr, 0, 64);
-  span = PCO2_GetSpan2();
-
-  sprintf(sendstr, "span2= %.2f\r\n", span);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_SpanDiff(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  float spandiff = 0.0;
-
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
-  {
-    spandiff = atof(&buffer[2]);
-    PCO2_SetSpanDiff(spandiff);
-  }
-
-  spandiff = PCO2_GetSpanDiff();
-  sprintf(sendstr, "spandiff= %0.2f\r\n", spandiff);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_Equil(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t eqsecs = 0;
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
-  {
-    eqsecs = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetEquil(eqsecs);
-  }
-
-  eqsecs = PCO2_GetEquil();
-  sprintf(sendstr, "equil= %lu\r\n", eqsecs);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_Warmup(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t warmup = 0;
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
-  {
-    warmup = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetWarmup(warmup);
-  }
-
-  warmup = PCO2_GetWarmup();
-  sprintf(sendstr, "warmup= %lu\r\n", warmup);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_SpanFlowOn( sUART_t *pUART, const char buffer[] )
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t spansecs = 0;
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
-  {
-    spansecs = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetSpanFlowON(spansecs);
-  }
-
-  spansecs = PCO2_GetSpanFlowON();
-  sprintf(sendstr, "spanflow= %lu\r\n", spansecs);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_Purge( sUART_t *pUART, const char buffer[] )
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t purgesecs = 0;
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
-  {
-    purgesecs = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetPurge(purgesecs);
-  }
-
-  purgesecs = PCO2_GetPurge();
-  sprintf(sendstr, "purge= %lu\r\n", purgesecs);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_PumpOn(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t pumpsecs = 0;
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
-  {
-    pumpsecs = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetPumpON(pumpsecs);
-  }
-
-  pumpsecs = PCO2_GetPumpON();
-  sprintf(sendstr, "pumpon= %lu\r\n", pumpsecs);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_PumpOff(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t pumpsecs = 0;
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
-  {
-    pumpsecs = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetPumpOFF(pumpsecs);
-  }
-
-  pumpsecs = PCO2_GetPumpOFF();
-  sprintf(sendstr, "pumpoff= %lu\r\n", pumpsecs);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_SampleCO2(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t co2secs = 0;
-
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
+  /** Nothing is written unless every pair passes */
+  status = PARAM_SetMany(buffer, &set);
+  if (PARAM_OK != status)
   {
-    co2secs = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetSampleCO2(co2secs);
+    CONSOLECMD_ParamFail(pUART, set.bad, status);
+    return result;
   }
 
-  co2secs = PCO2_GetSampleCO2();
-  sprintf(sendstr, "sampleco2= %lu\r\n", co2secs);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
-  result = CONSOLECMD_OK;
-  return result;
-}
-
-STATIC eConsoleCmdStatus_t CONSOLECMD_Vent(sUART_t *pUART, const char buffer[])
-{
-  eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
-  memset(sendstr, 0, 64);
-  uint32_t ventsecs = 0;
-
-  /** Check for write or read command */
-  if (true == is_write_cmd(buffer))
+  for (i = 0; i < set.cnt; i++)
   {
-    ventsecs = strtoul(&buffer[2], NULL, 10);
-    PCO2_SetVent(ventsecs);
+    PARAM_Format(set.param[i], sendstr);
+    CONSOLEIO_SendStr(pUART, sendstr);
+    CONSOLEIO_SendStr(pUART, STR_ENDLINE);
   }
 
-  /** Get the Vent time */
-  ventsecs = PCO2_GetVent();
-  sprintf(sendstr, "vent= %lu\r\n", ventsecs);
-
-  CONSOLEIO_SendStr(pUART, sendstr);
-
   result = CONSOLECMD_OK;
   return result;
 }
 
-STATIC eConsoleCmdStatus_t CONSOLECMD_Heater(sUART_t *pUART, const char buffer[])
+STATIC eConsoleCmdStatus_t CONSOLECMD_Sequence(sUART_t *pUART, const char buffer[])
 {
   eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
   memset(sendstr, 0, 64);
-  uint8_t heater = 0;
+  char seq[PCO2_SEQ_LEN];
 
   /** Check for write or read command */
   if (true == is_write_cmd(buffer))
   {
-    switch (buffer[2])
+    if (PCO2_OK != PCO2_SetSequence(&buffer[2]))
     {
-    case '0':
-      heater = 0;
-      break;
-    case '1':
-      heater = 1;
-      break;
-    default:
       return result;
-      break;
     }
-
-    /** Set the Heater to Commanded State */
-    PCO2_SetHeater(heater);
   }
 
-  /** Get Heater State */
-  heater = PCO2_GetHeater();
-  sprintf(sendstr, "heater= %u\r\n", heater);
+  PCO2_GetSequence(seq);
+  sprintf(sendstr, "seq= %s\r\n", seq);
 
-  /** Send Heater State */
   CONSOLEIO_SendStr(pUART, sendstr);
 
   result = CONSOLECMD_OK;
@@ -3291,6 +3219,87 @@ STATIC bool is_write_cmd(const char buffer[])
   return result;
 }
 
+/** @brief Report a Rejected Setting
+ *
+ *  "token- reason".  An out of range value also gets the limits.
+ *
+ *  @param *pUART Port
+ *  @param *token Failing name or name=value, NULL for none
+ *  @param status Reason
+ *
+ *  @return None
+ */
+STATIC void CONSOLECMD_ParamFail(sUART_t *pUART, const char *token, eParamStatus_t status)
+{
+  const sParam_t *param = NULL;
+  char name[24];
+  uint8_t i = 0;
+
+  if (NULL == token)
+  {
+    CONSOLEIO_SendStr(pUART, "Usage: set name=value name=value ...\r\n");
+    return;
+  }
+
+  while ((i < (sizeof(name) - 1u)) && (' ' != token[i]) && ('\r' != token[i]) &&
+         ('\n' != token[i]) && ('\0' != token[i]))
+  {
+    name[i] = token[i];
+    i++;
+  }
+  name[i] = '\0';
+  param = PARAM_Find(token);
+
+  switch (status)
+  {
+  case PARAM_RANGE:
+    sprintf(sendstr, "%s- Out of Range (%.*f to %.*f)\r\n", name,
+            param->decimals, param->min, param->decimals, param->max);
+    break;
+  case PARAM_UNKNOWN:
+    sprintf(sendstr, "%s- Not Found\r\n", name);
+    break;
+  case PARAM_READ_ONLY:
+    sprintf(sendstr, "%s- Read Only\r\n", name);
+    break;
+  default:
+    sprintf(sendstr, "%s- Bad Value\r\n", name);
+    break;
+  }
+
+  CONSOLEIO_SendStr(pUART, sendstr);
+}
+
+/** @brief Get Numeric Argument
+ *
+ *  Finds "key" (with its '=') in the buffer and reads the unsigned
+ *  number after it.
+ *
+ *  @param buffer Arguments
+ *  @param *key Key, e.g. "count="
+ *  @param *value Number out
+ *
+ *  @return true if the key is there with a number
+ */
+STATIC bool CONSOLECMD_ArgU32(const char buffer[], const char *key, uint32_t *value)
+{
+  const char *p = strstr(buffer, key);
+
+  if (NULL == p)
+  {
+    return false;
+  }
+
+  p += strlen(key);
+  if (0 == isdigit((unsigned char)*p))
+  {
+    return false;
+  }
+
+  *value = strtoul(p, NULL, 10);
+  return true;
+}
+
 STATIC eConsoleCmdStatus_t CONSOLECMD_HOTKEY_TerminalMode(sUART_t *pUART, const char buffer[])
 {
   eConsoleCmdStatus_t result = CONSOLECMD_FAIL;
@@ -3403,6 +3412,39 @@ STATIC bool verify_test_mode(sUART_t *pUART, eConsoleSubmode_t mode)
   return status;
 }
 
+bool CONSOLECMD_Param(sUART_t *pUART, const char buffer[], eConsoleCmdStatus_t *pResult)
+{
+  const sParam_t *param = PARAM_Find(buffer);
+  eParamStatus_t status = PARAM_OK;
+
+  if (NULL == param)
+  {
+    return false;
+  }
+
+  /** Check for write or read command */
+  buffer += strlen(param->name);
+  if (true == is_write_cmd(buffer))
+  {
+    status = PARAM_Set(param, &buffer[2]);
+  }
+
+  if (PARAM_OK == status)
+  {
+    PARAM_Format(param, sendstr);
+    strcat(sendstr, STR_ENDLINE);
+    CONSOLEIO_SendStr(pUART, sendstr);
+    *pResult = CONSOLECMD_OK;
+  }
+  else
+  {
+    CONSOLECMD_ParamFail(pUART, param->name, status);
+    *pResult = CONSOLECMD_FAIL;
+  }
+
+  return true;
+}
+
 const sConsoleCommandTable_t *CONSOLECMD_GetTable(void)
 {
   return &mConsoleCommandTable[0];
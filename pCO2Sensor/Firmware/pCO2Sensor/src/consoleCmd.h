@@ -55,6 +55,7 @@
 #include "sysinfo.h"
 #include "LED.h"
 #include "sht35.h"
+#include "param.h"
 
 /************************************************************************
  *                               MACROS
@@ -83,7 +84,7 @@
 #endif
 
 #define CONSOLECMD_SENDSTR_LEN (1450)
-#define CONSOLECMD_INDEX_LEN  102//(100)
+#define CONSOLECMD_INDEX_LEN  (140)
 /************************************************************************
  *                       Structs & Enums
  ************************************************************************/
@@ -145,6 +146,19 @@ extern const sConsoleHotkeyTable_t mConsoleHotkeyTable[10];
  */
 const sConsoleCommandTable_t *CONSOLECMD_GetTable(void);
 
+/** @brief Run a Registry Setting
+ *
+ *  Get ("name") or set ("name= value") a registry parameter.  The
+ *  console and command ports try this before the command table.
+ *
+ *  @param *pUART Port
+ *  @param buffer Received line
+ *  @param *pResult Command result out
+ *
+ *  @return true if the line named a registry parameter
+ */
+bool CONSOLECMD_Param(sUART_t *pUART, const char buffer[], eConsoleCmdStatus_t *pResult);
+
 /** @brief Get Console Hotkey Table
  *
  * Return the Console Hotkey Table
@@ -24,7 +24,7 @@ eConsoleIoStatus_t CONSOLEIO_Init(sUART_t *Console)
 
   if (BSP_OK != BSP_UART_Init(Console))
   {
-    Error(ERROR_MSG_01010008, LOG_Priority_High);
+    Error(ERROR_MSG_01010008, 0);
     return result;
   }
 
@@ -88,4 +88,34 @@ eConsoleIoStatus_t CONSOLEIO_SendStr(sUART_t *pUART, const char *buf)
 {
   BSP_UART_puts(pUART, buf, strlen(buf));
   return CONSOLEIO_OK;
-}
\ No newline at end of file
+}
+
+bool CONSOLEIO_WaitEvent(volatile uint8_t *pEvent, uint8_t mask, uint16_t seconds)
+{
+  volatile sSysTimer_t *t = &sysinfo.rxTimer;
+
+  while ((0 == (*pEvent & mask)) && (seconds > 0))
+  {
+    /** Expire on the next RTC tick */
+    t->tCounter = 0;
+    t->tFlag = true;
+
+    /** Check and sleep with interrupts off so a wakeup is not lost */
+    __disable_interrupt();
+    if ((0 == (*pEvent & mask)) && (true == t->tFlag))
+    {
+      __bis_SR_register(LPM0_bits | GIE);
+      __no_operation();
+    }
+    __enable_interrupt();
+
+    BSP_Hit_WD();
+    if (false == t->tFlag)
+    {
+      seconds--;
+    }
+  }
+  t->tFlag = false;
+
+  return (0 != (*pEvent & mask));
+}
@@ -38,6 +38,7 @@
 *			        STANDARD LIBRARIES
 ************************************************************************/
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdio.h>
 #ifndef UNIT_TESTING
 #include <stdlib.h>
@@ -122,4 +123,18 @@ eConsoleIoStatus_t CONSOLEIO_Send(sUART_t *pUART, char *buf, uint16_t bufLen, ui
  * @return result
  */
 eConsoleIoStatus_t CONSOLEIO_SendStr(sUART_t *pUART, const char *buf);
+
+/** @brief Console IO Wait for Receive Event
+ *
+ * Sleep in LPM0 until the UART ISR raises one of the requested receive
+ * events or the timeout expires.  The watchdog is hit on each 1 second
+ * RTC tick, so nothing polls the buffer while waiting.
+ *
+ * @param *pEvent ConsoleRxEvent or CommandRxEvent
+ * @param mask SYS_RX_EVENT_BYTE and/or SYS_RX_EVENT_LINE
+ * @param seconds Timeout in seconds
+ *
+ * @return true if the event was raised, false on timeout
+ */
+bool CONSOLEIO_WaitEvent(volatile uint8_t *pEvent, uint8_t mask, uint16_t seconds);
 #endif // _CONSOLEIO_H
@@ -0,0 +1,43 @@
+/** @file eqtime.c
+ *  @brief Equilibration pump timing
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note
+ *
+ *  @bug  No known bugs
+ */
+#include "eqtime.h"
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+uint16_t EQTIME_Target(const sEqTime_t *t)
+{
+  if ((true == t->slope) && (t->minimum < t->equil))
+  {
+    return t->minimum;
+  }
+  return t->equil;
+}
+
+uint16_t EQTIME_Prequil(const sEqTime_t *t)
+{
+  uint16_t target = EQTIME_Target(t);
+
+  return (target > t->warmup) ? (target - t->warmup) : target;
+}
+
+uint16_t EQTIME_Hold(const sEqTime_t *t, uint16_t prequil, uint16_t warmup)
+{
+  uint32_t pumped = (uint32_t)prequil + warmup;
+  uint16_t target = EQTIME_Target(t);
+
+  return (pumped < target) ? (uint16_t)(target - pumped) : 0u;
+}
@@ -0,0 +1,80 @@
+/** @file eqtime.h
+ *  @brief Equilibration pump timing
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note The equilibrator pumps with the Licor off (prequil), then keeps
+ *  @note pumping while the Licor warms up.  The adaptive warmup can end
+ *  @note early, so the pumped time is topped up (hold) to the target
+ *  @note before EPON sampling or the slope monitor starts.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _EQTIME_H
+#define _EQTIME_H
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
+/**
+ * @struct Equilibration Timing Settings
+ */
+typedef struct
+{
+  uint16_t equil;   /**< Total equilibration time (seconds) */
+  uint16_t warmup;  /**< Configured Licor warmup (seconds) */
+  bool slope;       /**< End equilibration on CO2 slope */
+  uint16_t minimum; /**< Minimum pump time with slope end (seconds) */
+} sEqTime_t;
+
+/************************************************************************
+ *					   Functions Prototypes
+ ************************************************************************/
+/** @brief Target Pump Time
+ *
+ *  Pumped time that must pass before the Licor samples.  The slope
+ *  minimum if the slope end point is on and shorter, otherwise equil.
+ *
+ *  @param *t Settings
+ *
+ *  @return Target (seconds)
+ */
+uint16_t EQTIME_Target(const sEqTime_t *t);
+
+/** @brief Licor-off Pump Time
+ *
+ *  Target less the configured warmup, or the whole target if the warmup
+ *  is as long.
+ *
+ *  @param *t Settings
+ *
+ *  @return Prequil (seconds)
+ */
+uint16_t EQTIME_Prequil(const sEqTime_t *t);
+
+/** @brief Pump Hold after Warmup
+ *
+ *  Time to keep pumping after a warmup of the given length so prequil,
+ *  warmup and hold reach the target.
+ *
+ *  @param *t Settings
+ *  @param prequil Licor-off pump time that ran (seconds)
+ *  @param warmup Actual warmup (seconds)
+ *
+ *  @return Hold (seconds)
+ */
+uint16_t EQTIME_Hold(const sEqTime_t *t, uint16_t prequil, uint16_t warmup);
+
+#endif // _EQTIME_H
@@ -0,0 +1,145 @@
+/** @file errlog.c
+ *  @brief Error code lookups and the persistent error history
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *  @bug  No known bugs
+ */
+#include "errlog.h"
+
+/************************************************************************
+ *					        Static Variables
+ ************************************************************************/
+/** Id and text of each code, in eErrorCode_t order */
+#define ERROR_ENTRY(code, id, text) (id),
+STATIC const uint32_t ERRLOG_Ids[ERROR_CNT] = {ERROR_TABLE};
+#undef ERROR_ENTRY
+
+#define ERROR_ENTRY(code, id, text) text,
+STATIC const char *const ERRLOG_Texts[ERROR_CNT] = {ERROR_TABLE};
+#undef ERROR_ENTRY
+
+/************************************************************************
+ *					        Global Variables
+ ************************************************************************/
+PERSISTENT sErrLog_t ErrorLog = {.head = 0, .count = 0, .run = 0};
+
+/************************************************************************
+ *					   Static Functions Prototypes
+ ************************************************************************/
+STATIC void ERRLOG_Check(sErrLog_t *log);
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+uint32_t ERRLOG_Id(eErrorCode_t code)
+{
+  return (code < ERROR_CNT) ? ERRLOG_Ids[code] : 0;
+}
+
+const char *ERRLOG_Text(eErrorCode_t code)
+{
+  return (code < ERROR_CNT) ? ERRLOG_Texts[code] : "Unknown Error";
+}
+
+void ERRLOG_Flag(eErrorCode_t code, uint16_t *flags)
+{
+  uint32_t id = ERRLOG_Id(code);
+  uint8_t group = (uint8_t)(id >> 16);
+  uint8_t i;
+
+  if ((id >> 24) != 0)
+  {
+    return;
+  }
+
+  for (i = 0; i < ERRLOG_FLAG_CNT; i++)
+  {
+    if (group == (1u << i))
+    {
+      /** The last two groups keep only the latest error */
+      if (i < 6)
+      {
+        flags[i] |= (uint16_t)id;
+      }
+      else
+      {
+        flags[i] = (uint16_t)id;
+      }
+    }
+  }
+}
+
+void ERRLOG_Clear(sErrLog_t *log)
+{
+  log->head = 0;
+  log->count = 0;
+}
+
+void ERRLOG_NewRun(sErrLog_t *log)
+{
+  log->run++;
+}
+
+void ERRLOG_Add(sErrLog_t *log, eErrorCode_t code, uint32_t arg, uint32_t epoch)
+{
+  sErrLogEntry_t *e;
+
+  ERRLOG_Check(log);
+
+  e = &log->entry[log->head];
+  e->epoch = epoch;
+  e->arg = arg;
+  e->code = (uint16_t)code;
+  e->run = log->run;
+
+  log->head = (log->head + 1u) % ERRLOG_SIZE;
+  if (log->count < ERRLOG_SIZE)
+  {
+    log->count++;
+  }
+}
+
+uint16_t ERRLOG_Count(sErrLog_t *log)
+{
+  ERRLOG_Check(log);
+  return log->count;
+}
+
+bool ERRLOG_Get(sErrLog_t *log, uint16_t idx, sErrLogEntry_t *entry)
+{
+  ERRLOG_Check(log);
+
+  if (idx >= log->count)
+  {
+    return false;
+  }
+
+  *entry = log->entry[(log->head + ERRLOG_SIZE - log->count + idx) % ERRLOG_SIZE];
+  return true;
+}
+
+/************************************************************************
+ *					   Static Functions
+ ************************************************************************/
+/** @brief Check History
+ *
+ *  FRAM keeps whatever was there.  Clear it if it makes no sense.
+ *
+ *  @param *log History
+ *
+ *  @return None
+ */
+STATIC void ERRLOG_Check(sErrLog_t *log)
+{
+  if ((log->head >= ERRLOG_SIZE) || (log->count > ERRLOG_SIZE))
+  {
+    ERRLOG_Clear(log);
+  }
+}
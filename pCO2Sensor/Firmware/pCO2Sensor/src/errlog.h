@@ -0,0 +1,166 @@
+/** @file errlog.h
+ *  @brief Error code lookups and the persistent error history
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note The history is a ring in FRAM.  When full the oldest entry is
+ *  @note overwritten.  An entry is written before head and count are
+ *  @note moved, so a reset part way through an add loses at most that
+ *  @note entry.  Head or count out of range (first boot, new layout)
+ *  @note clears the ring.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _ERRLOG_H
+#define _ERRLOG_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************************************************
+ *							HEADER FILES
+ ************************************************************************/
+#include "errorlist.h"
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+#define ERRLOG_SIZE (64)     /**< History entries kept */
+#define ERRLOG_FLAG_CNT (8)  /**< Data record flag words */
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
+/**
+ * @struct Error History Entry
+ */
+typedef struct
+{
+  uint32_t epoch; /**< RTC time of the error (seconds) */
+  uint32_t arg;   /**< Caller detail (retry, status, register...) */
+  uint16_t code;  /**< eErrorCode_t */
+  uint16_t run;   /**< Run number the error was raised in */
+} sErrLogEntry_t;
+
+/**
+ * @struct Error History
+ */
+typedef struct
+{
+  uint16_t head;                        /**< Next entry to write */
+  uint16_t count;                       /**< Entries held */
+  uint16_t run;                         /**< Current run number */
+  sErrLogEntry_t entry[ERRLOG_SIZE];    /**< Entries */
+} sErrLog_t;
+
+/************************************************************************
+ *				Externs
+ ************************************************************************/
+extern PERSISTENT sErrLog_t ErrorLog;
+
+/************************************************************************
+ *					    Function Prototypes
+ ************************************************************************/
+/** @brief Error Id
+ *
+ *  @param code Error code
+ *
+ *  @return Reported id, 0 for an unknown code
+ */
+uint32_t ERRLOG_Id(eErrorCode_t code);
+
+/** @brief Error Text
+ *
+ *  @param code Error code
+ *
+ *  @return Description, "Unknown Error" for an unknown code
+ */
+const char *ERRLOG_Text(eErrorCode_t code);
+
+/** @brief Set Data Record Flag
+ *
+ *  Or the low 16 bits of a 00GGxxxx id into the flag word for group GG.
+ *  Other ids are not flagged.
+ *
+ *  @param code Error code
+ *  @param *flags Flag words (ERRLOG_FLAG_CNT)
+ *
+ *  @return None
+ */
+void ERRLOG_Flag(eErrorCode_t code, uint16_t *flags);
+
+/** @brief Clear History
+ *
+ *  The run number is kept.
+ *
+ *  @param *log History
+ *
+ *  @return None
+ */
+void ERRLOG_Clear(sErrLog_t *log);
+
+/** @brief Start a New Run
+ *
+ *  @param *log History
+ *
+ *  @return None
+ */
+void ERRLOG_NewRun(sErrLog_t *log);
+
+/** @brief Add Entry
+ *
+ *  @param *log History
+ *  @param code Error code
+ *  @param arg Caller detail
+ *  @param epoch Time of the error
+ *
+ *  @return None
+ */
+void ERRLOG_Add(sErrLog_t *log, eErrorCode_t code, uint32_t arg, uint32_t epoch);
+
+/** @brief Entries Held
+ *
+ *  @param *log History
+ *
+ *  @return Number of entries
+ */
+uint16_t ERRLOG_Count(sErrLog_t *log);
+
+/** @brief Get Entry
+ *
+ *  @param *log History
+ *  @param idx 0 = oldest
+ *  @param *entry Entry out
+ *
+ *  @return true if idx is held
+ */
+bool ERRLOG_Get(sErrLog_t *log, uint16_t idx, sErrLogEntry_t *entry);
+
+#endif // _ERRLOG_H
@@ -1,201 +1,207 @@
-/** @file logging.h
- *  @brief Error Handling Library
+/** @file errorlist.h
+ *  @brief Error codes
  *
  *  @author Matt Casari, matthew.casari@noaa.gov
  *  @date January 9, 2018
- *  @version 1.0.0
+ *  @version 1.1.0
  *
  *  @copyright National Oceanic and Atmospheric Administration
  *  @copyright Pacific Marine Environmental Lab
  *  @copyright Environmental Development Division
  *
- *	@note Error handling library
+ *	@note ERROR_TABLE is the only definition of the error codes.  Each
+ *  @note entry is ERROR_ENTRY(code, id, text):
+ *  @note   code  eErrorCode_t value passed to Error()
+ *  @note   id    Number reported with the text and kept in the error
+ *  @note         history.  For 00GGxxxx ids the group bit GG picks the
+ *  @note         data record flag word and xxxx is or'd into it.
+ *  @note   text  Description for the console and the history dump
  *  @note
+ *  @note The table is expanded here for the enum and in errlog.c for the
+ *  @note id and text lookups.
  *
  *  @bug  No known bugs
  */
 #ifndef _ERRORSLIST_H
 #define _ERRORSLIST_H
 
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+/*          code                id          text    */
+#define ERROR_TABLE \
+    /* E0000 - E0049: System Errors */                                                        \
+    ERROR_ENTRY(ERROR_MSG_01010001, 0x01010001, "Startup Error")                              \
+    ERROR_ENTRY(ERROR_MSG_01010002, 0x01010002, "SCHEDULER Start Time in Past")               \
+    ERROR_ENTRY(ERROR_MSG_01010004, 0x01010004, "SCHEDULER Interval Longer Than Run")         \
+    ERROR_ENTRY(ERROR_MSG_01010008, 0x01010008, "CONSOLE Init Failure")                       \
+    ERROR_ENTRY(ERROR_MSG_01010010, 0x01010010, "COMMAND Init Failure")                       \
+    ERROR_ENTRY(ERROR_MSG_01010011, 0x01010011, "Invalid Command")                            \
+    ERROR_ENTRY(ERROR_MSG_01010012, 0x01010012, "Invalid Hotkey")                             \
+    ERROR_ENTRY(ERROR_MSG_01010020, 0x01010020, "BSP GPIO Error")                             \
+    ERROR_ENTRY(ERROR_MSG_01010021, 0x01010021, "BSP UART Baud Reg Error")                    \
+    ERROR_ENTRY(ERROR_MSG_01010022, 0x01010022, "BSP UART EUSCI A Init Error")                \
+    ERROR_ENTRY(ERROR_MSG_01010023, 0x01010023, "BSP UART Set Buad Error")                    \
+    ERROR_ENTRY(ERROR_MSG_01010030, 0x01010030, "BSP I2C Send Error")                         \
+    ERROR_ENTRY(ERROR_MSG_01010031, 0x01010031, "BSP I2C Not Recovered, Restarting")          \
+    ERROR_ENTRY(ERROR_MSG_01010100, 0x01010100, "BSP SYSCLK Init Failure")                    \
+    ERROR_ENTRY(ERROR_MSG_01010040, 0x01010040, "MAX310x Init Error")                         \
+    ERROR_ENTRY(ERROR_MSG_01010041, 0x01010041, "MAX310x Wakeup Error")                       \
+    /* Reset Causes */                                                                        \
+    ERROR_ENTRY(ERROR_MSG_01020001, 0x01020001, "Reset From - LPM5 Wake Up")                  \
+    ERROR_ENTRY(ERROR_MSG_01020002, 0x01020002, "Reset From - Security Violation")            \
+    ERROR_ENTRY(ERROR_MSG_01020004, 0x01020004, "No reset")                                   \
+    ERROR_ENTRY(ERROR_MSG_01020008, 0x01020008, "Reset From - BOR")                           \
+    ERROR_ENTRY(ERROR_MSG_01020010, 0x01020010, "Reset From - Watchdog Timeout")              \
+    ERROR_ENTRY(ERROR_MSG_01020020, 0x01020020, "Reset From - WD Key Violation")              \
+    ERROR_ENTRY(ERROR_MSG_01020040, 0x01020040, "Reset From - FRAM Key Violation")            \
+    ERROR_ENTRY(ERROR_MSG_01020080, 0x01020080, "Reset From - FRAM Uncorrectable Bit Error")  \
+    ERROR_ENTRY(ERROR_MSG_01020100, 0x01020100, "Reset From - Peripheral/config area fetch")  \
+    ERROR_ENTRY(ERROR_MSG_01020200, 0x01020200, "Reset From - CS Password violation")         \
+    ERROR_ENTRY(ERROR_MSG_01020400, 0x01020400, "Reset From - MPUSEGPIFG violation")          \
+    ERROR_ENTRY(ERROR_MSG_01020800, 0x01020800, "Reset From - MPUSEGIIFG violation")          \
+    ERROR_ENTRY(ERROR_MSG_01021000, 0x01021000, "Reset From - MPUSEG1IFG violation")          \
+    ERROR_ENTRY(ERROR_MSG_01022000, 0x01022000, "Reset From - MPUSEG2IFG violation")          \
+    ERROR_ENTRY(ERROR_MSG_01024000, 0x01024000, "Reset From - MPUSEG3IFG violation")          \
+    /* E0050 - E0099: Bus Errors */                                                           \
+    /* PCO2 General Errors */                                                                 \
+    ERROR_ENTRY(ERROR_MSG_00010001, 0x00010001, "PCO2 Licor Init Fail")                       \
+    ERROR_ENTRY(ERROR_MSG_00010002, 0x00010002, "PCO2 Flow Init Fail")                        \
+    ERROR_ENTRY(ERROR_MSG_00010004, 0x00010004, "PCO2 RH Init Fail")                          \
+    ERROR_ENTRY(ERROR_MSG_00010008, 0x00010008, "PCO2 DL Init Fail")                          \
+    ERROR_ENTRY(ERROR_MSG_00010010, 0x00010010, "PCO2 Config Fail")                           \
+    ERROR_ENTRY(ERROR_MSG_00010020, 0x00010020, "PCO2 Zero Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010040, 0x00010040, "PCO2 Span Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010080, 0x00010080, "PCO2 Span2 Fail")                            \
+    ERROR_ENTRY(ERROR_MSG_00010100, 0x00010100, "PCO2 Equil Fail")                            \
+    ERROR_ENTRY(ERROR_MSG_00010200, 0x00010200, "PCO2 Air Fail")                              \
+    ERROR_ENTRY(ERROR_MSG_00010400, 0x00010400, "PCO2 Rest Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010800, 0x00010800, "PCO2 Deploy Fail")                           \
+    ERROR_ENTRY(ERROR_MSG_00010A00, 0x00010A00, "PCO2 Purge Fail")                            \
+    ERROR_ENTRY(ERROR_MSG_00010A01, 0x00010A01, "PCO2 PRG1 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010A02, 0x00010A02, "PCO2 PRG2 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010A03, 0x00010A03, "PCO2 PRG3 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010A04, 0x00010A04, "PCO2 PRG4 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010A05, 0x00010A05, "PCO2 PRG5 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010A06, 0x00010A06, "PCO2 PRG6 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010A07, 0x00010A07, "PCO2 PRG7 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00010A08, 0x00010A08, "PCO2 PRG8 Fail")                             \
+    ERROR_ENTRY(ERROR_MSG_00011000, 0x00011000, "PCO2 Flow REST Fail")                        \
+    ERROR_ENTRY(ERROR_MSG_00012000, 0x00012000, "PCO2 Flow DPLY Fail")                        \
+    ERROR_ENTRY(ERROR_MSG_00014000, 0x00014000, "PCO2 Invalid Mode")                          \
+    ERROR_ENTRY(ERROR_MSG_0130,     0x00000130, "PCO2 Invalid Cal State")                     \
+    /* PCO2 Zero Errors */                                                                    \
+    ERROR_ENTRY(ERROR_MSG_00020001, 0x00020001, "PCO2 Licor Zero Failed")                     \
+    ERROR_ENTRY(ERROR_MSG_00020002, 0x00020002, "PCO2 Zero Flow ZERO_ON Fail")                \
+    ERROR_ENTRY(ERROR_MSG_00020004, 0x00020004, "PCO2 Zero SAMPLE 1 Fail")                    \
+    ERROR_ENTRY(ERROR_MSG_00020008, 0x00020008, "PCO2 Zero Flow ZERO_OFF Fail")               \
+    ERROR_ENTRY(ERROR_MSG_00020010, 0x00020010, "PCO2 Zero Flow VENT Fail")                   \
+    ERROR_ENTRY(ERROR_MSG_00020020, 0x00020020, "PCO2 Zero SAMPLE 2 Fail")                    \
+    ERROR_ENTRY(ERROR_MSG_00020040, 0x00020040, "PCO2 Zero CAL Fail")                         \
+    ERROR_ENTRY(ERROR_MSG_00020080, 0x00020080, "PCO2 Zero Flow POSTCAL Fail")                \
+    ERROR_ENTRY(ERROR_MSG_00020100, 0x00020100, "PCO2 Zero SAMPLE 3 Fail")                    \
+    /* PCO2 Span Errors */                                                                    \
+    ERROR_ENTRY(ERROR_MSG_00040001, 0x00040001, "PCO2 Licor Span Failed")                     \
+    ERROR_ENTRY(ERROR_MSG_00040002, 0x00040002, "PCO2 Span Flow SPAN_ON Fail")                \
+    ERROR_ENTRY(ERROR_MSG_00040004, 0x00040004, "PCO2 Span SAMPLE 1 Fail")                    \
+    ERROR_ENTRY(ERROR_MSG_00040008, 0x00040008, "PCO2 Span Flow SPAN_OFF Fail")               \
+    ERROR_ENTRY(ERROR_MSG_00040010, 0x00040010, "PCO2 Span Flow VENT Fail")                   \
+    ERROR_ENTRY(ERROR_MSG_00040020, 0x00040020, "PCO2 Span SAMPLE 2 Fail")                    \
+    ERROR_ENTRY(ERROR_MSG_00040080, 0x00040080, "PCO2 Span CAL Fail")                         \
+    ERROR_ENTRY(ERROR_MSG_00040100, 0x00040100, "PCO2 Span Flow POSTCAL Fail")                \
+    ERROR_ENTRY(ERROR_MSG_00040200, 0x00040200, "PCO2 Span SAMPLE 3 Fail")                    \
+    ERROR_ENTRY(ERROR_MSG_00040400, 0x00040400, "PCO2 Span Diff Not Met - Skipped")           \
+    /* PCO2 Span2 Errors */                                                                   \
+    ERROR_ENTRY(ERROR_MSG_00080001, 0x00080001, "PCO2 Licor Span2 Failed")                    \
+    ERROR_ENTRY(ERROR_MSG_00080002, 0x00080002, "PCO2 Span2 Flow SPAN2_ON Fail")              \
+    ERROR_ENTRY(ERROR_MSG_00080004, 0x00080004, "PCO2 Span2 SAMPLE 1 Fail")                   \
+    ERROR_ENTRY(ERROR_MSG_00080008, 0x00080008, "PCO2 Span2 Flow SPAN2_OFF Fail")             \
+    ERROR_ENTRY(ERROR_MSG_00080010, 0x00080010, "PCO2 Span2 Flow VENT Fail")                  \
+    ERROR_ENTRY(ERROR_MSG_00080020, 0x00080020, "PCO2 Span2 SAMPLE 2 Fail")                   \
+    ERROR_ENTRY(ERROR_MSG_00080040, 0x00080040, "PCO2 Span2 CAL Fail")                        \
+    ERROR_ENTRY(ERROR_MSG_00080080, 0x00080080, "PCO2 Span2 Flow POSTCAL Fail")               \
+    ERROR_ENTRY(ERROR_MSG_00080100, 0x00080100, "PCO2 Span2 SAMPLE 3 Fail")                   \
+    /* PCO2 Equilibrate & Air Failures */                                                     \
+    ERROR_ENTRY(ERROR_MSG_00100002, 0x00100002, "PCO2 Equil Flow EQUIL_ON Fail")              \
+    ERROR_ENTRY(ERROR_MSG_00100004, 0x00100004, "PCO2 Equil SAMPLE 1 Fail")                   \
+    ERROR_ENTRY(ERROR_MSG_00100008, 0x00100008, "PCO2 Equil Flow EQUIL_OFF 1 Fail")           \
+    ERROR_ENTRY(ERROR_MSG_00100010, 0x00100010, "PCO2 Equil Flow VENT Fail")                  \
+    ERROR_ENTRY(ERROR_MSG_00100020, 0x00100020, "PCO2 Equil Flow EQUIL_OFF 2 Fail")           \
+    ERROR_ENTRY(ERROR_MSG_00100040, 0x00100040, "PCO2 Equil SAMPLE 2 Fail")                   \
+    ERROR_ENTRY(ERROR_MSG_00100200, 0x00100200, "PCO2 Air Flow AIR_ON Fail")                  \
+    ERROR_ENTRY(ERROR_MSG_00100400, 0x00100400, "PCO2 Air SAMPLE 1 Fail")                     \
+    ERROR_ENTRY(ERROR_MSG_00100800, 0x00100800, "PCO2 Air Flow AIR_OFF 1 Fail")               \
+    ERROR_ENTRY(ERROR_MSG_00101000, 0x00101000, "PCO2 Air Flow VENT Fail")                    \
+    ERROR_ENTRY(ERROR_MSG_00102000, 0x00102000, "PCO2 Air Flow EQUIL_OFF Fail")               \
+    ERROR_ENTRY(ERROR_MSG_00104000, 0x00104000, "PCO2 Air SAMPLE 2 Fail")                     \
+    /* E1000 - E1999: MAX3109 */                                                              \
+    ERROR_ENTRY(ERROR_MSG_1001,     0x00000101, "MAX310X Buffer Error")                       \
+    ERROR_ENTRY(ERROR_MSG_1010,     0x00000110, "MAX310X SPI Error")                          \
+    ERROR_ENTRY(ERROR_MSG_1020,     0x00000120, "MAX310X Invalid Baudrate")                   \
+    /* E2000 - E2999: */                                                                      \
+    /* E3000 - E3999:  RTC Errors */                                                          \
+    ERROR_ENTRY(ERROR_MSG_00200002, 0x00200002, "RTC Alarm Before Current Time")              \
+    ERROR_ENTRY(ERROR_MSG_00200004, 0x00200004, "RTC Alarm After Current Alarm")              \
+    ERROR_ENTRY(ERROR_MSG_00200008, 0x00200008, "RTC Alarm Repeat = 0")                       \
+    ERROR_ENTRY(ERROR_MSG_00200010, 0x00200010, "RTC Invalid Month")                          \
+    ERROR_ENTRY(ERROR_MSG_00200020, 0x00200020, "RTC SQW Invalid Pin")                        \
+    ERROR_ENTRY(ERROR_MSG_00200040, 0x00200040, "RTC Alarm Invalid Pin")                      \
+    ERROR_ENTRY(ERROR_MSG_00200080, 0x00200080, "RTC Msg Too Long")                           \
+    ERROR_ENTRY(ERROR_MSG_00200100, 0x00200100, "RTC Msg Length > Buffer")                    \
+    ERROR_ENTRY(ERROR_MSG_00200200, 0x00200200, "RTC Msg Length Too Short")                   \
+    ERROR_ENTRY(ERROR_MSG_00200400, 0x00200400, "RTC I2C Transmission Error")                 \
+    ERROR_ENTRY(ERROR_MSG_00200800, 0x00200800, "RTC I2C Recieve Error")                      \
+    ERROR_ENTRY(ERROR_MSG_00201000, 0x00201000, "RTC I2C Hang")                               \
+    ERROR_ENTRY(ERROR_MSG_00202001, 0x00202001, "RTC Offset Calc Error")                      \
+    ERROR_ENTRY(ERROR_MSG_00202000, 0x00202000, "RTC Oscillator Select Error")                \
+    ERROR_ENTRY(ERROR_MSG_00202002, 0x00202002, "RTC Square Wave Config Error")               \
+    /* E4000 - E4999:  Flow Controller Errors */                                              \
+    ERROR_ENTRY(ERROR_MSG_00400001, 0x00400001, "FLOW Failed To Init")                        \
+    ERROR_ENTRY(ERROR_MSG_00400002, 0x00400002, "FLOW Failed On Startup")                     \
+    ERROR_ENTRY(ERROR_MSG_00400004, 0x00400004, "FLOW Invalid Flow State")                    \
+    ERROR_ENTRY(ERROR_MSG_00400008, 0x00400008, "FLOW Mode Set Failure")                      \
+    ERROR_ENTRY(ERROR_MSG_00400010, 0x00400010, "FLOW Message NACK")                          \
+    ERROR_ENTRY(ERROR_MSG_00400020, 0x00400020, "FLOW Message Not Sent")                      \
+    ERROR_ENTRY(ERROR_MSG_00400040, 0x00400040, "FLOW Mode Not Received")                     \
+    /* E5000 - E5999:  RH/Temp/Pressure Sensor Errors */                                      \
+    ERROR_ENTRY(ERROR_MSG_00400100, 0x00400100, "RH Sensor Error")                            \
+    ERROR_ENTRY(ERROR_MSG_00400200, 0x00400200, "RH I2C Failure")                             \
+    ERROR_ENTRY(ERROR_MSG_00400400, 0x00400400, "RH Serial Number Read Error")                \
+    ERROR_ENTRY(ERROR_MSG_00400800, 0x00400800, "RH Serial Number Not Set")                   \
+    /* E6000 - E6999:  Oxygen Sensor Errors */                                                \
+    ERROR_ENTRY(ERROR_MSG_00401000, 0x00401000, "O2 Sensor Error")                            \
+    /* E7000 - E7999:  LiCor 820/830 Errors */                                                \
+    ERROR_ENTRY(ERROR_MSG_00800002, 0x00800002, "Invalid Sensor Type")                        \
+    ERROR_ENTRY(ERROR_MSG_00800004, 0x00800004, "Invalid XML Parent Tag")                     \
+    ERROR_ENTRY(ERROR_MSG_00800008, 0x00800008, "Invalid XML Child Tag")                      \
+    ERROR_ENTRY(ERROR_MSG_00800010, 0x00800010, "Invalid XML LVL3 Tag")                       \
+    ERROR_ENTRY(ERROR_MSG_00800020, 0x00800020, "Invalid XML Combo")                          \
+    ERROR_ENTRY(ERROR_MSG_00800040, 0x00800040, "Invalid XML Level 1")                        \
+    ERROR_ENTRY(ERROR_MSG_00800080, 0x00800080, "Invalid XML Level 2")                        \
+    ERROR_ENTRY(ERROR_MSG_00800100, 0x00800100, "Invalid XML Level 3")                        \
+    ERROR_ENTRY(ERROR_MSG_00800200, 0x00800200, "Invalid XML Level 4")                        \
+    ERROR_ENTRY(ERROR_MSG_00800800, 0x00800800, "No H2O in LI820/840")                        \
+    ERROR_ENTRY(ERROR_MSG_00801000, 0x00801000, "No Pump")                                    \
+    /* E8000 - E8999:  Datalogger Errors */                                                   \
+    /* E9000 - E9999: */
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
 /**
- * Debug and Error messages are of the following format:
- *
- * XXXXX Message
- *
- * where XXXX is a four digit identifier.
- *
- *  Example Debug Message
- *  #define DEBUG0000   ("0000 Generic Debug Message")
- *
- *  Example Error Message
- *  #define ERROR0100  ("0100 Failure to Update")
+ *  @enum Error Codes
  */
-#define DEBUG_ID_LENGTH (4)
-#define ERROR_ID_LENGTH (8)
-
-/******************************* Debug Messages ******************************/
-
-#define DEBUG_MSG_1 ("0001 ")
-
-/******************************* Error Messages ******************************/
-/** E0000 - E0049: System Errors */
-#define ERROR_MSG_01010001 ("01010001 Startup Error")
-
-#define ERROR_MSG_01010002 ("01010002 SCHEDULER Start Time in Past")
-#define ERROR_MSG_01010004 ("01010004 SCHEDULER Interval Longer Than Run")
-
-#define ERROR_MSG_01010008 ("01010008 CONSOLE Init Failure")
-#define ERROR_MSG_01010010 ("01010010 COMMAND Init Failure")
-#define ERROR_MSG_01010011 ("01010011 Invalid Command")
-#define ERROR_MSG_01010012 ("01010012 Invalid Hotkey")
-#define ERROR_MSG_01010020 ("01010020 BSP GPIO Error")
-#define ERROR_MSG_01010021 ("01010021 BSP UART Baud Reg Error")
-#define ERROR_MSG_01010022 ("01010022 BSP UART EUSCI A Init Error")
-#define ERROR_MSG_01010023 ("01010023 BSP UART Set Buad Error")
-#define ERROR_MSG_01010030 ("01010030 BSP I2C Send Error")
-#define ERROR_MSG_01010100 ("01010100 BSP SYSCLK Init Failure")
-#define ERROR_MSG_01010040 ("01010040 MAX310x Init Error")
-#define ERROR_MSG_01010041 ("01010041 MAX310x Wakeup Error")
-
-/** E0050 - E0099: Bus Errors */
-
-/** PCO2 General Errors */
-#define ERROR_MSG_00010001 ("00010001 PCO2 Licor Init Fail")
-#define ERROR_MSG_00010002 ("00010002 PCO2 Flow Init Fail")
-#define ERROR_MSG_00010004 ("00010004 PCO2 RH Init Fail")
-#define ERROR_MSG_00010008 ("00010008 PCO2 DL Init Fail")
-
-#define ERROR_MSG_00010010 ("00010010 PCO2 Config Fail")
-#define ERROR_MSG_00010020 ("00010020 PCO2 Zero Fail")
-#define ERROR_MSG_00010040 ("00010040 PCO2 Span Fail")
-#define ERROR_MSG_00010080 ("00010080 PCO2 Span2 Fail")
-#define ERROR_MSG_00010100 ("00010100 PCO2 Equil Fail")
-#define ERROR_MSG_00010200 ("00010200 PCO2 Air Fail")
-#define ERROR_MSG_00010400 ("00010400 PCO2 Rest Fail")
-#define ERROR_MSG_00010800 ("00010800 PCO2 Deploy Fail")
-#define ERROR_MSG_00010A00 ("00010A00 PCO2 Purge Fail")
-#define ERROR_MSG_00010A01 ("00010A01 PCO2 PRG1 Fail")
-#define ERROR_MSG_00010A02 ("00010A01 PCO2 PRG2 Fail")
-#define ERROR_MSG_00010A03 ("00010A01 PCO2 PRG3 Fail")
-#define ERROR_MSG_00010A04 ("00010A01 PCO2 PRG4 Fail")
-#define ERROR_MSG_00010A05 ("00010A01 PCO2 PRG5 Fail")
-#define ERROR_MSG_00010A06 ("00010A01 PCO2 PRG6 Fail")
-#define ERROR_MSG_00010A07 ("00010A01 PCO2 PRG7 Fail")
-#define ERROR_MSG_00010A08 ("00010A01 PCO2 PRG8 Fail")
-
-#define ERROR_MSG_00011000 ("00011000 PCO2 Flow REST Fail")
-#define ERROR_MSG_00012000 ("00012000 PCO2 Flow DPLY Fail")
-#define ERROR_MSG_00014000 ("00014000 PCO2 Invalid Mode")
-
-#define ERROR_MSG_0130 ("0130 PCO2 Invalid Cal State")
-
-/** PCO2 Zero Errors */
-#define ERROR_MSG_00020001 ("00020001 PCO2 Licor Zero Failed")
-#define ERROR_MSG_00020002 ("00020002 PCO2 Zero Flow ZERO_ON Fail")
-#define ERROR_MSG_00020004 ("00020004 PCO2 Zero SAMPLE 1 Fail")
-#define ERROR_MSG_00020008 ("00020008 PCO2 Zero Flow ZERO_OFF Fail")
-#define ERROR_MSG_00020010 ("00020010 PCO2 Zero Flow VENT Fail")
-#define ERROR_MSG_00020020 ("00020020 PCO2 Zero SAMPLE 2 Fail")
-#define ERROR_MSG_00020040 ("00020040 PCO2 Zero CAL Fail")
-#define ERROR_MSG_00020080 ("00020080 PCO2 Zero Flow POSTCAL Fail")
-#define ERROR_MSG_00020100 ("00020100 PCO2 Zero SAMPLE 3 Fail")
-
-/** PCO2 Span Errors */
-#define ERROR_MSG_00040001 ("00040001 PCO2 Licor Span Failed")
-#define ERROR_MSG_00040002 ("00040002 PCO2 Span Flow SPAN_ON Fail")
-#define ERROR_MSG_00040004 ("00040004 PCO2 Span SAMPLE 1 Fail")
-#define ERROR_MSG_00040008 ("00040008 PCO2 Span Flow SPAN_OFF Fail")
-#define ERROR_MSG_00040010 ("00040010 PCO2 Span Flow VENT Fail")
-#define ERROR_MSG_00040020 ("00040020 PCO2 Span SAMPLE 2 Fail")
-#define ERROR_MSG_00040080 ("00040080 PCO2 Span CAL Fail")
-#define ERROR_MSG_00040100 ("00040100 PCO2 Span Flow POSTCAL Fail")
-#define ERROR_MSG_00040200 ("00040200 PCO2 Span SAMPLE 3 Fail")
-#define ERROR_MSG_00040400 ("00040400 PCO2 Span Diff Not Met - Skipped")
-
-/** PCO2 Span2 Errors */
-#define ERROR_MSG_00080001 ("00080001 PCO2 Licor Span2 Failed")
-#define ERROR_MSG_00080002 ("00080002 PCO2 Span2 Flow SPAN2_ON Fail")
-#define ERROR_MSG_00080004 ("00080004 PCO2 Span2 SAMPLE 1 Fail")
-#define ERROR_MSG_00080008 ("00080008 PCO2 Span2 Flow SPAN2_OFF Fail")
-#define ERROR_MSG_00080010 ("00080010 PCO2 Span2 Flow VENT Fail")
-#define ERROR_MSG_00080020 ("00080020 PCO2 Span2 SAMPLE 2 Fail")
-#define ERROR_MSG_00080040 ("00080040 PCO2 Span2 CAL Fail")
-#define ERROR_MSG_00080080 ("00080080 PCO2 Span2 Flow POSTCAL Fail")
-#define ERROR_MSG_00080100 ("00080100 PCO2 Span2 SAMPLE 3 Fail")
-
-/** PCO2 Equilibrate & Air Failures */
-#define ERROR_MSG_00100002 ("00100002 PCO2 Equil Flow EQUIL_ON Fail")
-#define ERROR_MSG_00100004 ("00100004 PCO2 Equil SAMPLE 1 Fail")
-#define ERROR_MSG_00100008 ("00100008 PCO2 Equil Flow EQUIL_OFF 1 Fail")
-#define ERROR_MSG_00100010 ("00100010 PCO2 Equil Flow VENT Fail")
-#define ERROR_MSG_00100020 ("00100020 PCO2 Equil Flow EQUIL_OFF 2 Fail")
-#define ERROR_MSG_00100040 ("00100040 PCO2 Equil SAMPLE 2 Fail")
-
-#define ERROR_MSG_00100200 ("00100200 PCO2 Air Flow AIR_ON Fail")
-#define ERROR_MSG_00100400 ("00100400 PCO2 Air SAMPLE 1 Fail")
-#define ERROR_MSG_00100800 ("00100800 PCO2 Air Flow AIR_OFF 1 Fail")
-#define ERROR_MSG_00101000 ("00101000 PCO2 Air Flow VENT Fail")
-#define ERROR_MSG_00102000 ("00102000 PCO2 Air Flow EQUIL_OFF Fail")
-#define ERROR_MSG_00104000 ("00104000 PCO2 Air SAMPLE 2 Fail")
-
-/** E1000 - E1999: MAX3109*/
-#define ERROR_MSG_1001 ("0101 MAX310X Buffer Error")
-#define ERROR_MSG_1010 ("0110 MAX310X SPI Error")
-#define ERROR_MSG_1020 ("0120 MAX310X Invalid Baudrate")
-#define ERROR_MSG_001010
-/** E2000 - E2999:  */
-
-/** E3000 - E3999:  RTC Errors */
-#define ERROR_MSG_00200002 ("00200002 RTC Alarm Before Current Time")
-#define ERROR_MSG_00200004 ("00200004 RTC Alarm After Current Alarm")
-#define ERROR_MSG_00200008 ("00200008 RTC Alarm Repeat = 0")
-#define ERROR_MSG_00200010 ("00200010 RTC Invalid Month")
-#define ERROR_MSG_00200020 ("00200020 RTC SQW Invalid Pin")
-#define ERROR_MSG_00200040 ("00200040 RTC Alarm Invalid Pin")
-#define ERROR_MSG_00200080 ("00200080 RTC Msg Too Long")
-#define ERROR_MSG_00200100 ("00200100 RTC Msg Length > Buffer")
-#define ERROR_MSG_00200200 ("00200200 RTC Msg Length Too Short")
-#define ERROR_MSG_00200400 ("00200400 RTC I2C Transmission Error")
-#define ERROR_MSG_00200800 ("00200800 RTC I2C Recieve Error")
-#define ERROR_MSG_00201000 ("00201000 RTC I2C Hang")
-#define ERROR_MSG_00202001 ("00202001 RTC Offset Calc Error")
-#define ERROR_MSG_00202000 ("00202000 RTC Oscillator Select Error")
-#define ERROR_MSG_00202002 ("00202002 RTC Square Wave Config Error")
-
-/** E4000 - E4999:  Flow Controller Errors*/
-#define ERROR_MSG_00400001 ("00400001 FLOW Failed To Init")
-#define ERROR_MSG_00400002 ("00400002 FLOW Failed On Startup")
-
-#define ERROR_MSG_00400004 ("00400004 FLOW Invalid Flow State")
-#define ERROR_MSG_00400008 ("00400008 FLOW Mode Set Failure")
-#define ERROR_MSG_00400010 ("00400010 FLOW Message NACK")
-#define ERROR_MSG_00400020 ("00400020 FLOW Message Not Sent")
-#define ERROR_MSG_00400040 ("00400040 FLOW Mode Not Received")
-
-/** E5000 - E5999:  RH/Temp/Pressure Sensor Errors */
-#define ERROR_MSG_00400100 ("00400100 RH Sensor Error")
-#define ERROR_MSG_00400200 ("00400200 RH I2C Failure")
-/** E6000 - E6999:  Oxygen Sensor Errors */
-#define ERROR_MSG_00401000 ("00401000 O2 Sensor Error")
-
-/** E7000 - E7999:  LiCor 820/830 Errors */
-#define ERROR_MSG_00800002 ("00800002 Invalid Sensor Type")
-#define ERROR_MSG_00800004 ("00800004 Invalid XML Parent Tag")
-#define ERROR_MSG_00800008 ("00800008 Invalid XML Child Tag")
-#define ERROR_MSG_00800010 ("00800010 Invalid XML LVL3 Tag")
-
-#define ERROR_MSG_00800020 ("00800020 Invalid XML Combo")
-#define ERROR_MSG_00800040 ("00800040 Invalid XML Level 1")
-#define ERROR_MSG_00800080 ("00800080 Invalid XML Level 2")
-#define ERROR_MSG_00800100 ("00800100 Invalid XML Level 3")
-#define ERROR_MSG_00800200 ("00800200 Invalid XML Level 4")
-
-#define ERROR_MSG_00800400 ("00800400")
-#define ERROR_MSG_00800800 ("00800800 No H2O in LI820/840")
-#define ERROR_MSG_00801000 ("00801000 No Pump")
-
-/** E8000 - E8999:  Datalogger Errors */
-
-/** E9000 - E9999:  */
-
-#endif // _ERRORLIST_H
\ No newline at end of file
+#define ERROR_ENTRY(code, id, text) code,
+typedef enum
+{
+  ERROR_TABLE
+  ERROR_CNT /**< Number of error codes */
+} eErrorCode_t;
+#undef ERROR_ENTRY
+
+#endif // _ERRORSLIST_H
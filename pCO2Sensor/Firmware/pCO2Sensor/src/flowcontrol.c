@@ -58,6 +58,14 @@ const char mode_pump_post[] = "_POST";
 
 static PERSISTENT char readStr[128];
 
+/** Mode command and record name of each state, indexed by eFLOWState_t */
+STATIC const sFlowStateMsg_t FLOW_StateMsg[FLOW_WIRE_MAX + 1] = {
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) \
+  [FLOW_STATE_##id] = {FLOW_STATE_WIRE(wire_code), record},
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
+};
+
 /************************************************************************
  *					   Static Functions Prototypes
  ************************************************************************/
@@ -85,7 +93,7 @@ eFLOWStatus_t FLOW_Init(void)
   /** Run the Startup Routine */
   if (FLOW_OK != FLOW_Startup(&Flow))
   {
-    Error(ERROR_MSG_00400002, LOG_Priority_High);
+    Error(ERROR_MSG_00400002, 0);
     return result;
   }
 
@@ -100,7 +108,6 @@ eFLOWStatus_t FLOW_SetMode(eFLOWState_t state)
   eFLOWStatus_t result = FLOW_FAIL;
   char str[32];
   memset(str, 0, 32);
-  strcpy(str, "mode=");
 
   /** Turn the Flow Control Module ON */
   if (Flow.Power.state == false)
@@ -108,138 +115,20 @@ eFLOWStatus_t FLOW_SetMode(eFLOWState_t state)
     FLOW_PowerON(&Flow.Power);
   }
 
-  /** Create the sendstring */
-  switch (state)
+  /** Look up the sendstring */
+  if (state == FLOW_STATE_TEST_PUMP)
+  {
+    strcpy(str, "mode=" FLOW_WIRE_PUMP_TOGGLE "\r\n");
+  }
+  else if ((state <= FLOW_WIRE_MAX) && (FLOW_StateMsg[state].cmd != NULL))
+  {
+    strcpy(str, FLOW_StateMsg[state].cmd);
+  }
+  else
   {
-  case FLOW_STATE_ZERO_PUMP_ON:
-    strcat(str, "ZPON");
-    break;
-  case FLOW_STATE_ZERO_PUMP_OFF:
-    strcat(str, "ZPOFF");
-    break;
-  case FLOW_STATE_ZERO_VENT:
-    strcat(str, "ZPVENT");
-    break;
-  case FLOW_STATE_ZERO_PUMP_POST:
-    strcat(str, "ZPPCAL");
-    break;
-  case FLOW_STATE_SPAN_PUMP_ON:
-    strcat(str, "SPON");
-    break;
-  case FLOW_STATE_SPAN_PUMP_OFF:
-    strcat(str, "SPOFF");
-    break;
-  case FLOW_STATE_SPAN_VENT:
-    strcat(str, "SPVENT");
-    break;
-  case FLOW_STATE_SPAN_PUMP_POST:
-    strcat(str, "SPPCAL");
-    break;
-  case FLOW_STATE_EQUIL_PUMP_ON:
-    strcat(str, "EPON");
-    break;
-  case FLOW_STATE_EQUIL_PUMP_OFF:
-    strcat(str, "EPOFF");
-    break;
-  case FLOW_STATE_EQUIL_VENT:
-    strcat(str, "EPVENT");
-    break;
-  case FLOW_STATE_EQUIL_PUMP_POST:
-    strcat(str, "EPPOST");
-    break;
-  case FLOW_STATE_AIR_PUMP_ON:
-    strcat(str, "APON");
-    break;
-  case FLOW_STATE_AIR_PUMP_OFF:
-    strcat(str, "APOFF");
-    break;
-  case FLOW_STATE_AIR_VENT:
-    strcat(str, "APVENT");
-    break;
-  case FLOW_STATE_AIR_POST:
-    strcat(str, "APPOST");
-    break;
-  case FLOW_STATE_REST:
-    strcat(str, "REST");
-    break;
-  case FLOW_STATE_DEPLOY:
-    strcat(str, "DEPLOY");
-    break;
-  case FLOW_STATE_VENT:
-    strcat(str, "VENT");
-    break;
-  case FLOW_STATE_PRESSURIZE:
-    strcat(str, "PRES");
-    break;
-  case FLOW_STATE_TEST_ZERO_0:
-    strcat(str, "ZERO_0");
-    break;
-  case FLOW_STATE_TEST_ZERO_1:
-    strcat(str, "ZERO_1");
-    break;
-  case FLOW_STATE_TEST_ZERO_2:
-    strcat(str, "ZERO_2");
-    break;
-  case FLOW_STATE_TEST_SPAN_0:
-    strcat(str, "SPAN_0");
-    break;
-  case FLOW_STATE_TEST_SPAN_1:
-    strcat(str, "SPAN_1");
-    break;
-  case FLOW_STATE_TEST_SPAN_2:
-    strcat(str, "SPAN_2");
-    break;
-  case FLOW_STATE_TEST_EQUIL_0:
-    strcat(str, "EQUIL_0");
-    break;
-  case FLOW_STATE_TEST_EQUIL_1:
-    strcat(str, "EQUIL_1");
-    break;
-  case FLOW_STATE_TEST_AIR_0:
-    strcat(str, "AIR_0");
-    break;
-  case FLOW_STATE_TEST_AIR_1:
-    strcat(str, "AIR_1");
-    break;
-  case FLOW_STATE_TEST_PUMP:
-    strcat(str, "PUMP_TOGGLE");
-    break;
-  case FLOW_STATE_PRG1:
-    strcat(str, "PRG1");
-    break;
-  case FLOW_STATE_PRG2:
-    strcat(str, "PRG2");
-    break;
-  case FLOW_STATE_PRG3:
-    strcat(str, "PRG3");
-    break;
-  case FLOW_STATE_PRG4:
-    strcat(str, "PRG4");
-    break;  
-  case FLOW_STATE_PRG5:
-    strcat(str, "PRG5");
-    break;
-  case FLOW_STATE_PRG6:
-    strcat(str, "PRG6");
-    break;
-  case FLOW_STATE_PRG7:
-    strcat(str, "PRG7");
-    break;
-  case FLOW_STATE_PRG8:
-    strcat(str, "PRG8");
-    break;
-//  case FLOW_STATE_PURGE:
-//    strcat(str, "PURGE");
-//    break;
-//  case FLOW_STATE_CLEAR:
-//    strcat(str, "CLEAR");
-//    break;
-  default:
-    Error(ERROR_MSG_00400004, LOG_Priority_Med);
+    Error(ERROR_MSG_00400004, 0);
     return result;
-    break;
   }
-  strcat(str, "\r\n");
 
   uint8_t failCnt = 8;
 
@@ -276,7 +165,7 @@ STATIC eFLOWStatus_t FLOW_SetMode_Command(sFLOW_t *Flow,
   /** Send the Command */
   if (MAX310X_OK != MAX310X_Send(&Flow->UART, str, strlen(str)))
   {
-    Error(ERROR_MSG_00400008, LOG_Priority_High);
+    Error(ERROR_MSG_00400008, 0);
     return result;
   }
 
@@ -304,7 +193,7 @@ STATIC eFLOWStatus_t FLOW_SetMode_Command(sFLOW_t *Flow,
   }
   else
   {
-    Error(ERROR_MSG_00400010, LOG_Priority_High);
+    Error(ERROR_MSG_00400010, 0);
     char temp[32];
     sprintf(temp, "Retry attempted %u times", 200 - counter);
   }
@@ -321,7 +210,7 @@ eFLOWStatus_t FLOW_GetMode(void)
 
   if (MAX310X_OK != MAX310X_Send(&Flow.UART, sendstr, len))
   {
-    Error(ERROR_MSG_00400020, LOG_Priority_Med);
+    Error(ERROR_MSG_00400020, 0);
     return result;
   }
 
@@ -336,7 +225,7 @@ eFLOWStatus_t FLOW_GetMode(void)
 
   if (0 == strlen(str))
   {
-    Error(ERROR_MSG_00400040, LOG_Priority_High);
+    Error(ERROR_MSG_00400040, 0);
     return result;
   }
 
@@ -375,7 +264,7 @@ int16_t FLOW_GetPulse(void)
 
   if (0 == strlen(str))
   {
-    Error(ERROR_MSG_00400040, LOG_Priority_High);
+    Error(ERROR_MSG_00400040, 0);
     return result;
   }
   else
@@ -430,7 +319,7 @@ int16_t FLOW_GetCurrent(void)
 
   if (0 == strlen(str))
   {
-    Error(ERROR_MSG_00400040, LOG_Priority_High);
+    Error(ERROR_MSG_00400040, 0);
     return result;
   }
   else
@@ -459,7 +348,7 @@ void FLOW_Write(char *val, uint8_t len)
 
   if (MAX310X_OK != MAX310X_Send(&Flow.UART, val, len))
   {
-    Error(ERROR_MSG_00400020, LOG_Priority_Med);
+    Error(ERROR_MSG_00400020, 0);
   }
 }
 
@@ -478,99 +367,10 @@ void FLOW_Read(char *val, uint8_t *len)
 
 void FLOW_GetState(char *str)
 {
-  switch (Flow.currentState)
+  if ((Flow.currentState <= FLOW_WIRE_MAX) && (FLOW_StateMsg[Flow.currentState].record != NULL))
   {
-  case FLOW_STATE_ZERO_PUMP_ON:
-    strcpy(str, "ZPON");
-    break;
-  case FLOW_STATE_ZERO_PUMP_OFF:
-    strcpy(str, "ZPOFF");
-    break;
-  case FLOW_STATE_ZERO_VENT:
-    strcpy(str, "ZPVENT");
-    break;
-  case FLOW_STATE_ZERO_PUMP_POST:
-    strcpy(str, "ZPPCAL");
-    break;
-  case FLOW_STATE_SPAN_PUMP_ON:
-    strcpy(str, "SPON");
-    break;
-  case FLOW_STATE_SPAN_PUMP_OFF:
-    strcpy(str, "SPOFF");
-    break;
-  case FLOW_STATE_SPAN_VENT:
-    strcpy(str, "SPVENT");
-    break;
-  case FLOW_STATE_SPAN_PUMP_POST:
-    strcpy(str, "SPPCAL");
-    break;
-  case FLOW_STATE_EQUIL_PUMP_ON:
-    strcpy(str, "EPON");
-    break;
-  case FLOW_STATE_EQUIL_PUMP_OFF:
-    strcpy(str, "EPOFF");
-    break;
-  case FLOW_STATE_EQUIL_VENT:
-    strcpy(str, "EPVENT");
-    break;
-  case FLOW_STATE_EQUIL_PUMP_POST:
-    strcpy(str, "EPPC");
-    break;
-  case FLOW_STATE_AIR_PUMP_ON:
-    strcpy(str, "APON");
-    break;
-  case FLOW_STATE_AIR_PUMP_OFF:
-    strcpy(str, "APOFF");
-    break;
-  case FLOW_STATE_AIR_VENT:
-    strcpy(str, "APVENT");
-    break;
-  case FLOW_STATE_AIR_POST:
-    strcpy(str, "APPOST");
-    break;
-  case FLOW_STATE_REST:
-    strcpy(str, "REST");
-    break;
-  case FLOW_STATE_DEPLOY:
-    strcpy(str, "DPLY");
-    break;
-  case FLOW_STATE_PRESSURIZE:
-    strcpy(str, "PRES");
-    break;
-  case FLOW_STATE_PRG1:
-    strcat(str, "PRG1");
-    break;
-  case FLOW_STATE_PRG2:
-    strcat(str, "PRG2");
-    break;
-  case FLOW_STATE_PRG3:
-    strcat(str, "PRG3");
-    break;
-  case FLOW_STATE_PRG4:
-    strcat(str, "PRG4");
-    break;
-  case FLOW_STATE_PRG5:
-    strcat(str, "PRG5");
-    break;
-  case FLOW_STATE_PRG6:
-    strcat(str, "PRG6");
-    break;
-  case FLOW_STATE_PRG7:
-    strcat(str, "PRG7");
-    break;
-  case FLOW_STATE_PRG8:
-    strcat(str, "PRG8");
-    break;
-//  case FLOW_STATE_PURGE:
-//    strcpy(str, "PURGE");
-//    break;
-//  case FLOW_STATE_CLEAR:
-//    strcpy(str, "CLEAR");
-//    break;
-  default:
-    break;
+    strcpy(str, FLOW_StateMsg[Flow.currentState].record);
   }
-  return;
 }
 
 void FLOW_Sleep(void)
@@ -641,7 +441,7 @@ STATIC eFLOWStatus_t FLOW_Startup(sFLOW_t *f)
   /** Set Baudrate */
   if (MAX310X_OK != MAX310X_SetBaudrate(&f->UART, FLOW_UART_BAUDRATE))
   {
-    Error(ERROR_MSG_00400001, LOG_Priority_Med);
+    Error(ERROR_MSG_00400001, 0);
     return result;
   }
 
@@ -58,6 +58,7 @@
 #include "AM08x5.h"
 #include "console.h"
 #include "command.h"
+#include "flowstate.h"
 /************************************************************************
  *							Structs & Enums
  ************************************************************************/
@@ -73,51 +74,28 @@ typedef enum
 
 /**
  * @enum Flow Control States
- * @brief Flow COntrol States
+ * @brief Flow Control States, generated from FLOW_STATE_TABLE (flowstate.h).
+ *  The value is the wire code sent to the Flow Controller.
  */
 typedef enum
 {
-    FLOW_STATE_ZERO_PUMP_ON = 0x01u,    /**< Zero, Pump On */
-    FLOW_STATE_ZERO_PUMP_OFF = 0x02u,   /**< Zero, Pump Off */
-    FLOW_STATE_ZERO_VENT = 0x03u,       /**< Zero, Vent */
-    FLOW_STATE_ZERO_PUMP_POST = 0x04u,  /**< Zero, Post */
-    FLOW_STATE_SPAN_PUMP_ON = 0x05u,    /**< Span, Pump On */
-    FLOW_STATE_SPAN_PUMP_OFF = 0x06u,   /**< Span, Pump Off */
-    FLOW_STATE_SPAN_VENT = 0x07u,       /**< Span, Vent*/
-    FLOW_STATE_SPAN_PUMP_POST = 0x08u,  /**< Span, Post */
-    FLOW_STATE_EQUIL_PUMP_ON = 0x09u,   /**< Equilibrate, Pump On */
-    FLOW_STATE_EQUIL_PUMP_OFF = 0x0Au,  /**< Equilibrate, Pump Off */
-    FLOW_STATE_EQUIL_VENT = 0x0Bu,      /**< Equilibrate, Vent */
-    FLOW_STATE_EQUIL_PUMP_POST = 0x0Cu, /**< Equilibrate, Post */
-    FLOW_STATE_AIR_PUMP_ON = 0x0Du,     /**< Air, Pump On */
-    FLOW_STATE_AIR_PUMP_OFF = 0x0Eu,    /**< Air, Pump Off */
-    FLOW_STATE_AIR_VENT = 0x0Fu,        /**< Air, Vent */
-    FLOW_STATE_AIR_POST = 0x10u,        /**< Air, Post Vent */
-    FLOW_STATE_REST = 0x14u,            /**< Rest */
-    FLOW_STATE_DEPLOY = 0x15u,          /**< Deploy */
-    FLOW_STATE_VENT = 0x17u,            /**< Vent/Dry Mode */
-    FLOW_STATE_PRESSURIZE = 0x18u,      /**< Auto-Pressurize Mode */
-    FLOW_STATE_PRG1 = 0x19u, /** Purge 1*/
-    FLOW_STATE_PRG2 = 0x20u, /** Purge 2*/
-    FLOW_STATE_PRG3 = 0x21u, /** Purge 3*/
-    FLOW_STATE_PRG4 = 0x22u, /** Purge 4*/
-    FLOW_STATE_PRG5 = 0x23u, /** Purge 5*/
-    FLOW_STATE_PRG6 = 0x24u, /** Purge 6*/
-    FLOW_STATE_PRG7 = 0x25u, /** Purge 7*/
-    FLOW_STATE_PRG8 = 0x26u, /** Purge 8*/
-    FLOW_STATE_TEST_ZERO_0 = 0x0100u,
-    FLOW_STATE_TEST_ZERO_1 = 0x0200u,
-    FLOW_STATE_TEST_ZERO_2 = 0x0400u,
-    FLOW_STATE_TEST_SPAN_0 = 0x0800u,
-    FLOW_STATE_TEST_SPAN_1 = 0x1000u,
-    FLOW_STATE_TEST_SPAN_2 = 0x2000u,
-    FLOW_STATE_TEST_EQUIL_0 = 0x4000u,
-    FLOW_STATE_TEST_EQUIL_1 = 0x8000u,
-    FLOW_STATE_TEST_AIR_0 = 0x10000u,
-    FLOW_STATE_TEST_AIR_1 = 0x20000u,
-    FLOW_STATE_TEST_PUMP = 0x80000u
+    FLOW_STATE_NONE = 0x00u, /**< No state */
+#define FLOW_STATE(id, wire_code, valve_bitmap, pump, name, record) FLOW_STATE_##id = (wire_code),
+    FLOW_STATE_TABLE
+#undef FLOW_STATE
+    FLOW_STATE_TEST_PUMP = 0x80u /**< Toggle the pump, not a state */
 } eFLOWState_t;
 
+/**
+ * @struct Flow State Message
+ * @brief Mode command and record name of a state
+ */
+typedef struct
+{
+    const char *cmd;    /**< Mode command, "mode=<wire code>\r\n" */
+    const char *record; /**< Raw data record name */
+} sFlowStateMsg_t;
+
 /**
  * @struct Power State Struct
  * @brief Power State Struct
@@ -0,0 +1,106 @@
+/** @file flowstate.h
+ *  @brief Flow states shared by the pCO2 Sensor and the Flow Controller
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note FLOW_STATE_TABLE is the only definition of the flow states.  Each
+ *  @note firmware defines FLOW_STATE(id, wire_code, valve_bitmap, pump, name,
+ *  @note record) and expands the table to build its enum and tables:
+ *  @note   id           State, FLOW_STATE_<id> (pCO2) or PCO2_<id> (Flow Controller)
+ *  @note   wire_code    Number sent as "mode=<wire_code>", 1 - FLOW_WIRE_MAX.
+ *  @note                Both enums use it as the value, so the Flow Controller
+ *  @note                decodes a mode with one table index.
+ *  @note   valve_bitmap Valve directions, bit 0 = V1, 1 = CA, 0 = CB
+ *  @note   pump         1 = Pump ON
+ *  @note   name         Mnemonic for logs and the console
+ *  @note   record       Prefix of the pCO2 raw data records.  Same as name
+ *  @note                except EPPC and DPLY, kept for existing data files.
+ *  @note
+ *  @note This file is kept identical in pCO2Sensor/src and FlowControl/src.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _FLOWSTATE_H
+#define _FLOWSTATE_H
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+/*          id               wire  valves  pump  name      record */
+#define FLOW_STATE_TABLE                                                \
+    FLOW_STATE(ZERO_PUMP_ON,    1,  0x10,  1,  "ZPON",   "ZPON")        \
+    FLOW_STATE(ZERO_PUMP_OFF,   2,  0x10,  0,  "ZPOFF",  "ZPOFF")       \
+    FLOW_STATE(ZERO_VENT,       3,  0x18,  0,  "ZPVENT", "ZPVENT")      \
+    FLOW_STATE(ZERO_PUMP_POST,  4,  0x10,  0,  "ZPPCAL", "ZPPCAL")      \
+    FLOW_STATE(SPAN_PUMP_ON,    5,  0x29,  0,  "SPON",   "SPON")        \
+    FLOW_STATE(SPAN_PUMP_OFF,   6,  0x39,  0,  "SPOFF",  "SPOFF")       \
+    FLOW_STATE(SPAN_VENT,       7,  0x39,  0,  "SPVENT", "SPVENT")      \
+    FLOW_STATE(SPAN_PUMP_POST,  8,  0x11,  0,  "SPPCAL", "SPPCAL")      \
+    FLOW_STATE(EQUIL_PUMP_ON,   9,  0x36,  1,  "EPON",   "EPON")        \
+    FLOW_STATE(EQUIL_PUMP_OFF,  10, 0x36,  0,  "EPOFF",  "EPOFF")       \
+    FLOW_STATE(EQUIL_VENT,      11, 0x39,  0,  "EPVENT", "EPVENT")      \
+    FLOW_STATE(EQUIL_PUMP_POST, 12, 0x39,  0,  "EPPOST", "EPPC")        \
+    FLOW_STATE(AIR_PUMP_ON,     13, 0x39,  1,  "APON",   "APON")        \
+    FLOW_STATE(AIR_PUMP_OFF,    14, 0x39,  0,  "APOFF",  "APOFF")       \
+    FLOW_STATE(AIR_VENT,        15, 0x39,  0,  "APVENT", "APVENT")      \
+    FLOW_STATE(AIR_POST,        16, 0x39,  0,  "APPOST", "APPOST")      \
+    FLOW_STATE(REST,            17, 0x10,  0,  "REST",   "REST")        \
+    FLOW_STATE(PRG1,            18, 0x35,  1,  "PRG1",   "PRG1")        \
+    FLOW_STATE(PRG2,            19, 0x26,  0,  "PRG2",   "PRG2")        \
+    FLOW_STATE(PRG3,            20, 0x3A,  0,  "PRG3",   "PRG3")        \
+    FLOW_STATE(PRG4,            21, 0x38,  0,  "PRG4",   "PRG4")        \
+    FLOW_STATE(PRG5,            22, 0x39,  0,  "PRG5",   "PRG5")        \
+    FLOW_STATE(PRG6,            23, 0x10,  0,  "PRG6",   "PRG6")        \
+    FLOW_STATE(PRG7,            24, 0x08,  0,  "PRG7",   "PRG7")        \
+    FLOW_STATE(PRG8,            25, 0x19,  0,  "PRG8",   "PRG8")        \
+    FLOW_STATE(DEPLOY,          26, 0x30,  0,  "DEPLOY", "DPLY")        \
+    FLOW_STATE(PRESSURIZE,      27, 0x11,  0,  "PRES",   "PRES")
+
+#define FLOW_WIRE_MAX (27)                  /**< Highest wire code */
+#define FLOW_WIRE_DIGITS (2)                /**< Most digits in a wire code */
+#define FLOW_WIRE_PUMP_TOGGLE "PUMP_TOGGLE" /**< Toggle the pump, valves unchanged */
+
+/** Mode command for a wire code, e.g. "mode=9\r\n" */
+#define FLOW_STATE_WIRE(wire_code) "mode=" #wire_code "\r\n"
+
+/************************************************************************
+ *					    Inline Functions
+ ************************************************************************/
+/** @brief Wire code from a mode argument
+ *
+ *  Reads the decimal wire code at the start of the text after "mode=".
+ *  Stops at the first non-digit.
+ *
+ *  @param *arg Mode argument
+ *
+ *  @return Wire code, 0 if not a number or above FLOW_WIRE_MAX
+ */
+static inline uint8_t FLOW_WireCode(const char *arg)
+{
+    uint8_t code = 0;
+    uint8_t i;
+
+    for (i = 0; (arg[i] >= '0') && (arg[i] <= '9'); i++)
+    {
+        if (i >= FLOW_WIRE_DIGITS)
+        {
+            return 0;
+        }
+        code = (uint8_t)((code * 10u) + (uint8_t)(arg[i] - '0'));
+    }
+
+    return (code <= FLOW_WIRE_MAX) ? code : 0;
+}
+
+#endif // _FLOWSTATE_H
@@ -0,0 +1,206 @@
+/** @file i2cbus.c
+ *  @brief I2C bus recovery and fault counters
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *  @bug  No known bugs
+ */
+#include "i2cbus.h"
+
+/************************************************************************
+ *					        Static Variables
+ ************************************************************************/
+STATIC const char *const I2CBUS_FaultNames[I2C_FAULT_CNT] = {"NACK", "ARB", "STUCK", "TIMEOUT"};
+
+/************************************************************************
+ *					   Static Functions Prototypes
+ ************************************************************************/
+STATIC void I2CBUS_Release(uint8_t port, uint16_t pin);
+STATIC void I2CBUS_Drive(uint8_t port, uint16_t pin);
+STATIC bool I2CBUS_Low(uint8_t port, uint16_t pin);
+STATIC bool I2CBUS_WaitScl(const sI2CBusPins_t *pins);
+STATIC void I2CBUS_Delay(void);
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+bool I2CBUS_Stuck(const sI2CBusPins_t *pins)
+{
+  return ((true == I2CBUS_Low(pins->sdaPort, pins->sdaPin)) ||
+          (true == I2CBUS_Low(pins->sclPort, pins->sclPin)));
+}
+
+eI2CFault_t I2CBUS_Classify(uint16_t ifg, const sI2CBusPins_t *pins)
+{
+  if (true == I2CBUS_Stuck(pins))
+  {
+    return I2C_FAULT_STUCK;
+  }
+
+  if (ifg & UCALIFG)
+  {
+    return I2C_FAULT_ARBLOST;
+  }
+
+  if (ifg & UCNACKIFG)
+  {
+    return I2C_FAULT_NACK;
+  }
+
+  return I2C_FAULT_TIMEOUT;
+}
+
+eI2CBusStatus_t I2CBUS_Recover(const sI2CBusPins_t *pins)
+{
+  eI2CBusStatus_t result = I2CBUS_FAIL;
+  uint8_t clocks;
+
+  /** Take both pins from the eUSCI, released */
+  I2CBUS_Release(pins->sdaPort, pins->sdaPin);
+  I2CBUS_Release(pins->sclPort, pins->sclPin);
+  I2CBUS_Delay();
+
+  /** A slave holding SCL cannot be clocked out */
+  if (true == I2CBUS_WaitScl(pins))
+  {
+    /** Clock out the rest of the byte the slave thinks it is sending */
+    for (clocks = 0; clocks < I2CBUS_MAX_CLOCKS; clocks++)
+    {
+      if (false == I2CBUS_Low(pins->sdaPort, pins->sdaPin))
+      {
+        break;
+      }
+      I2CBUS_Drive(pins->sclPort, pins->sclPin);
+      I2CBUS_Delay();
+      I2CBUS_Release(pins->sclPort, pins->sclPin);
+      if (false == I2CBUS_WaitScl(pins))
+      {
+        break;
+      }
+      I2CBUS_Delay();
+    }
+
+    /** STOP: SDA low to high while SCL is high */
+    I2CBUS_Drive(pins->sclPort, pins->sclPin);
+    I2CBUS_Delay();
+    I2CBUS_Drive(pins->sdaPort, pins->sdaPin);
+    I2CBUS_Delay();
+    I2CBUS_Release(pins->sclPort, pins->sclPin);
+    I2CBUS_WaitScl(pins);
+    I2CBUS_Delay();
+    I2CBUS_Release(pins->sdaPort, pins->sdaPin);
+    I2CBUS_Delay();
+
+    if (false == I2CBUS_Stuck(pins))
+    {
+      result = I2CBUS_OK;
+    }
+  }
+
+  /** Hand the pins back */
+  GPIO_setAsPeripheralModuleFunctionOutputPin(pins->sdaPort, pins->sdaPin, pins->function);
+  GPIO_setAsPeripheralModuleFunctionOutputPin(pins->sclPort, pins->sclPin, pins->function);
+
+  return result;
+}
+
+void I2CBUS_Count(sI2CFaults_t *faults, eI2CFault_t fault)
+{
+  if ((fault < I2C_FAULT_CNT) && (faults->count[fault] < UINT16_MAX))
+  {
+    faults->count[fault]++;
+  }
+}
+
+const char *I2CBUS_FaultName(eI2CFault_t fault)
+{
+  return (fault < I2C_FAULT_CNT) ? I2CBUS_FaultNames[fault] : "?";
+}
+
+/************************************************************************
+ *					   Static Functions
+ ************************************************************************/
+/** @brief Release Line
+ *
+ *  Input, the pull-up takes it high unless a slave holds it.
+ *
+ *  @param port Port
+ *  @param pin Pin
+ *
+ *  @return None
+ */
+STATIC void I2CBUS_Release(uint8_t port, uint16_t pin)
+{
+  GPIO_setAsInputPin(port, pin);
+}
+
+/** @brief Drive Line Low
+ *
+ *  Output low.  The output is set low before the direction so the line
+ *  is never driven high.
+ *
+ *  @param port Port
+ *  @param pin Pin
+ *
+ *  @return None
+ */
+STATIC void I2CBUS_Drive(uint8_t port, uint16_t pin)
+{
+  GPIO_setOutputLowOnPin(port, pin);
+  GPIO_setAsOutputPin(port, pin);
+}
+
+/** @brief Line Low
+ *
+ *  @param port Port
+ *  @param pin Pin
+ *
+ *  @return true if the line reads low
+ */
+STATIC bool I2CBUS_Low(uint8_t port, uint16_t pin)
+{
+  return (GPIO_INPUT_PIN_LOW == GPIO_getInputPinValue(port, pin));
+}
+
+/** @brief Wait for SCL
+ *
+ *  Give a slave stretching the clock time to let it go.
+ *
+ *  @param *pins Bus pins
+ *
+ *  @return true if SCL went high
+ */
+STATIC bool I2CBUS_WaitScl(const sI2CBusPins_t *pins)
+{
+  uint8_t spin;
+
+  for (spin = 0; spin < I2CBUS_STRETCH_SPIN; spin++)
+  {
+    if (false == I2CBUS_Low(pins->sclPort, pins->sclPin))
+    {
+      return true;
+    }
+    I2CBUS_Delay();
+  }
+
+  return false;
+}
+
+/** @brief Half Bit Delay
+ *
+ *  @param None
+ *
+ *  @return None
+ */
+STATIC void I2CBUS_Delay(void)
+{
+#ifndef UNIT_TESTING
+  __delay_cycles(I2CBUS_HALF_BIT_CYCLES);
+#endif
+}
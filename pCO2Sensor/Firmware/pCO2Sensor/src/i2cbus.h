@@ -0,0 +1,167 @@
+/** @file i2cbus.h
+ *  @brief I2C bus recovery and fault counters
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note A slave reset or browned out part way through a read can be left
+ *  @note holding SDA low, waiting for clocks that never come.  Resetting
+ *  @note the eUSCI does not free it.  I2CBUS_Recover takes the pins as
+ *  @note GPIO, clocks SCL (up to 9 times) until the slave lets go of SDA,
+ *  @note sends a STOP and hands the pins back to the eUSCI.
+ *  @note
+ *  @note The pins are open drain: a line is released by making it an
+ *  @note input (board pull-ups) and driven by making it an output low.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _I2CBUS_H
+#define _I2CBUS_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************************************************
+ *							HEADER FILES
+ ************************************************************************/
+#include "sysconfig.h"
+#include "driverlib/driverlib.h"
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+#define I2CBUS_MAX_CLOCKS (9)       /**< Clocks to free a slave mid byte (8 data + ACK) */
+#define I2CBUS_STRETCH_SPIN (100)   /**< Half bits to wait for a slave holding SCL */
+
+/** Half a 100kHz bit at the fastest MCLK, slower clocks only slow it down */
+#define I2CBUS_HALF_BIT_CYCLES (MCLK_FREQ / 200000)
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
+/**
+ *  @enum Bus Status
+ */
+typedef enum
+{
+  I2CBUS_OK = 0u,  /**< Both lines released */
+  I2CBUS_FAIL = 1u /**< A line is still held low */
+} eI2CBusStatus_t;
+
+/**
+ *  @enum Fault Type
+ */
+typedef enum
+{
+  I2C_FAULT_NACK = 0u,    /**< Slave did not acknowledge */
+  I2C_FAULT_ARBLOST = 1u, /**< Arbitration lost, SDA did not follow the master */
+  I2C_FAULT_STUCK = 2u,   /**< SDA or SCL held low */
+  I2C_FAULT_TIMEOUT = 3u, /**< Transfer never finished, lines free */
+  I2C_FAULT_CNT = 4u      /**< Number of fault types */
+} eI2CFault_t;
+
+/**
+ * @struct I2C Bus Pins
+ * @brief SDA and SCL of one eUSCI_B
+ */
+typedef struct
+{
+  uint8_t sdaPort;  /**< SDA port */
+  uint16_t sdaPin;  /**< SDA pin */
+  uint8_t sclPort;  /**< SCL port */
+  uint16_t sclPin;  /**< SCL pin */
+  uint8_t function; /**< eUSCI pin function */
+} sI2CBusPins_t;
+
+/**
+ * @struct I2C Fault Counters
+ * @brief Faults seen talking to one device
+ */
+typedef struct
+{
+  uint16_t count[I2C_FAULT_CNT]; /**< Faults by eI2CFault_t */
+  uint16_t recovered;            /**< Bus recoveries that freed the lines */
+  uint16_t unrecovered;          /**< Bus recoveries that did not */
+} sI2CFaults_t;
+
+/************************************************************************
+ *					    Function Prototypes
+ ************************************************************************/
+/** @brief Bus Stuck
+ *
+ *  Read the lines.  Works with the pins on the eUSCI or as GPIO.
+ *
+ *  @param *pins Bus pins
+ *
+ *  @return true if SDA or SCL is low
+ */
+bool I2CBUS_Stuck(const sI2CBusPins_t *pins);
+
+/** @brief Classify Fault
+ *
+ *  Work out why a transfer failed from the eUSCI flags and the lines.
+ *  A line held low wins over the flags.
+ *
+ *  @param ifg UCBxIFG after the failure
+ *  @param *pins Bus pins
+ *
+ *  @return Fault type
+ */
+eI2CFault_t I2CBUS_Classify(uint16_t ifg, const sI2CBusPins_t *pins);
+
+/** @brief Recover Bus
+ *
+ *  Clock SCL until SDA is released, send a STOP and hand the pins back
+ *  to the eUSCI.  The eUSCI should be held in reset while this runs and
+ *  re-initialized after.
+ *
+ *  @param *pins Bus pins
+ *
+ *  @return I2CBUS_OK if both lines are released
+ */
+eI2CBusStatus_t I2CBUS_Recover(const sI2CBusPins_t *pins);
+
+/** @brief Count Fault
+ *
+ *  @param *faults Device counters
+ *  @param fault Fault type
+ *
+ *  @return None
+ */
+void I2CBUS_Count(sI2CFaults_t *faults, eI2CFault_t fault);
+
+/** @brief Fault Name
+ *
+ *  @param fault Fault type
+ *
+ *  @return Short name for reports
+ */
+const char *I2CBUS_FaultName(eI2CFault_t fault);
+
+#endif // _I2CBUS_H
@@ -0,0 +1,365 @@
+/** @file i2cq.c
+ *  @brief Interrupt driven I2C transaction queue for the eUSCI_B buses
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note The main loop is the only producer.  The bus ISR takes the next
+ *  @note transfer when one finishes; the main loop only takes one when
+ *  @note the bus is idle, so the ISR for that bus cannot be running.
+ *
+ *  @bug  No known bugs
+ */
+#include "i2cq.h"
+
+/************************************************************************
+ *					   Static Functions Prototypes
+ ************************************************************************/
+STATIC void I2CQ_Next(sI2CQ_t *q);
+STATIC void I2CQ_Start(sI2CQ_t *q);
+STATIC void I2CQ_StartRead(sI2CQ_t *q);
+STATIC void I2CQ_Stop(sI2CQ_t *q);
+STATIC void I2CQ_Finish(sI2CQ_t *q, eI2CQResult_t result);
+STATIC void I2CQ_Sleep(sI2CQ_t *q, volatile bool *pBusy);
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+void I2CQ_Init(sI2CQ_t *q)
+{
+  I2CQRing_Clear(&q->Ring);
+  q->phase = I2CQ_PHASE_IDLE;
+  q->result = I2CQ_DONE;
+  q->idx = 0;
+  q->ticks = 0;
+  q->done = 0;
+  q->nack = 0;
+  q->timeout = 0;
+  q->arblost = 0;
+}
+
+eI2CQStatus_t I2CQ_Submit(sI2CQ_t *q, const sI2CQXfer_t *xfer)
+{
+  if ((xfer->txLen == 0) && (xfer->rxLen == 0))
+  {
+    return I2CQ_FAIL;
+  }
+
+  if (false == I2CQRing_Put(&q->Ring, *xfer))
+  {
+    return I2CQ_FULL;
+  }
+
+  /** A running bus picks it up when the current transfer finishes */
+  if (q->phase == I2CQ_PHASE_IDLE)
+  {
+    I2CQ_Next(q);
+  }
+
+  return I2CQ_OK;
+}
+
+bool I2CQ_Busy(sI2CQ_t *q)
+{
+  return (q->phase != I2CQ_PHASE_IDLE);
+}
+
+bool I2CQ_ISR(sI2CQ_t *q)
+{
+  sI2CQXfer_t *x = &q->Cur;
+  bool wake = false;
+
+  switch (*q->Reg.IV)
+  {
+  case USCI_I2C_UCALIFG:
+    /** Now a slave, there will be no STOP from us */
+    I2CQ_Finish(q, I2CQ_ARBLOST);
+    wake = true;
+    break;
+  case USCI_I2C_UCNACKIFG:
+    /** Address or data NACK'd, release the bus */
+    q->result = I2CQ_NACK;
+    I2CQ_Stop(q);
+    break;
+  case USCI_I2C_UCSTPIFG:
+    I2CQ_Finish(q, q->result);
+    wake = true;
+    break;
+  case USCI_I2C_UCRXIFG0:
+    /** STOP goes out with the last byte, so request it one byte early */
+    if ((uint8_t)(q->idx + 2u) == x->rxLen)
+    {
+      *q->Reg.CTLW0 |= UCTXSTP;
+    }
+    if (q->idx < x->rxLen)
+    {
+      x->rx[q->idx++] = (uint8_t)*q->Reg.RXBUF;
+    }
+    if (q->idx >= x->rxLen)
+    {
+      q->phase = I2CQ_PHASE_STOP;
+    }
+    break;
+  case USCI_I2C_UCTXIFG0:
+    if (q->phase != I2CQ_PHASE_TX)
+    {
+      break;
+    }
+    if (q->idx < x->txLen)
+    {
+      *q->Reg.TXBUF = x->tx[q->idx++];
+    }
+    else if (x->rxLen > 0)
+    {
+      I2CQ_StartRead(q);
+    }
+    else
+    {
+      I2CQ_Stop(q);
+    }
+    break;
+  default:
+    break;
+  }
+
+  return wake;
+}
+
+bool I2CQ_Tick(sI2CQ_t *q)
+{
+  if (q->phase == I2CQ_PHASE_IDLE)
+  {
+    return false;
+  }
+
+  if (++q->ticks < I2CQ_TIMEOUT_TICKS)
+  {
+    return false;
+  }
+
+  /** Stuck (clock held, STOP never seen).  Reset the eUSCI to free it */
+  *q->Reg.CTLW0 |= UCTXSTP;
+  *q->Reg.CTLW0 |= UCSWRST;
+  *q->Reg.CTLW0 &= ~UCSWRST;
+
+  I2CQ_Finish(q, I2CQ_TIMEOUT);
+  return true;
+}
+
+eI2CFault_t I2CQ_Fault(eI2CQResult_t result)
+{
+  switch (result)
+  {
+  case I2CQ_NACK:
+    return I2C_FAULT_NACK;
+  case I2CQ_ARBLOST:
+    return I2C_FAULT_ARBLOST;
+  default:
+    return I2C_FAULT_TIMEOUT;
+  }
+}
+
+void I2CQ_Done(eI2CQResult_t result, void *ctx)
+{
+  sI2CQDone_t *d = (sI2CQDone_t *)ctx;
+
+  d->result = result;
+  d->busy = false;
+}
+
+eI2CQResult_t I2CQ_Wait(sI2CQ_t *q, sI2CQDone_t *d)
+{
+  /** Stop if the queue drains without it, it was never submitted */
+  while ((true == d->busy) &&
+         ((q->phase != I2CQ_PHASE_IDLE) || (I2CQRing_Count(&q->Ring) > 0)))
+  {
+    I2CQ_Sleep(q, &d->busy);
+  }
+
+  return (true == d->busy) ? I2CQ_PENDING : d->result;
+}
+
+void I2CQ_Flush(sI2CQ_t *q)
+{
+  volatile bool busy = true;
+
+  while ((q->phase != I2CQ_PHASE_IDLE) || (I2CQRing_Count(&q->Ring) > 0))
+  {
+    I2CQ_Sleep(q, &busy);
+  }
+}
+
+/************************************************************************
+ *					   Static Functions
+ ************************************************************************/
+/** @brief Start the next transfer
+ *
+ *  With nothing left the queue interrupts are turned off so the bus is
+ *  left as the BSP_I2C_x functions expect.
+ *
+ *  @param *q Queue
+ *
+ *  @return None
+ */
+STATIC void I2CQ_Next(sI2CQ_t *q)
+{
+  if (true == I2CQRing_Get(&q->Ring, &q->Cur))
+  {
+    I2CQ_Start(q);
+  }
+  else
+  {
+    *q->Reg.IE = 0;
+  }
+}
+
+/** @brief Start a transfer
+ *
+ *  Take the bus: software STOP, queue interrupts only.  Releasing
+ *  UCSWRST clears IE, so IE is set after it.
+ *
+ *  @param *q Queue
+ *
+ *  @return None
+ */
+STATIC void I2CQ_Start(sI2CQ_t *q)
+{
+  q->idx = 0;
+  q->ticks = 0;
+  q->result = I2CQ_PENDING;
+
+  *q->Reg.CTLW0 |= UCSWRST;
+  *q->Reg.CTLW1 &= ~(UCASTP0 | UCASTP1);
+  *q->Reg.I2CSA = q->Cur.addr;
+  *q->Reg.CTLW0 &= ~UCSWRST;
+  *q->Reg.IFG = 0;
+  *q->Reg.IE = I2CQ_IE;
+
+  if (q->Cur.txLen > 0)
+  {
+    q->phase = I2CQ_PHASE_TX;
+    *q->Reg.CTLW0 |= (UCTR | UCTXSTT);
+  }
+  else
+  {
+    I2CQ_StartRead(q);
+  }
+}
+
+/** @brief Start (or restart) the read
+ *
+ *  A 1 byte read needs the STOP as soon as the START is out.  That is
+ *  one address byte on the wire, so it is waited for here.
+ *
+ *  @param *q Queue
+ *
+ *  @return None
+ */
+STATIC void I2CQ_StartRead(sI2CQ_t *q)
+{
+  uint16_t spin = I2CQ_STT_SPIN;
+
+  q->idx = 0;
+  q->phase = I2CQ_PHASE_RX;
+  *q->Reg.CTLW0 &= ~UCTR;
+  *q->Reg.CTLW0 |= UCTXSTT;
+
+  if (q->Cur.rxLen == 1)
+  {
+    while ((*q->Reg.CTLW0 & UCTXSTT) && (spin > 0))
+    {
+      spin--;
+    }
+    *q->Reg.CTLW0 |= UCTXSTP;
+  }
+}
+
+/** @brief Request STOP
+ *
+ *  The transfer finishes on the STOP interrupt.
+ *
+ *  @param *q Queue
+ *
+ *  @return None
+ */
+STATIC void I2CQ_Stop(sI2CQ_t *q)
+{
+  *q->Reg.CTLW0 |= UCTXSTP;
+  q->phase = I2CQ_PHASE_STOP;
+}
+
+/** @brief Finish the transfer on the bus
+ *
+ *  Count it, report it and start the next one.
+ *
+ *  @param *q Queue
+ *  @param result Transfer result
+ *
+ *  @return None
+ */
+STATIC void I2CQ_Finish(sI2CQ_t *q, eI2CQResult_t result)
+{
+  if (result == I2CQ_PENDING)
+  {
+    result = I2CQ_DONE;
+  }
+
+  switch (result)
+  {
+  case I2CQ_NACK:
+    q->nack++;
+    break;
+  case I2CQ_TIMEOUT:
+    q->timeout++;
+    break;
+  case I2CQ_ARBLOST:
+    q->arblost++;
+    break;
+  default:
+    q->done++;
+    break;
+  }
+
+  q->result = result;
+  q->phase = I2CQ_PHASE_IDLE;
+  if (q->Cur.done != NULL)
+  {
+    q->Cur.done(result, q->Cur.ctx);
+  }
+
+  I2CQ_Next(q);
+}
+
+/** @brief Sleep until a bus interrupt
+ *
+ *  Interrupts are off while checking so a completion between the check
+ *  and the sleep cannot be lost.  The host build runs the tick in place
+ *  so a transfer nobody completes times out.
+ *
+ *  @param *q Queue
+ *  @param *pBusy Sleep while true
+ *
+ *  @return None
+ */
+STATIC void I2CQ_Sleep(sI2CQ_t *q, volatile bool *pBusy)
+{
+#ifdef UNIT_TESTING
+  (void)pBusy;
+  I2CQ_Tick(q);
+#else
+  __disable_interrupt();
+  if ((true == *pBusy) && (q->phase != I2CQ_PHASE_IDLE))
+  {
+    __bis_SR_register(LPM0_bits | GIE);
+  }
+  else
+  {
+    __enable_interrupt();
+  }
+#endif
+}
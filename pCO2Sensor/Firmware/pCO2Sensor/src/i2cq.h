@@ -0,0 +1,293 @@
+/** @file i2cq.h
+ *  @brief Interrupt driven I2C transaction queue for the eUSCI_B buses
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note A transfer is {address, tx bytes, rx bytes, callback}.  The tx
+ *  @note bytes are written, then if there are rx bytes a repeated START
+ *  @note reads them, then STOP.  Transfers run in submit order, one at a
+ *  @note time, entirely from the bus ISR.  The caller submits and carries
+ *  @note on; the callback (ISR context) reports DONE, NACK, ARBLOST or
+ *  @note TIMEOUT.
+ *  @note
+ *  @note The bus must already be set up as a master by BSP_I2C_Init.  The
+ *  @note queue takes the bus over for each transfer (no auto STOP, its own
+ *  @note interrupt enables).  Do not call the BSP_I2C_x functions on a bus
+ *  @note while it has queued transfers; I2CQ_Flush waits for it to go idle.
+ *  @note
+ *  @note Only the main loop submits.  Callbacks must not submit.
+ *  @note
+ *  @note The bus vector calls I2CQ_ISR while I2CQ_Busy, and the RTC system
+ *  @note tick (nIRQ2, AMBIQ_RTC_SYSTICK_FREQ) calls I2CQ_Tick to time out a
+ *  @note stuck transfer.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _I2CQ_H
+#define _I2CQ_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************************************************
+ *							HEADER FILES
+ ************************************************************************/
+#include "driverlib/driverlib.h"
+#include "sysconfig.h"
+#include "ringbuf.h"
+#include "i2cbus.h"
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+#define I2CQ_DEPTH (8)          /**< Queued transfers per bus, power of two */
+#define I2CQ_TIMEOUT_MS (125)   /**< Time before a transfer is abandoned */
+#define I2CQ_STT_SPIN (200)     /**< Loops to wait for the START of a 1 byte read */
+
+/** I2CQ_TIMEOUT_MS in system ticks, rounded up.  The first tick can come */
+/** right after the submit, so never fewer than 2 */
+#define I2CQ_TIMEOUT_TICKS_RAW (((I2CQ_TIMEOUT_MS * AMBIQ_RTC_SYSTICK_FREQ) + 999u) / 1000u)
+#define I2CQ_TIMEOUT_TICKS ((I2CQ_TIMEOUT_TICKS_RAW < 2u) ? 2u : I2CQ_TIMEOUT_TICKS_RAW)
+
+/** Interrupts the queue runs on */
+#define I2CQ_IE (UCALIE | UCNACKIE | UCSTPIE | UCRXIE0 | UCTXIE0)
+
+/** Register set of eUSCI_Bn */
+#define I2CQ_REGS(n)                                \
+  {                                                 \
+    .CTLW0 = (volatile uint16_t *)&UCB##n##CTLW0,   \
+    .CTLW1 = (volatile uint16_t *)&UCB##n##CTLW1,   \
+    .I2CSA = (volatile uint16_t *)&UCB##n##I2CSA,   \
+    .IE = (volatile uint16_t *)&UCB##n##IE,         \
+    .IFG = (volatile uint16_t *)&UCB##n##IFG,       \
+    .IV = (volatile uint16_t *)&UCB##n##IV,         \
+    .TXBUF = (volatile uint16_t *)&UCB##n##TXBUF,   \
+    .RXBUF = (volatile uint16_t *)&UCB##n##RXBUF    \
+  }
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
+/**
+ *  @enum Queue Status
+ */
+typedef enum
+{
+  I2CQ_OK = 0u,  /**< Transfer queued */
+  I2CQ_FAIL = 1u, /**< Bad transfer */
+  I2CQ_FULL = 2u  /**< No room, nothing queued */
+} eI2CQStatus_t;
+
+/**
+ *  @enum Transfer Result
+ */
+typedef enum
+{
+  I2CQ_DONE = 0u,    /**< Every byte moved */
+  I2CQ_NACK = 1u,    /**< Slave did not acknowledge */
+  I2CQ_TIMEOUT = 2u, /**< No STOP within I2CQ_TIMEOUT_TICKS, bus reset */
+  I2CQ_PENDING = 3u, /**< Not finished yet */
+  I2CQ_ARBLOST = 4u  /**< Lost arbitration, no STOP sent */
+} eI2CQResult_t;
+
+/**
+ *  @enum Transfer Phase
+ */
+typedef enum
+{
+  I2CQ_PHASE_IDLE = 0u, /**< No transfer */
+  I2CQ_PHASE_TX = 1u,   /**< Writing tx bytes */
+  I2CQ_PHASE_RX = 2u,   /**< Reading rx bytes */
+  I2CQ_PHASE_STOP = 3u  /**< STOP requested, waiting for it */
+} eI2CQPhase_t;
+
+/** Completion callback, runs in the bus ISR */
+typedef void (*I2CQ_Callback_t)(eI2CQResult_t result, void *ctx);
+
+/**
+ * @struct I2C Transfer
+ * @brief One START to STOP transaction
+ */
+typedef struct
+{
+  uint8_t addr;          /**< 7 bit slave address */
+  const uint8_t *tx;     /**< Bytes to write */
+  uint8_t txLen;         /**< Number of bytes to write */
+  uint8_t *rx;           /**< Read buffer */
+  uint8_t rxLen;         /**< Number of bytes to read */
+  I2CQ_Callback_t done;  /**< Completion callback, NULL for none */
+  void *ctx;             /**< Callback context */
+} sI2CQXfer_t;
+
+RINGBUF_DECLARE(I2CQRing, sI2CQXfer_t, I2CQ_DEPTH)
+
+/**
+ * @struct eUSCI_B Registers
+ * @brief Registers of the bus the queue runs on
+ */
+typedef struct
+{
+  volatile uint16_t *CTLW0; /**< Control word 0 */
+  volatile uint16_t *CTLW1; /**< Control word 1 */
+  volatile uint16_t *I2CSA; /**< Slave address */
+  volatile uint16_t *IE;    /**< Interrupt enable */
+  volatile uint16_t *IFG;   /**< Interrupt flags */
+  volatile uint16_t *IV;    /**< Interrupt vector */
+  volatile uint16_t *TXBUF; /**< Transmit buffer */
+  volatile uint16_t *RXBUF; /**< Receive buffer */
+} sI2CQReg_t;
+
+/**
+ * @struct I2C Queue
+ * @brief Transfer queue of one bus
+ */
+typedef struct
+{
+  sI2CQReg_t Reg;                 /**< Bus registers */
+  sI2CQRing_t Ring;               /**< Waiting transfers */
+  sI2CQXfer_t Cur;                /**< Transfer on the bus */
+  volatile eI2CQPhase_t phase;    /**< Phase of Cur */
+  volatile eI2CQResult_t result;  /**< Result of Cur so far */
+  volatile uint8_t idx;           /**< Bytes moved in this phase */
+  volatile uint8_t ticks;         /**< System ticks Cur has run */
+  volatile uint16_t done;         /**< Transfers completed */
+  volatile uint16_t nack;         /**< Transfers NACK'd */
+  volatile uint16_t timeout;      /**< Transfers timed out */
+  volatile uint16_t arblost;      /**< Transfers that lost arbitration */
+} sI2CQ_t;
+
+/**
+ * @struct Transfer Completion
+ * @brief Used with I2CQ_Done to wait on a transfer
+ */
+typedef struct
+{
+  volatile bool busy;             /**< Set on submit, cleared on completion */
+  volatile eI2CQResult_t result;  /**< Transfer result */
+} sI2CQDone_t;
+
+extern sI2CQ_t I2CQ_B0; /**< RTC I2C bus */
+extern sI2CQ_t I2CQ_B1; /**< RH I2C bus */
+
+/************************************************************************
+ *					    Function Prototypes
+ ************************************************************************/
+/** @brief Initialize Queue
+ *
+ *  Empty the queue and clear the counters.  Bus setup is BSP_I2C_Init.
+ *
+ *  @param *q Queue
+ *
+ *  @return None
+ */
+void I2CQ_Init(sI2CQ_t *q);
+
+/** @brief Submit Transfer
+ *
+ *  Copy the transfer into the queue and start it if the bus is idle.
+ *  The tx and rx buffers must stay valid until the callback.
+ *
+ *  @param *q Queue
+ *  @param *xfer Transfer
+ *
+ *  @return result
+ */
+eI2CQStatus_t I2CQ_Submit(sI2CQ_t *q, const sI2CQXfer_t *xfer);
+
+/** @brief Queue Busy
+ *
+ *  @param *q Queue
+ *
+ *  @return true if a transfer is on the bus
+ */
+bool I2CQ_Busy(sI2CQ_t *q);
+
+/** @brief Bus Interrupt
+ *
+ *  Called from the eUSCI_Bn vector.  Reads UCBxIV and steps the transfer.
+ *
+ *  @param *q Queue
+ *
+ *  @return true if a transfer finished and the CPU should wake
+ */
+bool I2CQ_ISR(sI2CQ_t *q);
+
+/** @brief System Tick
+ *
+ *  Called from the RTC system tick.  Abandons a transfer that has run
+ *  I2CQ_TIMEOUT_TICKS (I2CQ_TIMEOUT_MS), resets the bus and starts the next one.
+ *
+ *  @param *q Queue
+ *
+ *  @return true if a transfer timed out and the CPU should wake
+ */
+bool I2CQ_Tick(sI2CQ_t *q);
+
+/** @brief Fault of Result
+ *
+ *  @param result Transfer result, not I2CQ_DONE
+ *
+ *  @return Fault type to count against the device
+ */
+eI2CFault_t I2CQ_Fault(eI2CQResult_t result);
+
+/** @brief Completion Callback
+ *
+ *  Stock callback.  ctx is an sI2CQDone_t.
+ *
+ *  @param result Transfer result
+ *  @param *ctx sI2CQDone_t to update
+ *
+ *  @return None
+ */
+void I2CQ_Done(eI2CQResult_t result, void *ctx);
+
+/** @brief Wait for Transfer
+ *
+ *  Sleep until the transfer using I2CQ_Done finishes.
+ *
+ *  @param *q Queue
+ *  @param *d Completion
+ *
+ *  @return Transfer result
+ */
+eI2CQResult_t I2CQ_Wait(sI2CQ_t *q, sI2CQDone_t *d);
+
+/** @brief Flush Queue
+ *
+ *  Sleep until every queued transfer has finished.
+ *
+ *  @param *q Queue
+ *
+ *  @return None
+ */
+void I2CQ_Flush(sI2CQ_t *q);
+
+#endif // _I2CQ_H
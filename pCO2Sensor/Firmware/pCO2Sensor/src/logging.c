@@ -27,14 +27,13 @@ STATIC PERSISTENT sLog_t logs = {
 
 };
 
-STATIC uint16_t ErrorCodes[8];
+STATIC uint16_t ErrorCodes[ERRLOG_FLAG_CNT];
 /************************************************************************
  *					   Static Functions Prototypes
  ************************************************************************/
 void _sendLog(const char *str);
 void _sendMsg(const char *prefix, const char *str);
 void _sendStr(const char *str);
-static void _parseErrors(char *str);
 /************************************************************************
  *					         Functions
  ************************************************************************/
@@ -53,22 +52,29 @@ void Log(const char *str, eLogPriority_t priority)
 
 }
 
-void Error(const char *str, eLogPriority_t priority)
+void Error(eErrorCode_t code, uint32_t arg)
 {
   char outstr[80];
-  char *pOutStr = &outstr[0];
-  memset(outstr, 0, 80);
-  strcpy(outstr, str);
+
+  /** History and flags first, they do not depend on the ports */
+  ERRLOG_Add(&ErrorLog, code, arg, AM08X5_GetEpoch());
+  ERRLOG_Flag(code, ErrorCodes);
+
+  if (arg != 0)
+  {
+    sprintf(outstr, "%08lX %s (%lu)", ERRLOG_Id(code), ERRLOG_Text(code), arg);
+  }
+  else
+  {
+    sprintf(outstr, "%08lX %s", ERRLOG_Id(code), ERRLOG_Text(code));
+  }
   _sendMsg("ERR", outstr);
-  char tempstr[8];
-  strncpy(tempstr, str, 8);
-  _parseErrors(tempstr);
 }
 
 void Error_Clear(void)
 {
   uint8_t i;
-  for (i = 0; i < 8; i++)
+  for (i = 0; i < ERRLOG_FLAG_CNT; i++)
   {
     ErrorCodes[i] = 0;
   }
@@ -80,7 +86,7 @@ void Error_GetFlags(char *s)
   char temp[9];
   uint8_t i;
 
-  for (i = 0; i < 8; i++)
+  for (i = 0; i < ERRLOG_FLAG_CNT; i++)
   {
     sprintf(temp, " %04x", ErrorCodes[i]);
     strcat(str, temp);
@@ -252,53 +258,3 @@ static void _sendStr(const char *str)
     }
 }
 
-
-static void _parseErrors(char *str)
-{
-
-  /** Convert last 4 to digits */
-  uint16_t value = 0;
-  uint8_t i;
-  for (i = 0; i < 4; i++)
-  {
-    value |= (str[i + 4] - '0') << (4 * (3 - i));
-  }
-
-  /** Sort into correct error code flags */
-  if (strncmp(str, "00", 2) == 0)
-  {
-    if (strncmp(&str[2], "01", 2) == 0)
-    {
-      ErrorCodes[0] |= value;
-    }
-    if (strncmp(&str[2], "02", 2) == 0)
-    {
-      ErrorCodes[1] |= value;
-    }
-    if (strncmp(&str[2], "04", 2) == 0)
-    {
-      ErrorCodes[2] |= value;
-    }
-    if (strncmp(&str[2], "08", 2) == 0)
-    {
-      ErrorCodes[3] |= value;
-    }
-    if (strncmp(&str[2], "10", 2) == 0)
-    {
-      ErrorCodes[4] |= value;
-    }
-    if (strncmp(&str[2], "20", 2) == 0)
-    {
-      ErrorCodes[5] |= value;
-    }
-    if (strncmp(&str[2], "40", 2) == 0)
-    {
-      ErrorCodes[6] = value;
-    }
-    if (strncmp(&str[2], "80", 2) == 0)
-    {
-      ErrorCodes[7] = value;
-    }
-  }
-  return;
-}
\ No newline at end of file
@@ -43,6 +43,7 @@
  *							HEADER FILES
  ************************************************************************/
 #include "errorlist.h"
+#include "errlog.h"
 #include "AM08x5.h"
 
 /************************************************************************
@@ -102,7 +103,7 @@ typedef struct
  *					   Functions Prototypes
  ************************************************************************/
 void Log(const char *str, eLogPriority_t priority);
-void Error(const char *str, eLogPriority_t priority);
+void Error(eErrorCode_t code, uint32_t arg);
 void Error_Clear(void);
 void Error_GetFlags(char *s);
 void SetLogLevel(eLogLevel_t level);
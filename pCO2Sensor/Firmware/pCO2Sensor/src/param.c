@@ -0,0 +1,291 @@
+/** @file param.c
+ *  @brief pCO2 configuration parameter registry
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *  @bug  No known bugs
+ */
+#include "param.h"
+#include "pco2.h"
+
+/************************************************************************
+ *					        Static Variables
+ ************************************************************************/
+/** Console order.  Integer ranges are the ones the PCO2_SetX functions
+ *  enforce; the float upper limits only catch typos */
+STATIC const sParam_t PARAM_Table[] = {
+    {"span", PARAM_FLOAT, &pco2.span, 0.0f, 20000.0f, 2, 0, "ppm", "Span Gas Concentration", NULL},
+    {"span2", PARAM_FLOAT, &pco2.span2, 0.0f, 20000.0f, 2, 0, "ppm", "Span2 Gas Concentration", NULL},
+    {"spandiff", PARAM_FLOAT, &pco2.spandiff, 0.0f, 100.0f, 2, 0, "kPa", "Span Pressure Difference", NULL},
+    {"equil", PARAM_U16, &pco2.equil.equil, 0.0f, 999.0f, 0, 0, "sec", "Length of Equilibration Pump", NULL},
+    {"warmup", PARAM_U16, &pco2.LI_warmup, 0.0f, 999.0f, 0, 0, "sec", "Length of LICOR Warmup", NULL},
+    {"pumpon", PARAM_U16, &pco2.pump.pumpon, 0.0f, 999.0f, 0, 0, "sec", "Length of pump on during cycle", NULL},
+    {"pumpoff", PARAM_U16, &pco2.pump.pumpoff, 0.0f, 999.0f, 0, 0, "sec", "Length of pump off during a cycle", NULL},
+    {"spanflow", PARAM_U16, &pco2.spanflow.flowon, 0.0f, 999.0f, 0, 0, "sec", "Span Flow ON duration", NULL},
+    {"purge", PARAM_U16, &pco2.purge.purge, 0.0f, 999.0f, 0, 0, "sec", "Purge duration", NULL},
+    {"sampleco2", PARAM_U16, &pco2.sampleCO2, 0.0f, 999.0f, 0, 0, "sec", "Length of data sample in cycle", NULL},
+    {"vent", PARAM_U16, &pco2.vent, 0.0f, 999.0f, 0, 0, "sec", "Length of delay between open/close vent", NULL},
+    {"heater", PARAM_U8, &pco2.LI_heater, 0.0f, 1.0f, 0, 0, "", "Licor Heater OFF or ON", &PCO2_ApplyHeater},
+    {"converge", PARAM_U8, &pco2.converge.enable, 0.0f, 1.0f, 0, 0, "", "End sample early on convergence OFF or ON", NULL},
+    {"convmin", PARAM_U16, &pco2.converge.minsamples, 2.0f, 999.0f, 0, 0, "samples", "Min samples before convergence check", NULL},
+    {"convco2", PARAM_FLOAT, &pco2.converge.co2, 0.0001f, 100.0f, 4, 0, "ppm", "CO2 std error convergence limit", NULL},
+    {"convpres", PARAM_FLOAT, &pco2.converge.pressure, 0.0f, 100.0f, 4, 0, "kPa", "Pres std error convergence limit (0=off)", NULL},
+    {"eqslope", PARAM_U8, &pco2.eqslope.enable, 0.0f, 1.0f, 0, 0, "", "End equil on CO2 slope OFF or ON", NULL},
+    {"eqmin", PARAM_U16, &pco2.eqslope.minimum, 0.0f, 999.0f, 0, 0, "sec", "Minimum equil pump time", NULL},
+    {"eqdwell", PARAM_U16, &pco2.eqslope.dwell, (float)PCO2_EQSLOPE_INTERVAL, 999.0f, 0, 0, "sec", "Time CO2 slope must stay under eqrate", NULL},
+    {"eqrate", PARAM_FLOAT, &pco2.eqslope.rate, 0.001f, 1000.0f, 3, 0, "ppm/min", "Equil CO2 slope limit", NULL},
+    {"liwarm", PARAM_U8, &pco2.liwarm.enable, 0.0f, 1.0f, 0, 0, "", "End LICOR warmup when stable OFF or ON", NULL},
+    {"liwtemp", PARAM_FLOAT, &pco2.liwarm.temp_tol, 0.001f, 50.0f, 3, 0, "degC", "LICOR warmup cell temp band", NULL},
+    {"liwpres", PARAM_FLOAT, &pco2.liwarm.pres_tol, 0.001f, 100.0f, 3, 0, "kPa", "LICOR warmup cell pressure band", NULL},
+    {"overlap", PARAM_U8, &pco2.overlap, 0.0f, 1.0f, 0, 0, "", "Warm LICOR during zero pump OFF or ON", NULL},
+    {"stream", PARAM_U8, &pco2.stream, 0.0f, 1.0f, 0, 0, "", "LICOR streams while sampling OFF or ON", NULL},
+    {"calpol", PARAM_U8, &pco2.calpol.enable, 0.0f, 1.0f, 0, 0, "", "Cal cadence policy OFF (cal every run) or ON", &PCO2_ApplyCalPolicy},
+    {"calzero", PARAM_U16, &pco2.calpol.zero_runs, 1.0f, 999.0f, 0, 0, "runs", "Zero every N runs", NULL},
+    {"calspan", PARAM_U16, &pco2.calpol.span_runs, 1.0f, 999.0f, 0, 0, "runs", "Span every M runs", NULL},
+    {"calhours", PARAM_U16, &pco2.calpol.span_hours, 0.0f, (float)PCO2_CALPOL_MAX_HOURS, 0, 0, "hours", "Span at least every T hours (0=off)", NULL},
+    {"calerr", PARAM_FLOAT, &pco2.calpol.span_err, 0.0f, 1000.0f, 3, 0, "ppm", "Force cal on span off error (0=off)", NULL},
+    {"caltemp", PARAM_FLOAT, &pco2.calpol.temp_change, 0.0f, 50.0f, 3, 0, "degC", "Force cal on cell temp change (0=off)", NULL},
+    {"sample", PARAM_U8, &pco2.sample, 1.0f, 4.0f, 0, PARAM_READONLY, "Hz", "Data Sampling Interval", NULL},
+};
+
+#define PARAM_CNT (sizeof(PARAM_Table) / sizeof(PARAM_Table[0]))
+
+/************************************************************************
+ *					   Static Functions Prototypes
+ ************************************************************************/
+STATIC bool PARAM_IsEnd(char c);
+STATIC void PARAM_Write(const sParam_t *param, float value);
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+uint16_t PARAM_Count(void)
+{
+  return (uint16_t)PARAM_CNT;
+}
+
+const sParam_t *PARAM_Entry(uint16_t idx)
+{
+  return (idx < PARAM_CNT) ? &PARAM_Table[idx] : NULL;
+}
+
+const sParam_t *PARAM_Find(const char *name)
+{
+  size_t len = 0;
+  uint16_t i;
+
+  while ((false == PARAM_IsEnd(name[len])) && ('=' != name[len]))
+  {
+    len++;
+  }
+
+  for (i = 0; i < PARAM_CNT; i++)
+  {
+    if ((strlen(PARAM_Table[i].name) == len) &&
+        (0 == strncmp(PARAM_Table[i].name, name, len)))
+    {
+      return &PARAM_Table[i];
+    }
+  }
+
+  return NULL;
+}
+
+eParamStatus_t PARAM_Parse(const sParam_t *param, const char *str, float *value)
+{
+  char *end = NULL;
+  double val;
+
+  if (0u != (param->flags & PARAM_READONLY))
+  {
+    return PARAM_READ_ONLY;
+  }
+
+  if (PARAM_FLOAT == param->type)
+  {
+    val = strtod(str, &end);
+  }
+  else
+  {
+    /** strtoul takes a sign, a setting can not */
+    if (0 == isdigit((unsigned char)str[0]))
+    {
+      return PARAM_FAIL;
+    }
+    val = (double)strtoul(str, &end, 10);
+  }
+
+  if ((end == str) || (false == PARAM_IsEnd(*end)))
+  {
+    return PARAM_FAIL;
+  }
+
+  /** Compared as stored so the limits themselves pass.  Written so NaN fails */
+  *value = (float)val;
+  if (!((*value >= param->min) && (*value <= param->max)))
+  {
+    return PARAM_RANGE;
+  }
+
+  return PARAM_OK;
+}
+
+eParamStatus_t PARAM_Set(const sParam_t *param, const char *str)
+{
+  eParamStatus_t status;
+  float value;
+
+  status = PARAM_Parse(param, str, &value);
+  if (PARAM_OK == status)
+  {
+    PARAM_Write(param, value);
+  }
+
+  return status;
+}
+
+eParamStatus_t PARAM_SetMany(const char *args, sParamSet_t *set)
+{
+  const char *p = args;
+  const sParam_t *param;
+  eParamStatus_t status = PARAM_OK;
+  size_t len;
+  uint8_t i;
+
+  set->cnt = 0;
+  set->bad = NULL;
+
+  /** Check them all */
+  while (PARAM_OK == status)
+  {
+    while (' ' == *p)
+    {
+      p++;
+    }
+    if (true == PARAM_IsEnd(*p))
+    {
+      break;
+    }
+
+    set->bad = p;
+    param = PARAM_Find(p);
+    if (NULL == param)
+    {
+      status = PARAM_UNKNOWN;
+      break;
+    }
+
+    len = strlen(param->name);
+    if (('=' != p[len]) || (set->cnt >= PARAM_SET_MAX))
+    {
+      status = PARAM_FAIL;
+      break;
+    }
+
+    status = PARAM_Parse(param, &p[len + 1u], &set->value[set->cnt]);
+    if (PARAM_OK == status)
+    {
+      set->param[set->cnt++] = param;
+      while (false == PARAM_IsEnd(*p))
+      {
+        p++;
+      }
+    }
+  }
+
+  if ((PARAM_OK == status) && (0u == set->cnt))
+  {
+    status = PARAM_FAIL;
+  }
+
+  if (PARAM_OK != status)
+  {
+    return status;
+  }
+
+  /** Then write them all */
+  set->bad = NULL;
+  for (i = 0; i < set->cnt; i++)
+  {
+    PARAM_Write(set->param[i], set->value[i]);
+  }
+
+  return PARAM_OK;
+}
+
+float PARAM_Value(const sParam_t *param)
+{
+  switch (param->type)
+  {
+  case PARAM_U8:
+    return (float)*(uint8_t *)param->value;
+  case PARAM_U16:
+    return (float)*(uint16_t *)param->value;
+  default:
+    return *(float *)param->value;
+  }
+}
+
+void PARAM_Format(const sParam_t *param, char *str)
+{
+  if (PARAM_FLOAT == param->type)
+  {
+    sprintf(str, "%s= %.*f", param->name, param->decimals, PARAM_Value(param));
+  }
+  else
+  {
+    sprintf(str, "%s= %u", param->name, (unsigned int)PARAM_Value(param));
+  }
+}
+
+/************************************************************************
+ *					   Static Functions
+ ************************************************************************/
+/** @brief End of Token
+ *
+ *  @param c Character
+ *
+ *  @return true at a space, CR, LF or NULL
+ */
+STATIC bool PARAM_IsEnd(char c)
+{
+  return ((' ' == c) || ('\r' == c) || ('\n' == c) || ('\0' == c));
+}
+
+/** @brief Write Value
+ *
+ *  The value has been checked.  The apply hook gets the old value.
+ *
+ *  @param *param Parameter
+ *  @param value New value
+ *
+ *  @return None
+ */
+STATIC void PARAM_Write(const sParam_t *param, float value)
+{
+  float prev = PARAM_Value(param);
+
+  switch (param->type)
+  {
+  case PARAM_U8:
+    *(uint8_t *)param->value = (uint8_t)value;
+    break;
+  case PARAM_U16:
+    *(uint16_t *)param->value = (uint16_t)value;
+    break;
+  default:
+    *(float *)param->value = value;
+    break;
+  }
+
+  if (NULL != param->apply)
+  {
+    param->apply(prev);
+  }
+}
@@ -0,0 +1,188 @@
+/** @file param.h
+ *  @brief pCO2 configuration parameter registry
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note Each numeric pCO2 setting is one registry entry: name, type,
+ *  @note where it lives in the persistent pco2 struct, the allowed range
+ *  @note (inclusive), unit and help.  The console get/set, report, help
+ *  @note and bulk set all work from the one table.
+ *  @note
+ *  @note Values are carried as float while checking.  Every integer
+ *  @note setting fits in the 24 bit mantissa.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _PARAM_H
+#define _PARAM_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+#define PARAM_SET_MAX (16)          /**< Settings in one bulk set */
+#define PARAM_READONLY (0x01u)      /**< Flag: value can not be set */
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
+/**
+ * @enum Parameter Status
+ */
+typedef enum
+{
+  PARAM_OK = 0u,       /**< Value accepted */
+  PARAM_FAIL = 1u,     /**< Value not a number of the right type */
+  PARAM_RANGE = 2u,    /**< Value outside min..max */
+  PARAM_UNKNOWN = 3u,  /**< No such parameter */
+  PARAM_READ_ONLY = 4u /**< Parameter can not be set */
+} eParamStatus_t;
+
+/**
+ * @enum Parameter Storage Type
+ */
+typedef enum
+{
+  PARAM_U8 = 0u,   /**< uint8_t */
+  PARAM_U16 = 1u,  /**< uint16_t */
+  PARAM_FLOAT = 2u /**< float */
+} eParamType_t;
+
+/**
+ * @struct Parameter Registry Entry
+ */
+typedef struct
+{
+  const char *name;          /**< Console command name */
+  eParamType_t type;         /**< Storage type of *value */
+  void *value;               /**< Setting in the persistent pco2 struct */
+  float min;                 /**< Smallest allowed value */
+  float max;                 /**< Largest allowed value */
+  uint8_t decimals;          /**< Digits shown for PARAM_FLOAT */
+  uint8_t flags;             /**< PARAM_READONLY */
+  const char *unit;          /**< Unit, "" for none */
+  const char *help;          /**< Help text */
+  void (*apply)(float prev); /**< Called after a write, NULL for none */
+} sParam_t;
+
+/**
+ * @struct Bulk Set
+ */
+typedef struct
+{
+  const sParam_t *param[PARAM_SET_MAX]; /**< Parameters to write */
+  float value[PARAM_SET_MAX];           /**< Checked values */
+  uint8_t cnt;                          /**< Settings held */
+  const char *bad;                      /**< Token that failed, NULL if none */
+} sParamSet_t;
+
+/************************************************************************
+ *					    Function Prototypes
+ ************************************************************************/
+/** @brief Registry Size
+ *
+ *  @return Number of parameters
+ */
+uint16_t PARAM_Count(void);
+
+/** @brief Registry Entry
+ *
+ *  @param idx Entry number
+ *
+ *  @return Entry, NULL past the end
+ */
+const sParam_t *PARAM_Entry(uint16_t idx);
+
+/** @brief Find Parameter
+ *
+ *  The name ends at a space, '=', CR, LF or NULL so a console line can
+ *  be passed as is.
+ *
+ *  @param *name Name
+ *
+ *  @return Entry, NULL if not found
+ */
+const sParam_t *PARAM_Find(const char *name);
+
+/** @brief Parse and Check Value
+ *
+ *  The value ends at a space, CR, LF or NULL.  Nothing is written.
+ *
+ *  @param *param Parameter
+ *  @param *str Value string
+ *  @param *value Checked value out
+ *
+ *  @return PARAM_OK, PARAM_FAIL, PARAM_RANGE or PARAM_READ_ONLY
+ */
+eParamStatus_t PARAM_Parse(const sParam_t *param, const char *str, float *value);
+
+/** @brief Parse, Check and Write Value
+ *
+ *  @param *param Parameter
+ *  @param *str Value string
+ *
+ *  @return As PARAM_Parse.  Only PARAM_OK writes.
+ */
+eParamStatus_t PARAM_Set(const sParam_t *param, const char *str);
+
+/** @brief Set Several Parameters
+ *
+ *  Space separated name=value pairs.  Every pair is parsed and checked
+ *  first; only if all pass are they written, in order.
+ *
+ *  @param *args Pairs
+ *  @param *set Checked settings out.  set->bad is the failing pair.
+ *
+ *  @return PARAM_OK or the first failure
+ */
+eParamStatus_t PARAM_SetMany(const char *args, sParamSet_t *set);
+
+/** @brief Current Value
+ *
+ *  @param *param Parameter
+ *
+ *  @return Value
+ */
+float PARAM_Value(const sParam_t *param);
+
+/** @brief Format Value
+ *
+ *  "name= value", no line ending.
+ *
+ *  @param *param Parameter
+ *  @param *str String out (name + 16 characters)
+ *
+ *  @return None
+ */
+void PARAM_Format(const sParam_t *param, char *str);
+
+#endif // _PARAM_H
@@ -17,13 +17,21 @@
 
 #include "pco2.h"
 #include "logging.h"
+#include "sbd.h"
+#include "vecstats.h"
 /************************************************************************
  *					        Static Variables
  ************************************************************************/
 const char PCO2_StandardHeader[] = "minute,t,t_std,press,p_std,pco2,pco2_std,o2,o2_std,rh,rh_std,rh_t,rh_t_std,raw_1,raw_1_std,raw_2,raw_2_std";
 STATIC char pco2_str[PCO2_STR_LEN];
 STATIC bool SPAN_SKIPPED;
+STATIC bool LICOR_WARMING;
+STATIC bool CAL_ZERO_DUE;
+STATIC bool CAL_SPAN_DUE;
+STATIC bool CAL_DRIFT_PENDING;
 PERSISTENT char PCO2_IData[4096];
+VSTATS_LEA_DATA(pco2_window)
+STATIC int32_t pco2_window[PCO2_SAMPLES_PER_MODE];
 
 PERSISTENT sStats_F_t pco2_li_co2;
 PERSISTENT sStats_F_t pco2_li_pres;
@@ -38,6 +46,7 @@ PERSISTENT sStats_F_t pco2_o2_o2;
 
 PERSISTENT uint32_t db_val;
 PERSISTENT uint32_t db_val2;
+PERSISTENT uint32_t pco2_run_epoch;
 
 PERSISTENT sPCO2_t pco2 = {
     .SampleMode = PCO2_SAMPLE_MODE_FAST,
@@ -77,9 +86,30 @@ PERSISTENT sPCO2_t pco2 = {
     .spandiff = DEFAULT_PCO2_SPANDIFF,
     .span = DEFAULT_PCO2_SPAN,
     .span2 = DEFAULT_PCO2_SPAN2,
+    .converge = {.enable = DEFAULT_PCO2_CONVERGE_ENABLE,
+                 .minsamples = DEFAULT_PCO2_CONVERGE_MIN_SAMPLES,
+                 .co2 = DEFAULT_PCO2_CONVERGE_CO2_SEM,
+                 .pressure = DEFAULT_PCO2_CONVERGE_PRES_SEM},
+    .eqslope = {.enable = DEFAULT_PCO2_EQSLOPE_ENABLE,
+                .minimum = DEFAULT_PCO2_EQSLOPE_MINIMUM,
+                .dwell = DEFAULT_PCO2_EQSLOPE_DWELL,
+                .rate = DEFAULT_PCO2_EQSLOPE_RATE},
+    .liwarm = {.enable = DEFAULT_PCO2_LIWARM_ENABLE,
+               .temp_tol = DEFAULT_PCO2_LIWARM_TEMP_TOL,
+               .pres_tol = DEFAULT_PCO2_LIWARM_PRES_TOL},
+    .calpol = {.enable = DEFAULT_PCO2_CALPOL_ENABLE,
+               .zero_runs = DEFAULT_PCO2_CALPOL_ZERO_RUNS,
+               .span_runs = DEFAULT_PCO2_CALPOL_SPAN_RUNS,
+               .span_hours = DEFAULT_PCO2_CALPOL_SPAN_HOURS,
+               .span_err = DEFAULT_PCO2_CALPOL_SPAN_ERR,
+               .temp_change = DEFAULT_PCO2_CALPOL_TEMP},
     .timeout1 = &sysinfo.timer1,
     .timeout2 = &sysinfo.timer2,
     .sampleTimer = &sysinfo.sampleTimer,
+    .warmTimer = &sysinfo.timer3,
+    .overlap = DEFAULT_PCO2_OVERLAP,
+    .stream = DEFAULT_PCO2_STREAM,
+    .seq = DEFAULT_PCO2_SEQUENCE,
     .sample = DEFAULT_PCO2_SAMPLE_FREQ};
 
 PERSISTENT sPCO2_t pco2_temp;
@@ -87,6 +117,7 @@ PERSISTENT sPCO2Dry_t pco2_dry;
 PERSISTENT sPCO2_sdata_t run_data;
 
 PERSISTENT sPCO2_idata_t i_data;
+PERSISTENT sPCO2CalState_t pco2_cal;
 
 const char PCO2_MODE_ZERO_PUMP_ON[] = "ZPON  ";
 const char PCO2_MODE_ZERO_PUMP_OFF[] = "ZPOFF ";
@@ -120,6 +151,7 @@ STATIC void PCO2_Calculate_DryCO2(sPCO2Dry_t *T, sPCO2_idata_t *idata);
 void PCO2_Set_O2Cal(void);
 STATIC void calculate_pumpwait(void);
 STATIC void calculate_prequil(void);
+STATIC void PCO2_EqTime(sEqTime_t *t);
 STATIC void PCO2_Licor_Warmup(void);
 STATIC ePCO2Status_t PCO2_State_PumpOn(ePCO2Mode_t mode);
 STATIC ePCO2Status_t PCO2_State_PumpOff(ePCO2Mode_t mode);
@@ -127,6 +159,41 @@ STATIC void clear_run_data(sPCO2_run_data_t *data);
 STATIC void clear_full_run_data(sPCO2_sdata_t *data);
 STATIC void clear_idata_mode_data(sPCO2_idata_mode_t *data);
 STATIC void clear_idata_data(sPCO2_idata_t *data);
+STATIC bool PCO2_Sample_Converged(uint16_t sampleCnt);
+STATIC void PCO2_Equil_Monitor(uint16_t warmup);
+STATIC uint16_t PCO2_Licor_WaitWarm(void);
+STATIC ePCO2Status_t PCO2_Licor_Ready(void);
+STATIC eLicorStatus_t PCO2_Stream_Wait(sLicorData_t *data, uint16_t ms);
+STATIC ePCO2Status_t PCO2_Step_Span(void);
+STATIC ePCO2Status_t PCO2_Run_Step(ePCO2Step_t step);
+STATIC uint32_t PCO2_Step_Seconds(ePCO2Step_t step);
+STATIC void PCO2_Cal_Plan(void);
+STATIC void PCO2_Cal_Drift(void);
+STATIC bool PCO2_Cal_Step(ePCO2Step_t step);
+STATIC void PCO2_Cal_Update(void);
+STATIC void PCO2_Save_History(uint32_t start);
+STATIC void PCO2_Dry_Store(sPCO2DryCell_t *cell);
+STATIC void PCO2_Dry_Clear(sPCO2DryCell_t *cell);
+STATIC void PCO2_Window_Float(sStats_F_t *s, const float *x, uint16_t n);
+STATIC void PCO2_Window_Raw(sStats_F_t *s, const uint32_t *x, uint16_t n);
+STATIC void PCO2_Window_Q31(sStats_F_t *s, uint16_t n, float lsb);
+
+/************************************************************************
+ *					         Run Step Table
+ ************************************************************************/
+STATIC const sPCO2StepDef_t PCO2_Steps[] = {
+    {PCO2_STEP_ZERO, 'Z', &PCO2_State_Zero, ERROR_MSG_00010020,
+     &pco2.pump.pumpon, 1, 3, 2, NULL},
+    {PCO2_STEP_SPAN, 'S', &PCO2_Step_Span, ERROR_MSG_00010040,
+     &pco2.spanflow.flowon, 1, 3, 2, &pco2_dry.span},
+    {PCO2_STEP_EQUIL, 'E', &PCO2_State_Equilibrate, ERROR_MSG_00010100,
+     &pco2.equil.equil, 1, 2, 1, &pco2_dry.equil},
+    {PCO2_STEP_AIR, 'A', &PCO2_State_Air, ERROR_MSG_00010200,
+     &pco2.pump.pumpon, 1, 2, 1, &pco2_dry.air},
+    {PCO2_STEP_PURGE, 'P', &PCO2_State_Purge, ERROR_MSG_00010A00,
+     &pco2.purge.purge, 2, 0, 0, NULL}};
+
+#define PCO2_STEPS_LEN (sizeof(PCO2_Steps) / sizeof(PCO2_Steps[0]))
 /************************************************************************
  *					         Functions
  ************************************************************************/
@@ -148,7 +215,7 @@ void PCO2_Initialize(void)
   /** Initialize the Flow Controller */
   if (FLOW_OK != FLOW_Init())
   {
-    Error(ERROR_MSG_00010002, LOG_Priority_High);
+    Error(ERROR_MSG_00010002, 0);
   }
 
   CONSOLE_Init();
@@ -166,7 +233,7 @@ void PCO2_Initialize(void)
   /** Initialize the Licor */
   if (LICOR_OK != LI8x0_Init())
   {
-    Error(ERROR_MSG_00010001, LOG_Priority_High);
+    Error(ERROR_MSG_00010001, 0);
   }
 
   /** Calculate the pumpoff and prequil times */
@@ -205,55 +272,42 @@ void PCO2_Calculate_RunTime(sTimeReg_t *t)
 {
   sTimeReg_t temp_s;
   sTimeReg_t *temp = &temp_s;
+  bool purge = true;
+  uint8_t i;
 
   /** Calculate the pumpoff and prequil times */
   calculate_prequil();
   calculate_pumpwait();
 
-  /** Add Init Times */
+  /** Add Init Times (only the part not hidden by the zero pump) */
   AM08X5_clear_time_struct(t);
-  AM08X5_seconds_to_time_struct(temp, pco2.LI_warmup);
-  AM08X5_add_time_struct(temp, t, t);
-
-  /** Add Zero Times */
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpon);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.sampleCO2 * 3);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpoff);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpoff);
-  AM08X5_add_time_struct(temp, t, t);
-
-  /** Add Span Times */
-  AM08X5_seconds_to_time_struct(temp, pco2.spanflow.flowon);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.sampleCO2 * 3);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpoff);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpoff);
-  AM08X5_add_time_struct(temp, t, t);
-
-  /** Add Equil Times */
-  AM08X5_seconds_to_time_struct(temp, pco2.equil.equil);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.sampleCO2 * 2);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpoff);
+  if (1 == pco2.overlap)
+  {
+    AM08X5_seconds_to_time_struct(temp, (pco2.LI_warmup > pco2.pump.pumpon) ? (pco2.LI_warmup - pco2.pump.pumpon) : 0);
+  }
+  else
+  {
+    AM08X5_seconds_to_time_struct(temp, pco2.LI_warmup);
+  }
   AM08X5_add_time_struct(temp, t, t);
 
-  /** Add Air Times */
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpon);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.sampleCO2 * 2);
-  AM08X5_add_time_struct(temp, t, t);
-  AM08X5_seconds_to_time_struct(temp, pco2.pump.pumpoff);
-  AM08X5_add_time_struct(temp, t, t);
+  /** Add the time of each step in the sequence */
+  for (i = 0; (i < PCO2_SEQ_LEN) && (PCO2_STEP_END != pco2.seq[i]); i++)
+  {
+    if (PCO2_STEP_PURGE == pco2.seq[i])
+    {
+      purge = false;
+    }
+    AM08X5_seconds_to_time_struct(temp, PCO2_Step_Seconds((ePCO2Step_t)pco2.seq[i]));
+    AM08X5_add_time_struct(temp, t, t);
+  }
 
-  /** Add Purge Times */
-  AM08X5_seconds_to_time_struct(temp, pco2.purge.purge * 2);
-  AM08X5_add_time_struct(temp, t, t);
+  /** Add Purge Times (worst case, purge may be added to any run) */
+  if (true == purge)
+  {
+    AM08X5_seconds_to_time_struct(temp, PCO2_Step_Seconds(PCO2_STEP_PURGE));
+    AM08X5_add_time_struct(temp, t, t);
+  }
 
   return;
 }
@@ -359,6 +413,10 @@ void PCO2_InstantRun_Test(void)
 
 void PCO2_Run(bool purge)
 {
+  uint8_t i;
+
+  pco2_run_epoch = AM08X5_GetEpoch();
+  ERRLOG_NewRun(&ErrorLog);
   PCO2_Initialize();
 
   db_val = 0;
@@ -369,6 +427,12 @@ void PCO2_Run(bool purge)
   /** Clear the idata struct */
   clear_idata_data(&i_data);
 
+  /** No seawater or air dry data until those steps run (span is kept) */
+  PCO2_Dry_Clear(&pco2_dry.equil);
+  PCO2_Dry_Clear(&pco2_dry.air);
+  pco2_dry.sw_xco2 = NAN;
+  pco2_dry.air_xco2 = NAN;
+
   /** Wakeup the Flow Controller */
   FLOW_Wakeup();
 
@@ -382,55 +446,42 @@ void PCO2_Run(bool purge)
   /** Configure System */
   if (PCO2_OK != PCO2_State_Config())
   {
-    Error(ERROR_MSG_00010010, LOG_Priority_High);
+    Error(ERROR_MSG_00010010, 0);
     PCO2_State_Rest();
     return;
   }
   
-  /** Zero Mode*/
-  BSP_Hit_WD();
-  if (PCO2_OK != PCO2_State_Zero())
-  {
-    Error(ERROR_MSG_00010010, LOG_Priority_High);
-    PCO2_State_Rest();
-    return;
-  }
+  /** Decide which calibrations are due this run */
+  PCO2_Cal_Plan();
 
-  /** Span Mode*/
-  BSP_Hit_WD();
+  /** Run the configured sequence */
   SPAN_SKIPPED = true;
-  if (PCO2_OK != PCO2_State_Span(pco2.span))
+  for (i = 0; (i < PCO2_SEQ_LEN) && (PCO2_STEP_END != pco2.seq[i]); i++)
   {
-    Error(ERROR_MSG_00010040, LOG_Priority_High);
-    PCO2_State_Rest();
-    return;
-  }
+    BSP_Hit_WD();
+    if (PCO2_STEP_PURGE == pco2.seq[i])
+    {
+      purge = false;
+    }
 
-  /** Equilibrate Mode*/
-  BSP_Hit_WD();
-  if (PCO2_OK != PCO2_State_Equilibrate())
-  {
-    Error(ERROR_MSG_00010100, LOG_Priority_High);
-    PCO2_State_Rest();
-    return;
-  }
+    if (false == PCO2_Cal_Step((ePCO2Step_t)pco2.seq[i]))
+    {
+      continue;
+    }
 
-  /** Air Mode */
-  BSP_Hit_WD();
-  if (PCO2_OK != PCO2_State_Air())
-  {
-    Error(ERROR_MSG_00010200, LOG_Priority_High);
-    PCO2_State_Rest();
-    return;
+    if (PCO2_OK != PCO2_Run_Step((ePCO2Step_t)pco2.seq[i]))
+    {
+      PCO2_State_Rest();
+      return;
+    }
   }
 
-  /** Purge Mode */
-  if(purge == true)
+  /** Purge Mode (if requested and not already in the sequence) */
+  if (purge == true)
   {
     BSP_Hit_WD();
-    if (PCO2_OK != PCO2_State_Purge())
+    if (PCO2_OK != PCO2_Run_Step(PCO2_STEP_PURGE))
     {
-      Error(ERROR_MSG_00010A00, LOG_Priority_High);
       PCO2_State_Rest();
       return;
     }
@@ -440,12 +491,15 @@ void PCO2_Run(bool purge)
   BSP_Hit_WD();
   if (PCO2_OK != PCO2_State_Rest())
   {
-    Error(ERROR_MSG_00010400, LOG_Priority_High);
+    Error(ERROR_MSG_00010400, 0);
     PCO2_State_Rest();
     return;
   }
   Log("", LOG_Priority_High);
 
+  /** Coefficient and dry CO2 math at full speed */
+  BSP_Clock_SetProfile(BSP_CLK_FULL);
+
   /** Display the Coefficients */
   PCO2_GetCoef();
 
@@ -454,14 +508,23 @@ void PCO2_Run(bool purge)
   i_data.COEFF.co2kspan = LI8x0_Get_KSpan_float();
   i_data.COEFF.co2kspan2 = LI8x0_Get_KSpan2_float();
 
+  /** Update the calibration ages */
+  PCO2_Cal_Update();
+
   /** Calculate the Dry CO2 */
+  /** A span left out by the cal policy reuses the last span data */
   BSP_Hit_WD();
-  if (SPAN_SKIPPED == false)
+  if ((SPAN_SKIPPED == false) ||
+      ((1 == pco2.calpol.enable) && (false == i_data.CAL.span) && (true == pco2_cal.valid)))
   {
     PCO2_Calculate_DryCO2(&pco2_dry, &i_data);
   }
 
+  /** Keep the run in the sdata history */
+  PCO2_Save_History(pco2_run_epoch);
+
   /** Indicate End of Run */
+  BSP_Clock_SetProfile(BSP_CLK_NORMAL);
   BSP_Hit_WD();
   Log("", LOG_Priority_High);
   Log("Run Complete\r\n", LOG_Priority_High);
@@ -473,7 +536,7 @@ ePCO2Status_t PCO2_Deploy(void)
   /** Deploy */
   if (PCO2_OK != PCO2_State_Deploy())
   {
-    Error(ERROR_MSG_00010800, LOG_Priority_High);
+    Error(ERROR_MSG_00010800, 0);
   }
   else
   {
@@ -629,6 +692,121 @@ float PCO2_GetSpan2(void)
   return pco2.span2;
 }
 
+uint8_t PCO2_GetConverge(void)
+{
+  return pco2.converge.enable;
+}
+
+uint32_t PCO2_GetConvergeMinSamples(void)
+{
+  return pco2.converge.minsamples;
+}
+
+float PCO2_GetConvergeCO2(void)
+{
+  return pco2.converge.co2;
+}
+
+float PCO2_GetConvergePressure(void)
+{
+  return pco2.converge.pressure;
+}
+
+uint8_t PCO2_GetEqSlope(void)
+{
+  return pco2.eqslope.enable;
+}
+
+uint32_t PCO2_GetEqMinimum(void)
+{
+  return pco2.eqslope.minimum;
+}
+
+uint32_t PCO2_GetEqDwell(void)
+{
+  return pco2.eqslope.dwell;
+}
+
+float PCO2_GetEqRate(void)
+{
+  return pco2.eqslope.rate;
+}
+
+uint8_t PCO2_GetLiWarm(void)
+{
+  return pco2.liwarm.enable;
+}
+
+float PCO2_GetLiWarmTemp(void)
+{
+  return pco2.liwarm.temp_tol;
+}
+
+float PCO2_GetLiWarmPres(void)
+{
+  return pco2.liwarm.pres_tol;
+}
+
+uint8_t PCO2_GetOverlap(void)
+{
+  return pco2.overlap;
+}
+
+uint8_t PCO2_GetStream(void)
+{
+  return pco2.stream;
+}
+
+uint8_t PCO2_GetCalPolicy(void)
+{
+  return pco2.calpol.enable;
+}
+
+uint16_t PCO2_GetCalZeroRuns(void)
+{
+  return pco2.calpol.zero_runs;
+}
+
+uint16_t PCO2_GetCalSpanRuns(void)
+{
+  return pco2.calpol.span_runs;
+}
+
+uint16_t PCO2_GetCalSpanHours(void)
+{
+  return pco2.calpol.span_hours;
+}
+
+float PCO2_GetCalSpanErr(void)
+{
+  return pco2.calpol.span_err;
+}
+
+float PCO2_GetCalTemp(void)
+{
+  return pco2.calpol.temp_change;
+}
+
+void PCO2_GetSequence(char *seq)
+{
+  uint8_t i;
+  uint8_t j;
+  uint8_t len = 0;
+
+  for (i = 0; (i < PCO2_SEQ_LEN) && (PCO2_STEP_END != pco2.seq[i]); i++)
+  {
+    for (j = 0; j < PCO2_STEPS_LEN; j++)
+    {
+      if (PCO2_Steps[j].step == pco2.seq[i])
+      {
+        seq[len++] = PCO2_Steps[j].id;
+        break;
+      }
+    }
+  }
+  seq[len] = 0;
+}
+
 void PCO2_GetCoef(void)
 {
   /** Get the Licor Calibration Coefficients */
@@ -808,148 +986,365 @@ void PCO2_SetHeater(uint8_t state)
   BSP_Hit_WD();
   if (2 > state)
   {
-    /** Set Heater*/
-    LI8x0_Heater(state);
-
     /** Set the state in the struct */
     pco2.LI_heater = state;
+
+    /** Set Heater*/
+    PCO2_ApplyHeater(0.0f);
   }
 }
 
-void PCO2_CalO2(void)
+void PCO2_ApplyHeater(float prev)
 {
+  (void)prev;
   BSP_Hit_WD();
-  Log("O2 Calibration Start\r\n", LOG_Priority_High);
-  /** Set Valves to Air */
-  FLOW_SetMode(FLOW_STATE_AIR_PUMP_ON);
-#ifndef TEST_QUICK_PERIODS
-  _delay_ms(60000);
-#else
-  _delay_ms(1000);
-#endif
-
-  FLOW_SetMode(FLOW_STATE_AIR_PUMP_OFF);
-  PCO2_Set_O2Cal();
+  LI8x0_Heater(pco2.LI_heater);
+}
 
-  /** Set Valves to Rest */
-  FLOW_SetMode(FLOW_STATE_REST);
+void PCO2_SetConverge(uint8_t state)
+{
+  if (2 > state)
+  {
+    pco2.converge.enable = state;
+  }
+}
 
-  Log("O2 Calibration Complete\r\n", LOG_Priority_High);
+void PCO2_SetConvergeMinSamples(uint32_t samples)
+{
+  if ((2 <= samples) && (1000 > samples))
+  {
+    pco2.converge.minsamples = samples;
+  }
 }
-/************************************************************************
- *					           Static Functions
- ************************************************************************/
-/** @brief PCO2 Set Timeout
- *
- * Sets a timeout timer
- *
- * @param *t Pointer to Timer Struct
- * @param seconds Seconds to timeout for
- *
- * @return result
- */
-STATIC void PCO2_SetTimeout(volatile sSysTimer_t *t, uint16_t seconds)
+
+void PCO2_SetConvergeCO2(float ppm)
 {
-  t->tCounter = seconds;
-  t->tFlag = true;
+  if (0.0 < ppm)
+  {
+    pco2.converge.co2 = ppm;
+  }
 }
 
-/** @brief PCO2 Set Sample Timeout
- *
- * Sets a timeout timer
- *
- * @param *t Pointer to Timer Struct
- * @param seconds Seconds to timeout for
- *
- * @return result
- */
-STATIC void PCO2_SetSampleTimeout(volatile sSysTimer_t *t, uint16_t ms)
+void PCO2_SetConvergePressure(float kpa)
 {
-  uint16_t cnt = 0;
-  if (ms > 0)
+  if (0.0 <= kpa)
   {
-    cnt = 1000 / ms;
-    BSP_Hit_WD();
-    t->tCounter = AMBIQ_RTC_SYSTICK_FREQ / cnt;
-    t->tFlag = true;
+    pco2.converge.pressure = kpa;
   }
-  else
+}
+
+void PCO2_SetEqSlope(uint8_t state)
+{
+  if (2 > state)
   {
-    t->tFlag = false;
+    pco2.eqslope.enable = state;
   }
-  BSP_Hit_WD();
 }
 
-/** @brief PCO2 Wait for Timeout
- *
- * Wait for timeout to complete
- *
- * @param *t Pointer to Timer Struct
- *
- * @return result
- */
-STATIC void PCO2_WaitOnTimeout(volatile sSysTimer_t *t)
+void PCO2_SetEqMinimum(uint32_t seconds)
 {
-  while (t->tFlag == true)
+  if (1000 > seconds)
   {
-    _delay_ms(500);
-    BSP_Hit_WD();
+    pco2.eqslope.minimum = seconds;
   }
-  COMMAND_puts("\r");
-  // Message("\r");
-  // _delay_ms(20);
-  // Message("\r");
 }
 
-/** @brief PCO2 Get Timeout
- *
- * Get a timeout timer
- *
- * @param *t Pointer to Timer Struct
- *
- * @return status of timeout
- */
-STATIC bool PCO2_GetTimeout(volatile sSysTimer_t *t)
+void PCO2_SetEqDwell(uint32_t seconds)
 {
-  bool val = t->tFlag;
-  val ^= 1;
-  return val;
+  if ((PCO2_EQSLOPE_INTERVAL <= seconds) && (1000 > seconds))
+  {
+    pco2.eqslope.dwell = seconds;
+  }
 }
 
-/** @brief PCO2 Configuration State
- *
- * Configures the PCO2
- *
- * @param None
- *
- * @return result
- */
-ePCO2Status_t PCO2_State_Config(void)
+void PCO2_SetEqRate(float ppm_min)
 {
-  BSP_Hit_WD();
-  ePCO2Status_t result = PCO2_FAIL;
-  Log("", LOG_Priority_High);
-  Log("Start PCO2 Config", LOG_Priority_Low);
+  if (0.0 < ppm_min)
+  {
+    pco2.eqslope.rate = ppm_min;
+  }
+}
 
-  /** Out of Low Current Mode */
-  BSP_Low_Current_Mode_OFF();
+void PCO2_SetLiWarm(uint8_t state)
+{
+  if (2 > state)
+  {
+    pco2.liwarm.enable = state;
+  }
+}
 
-  PCO2_Initialize();
+void PCO2_SetLiWarmTemp(float degc)
+{
+  if (0.0 < degc)
+  {
+    pco2.liwarm.temp_tol = degc;
+  }
+}
+
+void PCO2_SetLiWarmPres(float kpa)
+{
+  if (0.0 < kpa)
+  {
+    pco2.liwarm.pres_tol = kpa;
+  }
+}
+
+void PCO2_SetOverlap(uint8_t state)
+{
+  if (2 > state)
+  {
+    pco2.overlap = state;
+  }
+}
+
+void PCO2_SetStream(uint8_t state)
+{
+  if (2 > state)
+  {
+    pco2.stream = state;
+  }
+}
+
+void PCO2_SetCalPolicy(uint8_t state)
+{
+  uint8_t prev = pco2.calpol.enable;
+
+  if (2 > state)
+  {
+    pco2.calpol.enable = state;
+    PCO2_ApplyCalPolicy((float)prev);
+  }
+}
+
+void PCO2_ApplyCalPolicy(float prev)
+{
+  /** Start from a fresh zero and span */
+  if ((1 == pco2.calpol.enable) && (1.0f != prev))
+  {
+    pco2_cal.force = true;
+  }
+}
+
+void PCO2_SetCalZeroRuns(uint16_t runs)
+{
+  if ((0u < runs) && (1000u > runs))
+  {
+    pco2.calpol.zero_runs = runs;
+  }
+}
+
+void PCO2_SetCalSpanRuns(uint16_t runs)
+{
+  if ((0u < runs) && (1000u > runs))
+  {
+    pco2.calpol.span_runs = runs;
+  }
+}
+
+void PCO2_SetCalSpanHours(uint16_t hours)
+{
+  if (PCO2_CALPOL_MAX_HOURS >= hours)
+  {
+    pco2.calpol.span_hours = hours;
+  }
+}
+
+void PCO2_SetCalSpanErr(float ppm)
+{
+  if (0.0 <= ppm)
+  {
+    pco2.calpol.span_err = ppm;
+  }
+}
+
+void PCO2_SetCalTemp(float degc)
+{
+  if (0.0 <= degc)
+  {
+    pco2.calpol.temp_change = degc;
+  }
+}
+
+ePCO2Status_t PCO2_SetSequence(const char *seq)
+{
+  uint8_t temp[PCO2_SEQ_LEN];
+  uint8_t i;
+  uint8_t j;
+  char c;
+
+  memset(temp, PCO2_STEP_END, PCO2_SEQ_LEN);
+  for (i = 0; (0 != seq[i]) && ('\r' != seq[i]) && ('\n' != seq[i]) && (' ' != seq[i]); i++)
+  {
+    /** Leave room for the terminator */
+    if (i >= (PCO2_SEQ_LEN - 1))
+    {
+      return PCO2_FAIL;
+    }
+
+    c = toupper(seq[i]);
+    for (j = 0; j < PCO2_STEPS_LEN; j++)
+    {
+      if (PCO2_Steps[j].id == c)
+      {
+        temp[i] = PCO2_Steps[j].step;
+        break;
+      }
+    }
+
+    if (j == PCO2_STEPS_LEN)
+    {
+      return PCO2_FAIL;
+    }
+  }
+
+  if (0 == i)
+  {
+    return PCO2_FAIL;
+  }
+
+  memcpy(pco2.seq, temp, PCO2_SEQ_LEN);
+  return PCO2_OK;
+}
+
+void PCO2_CalO2(void)
+{
+  BSP_Hit_WD();
+  Log("O2 Calibration Start\r\n", LOG_Priority_High);
+  /** Set Valves to Air */
+  FLOW_SetMode(FLOW_STATE_AIR_PUMP_ON);
+#ifndef TEST_QUICK_PERIODS
+  _delay_ms(60000);
+#else
+  _delay_ms(1000);
+#endif
+
+  FLOW_SetMode(FLOW_STATE_AIR_PUMP_OFF);
+  PCO2_Set_O2Cal();
+
+  /** Set Valves to Rest */
+  FLOW_SetMode(FLOW_STATE_REST);
+
+  Log("O2 Calibration Complete\r\n", LOG_Priority_High);
+}
+/************************************************************************
+ *					           Static Functions
+ ************************************************************************/
+/** @brief PCO2 Set Timeout
+ *
+ * Sets a timeout timer
+ *
+ * @param *t Pointer to Timer Struct
+ * @param seconds Seconds to timeout for
+ *
+ * @return result
+ */
+STATIC void PCO2_SetTimeout(volatile sSysTimer_t *t, uint16_t seconds)
+{
+  t->tCounter = seconds;
+  t->tFlag = true;
+}
+
+/** @brief PCO2 Set Sample Timeout
+ *
+ * Sets a timeout timer
+ *
+ * @param *t Pointer to Timer Struct
+ * @param seconds Seconds to timeout for
+ *
+ * @return result
+ */
+STATIC void PCO2_SetSampleTimeout(volatile sSysTimer_t *t, uint16_t ms)
+{
+  uint16_t cnt = 0;
+  if (ms > 0)
+  {
+    cnt = 1000 / ms;
+    BSP_Hit_WD();
+    t->tCounter = AMBIQ_RTC_SYSTICK_FREQ / cnt;
+    t->tFlag = true;
+  }
+  else
+  {
+    t->tFlag = false;
+  }
+  BSP_Hit_WD();
+}
+
+/** @brief PCO2 Wait for Timeout
+ *
+ * Sleep in LPM3 until the RTC timer ISR ends the timeout
+ *
+ * @param *t Pointer to Timer Struct
+ *
+ * @return result
+ */
+STATIC void PCO2_WaitOnTimeout(volatile sSysTimer_t *t)
+{
+  BSP_Sleep_While(&t->tFlag);
+  COMMAND_puts("\r");
+  // Message("\r");
+  // _delay_ms(20);
+  // Message("\r");
+}
+
+/** @brief PCO2 Get Timeout
+ *
+ * Get a timeout timer
+ *
+ * @param *t Pointer to Timer Struct
+ *
+ * @return status of timeout
+ */
+STATIC bool PCO2_GetTimeout(volatile sSysTimer_t *t)
+{
+  bool val = t->tFlag;
+  val ^= 1;
+  return val;
+}
+
+/** @brief PCO2 Configuration State
+ *
+ * Configures the PCO2
+ *
+ * @param None
+ *
+ * @return result
+ */
+ePCO2Status_t PCO2_State_Config(void)
+{
+  BSP_Hit_WD();
+  ePCO2Status_t result = PCO2_FAIL;
+  Log("", LOG_Priority_High);
+  Log("Start PCO2 Config", LOG_Priority_Low);
+
+  /** Out of Low Current Mode */
+  BSP_Low_Current_Mode_OFF();
+
+  PCO2_Initialize();
 
   /** Start the Licor */
+  LICOR_WARMING = false;
   PCO2_Licor_Warmup();
   LI8x0_Config();
-  LI8x0_GetInfo();
 
-  /** Start a timer for 10 seconds */
-  PCO2_SetTimeout(pco2.timeout1, pco2.LI_warmup);
-  PCO2_WaitOnTimeout(pco2.timeout1);
+  /** Let the warmup run under the zero pump, join before the first sample */
+  if (1 == pco2.overlap)
+  {
+    PCO2_SetTimeout(pco2.warmTimer, pco2.LI_warmup);
+    LICOR_WARMING = true;
+    Log("LI Warmup overlapped with Zero", LOG_Priority_Low);
+    Log("End PCO2 Config", LOG_Priority_Low);
+    return PCO2_OK;
+  }
+
+  /** Wait for the Licor to warm up */
+  i_data.WARMUP.config = PCO2_Licor_WaitWarm();
 
   /** Configure the Licor */
   Log("Configure Licor", LOG_Priority_High);
   if (LICOR_OK != LI8x0_Config())
   {
-    Error(ERROR_MSG_00010010, LOG_Priority_High);
+    Error(ERROR_MSG_00010010, 0);
   }
   else
   {
@@ -1110,7 +1505,7 @@ void PCO2_Get_sdata(void)
   char sw[16];
   memset(air, 0, 16);
   memset(sw, 0, 16);
-  if (run_data.DRY.air_xco2 == NAN)
+  if (isnan(run_data.DRY.air_xco2))
   {
     strcpy(air, "NAN");
   }
@@ -1119,7 +1514,7 @@ void PCO2_Get_sdata(void)
     sprintf(air, "%7.3f", run_data.DRY.air_xco2);
   }
 
-  if (run_data.DRY.sw_xco2 == NAN)
+  if (isnan(run_data.DRY.sw_xco2))
   {
     strcpy(sw, "NAN");
   }
@@ -1378,10 +1773,69 @@ void PCO2_Get_idata(void)
   sprintf(temp, "DRY,,,,,,,,,,,,,,,,,,%0.6f,%0.6f,,,,\n", i_data.air_xco2, i_data.sw_xco2);
   Message(temp);
 
+  /** CONV - Samples and CO2 SEM per state, same order as above */
+  if (1 == pco2.converge.enable)
+  {
+    const sPCO2_idata_mode_t *conv[] = {&i_data.ZPON, &i_data.ZPOFF, &i_data.ZPPCAL,
+                                        &i_data.SPON, &i_data.SPOFF, &i_data.SPPCAL,
+                                        &i_data.EPON, &i_data.EPOFF,
+                                        &i_data.APON, &i_data.APOFF};
+    uint8_t i;
+    uint16_t len;
+
+    strcpy(temp, "CONV");
+    for (i = 0; i < (sizeof(conv) / sizeof(conv[0])); i++)
+    {
+      len = strlen(temp);
+      sprintf(&temp[len], ", %u, %0.4f",
+              (uint16_t)conv[i]->co2.numSamples,
+              conv[i]->co2_sem);
+    }
+    strcat(temp, "\n");
+    Message(temp);
+  }
+
+  /** WARMUP - Actual Licor warmup at config and equilibration */
+  if ((1 == pco2.liwarm.enable) || (1 == pco2.overlap))
+  {
+    sprintf(temp, "WARMUP, %u, %u\n",
+            i_data.WARMUP.config,
+            i_data.WARMUP.equil);
+    Message(temp);
+  }
+
+  /** CAL - Zero run, span run, zero age, span age (runs) */
+  if (1 == pco2.calpol.enable)
+  {
+    sprintf(temp, "CAL, %u, %u, %u, %u\n",
+            i_data.CAL.zero,
+            i_data.CAL.span,
+            i_data.CAL.zero_age,
+            i_data.CAL.span_age);
+    Message(temp);
+  }
+
+  /** EQUIL - Slope end point: pump time, slope, intercept, points, found */
+  if (1 == pco2.eqslope.enable)
+  {
+    sprintf(temp, "EQUIL, %u, %0.4f, %0.3f, %u, %u\n",
+            i_data.EQUIL.endtime,
+            i_data.EQUIL.slope,
+            i_data.EQUIL.intercept,
+            i_data.EQUIL.points,
+            i_data.EQUIL.detected);
+    Message(temp);
+  }
+
   sprintf(temp, "ERR,,,,,,,,,,,,,,,,,,,,,,,%s\n\n", run_data.ERRORS);
   Message(temp);
 }
 
+uint16_t PCO2_Pack_idata(uint8_t *buf, uint16_t len)
+{
+  return SBD_Pack(&i_data, ErrorLog.run, pco2_run_epoch, buf, len);
+}
+
 void PCO2_Set_mconfig(bool val)
 {
   pco2.man.mconfig = val;
@@ -1538,7 +1992,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG1, Pump ON, wait 40 seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG1))
   {
-    Error(ERROR_MSG_00010A01, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A01, 0);
     fail_count++;
   }
   ms_time = (uint32_t) 40*1000;
@@ -1547,7 +2001,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG2, Pump ON, wait PURGE seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG2))
   {
-    Error(ERROR_MSG_00010A02, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A02, 0);
     fail_count++;
   }
   ms_time = (uint32_t) pco2.purge.purge * 1000;
@@ -1556,7 +2010,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG3, Pump ON, wait 20 seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG3))
   {
-    Error(ERROR_MSG_00010A03, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A03, 0);
     fail_count++;
   }
   ms_time = (uint32_t) 20 * 1000;
@@ -1565,7 +2019,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG4, Pump ON, wait PURGE seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG4))
   {
-    Error(ERROR_MSG_00010A04, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A04, 0);
     fail_count++;
   }
   ms_time = (uint32_t) pco2.vent * 1000;
@@ -1574,7 +2028,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG5, Pump ON, wait 40 seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG5))
   {
-    Error(ERROR_MSG_00010A05, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A05, 0);
     fail_count++;
   }
   ms_time = (uint32_t) pco2.vent * 1000;
@@ -1583,7 +2037,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG6, Pump ON, wait PURGE seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG6))
   {
-    Error(ERROR_MSG_00010A06, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A06, 0);
     fail_count++;
   }
   ms_time = (uint32_t) 60 * 1000;
@@ -1592,7 +2046,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG7, Pump ON, wait 20 seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG7))
   {
-    Error(ERROR_MSG_00010A07, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A07, 0);
     fail_count++;
   }
   ms_time = (uint32_t) pco2.purge.purge * 1000;
@@ -1601,7 +2055,7 @@ ePCO2Status_t PCO2_State_Purge(void)
   /** Set the flow controller to PRG8, Pump ON, wait PURGE seconds */
   if (PCO2_OK != PCO2_SetMode(MODE_PRG8))
   {
-    Error(ERROR_MSG_00010A08, LOG_Priority_Med);
+    Error(ERROR_MSG_00010A08, 0);
     fail_count++;
   }
   ms_time = (uint32_t) pco2.vent * 1000;
@@ -1610,7 +2064,7 @@ ePCO2Status_t PCO2_State_Purge(void)
 //  /** Set the flow controller to PURGE, Pump OFF */
 //  if (PCO2_OK != PCO2_SetMode(MODE_PURGE))
 //  {
-//    Error(ERROR_MSG_00010A00, LOG_Priority_Med);
+//    Error(ERROR_MSG_00010A00, 0);
 //  }
 //
 //  /** Wait PURGE seconds */
@@ -1620,7 +2074,7 @@ ePCO2Status_t PCO2_State_Purge(void)
 //  /** Set the flow controller to CLEAR */
 //  if (PCO2_OK != PCO2_SetMode(MODE_CLEAR))
 //  {
-//    Error(ERROR_MSG_00010A00, LOG_Priority_Med);
+//    Error(ERROR_MSG_00010A00, 0);
 //  }
 //  else
 //  {
@@ -1657,7 +2111,7 @@ STATIC ePCO2Status_t PCO2_State_Rest(void)
   /** Set the flow controller to REST, Pump OFF */
   if (PCO2_OK != PCO2_SetMode(MODE_REST))
   {
-    Error(ERROR_MSG_00010800, LOG_Priority_Med);
+    Error(ERROR_MSG_00010800, 0);
   }
   else
   {
@@ -1692,7 +2146,7 @@ STATIC ePCO2Status_t PCO2_State_Deploy(void)
   /** Set the flow controller to Deploy, Pump OFF */
   if (PCO2_OK != PCO2_SetMode(MODE_DEPLOY))
   {
-    Error(ERROR_MSG_00012000, LOG_Priority_Med);
+    Error(ERROR_MSG_00012000, 0);
   }
   else
   {
@@ -1744,7 +2198,7 @@ ePCO2Status_t PCO2_State_Zero(void)
   /** Perform Pumpon state */
   if (PCO2_OK != PCO2_State_PumpOn(MODE_ZERO_PUMP_ON))
   {
-    Error(ERROR_MSG_00020002, LOG_Priority_High);
+    Error(ERROR_MSG_00020002, 0);
     return result;
   }
 
@@ -1753,14 +2207,14 @@ ePCO2Status_t PCO2_State_Zero(void)
                                    &run_data.ZPON,
                                    &i_data.ZPON))
   {
-    Error(ERROR_MSG_00020004, LOG_Priority_High);
+    Error(ERROR_MSG_00020004, 0);
     return result;
   }
 
   /** Perform Zero Pumpoff */
   if (PCO2_OK != PCO2_State_PumpOff(MODE_ZERO_PUMP_OFF))
   {
-    Error(ERROR_MSG_00101000, LOG_Priority_High);
+    Error(ERROR_MSG_00101000, 0);
     return result;
   }
 
@@ -1769,7 +2223,7 @@ ePCO2Status_t PCO2_State_Zero(void)
                                    &run_data.ZPOFF,
                                    &i_data.ZPOFF))
   {
-    Error(ERROR_MSG_00020020, LOG_Priority_High);
+    Error(ERROR_MSG_00020020, 0);
     return result;
   }
 
@@ -1779,14 +2233,14 @@ ePCO2Status_t PCO2_State_Zero(void)
   {
     if (PCO2_OK != PCO2_State_Calibrate(PCO2_CAL_ZERO, 0.0))
     {
-      Error(ERROR_MSG_00020040, LOG_Priority_High);
+      Error(ERROR_MSG_00020040, 0);
       return result;
     }
   }
 
   if (PCO2_OK != PCO2_SetMode(MODE_ZERO_POST_CAL))
   {
-    Error(ERROR_MSG_00020080, LOG_Priority_High);
+    Error(ERROR_MSG_00020080, 0);
     return result;
   }
 
@@ -1795,7 +2249,7 @@ ePCO2Status_t PCO2_State_Zero(void)
                                    &run_data.ZPPCAL,
                                    &i_data.ZPPCAL))
   {
-    Error(ERROR_MSG_00020100, LOG_Priority_High);
+    Error(ERROR_MSG_00020100, 0);
     return result;
   }
 
@@ -1827,7 +2281,7 @@ ePCO2Status_t PCO2_State_Span(float span)
   /** Perform Pumpon state */
   if (PCO2_OK != PCO2_State_PumpOn(MODE_SPAN_GAS_ON))
   {
-    Error(ERROR_MSG_00100200, LOG_Priority_High);
+    Error(ERROR_MSG_00100200, 0);
     return result;
   }
 
@@ -1836,14 +2290,14 @@ ePCO2Status_t PCO2_State_Span(float span)
                                    &run_data.SPON,
                                    &i_data.SPON))
   {
-    Error(ERROR_MSG_00040004, LOG_Priority_High);
+    Error(ERROR_MSG_00040004, 0);
     return result;
   }
 
   /** Perform Pumpoff */
   if (PCO2_OK != PCO2_State_PumpOff(MODE_SPAN_GAS_OFF))
   {
-    Error(ERROR_MSG_00101000, LOG_Priority_High);
+    Error(ERROR_MSG_00101000, 0);
     return result;
   }
 
@@ -1852,7 +2306,7 @@ ePCO2Status_t PCO2_State_Span(float span)
                                    &run_data.SPOFF,
                                    &i_data.SPOFF))
   {
-    Error(ERROR_MSG_00040020, LOG_Priority_High);
+    Error(ERROR_MSG_00040020, 0);
     return result;
   }
 
@@ -1868,195 +2322,843 @@ ePCO2Status_t PCO2_State_Span(float span)
       Log("Start Span Cal", LOG_Priority_Low);
       if (PCO2_OK != PCO2_State_Calibrate(PCO2_CAL_SPAN, span))
       {
-        Error(ERROR_MSG_00040080, LOG_Priority_High);
+        Error(ERROR_MSG_00040080, 0);
         return result;
       }
       SPAN_SKIPPED = false;
     }
     else
     {
-      Log("Span Cal Skipped", LOG_Priority_High);
-      Error(ERROR_MSG_00040400, LOG_Priority_High);
-      SPAN_SKIPPED = true;
+      Log("Span Cal Skipped", LOG_Priority_High);
+      Error(ERROR_MSG_00040400, 0);
+      SPAN_SKIPPED = true;
+    }
+  }
+
+  /** Set Mode PostCal */
+  if (PCO2_OK != PCO2_SetMode(MODE_SPAN_POST_CAL))
+  {
+    Error(ERROR_MSG_00040100, 0);
+    return result;
+  }
+
+  /** Sample the CO2 */
+  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_SPAN_POST_CAL,
+                                   &run_data.SPPCAL,
+                                   &i_data.SPPCAL))
+  {
+    Error(ERROR_MSG_00040200, 0);
+    return result;
+  }
+
+  /** Return */
+  Log("End Span", LOG_Priority_Low);
+  result = PCO2_OK;
+  return result;
+}
+
+/** @brief PCO2 Equilibrate State
+ *
+ * State which equilibrates the sea water in air to read pCO2 in the water.
+ *
+ * @param None
+ *
+ * @return result
+ */
+STATIC ePCO2Status_t PCO2_State_Equilibrate(void)
+{
+  BSP_Hit_WD();
+  ePCO2Status_t result = PCO2_FAIL;
+  sEqTime_t eqt;
+  uint16_t hold = 0;
+
+  Log("", LOG_Priority_High);
+  Log("Start Equilibration", LOG_Priority_Low);
+  /** Clear the char arrays */
+  memset(pco2_str, 0, PCO2_STR_LEN);
+
+  /** Turn the Licor OFF */
+  Log("Licor OFF", LOG_Priority_Low);
+  LI8x0_PowerOFF();
+
+  /** Perform Pumpon state */
+  BSP_Hit_WD();
+  if (PCO2_OK != PCO2_State_PumpOn(MODE_EQUILIBRATE_PUMP_ON))
+  {
+    Error(ERROR_MSG_00100200, 0);
+    return result;
+  }
+
+  /** Turn the Licor ON */
+  PCO2_Licor_Warmup();
+
+  /** Remove Power Supply from Low Power Mode */
+  BSP_Low_Current_Mode_OFF();
+
+  /** Wait for Licor Warmup */
+  i_data.WARMUP.equil = PCO2_Licor_WaitWarm();
+  Log("LI Warmup complete", LOG_Priority_Low);
+
+  /** Keep pumping for the time an early warmup cut short */
+  PCO2_EqTime(&eqt);
+  hold = EQTIME_Hold(&eqt, pco2.equil.prequil, i_data.WARMUP.equil);
+  if (hold > 0)
+  {
+    memset(pco2_str, 0, PCO2_STR_LEN);
+    sprintf(pco2_str, "Equil Hold %u seconds", hold);
+    Log(pco2_str, LOG_Priority_Low);
+    PCO2_SetTimeout(pco2.timeout1, hold);
+    PCO2_WaitOnTimeout(pco2.timeout1);
+  }
+
+  /** Run the rest of the equilibration until the CO2 slope flattens */
+  if (1 == pco2.eqslope.enable)
+  {
+    PCO2_Equil_Monitor(i_data.WARMUP.equil + hold);
+  }
+  Log("Equilibration Pump Complete", LOG_Priority_Low);
+
+  /** Sample the CO2 */
+  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_EQUILIBRATE_PUMP_ON,
+                                   &run_data.EPON,
+                                   &i_data.EPON))
+  {
+    Error(ERROR_MSG_00100004, 0);
+    return result;
+  }
+
+  Log("Equilibrate Pump Off", LOG_Priority_High);
+
+  /** Perform Pumpoff */
+  if (PCO2_OK != PCO2_State_PumpOff(MODE_EQUILIBRATE_PUMP_OFF))
+  {
+    Error(ERROR_MSG_00101000, 0);
+    return result;
+  }
+
+  /** Sample the CO2 */
+  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_EQUILIBRATE_PUMP_OFF,
+                                   &run_data.EPOFF,
+                                   &i_data.EPOFF))
+  {
+    Error(ERROR_MSG_00100040, 0);
+    return result;
+  }
+
+  /** Return */
+  Log("End Equilibration", LOG_Priority_Low);
+  result = PCO2_OK;
+  return result;
+}
+
+/** @brief PCO2 Air State
+ *
+ * State which measures CO2 in the air.
+ *
+ * @param None
+ *
+ * @return result
+ */
+STATIC ePCO2Status_t PCO2_State_Air(void)
+{
+  BSP_Hit_WD();
+  ePCO2Status_t result = PCO2_FAIL;
+  Log("", LOG_Priority_High);
+
+  /** Clear the char arrays */
+  memset(pco2_str, 0, PCO2_STR_LEN);
+
+  /** Low Current Mode OFF */
+  BSP_Low_Current_Mode_OFF();
+
+  /** Perform Pumpon state */
+  if (PCO2_OK != PCO2_State_PumpOn(MODE_AIR_PUMP_ON))
+  {
+    Error(ERROR_MSG_00100200, 0);
+    return result;
+  }
+
+  /** Sample the CO2 */
+  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_AIR_PUMP_ON,
+                                   &run_data.APON,
+                                   &i_data.APON))
+  {
+    Error(ERROR_MSG_00100400, 0);
+    return result;
+  }
+
+  /** Perform Pumpoff */
+  if (PCO2_OK != PCO2_State_PumpOff(MODE_AIR_PUMP_OFF))
+  {
+    Error(ERROR_MSG_00101000, 0);
+    return result;
+  }
+
+  /** Sample the CO2 */
+  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_AIR_PUMP_OFF,
+                                   &run_data.APOFF,
+                                   &i_data.APOFF))
+  {
+    Error(ERROR_MSG_00104000, 0);
+    return result;
+  }
+
+  /** Calibrate O2 at conclusion of Air */
+  PCO2_Set_O2Cal();
+
+  /** Return */
+  result = PCO2_OK;
+  return result;
+}
+
+/** @brief PCO2 Equilibration Monitor
+ *
+ * Read CO2 every PCO2_EQSLOPE_INTERVAL seconds and fit a line to the
+ * last PCO2_EQSLOPE_POINTS readings.  Returns once the slope has stayed
+ * under the rate limit for the dwell time, or the equil time is used up.
+ * The end time and last fit are stored in i_data.EQUIL.
+ *
+ * @param warmup Length of the Licor warmup just completed (seconds)
+ *
+ * @return None
+ */
+STATIC void PCO2_Equil_Monitor(uint16_t warmup)
+{
+  float eq_t[PCO2_EQSLOPE_POINTS];
+  float eq_co2[PCO2_EQSLOPE_POINTS];
+  uint8_t idx = 0;
+  uint8_t cnt = 0;
+  uint16_t elapsed = pco2.equil.prequil + warmup;
+  uint16_t remaining = 0;
+  int32_t stable = -1;
+  float slope = NAN;
+  float intercept = NAN;
+  sLicorData_t li_data;
+  char sstr[64];
+
+  BSP_Hit_WD();
+  if (pco2.equil.equil > elapsed)
+  {
+    remaining = pco2.equil.equil - elapsed;
+  }
+
+  memset(sstr, NULL, 64);
+  sprintf(sstr, "Equil Slope Monitor up to %u seconds", remaining);
+  Log(sstr, LOG_Priority_High);
+
+  i_data.EQUIL.detected = false;
+  PCO2_SetTimeout(pco2.timeout1, remaining);
+  while (PCO2_GetTimeout(pco2.timeout1) == false)
+  {
+    BSP_Hit_WD();
+    PCO2_SetTimeout(pco2.timeout2, PCO2_EQSLOPE_INTERVAL);
+
+    LI8x0_Clear_Data(&li_data);
+    LI8x0_Sample_Query();
+    if (LICOR_OK == LI8x0_Sample_Read(&li_data))
+    {
+      /** Time in minutes so the slope is in ppm/min */
+      eq_t[idx] = (float)elapsed / 60.0f;
+      eq_co2[idx] = li_data.co2;
+      idx = (idx + 1) % PCO2_EQSLOPE_POINTS;
+      if (cnt < PCO2_EQSLOPE_POINTS)
+      {
+        cnt++;
+      }
+
+      if ((3 <= cnt) && (true == STATS_LinearFit(eq_t, eq_co2, cnt, &slope, &intercept)))
+      {
+        if (fabs(slope) < pco2.eqslope.rate)
+        {
+          if (stable < 0)
+          {
+            stable = elapsed;
+          }
+          else if ((elapsed - stable) >= pco2.eqslope.dwell)
+          {
+            i_data.EQUIL.detected = true;
+            break;
+          }
+        }
+        else
+        {
+          stable = -1;
+        }
+      }
+    }
+
+    PCO2_WaitOnTimeout(pco2.timeout2);
+    elapsed += PCO2_EQSLOPE_INTERVAL;
+  }
+
+  i_data.EQUIL.endtime = elapsed;
+  i_data.EQUIL.slope = slope;
+  i_data.EQUIL.intercept = intercept;
+  i_data.EQUIL.points = cnt;
+
+  memset(sstr, NULL, 64);
+  sprintf(sstr, "Equil End %u seconds, slope %.3f ppm/min", elapsed, slope);
+  Log(sstr, LOG_Priority_High);
+  if (false == i_data.EQUIL.detected)
+  {
+    Log("Equil slope end point not found", LOG_Priority_Med);
+  }
+}
+
+/** @brief PCO2 Licor Wait for Warmup
+ *
+ * Wait for the Licor to warm up.  With the adaptive warmup on, the cell
+ * temperature and pressure are read every PCO2_LIWARM_INTERVAL seconds and
+ * the wait ends once the last PCO2_LIWARM_POINTS readings of both are within
+ * their tolerance bands.  Never waits longer than the configured warmup.
+ *
+ * @param None
+ *
+ * @return Actual warmup time (seconds)
+ */
+STATIC uint16_t PCO2_Licor_WaitWarm(void)
+{
+  float temp[PCO2_LIWARM_POINTS];
+  float pres[PCO2_LIWARM_POINTS];
+  float tmin, tmax, pmin, pmax;
+  uint8_t idx = 0;
+  uint8_t cnt = 0;
+  uint8_t i;
+  uint16_t elapsed = 0;
+  sLicorData_t li_data;
+  char sstr[64];
+
+  BSP_Hit_WD();
+  PCO2_SetTimeout(pco2.timeout1, pco2.LI_warmup);
+
+  if (1 != pco2.liwarm.enable)
+  {
+    PCO2_WaitOnTimeout(pco2.timeout1);
+    return pco2.LI_warmup;
+  }
+
+  while (PCO2_GetTimeout(pco2.timeout1) == false)
+  {
+    BSP_Hit_WD();
+    PCO2_SetTimeout(pco2.timeout2, PCO2_LIWARM_INTERVAL);
+
+    LI8x0_Clear_Data(&li_data);
+    LI8x0_Sample_Query();
+    if (LICOR_OK == LI8x0_Sample_Read(&li_data))
+    {
+      temp[idx] = li_data.celltemp;
+      pres[idx] = li_data.cellpres;
+      idx = (idx + 1) % PCO2_LIWARM_POINTS;
+      if (cnt < PCO2_LIWARM_POINTS)
+      {
+        cnt++;
+      }
+    }
+    else
+    {
+      /** Licor not answering yet, restart the window */
+      cnt = 0;
+    }
+
+    if (PCO2_LIWARM_POINTS == cnt)
+    {
+      tmin = tmax = temp[0];
+      pmin = pmax = pres[0];
+      for (i = 1; i < PCO2_LIWARM_POINTS; i++)
+      {
+        tmin = (temp[i] < tmin) ? temp[i] : tmin;
+        tmax = (temp[i] > tmax) ? temp[i] : tmax;
+        pmin = (pres[i] < pmin) ? pres[i] : pmin;
+        pmax = (pres[i] > pmax) ? pres[i] : pmax;
+      }
+
+      if (((tmax - tmin) <= pco2.liwarm.temp_tol) &&
+          ((pmax - pmin) <= pco2.liwarm.pres_tol))
+      {
+        break;
+      }
+    }
+
+    PCO2_WaitOnTimeout(pco2.timeout2);
+    elapsed += PCO2_LIWARM_INTERVAL;
+  }
+
+  if (elapsed > pco2.LI_warmup)
+  {
+    elapsed = pco2.LI_warmup;
+  }
+
+  memset(sstr, NULL, 64);
+  sprintf(sstr, "LI Warmup %u of %u seconds", elapsed, pco2.LI_warmup);
+  Log(sstr, LOG_Priority_High);
+  return elapsed;
+}
+
+/** @brief PCO2 Licor Ready
+ *
+ * Join point for a Licor warmup started by PCO2_State_Config with
+ * overlap on.  Waits for what is left of the warmup, then configures
+ * the Licor.  Returns immediately if no warmup is pending.
+ *
+ * @param None
+ *
+ * @return result
+ */
+STATIC ePCO2Status_t PCO2_Licor_Ready(void)
+{
+  ePCO2Status_t result = PCO2_OK;
+  uint16_t remaining = 0;
+  char sstr[64];
+
+  if (false == LICOR_WARMING)
+  {
+    return result;
+  }
+
+  BSP_Hit_WD();
+  if (true == pco2.warmTimer->tFlag)
+  {
+    remaining = pco2.warmTimer->tCounter;
+  }
+  PCO2_WaitOnTimeout(pco2.warmTimer);
+  LICOR_WARMING = false;
+  i_data.WARMUP.config = remaining;
+
+  memset(sstr, NULL, 64);
+  sprintf(sstr, "LI Warmup joined, waited %u seconds", remaining);
+  Log(sstr, LOG_Priority_High);
+
+  /** Configure the Licor */
+  Log("Configure Licor", LOG_Priority_High);
+  if (LICOR_OK != LI8x0_Config())
+  {
+    Error(ERROR_MSG_00010010, 0);
+    result = PCO2_FAIL;
+  }
+
+  return result;
+}
+
+/** @brief PCO2 Span Step
+ *
+ * Run step wrapper for the span state at the configured span gas
+ *
+ * @param None
+ *
+ * @return result
+ */
+STATIC ePCO2Status_t PCO2_Step_Span(void)
+{
+  return PCO2_State_Span(pco2.span);
+}
+
+/** @brief PCO2 Run Step
+ *
+ * Look up a step in the run step table, run it and keep its dry data
+ *
+ * @param step Run step
+ *
+ * @return result
+ */
+STATIC ePCO2Status_t PCO2_Run_Step(ePCO2Step_t step)
+{
+  uint8_t i;
+
+  for (i = 0; i < PCO2_STEPS_LEN; i++)
+  {
+    if (PCO2_Steps[i].step == step)
+    {
+      if (PCO2_OK != PCO2_Steps[i].run())
+      {
+        Error(PCO2_Steps[i].error, 0);
+        return PCO2_FAIL;
+      }
+
+      /** Last sample window feeds the dry CO2 */
+      if (NULL != PCO2_Steps[i].dry)
+      {
+        PCO2_Dry_Store(PCO2_Steps[i].dry);
+      }
+      return PCO2_OK;
+    }
+  }
+
+  Error(ERROR_MSG_00014000, 0);
+  return PCO2_FAIL;
+}
+
+/** @brief PCO2 Step Seconds
+ *
+ * Worst case length of a run step, used for the run time estimate
+ *
+ * @param step Run step
+ *
+ * @return Step length (seconds)
+ */
+STATIC uint32_t PCO2_Step_Seconds(ePCO2Step_t step)
+{
+  uint32_t seconds = 0;
+  uint8_t i;
+
+  for (i = 0; i < PCO2_STEPS_LEN; i++)
+  {
+    if (PCO2_Steps[i].step == step)
+    {
+      seconds = (uint32_t)*PCO2_Steps[i].on * PCO2_Steps[i].ons;
+      seconds += (uint32_t)pco2.sampleCO2 * PCO2_Steps[i].samples;
+      seconds += (uint32_t)pco2.pump.pumpoff * PCO2_Steps[i].settles;
+      break;
+    }
+  }
+
+  return seconds;
+}
+
+/** @brief PCO2 Dry Store
+ *
+ * Keep the means of the last sample window for the dry CO2
+ *
+ * @param cell Dry cell data
+ *
+ * @return None
+ */
+STATIC void PCO2_Dry_Store(sPCO2DryCell_t *cell)
+{
+  cell->li_co2 = pco2_li_co2.mean;
+  cell->li_temperature = pco2_li_temp.mean;
+  cell->li_pressure = pco2_li_pres.mean;
+  cell->rh_rh = pco2_rh_rh.mean;
+  cell->rh_temperature = pco2_rh_temp.mean;
+}
+
+/** @brief PCO2 Dry Clear
+ *
+ * Mark dry cell data as not measured
+ *
+ * @param cell Dry cell data
+ *
+ * @return None
+ */
+STATIC void PCO2_Dry_Clear(sPCO2DryCell_t *cell)
+{
+  cell->li_co2 = NAN;
+  cell->li_temperature = NAN;
+  cell->li_pressure = NAN;
+  cell->rh_rh = NAN;
+  cell->rh_temperature = NAN;
+}
+
+/** @brief PCO2 Window Statistics (Float)
+ *
+ * Compute mean, std, min and max of a float channel from its run_data
+ * window in Q31 integers.  Falls back to float statistics over the same
+ * window when a sample does not fit.
+ *
+ * @param *s Running statistics of the channel
+ * @param *x Channel window in run_data
+ * @param n Samples in the window
+ *
+ * @return None
+ */
+STATIC void PCO2_Window_Float(sStats_F_t *s, const float *x, uint16_t n)
+{
+  uint16_t i;
+
+  STATS_Clear(s);
+  if (0u == n)
+  {
+    return;
+  }
+
+  if (0u == VSTATS_ToQ31(x, pco2_window, n, 0.0f, PCO2_VSTATS_LSB))
+  {
+    PCO2_Window_Q31(s, n, PCO2_VSTATS_LSB);
+    return;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    STATS_Add(s, x[i]);
+  }
+  STATS_Compute(s);
+}
+
+/** @brief PCO2 Window Statistics (Raw)
+ *
+ * Same as PCO2_Window_Float for the Licor raw counts, one count per LSB.
+ *
+ * @param *s Running statistics of the channel
+ * @param *x Channel window in run_data
+ * @param n Samples in the window
+ *
+ * @return None
+ */
+STATIC void PCO2_Window_Raw(sStats_F_t *s, const uint32_t *x, uint16_t n)
+{
+  uint16_t i;
+
+  STATS_Clear(s);
+  if (0u == n)
+  {
+    return;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    if (x[i] > (uint32_t)VSTATS_Q31_MAX)
+    {
+      break;
     }
+    pco2_window[i] = (int32_t)x[i];
   }
 
-  /** Set Mode PostCal */
-  if (PCO2_OK != PCO2_SetMode(MODE_SPAN_POST_CAL))
+  if (i == n)
   {
-    Error(ERROR_MSG_00040100, LOG_Priority_High);
-    return result;
+    PCO2_Window_Q31(s, n, 1.0f);
+    return;
   }
 
-  /** Sample the CO2 */
-  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_SPAN_POST_CAL,
-                                   &run_data.SPPCAL,
-                                   &i_data.SPPCAL))
+  for (i = 0; i < n; i++)
   {
-    Error(ERROR_MSG_00040200, LOG_Priority_High);
-    return result;
+    STATS_Add(s, (float)x[i]);
   }
+  STATS_Compute(s);
+}
 
-  /** Add Span Statistical Data to Dry Data Calculations */
-  pco2_dry.span.li_co2 = pco2_li_co2.mean;
-  pco2_dry.span.li_temperature = pco2_li_temp.mean;
-  pco2_dry.span.li_pressure = pco2_li_pres.mean;
-  pco2_dry.span.rh_rh = pco2_rh_rh.mean;
-  pco2_dry.span.rh_temperature = pco2_rh_temp.mean;
-
-  /** Return */
-  Log("End Span", LOG_Priority_Low);
-  result = PCO2_OK;
-  return result;
+/** @brief PCO2 Window Statistics (Q31)
+ *
+ * Fill the running statistics from the Q31 copy in pco2_window.  M2 is
+ * kept consistent with the variance so STATS_SEM still works.
+ *
+ * @param *s Running statistics of the channel
+ * @param n Samples in the window
+ * @param lsb Value of one count
+ *
+ * @return None
+ */
+STATIC void PCO2_Window_Q31(sStats_F_t *s, uint16_t n, float lsb)
+{
+  sVStats_Q31_t v;
+  float var;
+
+  VSTATS_Window_Q31(pco2_window, n, &v);
+  var = VSTATS_Var_Q31(&v, lsb);
+
+  s->numSamples = n;
+  s->mean = VSTATS_Mean_Q31(&v, 0.0f, lsb);
+  s->sum = s->mean * (float)n;
+  s->M2 = var * (float)n;
+  s->std = sqrt(var);
+  s->min = (float)v.min * lsb;
+  s->max = (float)v.max * lsb;
 }
 
-/** @brief PCO2 Equilibrate State
+/** @brief PCO2 Calibration Plan
  *
- * State which equilibrates the sea water in air to read pCO2 in the water.
+ * Decide if the zero and span are due this run.  With the cal policy
+ * off, or no calibration on record, both always run.  A span always
+ * brings a zero with it.
  *
  * @param None
  *
- * @return result
+ * @return None
  */
-STATIC ePCO2Status_t PCO2_State_Equilibrate(void)
+STATIC void PCO2_Cal_Plan(void)
 {
-  BSP_Hit_WD();
-  ePCO2Status_t result = PCO2_FAIL;
-
-  Log("", LOG_Priority_High);
-  Log("Start Equilibration", LOG_Priority_Low);
-  /** Clear the char arrays */
-  memset(pco2_str, 0, PCO2_STR_LEN);
+  sTimeReg_t now;
 
-  /** Turn the Licor OFF */
-  Log("Licor OFF", LOG_Priority_Low);
-  LI8x0_PowerOFF();
+  CAL_ZERO_DUE = true;
+  CAL_SPAN_DUE = true;
+  CAL_DRIFT_PENDING = false;
 
-  /** Perform Pumpon state */
-  BSP_Hit_WD();
-  if (PCO2_OK != PCO2_State_PumpOn(MODE_EQUILIBRATE_PUMP_ON))
+  if (1 != pco2.calpol.enable)
   {
-    Error(ERROR_MSG_00100200, LOG_Priority_High);
-    return result;
+    return;
   }
 
-  /** Turn the Licor ON */
-  PCO2_Licor_Warmup();
-
-  /** Remove Power Supply from Low Power Mode */
-  BSP_Low_Current_Mode_OFF();
-
-  /** Wait for Licor Warmup Timeout */
-  PCO2_SetTimeout(pco2.timeout1, pco2.LI_warmup);
-  PCO2_WaitOnTimeout(pco2.timeout1);
-  Log("LI Warmup complete", LOG_Priority_Low);
-  Log("Equilibration Pump Complete", LOG_Priority_Low);
-
-  /** Sample the CO2 */
-  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_EQUILIBRATE_PUMP_ON,
-                                   &run_data.EPON,
-                                   &i_data.EPON))
+  if ((false == pco2_cal.valid) || (true == pco2_cal.force))
   {
-    Error(ERROR_MSG_00100004, LOG_Priority_High);
-    return result;
+    Log("Cal Policy: Cal forced", LOG_Priority_High);
+    return;
   }
 
-  Log("Equilibrate Pump Off", LOG_Priority_High);
+  CAL_ZERO_DUE = ((pco2_cal.zero_age + 1u) >= pco2.calpol.zero_runs);
+  CAL_SPAN_DUE = ((pco2_cal.span_age + 1u) >= pco2.calpol.span_runs);
 
-  /** Perform Pumpoff */
-  if (PCO2_OK != PCO2_State_PumpOff(MODE_EQUILIBRATE_PUMP_OFF))
+  /** Span interval */
+  if ((false == CAL_SPAN_DUE) && (0u < pco2.calpol.span_hours))
   {
-    Error(ERROR_MSG_00101000, LOG_Priority_High);
-    return result;
+    AM08X5_GetTime(&now);
+    if (true == AM08X5_compare_time(&now, &pco2_cal.span_due))
+    {
+      Log("Cal Policy: Span interval elapsed", LOG_Priority_High);
+      CAL_SPAN_DUE = true;
+    }
   }
 
-  /** Sample the CO2 */
-  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_EQUILIBRATE_PUMP_OFF,
-                                   &run_data.EPOFF,
-                                   &i_data.EPOFF))
+  /** Cell temperature drift since the last span, once the Licor is warm */
+  if ((false == CAL_SPAN_DUE) && (0.0f < pco2.calpol.temp_change))
   {
-    Error(ERROR_MSG_00100040, LOG_Priority_High);
-    return result;
+    CAL_DRIFT_PENDING = true;
+    if (false == LICOR_WARMING)
+    {
+      PCO2_Cal_Drift();
+    }
   }
 
-  /** Add Equil Statistical Data to Dry Data Calculations */
-  pco2_dry.equil.li_co2 = pco2_li_co2.mean;
-  pco2_dry.equil.li_temperature = pco2_li_temp.mean;
-  pco2_dry.equil.li_pressure = pco2_li_pres.mean;
-  pco2_dry.equil.rh_rh = pco2_rh_rh.mean;
-  pco2_dry.equil.rh_temperature = pco2_rh_temp.mean;
-
-  /** Return */
-  Log("End Equilibration", LOG_Priority_Low);
-  result = PCO2_OK;
-  return result;
+  if (true == CAL_SPAN_DUE)
+  {
+    CAL_ZERO_DUE = true;
+  }
 }
 
-/** @brief PCO2 Air State
+/** @brief PCO2 Calibration Drift
  *
- * State which measures CO2 in the air.
+ * Pending cell temperature check of the calibration plan.  Called with
+ * the Licor warm: from the plan, or at the first sample after an
+ * overlapped warmup joins.  A span due on drift brings a zero with it.
  *
  * @param None
  *
- * @return result
+ * @return None
  */
-STATIC ePCO2Status_t PCO2_State_Air(void)
+STATIC void PCO2_Cal_Drift(void)
 {
-  BSP_Hit_WD();
-  ePCO2Status_t result = PCO2_FAIL;
-  Log("", LOG_Priority_High);
-
-  /** Clear the char arrays */
-  memset(pco2_str, 0, PCO2_STR_LEN);
+  sLicorData_t li_data;
+  char sstr[64];
 
-  /** Low Current Mode OFF */
-  BSP_Low_Current_Mode_OFF();
+  if (false == CAL_DRIFT_PENDING)
+  {
+    return;
+  }
+  CAL_DRIFT_PENDING = false;
 
-  /** Perform Pumpon state */
-  if (PCO2_OK != PCO2_State_PumpOn(MODE_AIR_PUMP_ON))
+  if (PCO2_OK != PCO2_Licor_Ready())
   {
-    Error(ERROR_MSG_00100200, LOG_Priority_High);
-    return result;
+    return;
   }
 
-  /** Sample the CO2 */
-  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_AIR_PUMP_ON,
-                                   &run_data.APON,
-                                   &i_data.APON))
+  LI8x0_Clear_Data(&li_data);
+  LI8x0_Sample_Query();
+  if ((LICOR_OK == LI8x0_Sample_Read(&li_data)) &&
+      (fabs(li_data.celltemp - pco2_cal.span_celltemp) > pco2.calpol.temp_change))
   {
-    Error(ERROR_MSG_00100400, LOG_Priority_High);
-    return result;
+    memset(sstr, NULL, 64);
+    sprintf(sstr, "Cal Policy: Cell temp moved %0.2f C",
+            li_data.celltemp - pco2_cal.span_celltemp);
+    Log(sstr, LOG_Priority_High);
+    CAL_SPAN_DUE = true;
+    CAL_ZERO_DUE = true;
   }
+}
 
-  /** Perform Pumpoff */
-  if (PCO2_OK != PCO2_State_PumpOff(MODE_AIR_PUMP_OFF))
+/** @brief PCO2 Calibration Step
+ *
+ * Check a run step against the calibration plan.  Zero and span steps
+ * that are not due are skipped and the Licor keeps its coefficients.
+ *
+ * @param step Run step
+ *
+ * @return true if the step should run
+ */
+STATIC bool PCO2_Cal_Step(ePCO2Step_t step)
+{
+  char sstr[64];
+
+  memset(sstr, NULL, 64);
+  switch (step)
   {
-    Error(ERROR_MSG_00101000, LOG_Priority_High);
-    return result;
+  case PCO2_STEP_ZERO:
+    /** No zero pump to overlap, settle the drift check now */
+    if (false == CAL_ZERO_DUE)
+    {
+      PCO2_Cal_Drift();
+    }
+    if (false == CAL_ZERO_DUE)
+    {
+      sprintf(sstr, "Zero skipped, zero age %u runs", pco2_cal.zero_age);
+      Log(sstr, LOG_Priority_High);
+      return false;
+    }
+    i_data.CAL.zero = true;
+    break;
+  case PCO2_STEP_SPAN:
+    PCO2_Cal_Drift();
+    if (false == CAL_SPAN_DUE)
+    {
+      sprintf(sstr, "Span skipped, span age %u runs", pco2_cal.span_age);
+      Log(sstr, LOG_Priority_High);
+      return false;
+    }
+    i_data.CAL.span = true;
+    break;
+  default:
+    break;
   }
 
-  /** Sample the CO2 */
-  if (PCO2_OK != PCO2_State_Sample(PCO2_MODE_AIR_PUMP_OFF,
-                                   &run_data.APOFF,
-                                   &i_data.APOFF))
+  return true;
+}
+
+/** @brief PCO2 Calibration Update
+ *
+ * Age the calibrations at the end of a run, restart the span interval
+ * after a span and check the span off error for drift.
+ *
+ * @param None
+ *
+ * @return None
+ */
+STATIC void PCO2_Cal_Update(void)
+{
+  sTimeReg_t now;
+  sTimeReg_t interval;
+  float err;
+  char sstr[64];
+
+  if (true == i_data.CAL.zero)
   {
-    Error(ERROR_MSG_00104000, LOG_Priority_High);
-    return result;
+    pco2_cal.zero_age = 0u;
+  }
+  else if (UINT16_MAX > pco2_cal.zero_age)
+  {
+    pco2_cal.zero_age++;
   }
 
-  /** Add Air Statistical Data to Dry Data Calculations */
-  pco2_dry.air.li_co2 = pco2_li_co2.mean;
-  pco2_dry.air.li_temperature = pco2_li_temp.mean;
-  pco2_dry.air.li_pressure = pco2_li_pres.mean;
-  pco2_dry.air.rh_rh = pco2_rh_rh.mean;
-  pco2_dry.air.rh_temperature = pco2_rh_temp.mean;
+  /** A span skipped on pressure difference does not count */
+  if ((true == i_data.CAL.span) && (false == SPAN_SKIPPED))
+  {
+    pco2_cal.span_age = 0u;
+    pco2_cal.span_celltemp = pco2_dry.span.li_temperature;
 
-  /** Calibrate O2 at conclusion of Air */
-  PCO2_Set_O2Cal();
+    AM08X5_GetTime(&now);
+    AM08X5_clear_time_struct(&interval);
+    interval.date = pco2.calpol.span_hours / 24u;
+    interval.hour = pco2.calpol.span_hours % 24u;
+    AM08X5_add_time_struct(&now, &interval, &pco2_cal.span_due);
 
-  /** Return */
-  result = PCO2_OK;
-  return result;
+    if ((true == i_data.CAL.zero) || (true == pco2_cal.valid))
+    {
+      pco2_cal.valid = true;
+      pco2_cal.force = false;
+    }
+
+    /** Large pre-cal error, calibrate again next run */
+    err = i_data.SPOFF.co2.mean - pco2.span;
+    if ((0.0f < pco2.calpol.span_err) && (fabs(err) > pco2.calpol.span_err))
+    {
+      memset(sstr, NULL, 64);
+      sprintf(sstr, "Cal Policy: Span error %0.2f ppm", err);
+      Log(sstr, LOG_Priority_High);
+      pco2_cal.force = true;
+    }
+  }
+  else if (UINT16_MAX > pco2_cal.span_age)
+  {
+    pco2_cal.span_age++;
+  }
+
+  i_data.CAL.zero_age = pco2_cal.zero_age;
+  i_data.CAL.span_age = pco2_cal.span_age;
 }
 
 STATIC void PCO2_Licor_Warmup(void)
@@ -2086,7 +3188,7 @@ STATIC ePCO2Status_t PCO2_State_PumpOn(ePCO2Mode_t mode)
     strcpy(pco2.mode, PCO2_MODE_ZERO_PUMP_ON);
     if (PCO2_OK != PCO2_SetMode(MODE_ZERO_PUMP_ON))
     {
-      Error(ERROR_MSG_00020002, LOG_Priority_High);
+      Error(ERROR_MSG_00020002, 0);
       return result;
     }
     break;
@@ -2094,7 +3196,7 @@ STATIC ePCO2Status_t PCO2_State_PumpOn(ePCO2Mode_t mode)
     strcpy(pco2.mode, PCO2_MODE_SPAN_GAS_ON);
     if (PCO2_OK != PCO2_SetMode(MODE_SPAN_GAS_ON))
     {
-      Error(ERROR_MSG_00040002, LOG_Priority_High);
+      Error(ERROR_MSG_00040002, 0);
       return result;
     }
     break;
@@ -2102,7 +3204,7 @@ STATIC ePCO2Status_t PCO2_State_PumpOn(ePCO2Mode_t mode)
     strcpy(pco2.mode, PCO2_MODE_SPAN2_GAS_ON);
     if (PCO2_OK != PCO2_SetMode(MODE_SPAN2_GAS_ON))
     {
-      Error(ERROR_MSG_00080002, LOG_Priority_High);
+      Error(ERROR_MSG_00080002, 0);
       return result;
     }
     break;
@@ -2111,7 +3213,7 @@ STATIC ePCO2Status_t PCO2_State_PumpOn(ePCO2Mode_t mode)
     strcpy(pco2.mode, PCO2_MODE_AIR_PUMP_ON);
     if (PCO2_OK != PCO2_SetMode(MODE_AIR_PUMP_ON))
     {
-      Error(ERROR_MSG_00100200, LOG_Priority_High);
+      Error(ERROR_MSG_00100200, 0);
       return result;
     }
     strcpy(pco2.mode, PCO2_MODE_AIR_PUMP_ON);
@@ -2124,7 +3226,7 @@ STATIC ePCO2Status_t PCO2_State_PumpOn(ePCO2Mode_t mode)
     strcpy(pco2.mode, PCO2_MODE_EQUILIBRATE_PUMP_ON);
     if (PCO2_OK != PCO2_SetMode(MODE_EQUILIBRATE_PUMP_ON))
     {
-      Error(ERROR_MSG_00100002, LOG_Priority_High);
+      Error(ERROR_MSG_00100002, 0);
       return result;
     }
 
@@ -2187,19 +3289,19 @@ STATIC ePCO2Status_t PCO2_State_PumpOff(ePCO2Mode_t mode)
     switch (mode)
     {
     case MODE_ZERO_PUMP_OFF:
-      Error(ERROR_MSG_00020008, LOG_Priority_High);
+      Error(ERROR_MSG_00020008, 0);
       break;
     case MODE_SPAN_GAS_OFF:
-      Error(ERROR_MSG_00040008, LOG_Priority_High);
+      Error(ERROR_MSG_00040008, 0);
       break;
     case MODE_SPAN2_GAS_OFF:
-      Error(ERROR_MSG_00080008, LOG_Priority_High);
+      Error(ERROR_MSG_00080008, 0);
       break;
     case MODE_EQUILIBRATE_PUMP_OFF:
-      Error(ERROR_MSG_00100008, LOG_Priority_High);
+      Error(ERROR_MSG_00100008, 0);
       break;
     case MODE_AIR_PUMP_OFF:
-      Error(ERROR_MSG_00100800, LOG_Priority_High);
+      Error(ERROR_MSG_00100800, 0);
       break;
     default:
       Log("Invalid Pump Off Mode", LOG_Priority_High);
@@ -2225,19 +3327,19 @@ STATIC ePCO2Status_t PCO2_State_PumpOff(ePCO2Mode_t mode)
     switch (mode)
     {
     case MODE_ZERO_VENT:
-      Error(ERROR_MSG_00020010, LOG_Priority_High);
+      Error(ERROR_MSG_00020010, 0);
       break;
     case MODE_SPAN_VENT:
-      Error(ERROR_MSG_00040010, LOG_Priority_High);
+      Error(ERROR_MSG_00040010, 0);
       break;
     case MODE_SPAN2_VENT:
-      Error(ERROR_MSG_00080010, LOG_Priority_High);
+      Error(ERROR_MSG_00080010, 0);
       break;
     case MODE_EQUILIBRATE_VENT:
-      Error(ERROR_MSG_00100010, LOG_Priority_High);
+      Error(ERROR_MSG_00100010, 0);
       break;
     case MODE_AIR_VENT:
-      Error(ERROR_MSG_00101000, LOG_Priority_High);
+      Error(ERROR_MSG_00101000, 0);
       break;
     default:
       Log("Invalid Pump Off Mode", LOG_Priority_High);
@@ -2263,19 +3365,19 @@ STATIC ePCO2Status_t PCO2_State_PumpOff(ePCO2Mode_t mode)
     switch (mode)
     {
     case MODE_ZERO_POST_CAL:
-      Error(ERROR_MSG_00020040, LOG_Priority_High);
+      Error(ERROR_MSG_00020040, 0);
       break;
     case MODE_SPAN_POST_CAL:
-      Error(ERROR_MSG_00040100, LOG_Priority_High);
+      Error(ERROR_MSG_00040100, 0);
       break;
     case MODE_SPAN2_POST_CAL:
-      Error(ERROR_MSG_00080080, LOG_Priority_High);
+      Error(ERROR_MSG_00080080, 0);
       break;
     case MODE_EQUILIBRATE_POST_VENT:
-      Error(ERROR_MSG_00100020, LOG_Priority_High);
+      Error(ERROR_MSG_00100020, 0);
       break;
     case MODE_AIR_POST_VENT:
-      Error(ERROR_MSG_00102000, LOG_Priority_High);
+      Error(ERROR_MSG_00102000, 0);
       break;
     default:
       Log("Invalid Post-Cal/Post-Vent Mode", LOG_Priority_High);
@@ -2314,7 +3416,7 @@ STATIC ePCO2Status_t PCO2_State_Calibrate(ePCO2Cal_t state, float concentration)
     Log("PCO2 Cal: Zero", LOG_Priority_Low);
     if (LICOR_FAIL == LI8x0_Zero())
     {
-      Error(ERROR_MSG_00020001, LOG_Priority_High);
+      Error(ERROR_MSG_00020001, 0);
     }
     else
     {
@@ -2325,7 +3427,7 @@ STATIC ePCO2Status_t PCO2_State_Calibrate(ePCO2Cal_t state, float concentration)
     Log("PCO2 Cal: Span", LOG_Priority_Low);
     if (LICOR_FAIL == LI8x0_Span(concentration))
     {
-      Error(ERROR_MSG_00040001, LOG_Priority_High);
+      Error(ERROR_MSG_00040001, 0);
     }
     else
     {
@@ -2336,7 +3438,7 @@ STATIC ePCO2Status_t PCO2_State_Calibrate(ePCO2Cal_t state, float concentration)
     Log("PCO2 Cal: Span2", LOG_Priority_Low);
     if (LICOR_FAIL == LI8x0_Span2(concentration))
     {
-      Error(ERROR_MSG_00080001, LOG_Priority_High);
+      Error(ERROR_MSG_00080001, 0);
     }
     else
     {
@@ -2345,7 +3447,7 @@ STATIC ePCO2Status_t PCO2_State_Calibrate(ePCO2Cal_t state, float concentration)
     break;
   default:
     Log("PCO2 Cal: FAIL", LOG_Priority_Low);
-    Error(ERROR_MSG_0130, LOG_Priority_Low);
+    Error(ERROR_MSG_0130, 0);
     break;
   }
 
@@ -2359,6 +3461,31 @@ STATIC ePCO2Status_t PCO2_State_Calibrate(ePCO2Cal_t state, float concentration)
   return result;
 }
 
+/** @brief Wait for a Licor Stream Frame
+ *
+ * Sleep on the RTC sample tick until the Licor stream has a new frame
+ *
+ * @param *data Pointer to Licor data
+ * @param ms Longest wait (ms)
+ *
+ * @return LICOR_OK if a frame was read
+ */
+STATIC eLicorStatus_t PCO2_Stream_Wait(sLicorData_t *data, uint16_t ms)
+{
+  eLicorStatus_t result = LI8x0_Stream_Read(data);
+  uint16_t waited = 0;
+
+  while ((LICOR_OK != result) && (waited < ms))
+  {
+    PCO2_SetSampleTimeout(pco2.sampleTimer, PCO2_STREAM_TICK_MS);
+    BSP_Sleep_While(&pco2.sampleTimer->tFlag);
+    waited += PCO2_STREAM_TICK_MS;
+    result = LI8x0_Stream_Read(data);
+  }
+
+  return result;
+}
+
 /** @brief PCO2 Sample Routine
  *
  * Routine to sample the CO2 (Licor) Sensor
@@ -2375,6 +3502,12 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
   uint16_t maxLicorSamples = ((pco2.sampleCO2 * 11) / 10) * 2;
   uint16_t minLicorSamples = ((pco2.sampleCO2 * 9) / 10) * 2;
   uint16_t sampleCnt = 0;
+  uint8_t start = rdata->sample_idx;
+  uint8_t n;
+  bool converged = false;
+  bool stream = false;
+  bool rhQueued = false;
+  eLicorStatus_t li_result;
   sLicorData_t li_data;
   float rh_temperature = 0.0;
   float rh_humidity = 0.0;
@@ -2383,19 +3516,19 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
   sTimeReg_t tsample;
   BSP_Hit_WD();
 
+  /** Finish any overlapped Licor warmup before taking data */
+  if (PCO2_OK != PCO2_Licor_Ready())
+  {
+    return result;
+  }
+  PCO2_Cal_Drift();
+
   /** Clear the Licor UART Buffer */
   LI8x0_ClearBuffer();
 
-  /** Clear the Stats Structs */
+  /** Clear the running Stats, the window pass fills the rest */
   STATS_Clear(&pco2_li_co2);
-  STATS_Clear(&pco2_li_temp);
   STATS_Clear(&pco2_li_pres);
-  STATS_Clear(&pco2_o2_o2);
-  STATS_Clear(&pco2_rh_rh);
-  STATS_Clear(&pco2_rh_temp);
-  STATS_Clear(&pco2_rh_pres);
-  STATS_Clear(&pco2_li_raw1);
-  STATS_Clear(&pco2_li_raw2);
 
   /** Set Timeout */
   PCO2_SetTimeout(pco2.timeout1, pco2.sampleCO2);
@@ -2415,25 +3548,48 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
   /** Grab current time */
   AM08X5_GetTime(&tsample);
 
+  /** The loop mostly waits on the Licor UART and the I2C sensors, so it */
+  /** idles MCLK and only runs the format and stats bursts at full speed */
+  BSP_Clock_SetProfile(BSP_CLK_IDLE);
+
   /** Number of samples */
   uint8_t numSamples = pco2.sampleCO2 * pco2.sample;
   uint16_t sampleTimeoutMs = 1000 / pco2.sample;
+
+  /** Licor outputs each sample on its own, paced by its outrate */
+  if (1 == pco2.stream)
+  {
+    stream = (LICOR_OK == LI8x0_Stream_Start(1.0f / (float)pco2.sample));
+  }
+
   while ((PCO2_GetTimeout(pco2.timeout1) == false) || (sampleCnt < numSamples))
   {
     BSP_Hit_WD();
-    PCO2_SetSampleTimeout(pco2.sampleTimer, sampleTimeoutMs);
 
     /** Clear Licor Data Struct */
     LI8x0_Clear_Data(&li_data);
-    /** Query Licor */
-    LI8x0_Sample_Query();
+    if (true == stream)
+    {
+      /** Wait for the next frame, allow one missed frame */
+      li_result = PCO2_Stream_Wait(&li_data, sampleTimeoutMs * 2);
+    }
+    else
+    {
+      PCO2_SetSampleTimeout(pco2.sampleTimer, sampleTimeoutMs);
+      /** Query Licor */
+      LI8x0_Sample_Query();
+    }
+
+    /** Queue the RTC time and the RH measured since the last sample */
+    AM08X5_GetTime_Start();
+    if (true == rhQueued)
+    {
+      SHT3X_Measure_Fetch();
+    }
 
     /** Read O2 */
     o2_o2 = MAX250_Read();
 
-    /** Read RH */
-    SHT3X_GetTempAndHumidity(&rh_temperature, &rh_humidity, REPEATAB_HIGH, MODE_POLLING, 10);
-
     /** Prepend mode to output */
     memset(pco2_str, NULL, PCO2_STR_LEN);
 
@@ -2445,17 +3601,28 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
     /** Datalogger Write Raw Vals */
     /** @todo Implement This for datalogger */
     sTimeReg_t sTime;
-    AM08X5_GetTime(&sTime);
-    AM08X5_GetTimestamp_ISO8601_w_hundredths(temp);
+    AM08X5_GetTime_Finish(&sTime);
+    BSP_Clock_SetProfile(BSP_CLK_FULL);
+    AM08X5_Format_ISO8601_w_hundredths(&sTime, temp);
     len += strlen(temp);
     strcat(pco2_str, temp);
     strcat(pco2_str, ", ");
     len += 1;
+    BSP_Clock_SetProfile(BSP_CLK_IDLE);
 
-    /** Read Licor */
-    if (LI8x0_Sample_Read(&li_data) == LICOR_OK)
+    /** Read Licor (the driver parses at full speed) */
+    if (false == stream)
     {
+      li_result = LI8x0_Sample_Read(&li_data);
+    }
+
+    /** Read RH (measures directly on the first sample) */
+    SHT3X_Measure_Result(&rh_temperature, &rh_humidity);
+    rhQueued = (SHT_OK == SHT3X_Measure_Start(REPEATAB_HIGH));
 
+    if (LICOR_OK == li_result)
+    {
+      BSP_Clock_SetProfile(BSP_CLK_FULL);
       sprintf(temp, "%s, %9.3f, %7.3f, %7.3f, %6ld, %6ld, %7.3f, %6.3f, %7.3f\0",
               sysinfo.SerialNumber, li_data.co2, li_data.celltemp, li_data.cellpres,
               li_data.raw.co2, li_data.raw.co2ref, rh_humidity, rh_temperature, o2_o2);
@@ -2463,17 +3630,14 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
       {
         strcat(pco2_str, temp);
       }
+      BSP_Clock_SetProfile(BSP_CLK_IDLE);
       Data(pco2_str);
+      BSP_Clock_SetProfile(BSP_CLK_FULL);
 
-      /** Add Data to Stats (Floats) */
+      /** Running stats only for the convergence check, the rest come */
+      /** from the window pass */
       STATS_Add(&pco2_li_co2, li_data.co2);
-      STATS_Add(&pco2_li_temp, li_data.celltemp);
       STATS_Add(&pco2_li_pres, li_data.cellpres);
-      STATS_Add(&pco2_o2_o2, o2_o2);
-      STATS_Add(&pco2_rh_rh, rh_humidity);
-      STATS_Add(&pco2_rh_temp, rh_temperature);
-      STATS_Add(&pco2_li_raw1, (float)li_data.raw.co2);
-      STATS_Add(&pco2_li_raw2, (float)li_data.raw.co2ref);
 
       /** Add Data to Run Data struct */
       if (rdata->sample_idx < PCO2_SAMPLES_PER_MODE)
@@ -2494,11 +3658,28 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
         pco2.LIData = li_data;
       }
       sampleCnt++;
-      while ((PCO2_GetTimeout(pco2.sampleTimer) == false))
-        ;
+
+      /** End the window early if the means have settled */
+      converged = PCO2_Sample_Converged(sampleCnt);
+      BSP_Clock_SetProfile(BSP_CLK_IDLE);
+      if (true == converged)
+      {
+        break;
+      }
+
+      /** Sleep until the next sample tick */
+      if (false == stream)
+      {
+        BSP_Sleep_While(&pco2.sampleTimer->tFlag);
+      }
     }
   }
 
+  if (true == stream)
+  {
+    LI8x0_Stream_Stop();
+  }
+
   Log("Stop Data", LOG_Priority_Low);
   BSP_Hit_WD();
   if ((sampleCnt >= minLicorSamples) && (sampleCnt <= maxLicorSamples))
@@ -2506,25 +3687,34 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
     result = PCO2_OK;
   }
 
-  /** Calculate Stats (Floats) */
-  STATS_Compute(&pco2_li_co2);
-  STATS_Compute(&pco2_li_temp);
-  STATS_Compute(&pco2_li_pres);
-  STATS_Compute(&pco2_o2_o2);
-  STATS_Compute(&pco2_rh_rh);
-  STATS_Compute(&pco2_rh_temp);
+  if (true == converged)
+  {
+    sprintf(sstr, "Converged after %u samples, CO2 SEM %.4f", sampleCnt, STATS_SEM(&pco2_li_co2));
+    Log(sstr, LOG_Priority_Med);
+  }
 
-  /** Calculate Stats (Ints) */
-  STATS_Compute(&pco2_li_raw1);
+  /** Calculate Stats (Floats), exact over the run_data window only */
+  BSP_Clock_SetProfile(BSP_CLK_FULL);
+  n = rdata->sample_idx - start;
+  PCO2_Window_Float(&pco2_li_co2, &rdata->CO2[start], n);
+  PCO2_Window_Float(&pco2_li_temp, &rdata->Li_temp[start], n);
+  PCO2_Window_Float(&pco2_li_pres, &rdata->Li_pres[start], n);
+  PCO2_Window_Float(&pco2_o2_o2, &rdata->O2[start], n);
+  PCO2_Window_Float(&pco2_rh_rh, &rdata->RH[start], n);
+  PCO2_Window_Float(&pco2_rh_temp, &rdata->RH_T[start], n);
 
-  STATS_Compute(&pco2_li_raw2);
+  /** Calculate Stats (Ints) */
+  PCO2_Window_Raw(&pco2_li_raw1, &rdata->Li_raw[start], n);
+  PCO2_Window_Raw(&pco2_li_raw2, &rdata->Li_ref[start], n);
 
   /** Create the string */
+  BSP_Clock_SetProfile(BSP_CLK_IDLE);
   char timestamp[24];
   AM08X5_GetTimestamp_ISO8601(timestamp);
   Log("Sample - Statistics", LOG_Priority_High);
   const char StatsHeader[] = "State,SN,Timestamp,Li_Temp_ave(C),Li_Temp_sd,Li_Pres_ave(kPa),Li_Pres_sd,CO2_ave(PPM),CO2_SD,O2_ave(%),O2_S,RH_ave(%),RH_sd,RH_T_ave(C),Rh_T_sd,Li_RawSample_ave,Li_RawSample_sd,Li_RawDetector_ave,Li_RawReference_sd";
   Stats(StatsHeader);
+  BSP_Clock_SetProfile(BSP_CLK_FULL);
 
   memset(temp, NULL, 175);
   sprintf(temp, "%s, %s, %7.3f, %7.3f, %7.3f, %7.3f, %9.3f, %8.3f, %7.3f, %7.3f, %7.3f, %7.3f, %7.3f, %7.3f, %8ld, %8ld, %8ld, %8ld",
@@ -2553,14 +3743,49 @@ STATIC ePCO2Status_t PCO2_State_Sample(const char *mode,
   idata->rh_temperature = pco2_rh_temp;
   idata->raw1 = pco2_li_raw1;
   idata->raw2 = pco2_li_raw2;
+  idata->co2_sem = STATS_SEM(&pco2_li_co2);
+  idata->pressure_sem = STATS_SEM(&pco2_li_pres);
+  idata->converged = converged;
 
   /** Write the log */
+  BSP_Clock_SetProfile(BSP_CLK_NORMAL);
   Stats(pco2_str);
 
   result = PCO2_OK;
   return result;
 }
 
+/** @brief Sample Window Converged
+ *
+ * Check the running CO2 (and optionally pressure) statistics to see if
+ * the standard error of the mean has dropped below the configured
+ * thresholds.  Never converges before the configured minimum samples.
+ *
+ * @param sampleCnt Number of samples collected so far
+ *
+ * @return true if converged, false otherwise
+ */
+STATIC bool PCO2_Sample_Converged(uint16_t sampleCnt)
+{
+  if ((0 == pco2.converge.enable) || (sampleCnt < pco2.converge.minsamples))
+  {
+    return false;
+  }
+
+  if (STATS_SEM(&pco2_li_co2) > pco2.converge.co2)
+  {
+    return false;
+  }
+
+  if ((0.0 < pco2.converge.pressure) &&
+      (STATS_SEM(&pco2_li_pres) > pco2.converge.pressure))
+  {
+    return false;
+  }
+
+  return true;
+}
+
 STATIC ePCO2Status_t PCO2_SetMode(ePCO2Mode_t mode)
 {
   ePCO2Status_t result = PCO2_FAIL;
@@ -2695,7 +3920,7 @@ STATIC ePCO2Status_t PCO2_SetMode(ePCO2Mode_t mode)
     Log("AUTO-PRESSURIZE", LOG_Priority_Low);
     fresult = FLOW_SetMode(FLOW_STATE_PRESSURIZE);
   default:
-    Error(ERROR_MSG_00014000, LOG_Priority_Low);
+    Error(ERROR_MSG_00014000, 0);
     break;
   }
 #ifdef UNIT_TESTING
@@ -2951,18 +4176,32 @@ STATIC void calculate_pumpwait(void)
  */
 STATIC void calculate_prequil(void)
 {
-  uint16_t sub_time = pco2.LI_warmup;
-  pco2.equil.prequil = pco2.equil.equil;
-  if (pco2.equil.prequil > sub_time)
-  {
-    pco2.equil.prequil -= sub_time;
-  }
-  else
+  sEqTime_t eqt;
+
+  PCO2_EqTime(&eqt);
+  pco2.equil.prequil = EQTIME_Prequil(&eqt);
+  if (EQTIME_Target(&eqt) <= pco2.LI_warmup)
   {
     pco2.pump.pumpwait = 2;
   }
 }
 
+/** @brief Equilibration Timing Settings
+ *
+ * Loads the equilibration timing settings from the current configuration.
+ *
+ * @param *t Settings
+ *
+ * @return None
+ */
+STATIC void PCO2_EqTime(sEqTime_t *t)
+{
+  t->equil = pco2.equil.equil;
+  t->warmup = pco2.LI_warmup;
+  t->slope = (1 == pco2.eqslope.enable);
+  t->minimum = pco2.eqslope.minimum;
+}
+
 STATIC void clear_run_data(sPCO2_run_data_t *data)
 {
   uint8_t i;
@@ -2999,11 +4238,43 @@ STATIC void clear_full_run_data(sPCO2_sdata_t *data)
   clear_run_data(&data->EPON);
   clear_run_data(&data->APOFF);
   clear_run_data(&data->APON);
-  data->DRY.air_xco2 = 0.0f;
-  data->DRY.sw_xco2 = 0.0f;
+  data->DRY.air_xco2 = NAN;
+  data->DRY.sw_xco2 = NAN;
   memset(data->ERRORS, 0, 40);
 }
 
+/** @brief Save Run to the sdata History
+ *
+ * Summarise each mode of run_data into the next SdataLog record.
+ *
+ * @param start RTC time the run started
+ *
+ * @return None
+ */
+STATIC void PCO2_Save_History(uint32_t start)
+{
+  /** sdata order */
+  const sPCO2_run_data_t *const modes[SDLOG_MODES] = {
+      &run_data.ZPON, &run_data.ZPOFF, &run_data.ZPPCAL,
+      &run_data.SPON, &run_data.SPOFF, &run_data.SPPCAL,
+      &run_data.EPON, &run_data.EPOFF, &run_data.APON, &run_data.APOFF};
+  sSdLogRecord_t *rec;
+  uint8_t m;
+
+  rec = SDLOG_Next(&SdataLog);
+  for (m = 0; m < SDLOG_MODES; m++)
+  {
+    BSP_Hit_WD();
+    SDLOG_SetMode(&rec->mode[m], modes[m]->CO2, modes[m]->Li_temp,
+                  modes[m]->Li_pres, modes[m]->RH, modes[m]->RH_T,
+                  modes[m]->O2, modes[m]->sample_idx);
+  }
+  rec->sw_xco2 = run_data.DRY.sw_xco2;
+  rec->air_xco2 = run_data.DRY.air_xco2;
+
+  SDLOG_Commit(&SdataLog, ErrorLog.run, start);
+}
+
 STATIC void clear_idata_mode_data(sPCO2_idata_mode_t *data)
 {
   STATS_Clear(&data->temperature);
@@ -3013,6 +4284,9 @@ STATIC void clear_idata_mode_data(sPCO2_idata_mode_t *data)
   STATS_Clear(&data->rh);
   STATS_Clear(&data->raw1);
   STATS_Clear(&data->raw2);
+  data->co2_sem = 0.0f;
+  data->pressure_sem = 0.0f;
+  data->converged = false;
 }
 
 STATIC void clear_idata_data(sPCO2_idata_t *data)
@@ -3030,6 +4304,17 @@ STATIC void clear_idata_data(sPCO2_idata_t *data)
   data->COEFF.co2kzero = 0.0f;
   data->COEFF.co2kspan = 0.0f;
   data->COEFF.co2kspan2 = 0.0f;
-  data->sw_xco2 = 0.0f;
-  data->air_xco2 = 0.0f;
+  data->EQUIL.endtime = 0u;
+  data->EQUIL.slope = NAN;
+  data->EQUIL.intercept = NAN;
+  data->EQUIL.points = 0u;
+  data->EQUIL.detected = false;
+  data->WARMUP.config = 0u;
+  data->WARMUP.equil = 0u;
+  data->CAL.zero = false;
+  data->CAL.span = false;
+  data->CAL.zero_age = 0u;
+  data->CAL.span_age = 0u;
+  data->sw_xco2 = NAN;
+  data->air_xco2 = NAN;
 }
\ No newline at end of file
@@ -42,6 +42,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <math.h>
+#include <ctype.h>
 #ifndef UNIT_TESTING
 #include <stdlib.h>
 #endif
@@ -57,8 +58,10 @@
 #include "max250.h"
 #include "flowcontrol.h"
 #include "statistics.h"
+#include "eqtime.h"
 
 #include "errorlist.h"
+#include "sdlog.h"
 //#include "rh.h"
 #include "sht35.h"
 #include "scheduler.h"
@@ -156,6 +159,54 @@ typedef enum
   PCO2_SAMPLE_MODE_DEPLOY = 0x04u  /**< Deployment Mode */
 } ePCO2SampleMode_t;
 
+/**
+ * @enum PCO2 Run Step
+ * @brief Steps of a run sequence
+ */
+typedef enum
+{
+  PCO2_STEP_END = 0x00u,   /**< End of sequence */
+  PCO2_STEP_ZERO = 0x01u,  /**< Zero (ZPON, ZPOFF, ZPPCAL) */
+  PCO2_STEP_SPAN = 0x02u,  /**< Span (SPON, SPOFF, SPPCAL) */
+  PCO2_STEP_EQUIL = 0x03u, /**< Equilibrate (EPON, EPOFF) */
+  PCO2_STEP_AIR = 0x04u,   /**< Air (APON, APOFF) */
+  PCO2_STEP_PURGE = 0x05u  /**< Purge */
+} ePCO2Step_t;
+
+#define PCO2_SEQ_LEN (8)
+
+/**
+ * @struct PCO2 Dry Cell Data
+ * @brief Cell means at the end of a step, used for the dry CO2
+ */
+typedef struct
+{
+  float li_co2;         /** CO2 mean (ppm) */
+  float li_temperature; /** Mean temperature (degC) */
+  float li_pressure;    /** Pressure (kPa) */
+  float rh_temperature; /** RH temperature mean (degC) */
+  float rh_rh;          /** RH mean (%) */
+} sPCO2DryCell_t;
+
+/**
+ * @struct PCO2 Run Step Definition
+ * @brief One entry of the run step table
+ *
+ * The step length is (on * ons) + (sampleCO2 * samples) + (pumpoff * settles).
+ */
+typedef struct
+{
+  ePCO2Step_t step;           /**< Step */
+  char id;                    /**< Console letter for the step */
+  ePCO2Status_t (*run)(void); /**< State function */
+  eErrorCode_t error;         /**< Error on failure */
+  const uint16_t *on;         /**< Flow on time setting (seconds) */
+  uint8_t ons;                /**< Flow on periods */
+  uint8_t samples;            /**< Sample windows */
+  uint8_t settles;            /**< Pump off settles */
+  sPCO2DryCell_t *dry;        /**< Dry data from the last sample, NULL for none */
+} sPCO2StepDef_t;
+
 typedef struct
 {
   bool mconfig;
@@ -221,15 +272,48 @@ typedef struct pco2_t
   uint8_t LI_heater;   /**< Licor Heater on of off (0=off, 1=on) */
   uint8_t zero_on;
   uint8_t span_on;
+  uint8_t overlap;                   /**< Warm Licor during zero pump on (0=off, 1=on) */
+  uint8_t stream;                    /**< Licor streams while sampling (0=polled, 1=stream) */
+  uint8_t seq[PCO2_SEQ_LEN];         /**< Run sequence (ePCO2Step_t), PCO2_STEP_END terminated */
   uint16_t vent;                     /**< Length of time to vent before closing (seconds) */
   volatile sSysTimer_t *timeout1;    /**< Seconds countdown timer 1 */
   volatile sSysTimer_t *timeout2;    /**< Seconds countdown timer 2 */
   volatile sSysTimer_t *sampleTimer; /**< Sample seconds countdown timer */
+  volatile sSysTimer_t *warmTimer;   /**< Licor warmup seconds countdown timer */
   volatile uint16_t *cal_timeout;    /**< Calibration seconds countdown timer */
   float spandiff;                    /**< Span Gas Pressure Difference */
   float span;                        /**< Span Gas Concentration */
   float span2;                       /**< Span2 Gas Concentration */
   float bbc;                         /**< Band Broadening Coefficient */
+  struct
+  {
+    uint8_t enable;      /**< End sample window early on convergence (0=off, 1=on) */
+    uint16_t minsamples; /**< Minimum samples before convergence is checked */
+    float co2;           /**< CO2 standard error of mean threshold (ppm) */
+    float pressure;      /**< Pressure standard error of mean threshold (kPa), 0=ignore */
+  } converge;
+  struct
+  {
+    uint8_t enable;   /**< End equilibration on CO2 slope (0=off, 1=on) */
+    uint16_t minimum; /**< Minimum equilibration pump time (seconds) */
+    uint16_t dwell;   /**< Time slope must stay under rate (seconds) */
+    float rate;       /**< CO2 slope limit (ppm/min) */
+  } eqslope;
+  struct
+  {
+    uint8_t enable; /**< End Licor warmup when cell is stable (0=off, 1=on) */
+    float temp_tol; /**< Cell temperature stability band (degC) */
+    float pres_tol; /**< Cell pressure stability band (kPa) */
+  } liwarm;
+  struct
+  {
+    uint8_t enable;       /**< Calibration cadence policy (0=cal every run, 1=on) */
+    uint16_t zero_runs;   /**< Zero every N runs */
+    uint16_t span_runs;   /**< Span every M runs */
+    uint16_t span_hours;  /**< Span at least every T hours, 0=off */
+    float span_err;       /**< Force cal if span off CO2 error exceeds (ppm), 0=off */
+    float temp_change;    /**< Force cal if cell temperature moved by (degC), 0=off */
+  } calpol;
   sManufacturer_t man;
   char mode[8];
 } sPCO2_t;
@@ -240,30 +324,9 @@ typedef struct pco2_t
  */
 typedef struct
 {
-  struct
-  {
-    float li_co2;         /** Span Off CO2 mean (ppm) */
-    float li_temperature; /** Span Off mean temperature (degC) */
-    float li_pressure;    /** Span Off Pressure (kPa) */
-    float rh_temperature; /** Span Off RH mean (%) */
-    float rh_rh;          /** Span Off RH mean (%) */
-  } span;
-  struct
-  {
-    float li_co2;         /** Equilibrator Off CO2 mean (ppm) */
-    float li_temperature; /** Equilibrator Off mean temperature (degC) */
-    float li_pressure;    /** Equilibrator Off Pressure (kPa) */
-    float rh_temperature; /** Equilibrator Off RH mean (%) */
-    float rh_rh;          /** Equilibrator Off RH mean (%) */
-  } equil;
-  struct
-  {
-    float li_co2;         /** Air Off CO2 mean (ppm) */
-    float li_temperature; /** Air Off mean temperature (degC) */
-    float li_pressure;    /** Air Off Pressure (kPa) */
-    float rh_temperature; /** Air Off RH mean (%) */
-    float rh_rh;          /** Air Off RH mean (%) */
-  } air;
+  sPCO2DryCell_t span;  /** Span post cal */
+  sPCO2DryCell_t equil; /** Equilibrator off */
+  sPCO2DryCell_t air;   /** Air off */
   float sw_xco2;  /** Seawater Dry CO2 (ppm) */
   float air_xco2; /** Atmospheric air Dry CO2 (ppm) */
   struct
@@ -324,6 +387,9 @@ typedef struct
   sStats_F_t rh_temperature;
   sStats_F_t raw1;
   sStats_F_t raw2;
+  float co2_sem;      /**< CO2 standard error of mean at end of window (ppm) */
+  float pressure_sem; /**< Pressure standard error of mean at end of window (kPa) */
+  bool converged;     /**< Window ended early on convergence */
   char timestamp[23];
 } sPCO2_idata_mode_t;
 
@@ -345,15 +411,49 @@ typedef struct
     float co2kspan;
     float co2kspan2;
   } COEFF;
+  struct
+  {
+    uint16_t endtime; /**< Equilibration pump time at end (seconds) */
+    float slope;      /**< Last fitted CO2 slope (ppm/min) */
+    float intercept;  /**< Last fitted CO2 at equilibration start (ppm) */
+    uint8_t points;   /**< Number of CO2 points in last fit */
+    bool detected;    /**< End point found before equil time */
+  } EQUIL;
+  struct
+  {
+    uint16_t config; /**< Licor warmup at start of run (seconds) */
+    uint16_t equil;  /**< Licor warmup during equilibration (seconds) */
+  } WARMUP;
+  struct
+  {
+    bool zero;         /**< Zero run this cycle */
+    bool span;         /**< Span run this cycle */
+    uint16_t zero_age; /**< Runs since the zero coefficient was set */
+    uint16_t span_age; /**< Runs since the span coefficient was set */
+  } CAL;
   float sw_xco2;  /**< Seawater Dry CO2 (ppm) */
   float air_xco2; /**< Atmospheric air Dry CO2 (ppm) */
 } sPCO2_idata_t;
 
+/**
+ * @struct sPCO2CalState_t
+ * @brief Calibration cadence state, kept across runs
+ */
+typedef struct
+{
+  uint16_t zero_age;    /**< Runs since last zero */
+  uint16_t span_age;    /**< Runs since last span */
+  sTimeReg_t span_due;  /**< Time the next span is due */
+  float span_celltemp;  /**< Licor cell temperature at last span (degC) */
+  bool force;           /**< Zero and span on the next run */
+  bool valid;           /**< A zero and span are on record */
+} sPCO2CalState_t;
+
 /************************************************************************
  *							  Externs
  ************************************************************************/
+extern PERSISTENT sPCO2_t pco2;
 #ifdef UNIT_TESTING
-extern sPCO2_t pco2;
 extern char pco2_str[512];
 extern sStats_F_t pco2_li_co2;
 extern sStats_F_t pco2_li_pres;
@@ -683,6 +783,206 @@ float PCO2_GetSpan(void);
  */
 float PCO2_GetSpan2(void);
 
+/** @brief Get Convergence State
+ *
+ * Get the sample window convergence (early stop) state
+ *
+ * @param None
+ *
+ * @return convergence state (0=Off, 1=On)
+ */
+uint8_t PCO2_GetConverge(void);
+
+/** @brief Get Convergence Minimum Samples
+ *
+ * Get the minimum number of samples before convergence is checked
+ *
+ * @param None
+ *
+ * @return Minimum samples
+ */
+uint32_t PCO2_GetConvergeMinSamples(void);
+
+/** @brief Get CO2 Convergence Threshold
+ *
+ * Get the CO2 standard error of the mean threshold
+ *
+ * @param None
+ *
+ * @return CO2 SEM threshold (ppm)
+ */
+float PCO2_GetConvergeCO2(void);
+
+/** @brief Get Pressure Convergence Threshold
+ *
+ * Get the pressure standard error of the mean threshold
+ *
+ * @param None
+ *
+ * @return Pressure SEM threshold (kPa), 0 if not used
+ */
+float PCO2_GetConvergePressure(void);
+
+/** @brief Get Equilibration Slope State
+ *
+ * Get the slope based equilibration end point state
+ *
+ * @param None
+ *
+ * @return state (0=Off, 1=On)
+ */
+uint8_t PCO2_GetEqSlope(void);
+
+/** @brief Get Minimum Equilibration Time
+ *
+ * Get the minimum equilibration pump time before the slope is checked
+ *
+ * @param None
+ *
+ * @return Minimum time (seconds)
+ */
+uint32_t PCO2_GetEqMinimum(void);
+
+/** @brief Get Equilibration Dwell
+ *
+ * Get the time the CO2 slope must stay under the rate limit
+ *
+ * @param None
+ *
+ * @return Dwell time (seconds)
+ */
+uint32_t PCO2_GetEqDwell(void);
+
+/** @brief Get Equilibration Rate
+ *
+ * Get the CO2 slope limit for the equilibration end point
+ *
+ * @param None
+ *
+ * @return Rate (ppm/min)
+ */
+float PCO2_GetEqRate(void);
+
+/** @brief Get Adaptive Warmup State
+ *
+ * Get the Licor stability based warmup state
+ *
+ * @param None
+ *
+ * @return state (0=Off, 1=On)
+ */
+uint8_t PCO2_GetLiWarm(void);
+
+/** @brief Get Warmup Temperature Tolerance
+ *
+ * Get the cell temperature band for a stable Licor
+ *
+ * @param None
+ *
+ * @return Temperature band (degC)
+ */
+float PCO2_GetLiWarmTemp(void);
+
+/** @brief Get Warmup Pressure Tolerance
+ *
+ * Get the cell pressure band for a stable Licor
+ *
+ * @param None
+ *
+ * @return Pressure band (kPa)
+ */
+float PCO2_GetLiWarmPres(void);
+
+/** @brief Get Warmup Overlap State
+ *
+ * Get the state of the Licor warmup / zero pump on overlap
+ *
+ * @param None
+ *
+ * @return state (0=Off, 1=On)
+ */
+uint8_t PCO2_GetOverlap(void);
+
+/** @brief Get Licor Stream State
+ *
+ * Get whether the Licor streams (1) or is polled (0) while sampling
+ *
+ * @param None
+ *
+ * @return state (0=Polled, 1=Stream)
+ */
+uint8_t PCO2_GetStream(void);
+
+/** @brief Get Run Sequence
+ *
+ * Get the run sequence as a string of step letters (Z, S, E, A, P)
+ *
+ * @param *seq Pointer to string (at least PCO2_SEQ_LEN chars)
+ *
+ * @return None
+ */
+void PCO2_GetSequence(char *seq);
+
+/** @brief Get Calibration Policy State
+ *
+ * Get the calibration cadence policy state
+ *
+ * @param None
+ *
+ * @return state (0=Off, 1=On)
+ */
+uint8_t PCO2_GetCalPolicy(void);
+
+/** @brief Get Zero Cadence
+ *
+ * Get the number of runs between zeros
+ *
+ * @param None
+ *
+ * @return Runs
+ */
+uint16_t PCO2_GetCalZeroRuns(void);
+
+/** @brief Get Span Cadence
+ *
+ * Get the number of runs between spans
+ *
+ * @param None
+ *
+ * @return Runs
+ */
+uint16_t PCO2_GetCalSpanRuns(void);
+
+/** @brief Get Span Interval
+ *
+ * Get the maximum time between spans
+ *
+ * @param None
+ *
+ * @return Interval (hours), 0 if not used
+ */
+uint16_t PCO2_GetCalSpanHours(void);
+
+/** @brief Get Span Error Limit
+ *
+ * Get the span off CO2 error that forces a calibration
+ *
+ * @param None
+ *
+ * @return Error limit (ppm), 0 if not used
+ */
+float PCO2_GetCalSpanErr(void);
+
+/** @brief Get Cell Temperature Limit
+ *
+ * Get the cell temperature change that forces a calibration
+ *
+ * @param None
+ *
+ * @return Temperature change (degC), 0 if not used
+ */
+float PCO2_GetCalTemp(void);
+
 /**  @brief Get Licor Coefficients
  *
  * Get the Licor Coefficients
@@ -852,6 +1152,240 @@ void PCO2_SetVent(uint32_t seconds);
  */
 void PCO2_SetHeater(uint8_t state);
 
+/** @brief Apply Heater Setting
+ *
+ * Send pco2.LI_heater to the Licor.  Parameter registry hook.
+ *
+ * @param prev Previous setting (unused)
+ *
+ * @return None
+ */
+void PCO2_ApplyHeater(float prev);
+
+/** @brief Set Convergence On/Off
+ *
+ * Allow the CO2 sample window to end early once the running mean has
+ * converged (ON=1) or always sample the full window (OFF=0)
+ *
+ * @param state Convergence state (0=OFF, 1=ON)
+ *
+ * @return None
+ */
+void PCO2_SetConverge(uint8_t state);
+
+/** @brief Set Convergence Minimum Samples
+ *
+ * Minimum number of samples before convergence is checked
+ *
+ * @param samples Minimum samples (2 - 999)
+ *
+ * @return None
+ */
+void PCO2_SetConvergeMinSamples(uint32_t samples);
+
+/** @brief Set CO2 Convergence Threshold
+ *
+ * CO2 standard error of the mean below which the window may end
+ *
+ * @param ppm CO2 SEM threshold (ppm)
+ *
+ * @return None
+ */
+void PCO2_SetConvergeCO2(float ppm);
+
+/** @brief Set Pressure Convergence Threshold
+ *
+ * Pressure standard error of the mean below which the window may end.
+ * Set to 0 to ignore pressure.
+ *
+ * @param kpa Pressure SEM threshold (kPa)
+ *
+ * @return None
+ */
+void PCO2_SetConvergePressure(float kpa);
+
+/** @brief Set Equilibration Slope On/Off
+ *
+ * End the equilibration pump once the CO2 slope has flattened (ON=1) or
+ * always run the full equil time (OFF=0)
+ *
+ * @param state Slope end point state (0=OFF, 1=ON)
+ *
+ * @return None
+ */
+void PCO2_SetEqSlope(uint8_t state);
+
+/** @brief Set Minimum Equilibration Time
+ *
+ * Minimum equilibration pump time before the CO2 slope is checked
+ *
+ * @param seconds Minimum time (seconds)
+ *
+ * @return None
+ */
+void PCO2_SetEqMinimum(uint32_t seconds);
+
+/** @brief Set Equilibration Dwell
+ *
+ * Time the CO2 slope must stay under the rate limit
+ *
+ * @param seconds Dwell time (seconds)
+ *
+ * @return None
+ */
+void PCO2_SetEqDwell(uint32_t seconds);
+
+/** @brief Set Equilibration Rate
+ *
+ * CO2 slope limit for the equilibration end point
+ *
+ * @param ppm_min Slope limit (ppm/min)
+ *
+ * @return None
+ */
+void PCO2_SetEqRate(float ppm_min);
+
+/** @brief Set Adaptive Warmup On/Off
+ *
+ * End the Licor warmup once cell temperature and pressure are stable
+ * (ON=1) or always wait the full warmup time (OFF=0)
+ *
+ * @param state Adaptive warmup state (0=OFF, 1=ON)
+ *
+ * @return None
+ */
+void PCO2_SetLiWarm(uint8_t state);
+
+/** @brief Set Warmup Temperature Tolerance
+ *
+ * Cell temperature band (max - min) for a stable Licor
+ *
+ * @param degc Temperature band (degC)
+ *
+ * @return None
+ */
+void PCO2_SetLiWarmTemp(float degc);
+
+/** @brief Set Warmup Pressure Tolerance
+ *
+ * Cell pressure band (max - min) for a stable Licor
+ *
+ * @param kpa Pressure band (kPa)
+ *
+ * @return None
+ */
+void PCO2_SetLiWarmPres(float kpa);
+
+/** @brief Set Warmup Overlap On/Off
+ *
+ * Warm the Licor while the zero pump runs (ON=1), or finish the warmup
+ * before starting the zero pump (OFF=0)
+ *
+ * @param state Overlap state (0=OFF, 1=ON)
+ *
+ * @return None
+ */
+void PCO2_SetOverlap(uint8_t state);
+
+/** @brief Set Licor Stream On/Off
+ *
+ * Have the Licor output at the sample rate during each sample window
+ * (ON=1), or query it for every sample (OFF=0)
+ *
+ * @param state Stream state (0=OFF, 1=ON)
+ *
+ * @return None
+ */
+void PCO2_SetStream(uint8_t state);
+
+/** @brief Set Run Sequence
+ *
+ * Set the run sequence from a string of step letters.  Z=Zero, S=Span,
+ * E=Equilibrate, A=Air, P=Purge.  The sequence is unchanged if any
+ * letter is unknown or the string is empty or too long.
+ *
+ * @param *seq Pointer to step letter string
+ *
+ * @return result
+ */
+ePCO2Status_t PCO2_SetSequence(const char *seq);
+
+/** @brief Set Calibration Policy On/Off
+ *
+ * Zero and span on their own cadence and reuse the Licor coefficients
+ * in between (ON=1), or zero and span every run (OFF=0).  Turning the
+ * policy on forces a zero and span on the next run.
+ *
+ * @param state Policy state (0=OFF, 1=ON)
+ *
+ * @return None
+ */
+void PCO2_SetCalPolicy(uint8_t state);
+
+/** @brief Apply Calibration Policy Setting
+ *
+ * Force a zero and span on the next run if pco2.calpol.enable was just
+ * turned on.  Parameter registry hook.
+ *
+ * @param prev Previous setting
+ *
+ * @return None
+ */
+void PCO2_ApplyCalPolicy(float prev);
+
+/** @brief Set Zero Cadence
+ *
+ * Zero the Licor every N runs
+ *
+ * @param runs Runs between zeros (1 or more)
+ *
+ * @return None
+ */
+void PCO2_SetCalZeroRuns(uint16_t runs);
+
+/** @brief Set Span Cadence
+ *
+ * Span the Licor every M runs
+ *
+ * @param runs Runs between spans (1 or more)
+ *
+ * @return None
+ */
+void PCO2_SetCalSpanRuns(uint16_t runs);
+
+/** @brief Set Span Interval
+ *
+ * Span the Licor at least every T hours, regardless of run count.
+ * Set to 0 to span on run count only.
+ *
+ * @param hours Interval (hours, max PCO2_CALPOL_MAX_HOURS)
+ *
+ * @return None
+ */
+void PCO2_SetCalSpanHours(uint16_t hours);
+
+/** @brief Set Span Error Limit
+ *
+ * Force a zero and span on the next run if the span off CO2 differs
+ * from the span gas by more than this.  Set to 0 to ignore.
+ *
+ * @param ppm Error limit (ppm)
+ *
+ * @return None
+ */
+void PCO2_SetCalSpanErr(float ppm);
+
+/** @brief Set Cell Temperature Limit
+ *
+ * Force a zero and span if the Licor cell temperature has moved by
+ * more than this since the last span.  Set to 0 to ignore.
+ *
+ * @param degc Temperature change (degC)
+ *
+ * @return None
+ */
+void PCO2_SetCalTemp(float degc);
+
 /** @brief Schedule O2 Calibration Time
  *
  * Schedule the O2 calibration time
@@ -950,6 +1484,17 @@ void PCO2_Get_sdata(void);
 
 void PCO2_Get_idata(void);
 
+/** @brief Pack idata for Iridium
+ *
+ * The last run's summary as one binary SBD message (layout in sbd.h).
+ *
+ * @param *buf Message out
+ * @param len Size of buf
+ *
+ * @return Bytes packed, 0 if buf is too small
+ */
+uint16_t PCO2_Pack_idata(uint8_t *buf, uint16_t len);
+
 void PCO2_Set_mconfig(bool val);
 void PCO2_Set_ssct(float val);
 void PCO2_Set_sscsc(float val);
@@ -0,0 +1,166 @@
+/** @file ringbuf.h
+ *  @brief Generic single producer / single consumer ring buffer
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note RINGBUF_DECLARE(name, type, size) generates the struct s<name>_t
+ *  @note and static inline <name>_Clear/Put/Get/Count/Free/Write/Read.
+ *  @note size must be a power of two no larger than 32768.  The read and
+ *  @note write indexes run free and are masked on access, so the full
+ *  @note size is usable and no size field has to be kept up to date.
+ *  @note
+ *  @note Concurrency: one producer (Put/Write) and one consumer
+ *  @note (Get/Read) may run at the same time, e.g. an ISR and the main
+ *  @note loop, without disabling interrupts.  Only the producer writes
+ *  @note the write index and only the consumer writes the read index.
+ *  @note Data is stored before the write index is published and read
+ *  @note before the read index is released.  Clear is only safe while
+ *  @note the other side is idle.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _RINGBUF_H
+#define _RINGBUF_H
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+/** Compiler (and on a host, CPU) ordering point between data and index */
+#if defined(UNIT_TESTING) && defined(__GNUC__)
+#define RINGBUF_BARRIER() __sync_synchronize()
+#elif defined(__GNUC__)
+#define RINGBUF_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define RINGBUF_BARRIER()
+#endif
+
+/** Bulk copies use memcpy where the barrier is available, otherwise */
+/** an element loop through the volatile buffer keeps the ordering */
+#if defined(__GNUC__)
+#define RINGBUF_COPY(dst, src, n, type) memcpy((void *)(dst), (const void *)(src), (n) * sizeof(type))
+#else
+#define RINGBUF_COPY(dst, src, n, type)                                           \
+    do                                                                            \
+    {                                                                             \
+        uint16_t _i;                                                              \
+        for (_i = 0; _i < (n); _i++)                                              \
+        {                                                                         \
+            ((volatile type *)(dst))[_i] = ((const volatile type *)(src))[_i];   \
+        }                                                                         \
+    } while (0)
+#endif
+
+#define RINGBUF_DECLARE(name, type, size)                                         \
+    typedef char name##_size_must_be_power_of_two                                 \
+        [((((size) & ((size) - 1)) == 0) && ((size) <= 32768u)) ? 1 : -1];       \
+                                                                                  \
+    typedef struct                                                                \
+    {                                                                             \
+        volatile uint16_t write;       /**< Write index (producer only) */        \
+        volatile uint16_t read;        /**< Read index (consumer only) */         \
+        volatile type buffer[(size)];  /**< Data */                               \
+    } s##name##_t;                                                                \
+                                                                                  \
+    static inline void name##_Clear(s##name##_t *rb)                              \
+    {                                                                             \
+        rb->read = 0u;                                                            \
+        rb->write = 0u;                                                           \
+    }                                                                             \
+                                                                                  \
+    static inline uint16_t name##_Count(const s##name##_t *rb)                    \
+    {                                                                             \
+        return (uint16_t)(rb->write - rb->read);                                  \
+    }                                                                             \
+                                                                                  \
+    static inline uint16_t name##_Free(const s##name##_t *rb)                     \
+    {                                                                             \
+        return (uint16_t)((size) - (uint16_t)(rb->write - rb->read));             \
+    }                                                                             \
+                                                                                  \
+    static inline bool name##_Put(s##name##_t *rb, type val)                      \
+    {                                                                             \
+        uint16_t w = rb->write;                                                   \
+        if ((uint16_t)(w - rb->read) >= (size))                                   \
+        {                                                                         \
+            return false;                                                         \
+        }                                                                         \
+        rb->buffer[w & ((size) - 1u)] = val;                                      \
+        RINGBUF_BARRIER();                                                        \
+        rb->write = (uint16_t)(w + 1u);                                           \
+        return true;                                                              \
+    }                                                                             \
+                                                                                  \
+    static inline bool name##_Get(s##name##_t *rb, type *val)                     \
+    {                                                                             \
+        uint16_t r = rb->read;                                                    \
+        if (r == rb->write)                                                       \
+        {                                                                         \
+            return false;                                                         \
+        }                                                                         \
+        RINGBUF_BARRIER();                                                        \
+        *val = rb->buffer[r & ((size) - 1u)];                                     \
+        RINGBUF_BARRIER();                                                        \
+        rb->read = (uint16_t)(r + 1u);                                            \
+        return true;                                                              \
+    }                                                                             \
+                                                                                  \
+    static inline uint16_t name##_Write(s##name##_t *rb, const type *src,         \
+                                        uint16_t len)                             \
+    {                                                                             \
+        uint16_t w = rb->write;                                                   \
+        uint16_t idx = w & ((size) - 1u);                                         \
+        uint16_t space = (uint16_t)((size) - (uint16_t)(w - rb->read));           \
+        uint16_t first;                                                           \
+        if (len > space)                                                          \
+        {                                                                         \
+            len = space;                                                          \
+        }                                                                         \
+        first = (uint16_t)((size) - idx);                                         \
+        if (first > len)                                                          \
+        {                                                                         \
+            first = len;                                                          \
+        }                                                                         \
+        RINGBUF_COPY(&rb->buffer[idx], src, first, type);                         \
+        RINGBUF_COPY(&rb->buffer[0], &src[first], len - first, type);             \
+        RINGBUF_BARRIER();                                                        \
+        rb->write = (uint16_t)(w + len);                                          \
+        return len;                                                               \
+    }                                                                             \
+                                                                                  \
+    static inline uint16_t name##_Read(s##name##_t *rb, type *dst, uint16_t len)  \
+    {                                                                             \
+        uint16_t r = rb->read;                                                    \
+        uint16_t idx = r & ((size) - 1u);                                         \
+        uint16_t avail = (uint16_t)(rb->write - r);                               \
+        uint16_t first;                                                           \
+        if (len > avail)                                                          \
+        {                                                                         \
+            len = avail;                                                          \
+        }                                                                         \
+        first = (uint16_t)((size) - idx);                                         \
+        if (first > len)                                                          \
+        {                                                                         \
+            first = len;                                                          \
+        }                                                                         \
+        RINGBUF_BARRIER();                                                        \
+        RINGBUF_COPY(dst, &rb->buffer[idx], first, type);                         \
+        RINGBUF_COPY(&dst[first], &rb->buffer[0], len - first, type);             \
+        RINGBUF_BARRIER();                                                        \
+        rb->read = (uint16_t)(r + len);                                           \
+        return len;                                                               \
+    }
+
+#endif // _RINGBUF_H
@@ -0,0 +1,236 @@
+/** @file sbd.c
+ *  @brief Binary Iridium SBD packing of the idata summary
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *  @bug  No known bugs
+ */
+#include "sbd.h"
+#include "crc.h"
+
+/************************************************************************
+ *					   Static Functions Prototypes
+ ************************************************************************/
+STATIC uint8_t *SBD_PutMode(uint8_t *p, const sPCO2_idata_mode_t *mode);
+STATIC uint8_t *SBD_PutRaw(uint8_t *p, uint32_t val, uint8_t bytes);
+STATIC uint8_t *SBD_PutU(uint8_t *p, float val, float lsb, uint8_t bytes);
+STATIC uint8_t *SBD_PutI(uint8_t *p, float val, float lsb, uint8_t bytes);
+STATIC uint8_t *SBD_PutF32(uint8_t *p, float val);
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+uint16_t SBD_Pack(const sPCO2_idata_t *idata, uint16_t run, uint32_t epoch,
+                  uint8_t *buf, uint16_t len)
+{
+  /** Same order as the ASCII idata */
+  const sPCO2_idata_mode_t *const modes[SBD_MODES] = {
+      &idata->ZPON, &idata->ZPOFF, &idata->ZPPCAL,
+      &idata->SPON, &idata->SPOFF, &idata->SPPCAL,
+      &idata->EPON, &idata->EPOFF, &idata->APON, &idata->APOFF};
+  uint8_t *p = buf;
+  uint8_t flags = 0;
+  uint8_t m;
+
+  if (len < SBD_LEN)
+  {
+    return 0;
+  }
+
+  /** Header */
+  if (true == idata->CAL.zero)
+  {
+    flags |= SBD_FLAG_ZERO;
+  }
+  if (true == idata->CAL.span)
+  {
+    flags |= SBD_FLAG_SPAN;
+  }
+  if (true == idata->EQUIL.detected)
+  {
+    flags |= SBD_FLAG_EQUIL;
+  }
+  p = SBD_PutRaw(p, SBD_VERSION, 1);
+  p = SBD_PutRaw(p, run, 2);
+  p = SBD_PutRaw(p, epoch, 4);
+  p = SBD_PutRaw(p, flags, 1);
+
+  /** Modes */
+  for (m = 0; m < SBD_MODES; m++)
+  {
+    p = SBD_PutMode(p, modes[m]);
+  }
+
+  /** Trailer */
+  p = SBD_PutF32(p, idata->COEFF.co2kzero);
+  p = SBD_PutF32(p, idata->COEFF.co2kspan);
+  p = SBD_PutF32(p, idata->COEFF.co2kspan2);
+  p = SBD_PutU(p, idata->sw_xco2, 0.001f, 3);
+  p = SBD_PutU(p, idata->air_xco2, 0.001f, 3);
+  p = SBD_PutRaw(p, CRC_Calc((char *)buf, (uint32_t)(p - buf)), 2);
+
+  return (uint16_t)(p - buf);
+}
+
+/************************************************************************
+ *					   Static Functions
+ ************************************************************************/
+/** @brief Pack Mode
+ *
+ *  @param *p Write position
+ *  @param *mode Mode summary
+ *
+ *  @return Next write position
+ */
+STATIC uint8_t *SBD_PutMode(uint8_t *p, const sPCO2_idata_mode_t *mode)
+{
+  uint32_t n = mode->co2.numSamples;
+
+  if (n > 0x7Fu)
+  {
+    n = 0x7Fu;
+  }
+  if (true == mode->converged)
+  {
+    n |= SBD_CONVERGED;
+  }
+
+  p = SBD_PutRaw(p, n, 1);
+  p = SBD_PutI(p, mode->temperature.mean, 0.01f, 2);
+  p = SBD_PutU(p, mode->temperature.std, 0.01f, 1);
+  p = SBD_PutU(p, mode->pressure.mean, 0.01f, 2);
+  p = SBD_PutU(p, mode->pressure.std, 0.01f, 1);
+  p = SBD_PutI(p, mode->co2.mean, 0.001f, 3);
+  p = SBD_PutU(p, mode->co2.std, 0.001f, 2);
+  p = SBD_PutU(p, mode->o2.mean, 0.001f, 2);
+  p = SBD_PutU(p, mode->o2.std, 0.01f, 1);
+  p = SBD_PutU(p, mode->rh.mean, 0.01f, 2);
+  p = SBD_PutU(p, mode->rh.std, 0.01f, 1);
+  p = SBD_PutI(p, mode->rh_temperature.mean, 0.01f, 2);
+  p = SBD_PutU(p, mode->rh_temperature.std, 0.01f, 1);
+  p = SBD_PutU(p, mode->raw1.mean, 1.0f, 3);
+  p = SBD_PutU(p, mode->raw1.std, 1.0f, 2);
+  p = SBD_PutU(p, mode->raw2.mean, 1.0f, 3);
+  p = SBD_PutU(p, mode->raw2.std, 1.0f, 2);
+
+  return p;
+}
+
+/** @brief Put Integer
+ *
+ *  @param *p Write position
+ *  @param val Value
+ *  @param bytes Field width, most significant byte first
+ *
+ *  @return Next write position
+ */
+STATIC uint8_t *SBD_PutRaw(uint8_t *p, uint32_t val, uint8_t bytes)
+{
+  while (bytes > 0u)
+  {
+    bytes--;
+    *p++ = (uint8_t)(val >> (8u * bytes));
+  }
+
+  return p;
+}
+
+/** @brief Put Scaled Unsigned
+ *
+ *  Rounded and clamped to one below all ones.  NaN is all ones.
+ *
+ *  @param *p Write position
+ *  @param val Value
+ *  @param lsb Value of one count
+ *  @param bytes Field width (1 to 3)
+ *
+ *  @return Next write position
+ */
+STATIC uint8_t *SBD_PutU(uint8_t *p, float val, float lsb, uint8_t bytes)
+{
+  uint32_t nodata = (1UL << (8u * bytes)) - 1u;
+  float x = (val / lsb) + 0.5f;
+  uint32_t counts;
+
+  if (isnan(val))
+  {
+    counts = nodata;
+  }
+  else if (x < 1.0f)
+  {
+    counts = 0;
+  }
+  else if (x >= (float)nodata)
+  {
+    counts = nodata - 1u;
+  }
+  else
+  {
+    counts = (uint32_t)x;
+  }
+
+  return SBD_PutRaw(p, counts, bytes);
+}
+
+/** @brief Put Scaled Signed
+ *
+ *  Two's complement, rounded and clamped to +-(2^(8 * bytes - 1) - 1).
+ *  NaN is the most negative value (0x8000, 0x800000).
+ *
+ *  @param *p Write position
+ *  @param val Value
+ *  @param lsb Value of one count
+ *  @param bytes Field width (2 or 3)
+ *
+ *  @return Next write position
+ */
+STATIC uint8_t *SBD_PutI(uint8_t *p, float val, float lsb, uint8_t bytes)
+{
+  int32_t max = (int32_t)((1UL << ((8u * bytes) - 1u)) - 1u);
+  float x = val / lsb;
+  int32_t counts;
+
+  if (isnan(val))
+  {
+    counts = -max - 1;
+  }
+  else
+  {
+    x += (x < 0.0f) ? -0.5f : 0.5f;
+    if (x <= (float)-max)
+    {
+      counts = -max;
+    }
+    else if (x >= (float)max)
+    {
+      counts = max;
+    }
+    else
+    {
+      counts = (int32_t)x;
+    }
+  }
+
+  return SBD_PutRaw(p, (uint32_t)counts, bytes);
+}
+
+/** @brief Put Float
+ *
+ *  @param *p Write position
+ *  @param val Value
+ *
+ *  @return Next write position
+ */
+STATIC uint8_t *SBD_PutF32(uint8_t *p, float val)
+{
+  uint32_t bits;
+
+  memcpy(&bits, &val, sizeof(bits));
+  return SBD_PutRaw(p, bits, 4);
+}
@@ -0,0 +1,102 @@
+/** @file sbd.h
+ *  @brief Binary Iridium SBD packing of the idata summary
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note One full cycle in SBD_LEN bytes, inside the 340 byte SBD MO
+ *  @note limit.  The ASCII idata is ~2.4k.  All fields are big endian
+ *  @note scaled integers except the Licor coefficients (IEEE float).
+ *  @note
+ *  @note  Header   version u8, run u16, epoch u32, flags u8
+ *  @note  Mode x10 (idata order ZPON..APOFF)
+ *  @note           n u8 (bit 7 converged, 0-127 samples)
+ *  @note           cell temp i16 0.01C,  sd u8 0.01C
+ *  @note           cell pres u16 0.01kPa, sd u8 0.01kPa
+ *  @note           co2 i24 0.001ppm,     sd u16 0.001ppm
+ *  @note           o2 u16 0.001%,        sd u8 0.01%
+ *  @note           rh u16 0.01%,         sd u8 0.01%
+ *  @note           rh temp i16 0.01C,    sd u8 0.01C
+ *  @note           raw1 u24 counts,      sd u16 counts
+ *  @note           raw2 u24 counts,      sd u16 counts
+ *  @note  Trailer  co2kzero, co2kspan, co2kspan2 f32,
+ *  @note           sw xco2 u24 0.001ppm, air xco2 u24 0.001ppm,
+ *  @note           CRC16 (XMODEM) of all bytes before it
+ *  @note
+ *  @note No value (NaN) is all ones unsigned, 0x8000 / 0x800000 signed.
+ *  @note Values out of range are clamped.  Change SBD_VERSION with the
+ *  @note layout.  Version 2: co2 is signed, zero gas can read below 0.
+ *  @note test/sbd_decode.c is the reference decoder.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _SBD_H
+#define _SBD_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************************************************
+ *							HEADER FILES
+ ************************************************************************/
+#include "pco2.h"
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+#define SBD_VERSION (2u)         /**< Layout version */
+#define SBD_MODES (10)           /**< Modes packed */
+#define SBD_HEADER_LEN (8)       /**< Header bytes */
+#define SBD_MODE_LEN (31)        /**< Bytes per mode */
+#define SBD_TRAILER_LEN (20)     /**< Trailer bytes, CRC included */
+#define SBD_LEN (SBD_HEADER_LEN + (SBD_MODES * SBD_MODE_LEN) + SBD_TRAILER_LEN)
+#define SBD_MO_MAX (340)         /**< Iridium SBD MO message limit */
+
+#define SBD_FLAG_ZERO (0x01u)    /**< Zero run this cycle */
+#define SBD_FLAG_SPAN (0x02u)    /**< Span run this cycle */
+#define SBD_FLAG_EQUIL (0x04u)   /**< Equil slope end point found */
+#define SBD_CONVERGED (0x80u)    /**< Mode n byte: ended on convergence */
+
+/************************************************************************
+ *					    Function Prototypes
+ ************************************************************************/
+/** @brief Pack idata
+ *
+ *  @param *idata Run summary
+ *  @param run Run number
+ *  @param epoch Run start time
+ *  @param *buf Message out
+ *  @param len Size of buf
+ *
+ *  @return Bytes packed (SBD_LEN), 0 if buf is too small
+ */
+uint16_t SBD_Pack(const sPCO2_idata_t *idata, uint16_t run, uint32_t epoch,
+                  uint8_t *buf, uint16_t len);
+
+#endif // _SBD_H
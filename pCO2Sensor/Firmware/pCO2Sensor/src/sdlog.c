@@ -0,0 +1,293 @@
+/** @file sdlog.c
+ *  @brief Persistent multi-run sdata history
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *  @bug  No known bugs
+ */
+#include "sdlog.h"
+#include "crc.h"
+#include "statistics.h"
+
+/************************************************************************
+ *					        Static Variables
+ ************************************************************************/
+/** Same order and names as the sdata dump */
+STATIC const char *const SDLOG_Modes[SDLOG_MODES] = {
+    "ZPON", "ZPOFF", "ZPPCAL", "SPON", "SPOFF",
+    "SPPCAL", "EPON", "EPOFF", "APON", "APOFF"};
+
+/************************************************************************
+ *					        Global Variables
+ ************************************************************************/
+PERSISTENT sSdLog_t SdataLog = {.head = 0, .count = 0};
+
+/************************************************************************
+ *					   Static Functions Prototypes
+ ************************************************************************/
+STATIC void SDLOG_Check(sSdLog_t *log);
+STATIC uint16_t SDLOG_Crc(const sSdLogRecord_t *rec);
+STATIC float SDLOG_Mean(const float *x, uint16_t n, float *sd);
+STATIC uint16_t SDLOG_ScaleU16(float val, float lsb);
+STATIC int16_t SDLOG_ScaleI16(float val, float lsb);
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+const char *SDLOG_ModeName(uint8_t mode)
+{
+  return (mode < SDLOG_MODES) ? SDLOG_Modes[mode] : "FAIL";
+}
+
+void SDLOG_Clear(sSdLog_t *log)
+{
+  log->head = 0;
+  log->count = 0;
+}
+
+sSdLogRecord_t *SDLOG_Next(sSdLog_t *log)
+{
+  sSdLogRecord_t *rec;
+
+  SDLOG_Check(log);
+
+  /** The slot at head is the oldest when full */
+  if (log->count >= SDLOG_SIZE)
+  {
+    log->count = SDLOG_SIZE - 1u;
+  }
+
+  rec = &log->rec[log->head];
+  memset(rec, 0, sizeof(sSdLogRecord_t));
+  return rec;
+}
+
+void SDLOG_SetMode(sSdLogMode_t *mode, const float *co2, const float *temp,
+                   const float *pres, const float *rh, const float *rh_temp,
+                   const float *o2, uint16_t n)
+{
+  sSdLogSample_t *s;
+  uint16_t i;
+  uint16_t j;
+  float sd;
+
+  mode->n = n;
+  mode->co2 = SDLOG_Mean(co2, n, &mode->co2_sd);
+  mode->temp = SDLOG_Mean(temp, n, &sd);
+  mode->pres = SDLOG_Mean(pres, n, &sd);
+  mode->rh = SDLOG_Mean(rh, n, &sd);
+  mode->rh_temp = SDLOG_Mean(rh_temp, n, &sd);
+  mode->o2 = SDLOG_Mean(o2, n, &sd);
+
+  /** Evenly spaced, first sample always kept */
+  mode->kept = (n < SDLOG_SAMPLES) ? n : SDLOG_SAMPLES;
+  for (i = 0; i < mode->kept; i++)
+  {
+    j = (uint16_t)(((uint32_t)i * n) / mode->kept);
+    s = &mode->sample[i];
+    s->co2 = SDLOG_ScaleU16(co2[j], 0.1f);
+    s->temp = SDLOG_ScaleI16(temp[j], 0.01f);
+    s->pres = SDLOG_ScaleU16(pres[j], 0.01f);
+    s->rh = SDLOG_ScaleU16(rh[j], 0.01f);
+  }
+}
+
+void SDLOG_Commit(sSdLog_t *log, uint16_t run, uint32_t epoch)
+{
+  sSdLogRecord_t *rec;
+
+  SDLOG_Check(log);
+
+  rec = &log->rec[log->head];
+  rec->run = run;
+  rec->epoch = epoch;
+  rec->rsvd = 0;
+  rec->crc = SDLOG_Crc(rec);
+
+  log->head = (log->head + 1u) % SDLOG_SIZE;
+  if (log->count < SDLOG_SIZE)
+  {
+    log->count++;
+  }
+}
+
+uint16_t SDLOG_Count(sSdLog_t *log)
+{
+  SDLOG_Check(log);
+  return log->count;
+}
+
+const sSdLogRecord_t *SDLOG_Get(sSdLog_t *log, uint16_t idx)
+{
+  SDLOG_Check(log);
+
+  if (idx >= log->count)
+  {
+    return NULL;
+  }
+
+  return &log->rec[(log->head + SDLOG_SIZE - log->count + idx) % SDLOG_SIZE];
+}
+
+bool SDLOG_FindRun(sSdLog_t *log, uint16_t run, uint16_t *idx)
+{
+  uint16_t i;
+
+  for (i = 0; i < SDLOG_Count(log); i++)
+  {
+    if ((int16_t)(SDLOG_Get(log, i)->run - run) >= 0)
+    {
+      *idx = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool SDLOG_FindEpoch(sSdLog_t *log, uint32_t epoch, uint16_t *idx)
+{
+  uint16_t i;
+
+  for (i = 0; i < SDLOG_Count(log); i++)
+  {
+    if (SDLOG_Get(log, i)->epoch >= epoch)
+    {
+      *idx = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool SDLOG_Valid(const sSdLogRecord_t *rec)
+{
+  return (rec->crc == SDLOG_Crc(rec));
+}
+
+/************************************************************************
+ *					   Static Functions
+ ************************************************************************/
+/** @brief Check History
+ *
+ *  FRAM keeps whatever was there.  Clear it if it makes no sense.
+ *
+ *  @param *log History
+ *
+ *  @return None
+ */
+STATIC void SDLOG_Check(sSdLog_t *log)
+{
+  if ((log->head >= SDLOG_SIZE) || (log->count > SDLOG_SIZE))
+  {
+    SDLOG_Clear(log);
+  }
+}
+
+/** @brief Record CRC
+ *
+ *  @param *rec Record
+ *
+ *  @return CRC of the record up to the crc field
+ */
+STATIC uint16_t SDLOG_Crc(const sSdLogRecord_t *rec)
+{
+  return CRC_Calc((char *)rec, offsetof(sSdLogRecord_t, crc));
+}
+
+/** @brief Mean and Standard Deviation
+ *
+ *  @param *x Values
+ *  @param n Number of values
+ *  @param *sd Standard deviation out
+ *
+ *  @return Mean, NAN for no values
+ */
+STATIC float SDLOG_Mean(const float *x, uint16_t n, float *sd)
+{
+  sStats_F_t stats;
+  uint16_t i;
+
+  if (0u == n)
+  {
+    *sd = NAN;
+    return NAN;
+  }
+
+  STATS_Clear(&stats);
+  for (i = 0; i < n; i++)
+  {
+    STATS_Add(&stats, x[i]);
+  }
+  STATS_Compute(&stats);
+
+  *sd = stats.std;
+  return stats.mean;
+}
+
+/** @brief Scale to Unsigned
+ *
+ *  Rounded and clamped.  NaN is SDLOG_NODATA_U16.
+ *
+ *  @param val Value
+ *  @param lsb Value of one count
+ *
+ *  @return Counts
+ */
+STATIC uint16_t SDLOG_ScaleU16(float val, float lsb)
+{
+  float x = (val / lsb) + 0.5f;
+
+  if (isnan(val))
+  {
+    return SDLOG_NODATA_U16;
+  }
+  if (x < 0.0f)
+  {
+    return 0u;
+  }
+  if (x > (float)(SDLOG_NODATA_U16 - 1u))
+  {
+    return SDLOG_NODATA_U16 - 1u;
+  }
+
+  return (uint16_t)x;
+}
+
+/** @brief Scale to Signed
+ *
+ *  Rounded and clamped.  NaN is SDLOG_NODATA_I16.
+ *
+ *  @param val Value
+ *  @param lsb Value of one count
+ *
+ *  @return Counts
+ */
+STATIC int16_t SDLOG_ScaleI16(float val, float lsb)
+{
+  float x = val / lsb;
+
+  if (isnan(val))
+  {
+    return SDLOG_NODATA_I16;
+  }
+
+  x += (x < 0.0f) ? -0.5f : 0.5f;
+  if (x < -32767.0f)
+  {
+    return -32767;
+  }
+  if (x > 32767.0f)
+  {
+    return 32767;
+  }
+
+  return (int16_t)x;
+}
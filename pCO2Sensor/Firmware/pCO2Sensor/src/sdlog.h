@@ -0,0 +1,231 @@
+/** @file sdlog.h
+ *  @brief Persistent multi-run sdata history
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note The last SDLOG_SIZE runs are kept in a FRAM ring.  Each record
+ *  @note holds the run number and start epoch, a summary of every mode
+ *  @note and up to SDLOG_SAMPLES evenly spaced raw samples per mode in
+ *  @note scaled integers.  A full sPCO2_sdata_t is ~67k, a record ~2.2k.
+ *  @note
+ *  @note A record is filled in place, then SDLOG_Commit adds the CRC
+ *  @note (XMODEM CRC16) and moves head and count.  A reset part way
+ *  @note through filling loses that run (and the oldest, if full).
+ *  @note Head or count out of range clears the ring, a bad CRC is
+ *  @note reported by SDLOG_Valid.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _SDLOG_H
+#define _SDLOG_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+#define SDLOG_SIZE (16)          /**< Runs kept */
+#define SDLOG_MODES (10)         /**< Modes in a run, sdata order */
+#define SDLOG_SAMPLES (24)       /**< Raw samples kept per mode */
+#define SDLOG_NODATA_U16 (0xFFFFu)  /**< Unsigned sample with no value */
+#define SDLOG_NODATA_I16 (-32768)   /**< Signed sample with no value */
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
+/**
+ * @struct Raw Sample
+ */
+typedef struct
+{
+  uint16_t co2;  /**< Licor CO2 (0.1 ppm) */
+  int16_t temp;  /**< Licor cell temperature (0.01 degC) */
+  uint16_t pres; /**< Licor cell pressure (0.01 kPa) */
+  uint16_t rh;   /**< RH (0.01 %) */
+} sSdLogSample_t;
+
+/**
+ * @struct Mode Summary
+ */
+typedef struct
+{
+  float co2;                             /**< Mean CO2 (ppm) */
+  float co2_sd;                          /**< CO2 standard deviation (ppm) */
+  float temp;                            /**< Mean cell temperature (degC) */
+  float pres;                            /**< Mean cell pressure (kPa) */
+  float rh;                              /**< Mean RH (%) */
+  float rh_temp;                         /**< Mean RH temperature (degC) */
+  float o2;                              /**< Mean O2 (%) */
+  uint16_t n;                            /**< Samples taken */
+  uint16_t kept;                         /**< Samples in sample[] */
+  sSdLogSample_t sample[SDLOG_SAMPLES];  /**< Evenly spaced raw samples */
+} sSdLogMode_t;
+
+/**
+ * @struct Run Record
+ */
+typedef struct
+{
+  uint32_t epoch;                   /**< RTC time the run started (seconds) */
+  uint16_t run;                     /**< Run number (as the error history) */
+  uint16_t rsvd;                    /**< Zero */
+  float sw_xco2;                    /**< Seawater dry CO2 (ppm) */
+  float air_xco2;                   /**< Air dry CO2 (ppm) */
+  sSdLogMode_t mode[SDLOG_MODES];   /**< Modes, sdata order */
+  uint16_t crc;                     /**< CRC of everything above */
+} sSdLogRecord_t;
+
+/**
+ * @struct Run History
+ */
+typedef struct
+{
+  uint16_t head;                       /**< Next record to write */
+  uint16_t count;                      /**< Records held */
+  sSdLogRecord_t rec[SDLOG_SIZE];      /**< Records */
+} sSdLog_t;
+
+/************************************************************************
+ *				Externs
+ ************************************************************************/
+extern PERSISTENT sSdLog_t SdataLog;
+
+/************************************************************************
+ *					    Function Prototypes
+ ************************************************************************/
+/** @brief Mode Name
+ *
+ *  @param mode Mode index (sdata order)
+ *
+ *  @return "ZPON" ... "APOFF", "FAIL" past the end
+ */
+const char *SDLOG_ModeName(uint8_t mode);
+
+/** @brief Clear History
+ *
+ *  @param *log History
+ *
+ *  @return None
+ */
+void SDLOG_Clear(sSdLog_t *log);
+
+/** @brief Next Record
+ *
+ *  Zeroes and returns the record the next commit will add.  When the
+ *  ring is full the oldest record is dropped first.
+ *
+ *  @param *log History
+ *
+ *  @return Record to fill
+ */
+sSdLogRecord_t *SDLOG_Next(sSdLog_t *log);
+
+/** @brief Fill Mode
+ *
+ *  Summarise n samples and keep up to SDLOG_SAMPLES evenly spaced ones.
+ *
+ *  @param *mode Mode in the record from SDLOG_Next
+ *  @param *co2 CO2 (ppm)
+ *  @param *temp Cell temperature (degC)
+ *  @param *pres Cell pressure (kPa)
+ *  @param *rh RH (%)
+ *  @param *rh_temp RH temperature (degC)
+ *  @param *o2 O2 (%)
+ *  @param n Samples
+ *
+ *  @return None
+ */
+void SDLOG_SetMode(sSdLogMode_t *mode, const float *co2, const float *temp,
+                   const float *pres, const float *rh, const float *rh_temp,
+                   const float *o2, uint16_t n);
+
+/** @brief Commit Record
+ *
+ *  Stamp and CRC the record from SDLOG_Next, then add it to the ring.
+ *
+ *  @param *log History
+ *  @param run Run number
+ *  @param epoch Run start time
+ *
+ *  @return None
+ */
+void SDLOG_Commit(sSdLog_t *log, uint16_t run, uint32_t epoch);
+
+/** @brief Records Held
+ *
+ *  @param *log History
+ *
+ *  @return Number of records
+ */
+uint16_t SDLOG_Count(sSdLog_t *log);
+
+/** @brief Get Record
+ *
+ *  @param *log History
+ *  @param idx 0 = oldest
+ *
+ *  @return Record, NULL if idx is not held
+ */
+const sSdLogRecord_t *SDLOG_Get(sSdLog_t *log, uint16_t idx);
+
+/** @brief Find Run
+ *
+ *  Run numbers wrap, so "at or after" is within half the range.
+ *
+ *  @param *log History
+ *  @param run Run number
+ *  @param *idx Index of the first record at or after run
+ *
+ *  @return true if found
+ */
+bool SDLOG_FindRun(sSdLog_t *log, uint16_t run, uint16_t *idx);
+
+/** @brief Find Time
+ *
+ *  @param *log History
+ *  @param epoch RTC time
+ *  @param *idx Index of the first record started at or after epoch
+ *
+ *  @return true if found
+ */
+bool SDLOG_FindEpoch(sSdLog_t *log, uint32_t epoch, uint16_t *idx);
+
+/** @brief Check Record CRC
+ *
+ *  @param *rec Record
+ *
+ *  @return true if the CRC matches
+ */
+bool SDLOG_Valid(const sSdLogRecord_t *rec);
+
+#endif // _SDLOG_H
@@ -50,6 +50,12 @@ PERSISTENT sSHT3X_t SHT35 = {
 #endif
 
 #define POLYNOMIAL (0x131) /** P(x) = x^8 + x^5 + x^4 + 1 = 100110001 */
+
+STATIC uint8_t SHT3X_MeasCmd[2];                                             /**< Queued measurement command */
+STATIC uint8_t SHT3X_MeasData[6];                                            /**< Queued measurement T, CRC, RH, CRC */
+STATIC sI2CQDone_t SHT3X_MeasDone = {.busy = false, .result = I2CQ_PENDING}; /**< Queued read completion */
+STATIC etRepeatability SHT3X_MeasRepeat = REPEATAB_HIGH;                     /**< Repeatability of the queued measurement */
+STATIC bool SHT3X_MeasStarted = false;                                       /**< Measurement command queued */
 /************************************************************************
  *			Static Functions
  ************************************************************************/
@@ -246,7 +252,7 @@ STATIC eSHTError_t SHT3X_Read4BytesAndCrcs(uint16_t *data,
   /** Read the two data bytes and one checksum byte */
   if (BSP_FAIL == BSP_I2C_gets(&SHT35.I2C, bytes, 6))
   {
-    Error(ERROR_MSG_00400200, LOG_Priority_High);
+    Error(ERROR_MSG_00400200, 0);
     return error;
   }
 
@@ -406,6 +412,8 @@ void SHT3X_Init(uint8_t i2cAddress)
   /** Initialize I2C */
   BSP_I2C_Init(&SHT35.I2C);
   SHT3X_SetI2CAddr(i2cAddress << 1);
+  I2CQ_Init(SHT35_I2C_QUEUE);
+  SHT3X_MeasStarted = false;
 
   /** Release Reset */
 #ifdef SHT3X_RESET_PIN
@@ -455,8 +463,8 @@ uint32_t SHT3X_ReadSerialNumber(void)
   }
   else
   {
-    Error("SHT35: Error Reading Serial Number", LOG_Priority_High);
-    Error("SHT35: Serial Number not set", LOG_Priority_High);
+    Error(ERROR_MSG_00400400, error);
+    Error(ERROR_MSG_00400800, 0);
   }
   return serialNumber;
 }
@@ -660,6 +668,107 @@ eSHTError_t SHT3X_GetTempAndHumidityPolling(float *temperature,
   return error;
 }
 
+/***********************************************************************/
+eSHTError_t SHT3X_Measure_Start(etRepeatability repeatability)
+{
+  sI2CQXfer_t xfer = {.addr = SHT35.I2C.slaveAddress >> 1,
+                      .tx = SHT3X_MeasCmd,
+                      .txLen = 2,
+                      .rx = NULL,
+                      .rxLen = 0,
+                      .done = NULL,
+                      .ctx = NULL};
+  uint16_t cmd;
+
+  switch (repeatability)
+  {
+  case REPEATAB_LOW:
+    cmd = CMD_MEAS_POLLING_L;
+    break;
+  case REPEATAB_MEDIUM:
+    cmd = CMD_MEAS_POLLING_M;
+    break;
+  case REPEATAB_HIGH:
+    cmd = CMD_MEAS_POLLING_H;
+    break;
+  default:
+    return SHT_PARAM_ERROR;
+  }
+
+  SHT3X_MeasCmd[0] = (uint8_t)(cmd >> 8);
+  SHT3X_MeasCmd[1] = (uint8_t)(cmd & 0x00FF);
+  SHT3X_MeasRepeat = repeatability;
+
+  SHT3X_MeasStarted = (I2CQ_OK == I2CQ_Submit(SHT35_I2C_QUEUE, &xfer));
+
+  return (true == SHT3X_MeasStarted) ? SHT_OK : SHT_FAIL;
+}
+
+/***********************************************************************/
+eSHTError_t SHT3X_Measure_Fetch(void)
+{
+  sI2CQXfer_t xfer = {.addr = SHT35.I2C.slaveAddress >> 1,
+                      .tx = NULL,
+                      .txLen = 0,
+                      .rx = SHT3X_MeasData,
+                      .rxLen = 6,
+                      .done = I2CQ_Done,
+                      .ctx = &SHT3X_MeasDone};
+
+  if ((false == SHT3X_MeasStarted) || (true == SHT3X_MeasDone.busy))
+  {
+    return SHT_FAIL;
+  }
+  SHT3X_MeasStarted = false;
+
+  SHT3X_MeasDone.busy = true;
+  SHT3X_MeasDone.result = I2CQ_PENDING;
+  if (I2CQ_OK != I2CQ_Submit(SHT35_I2C_QUEUE, &xfer))
+  {
+    SHT3X_MeasDone.busy = false;
+    return SHT_FAIL;
+  }
+
+  return SHT_OK;
+}
+
+/***********************************************************************/
+eSHTError_t SHT3X_Measure_Result(float *temperature, float *humidity)
+{
+  eSHTError_t error = SHT_FAIL;
+  eI2CQResult_t result;
+
+  result = I2CQ_Wait(SHT35_I2C_QUEUE, &SHT3X_MeasDone);
+  SHT3X_MeasDone.busy = false;
+  SHT3X_MeasDone.result = I2CQ_PENDING;
+
+  if (result == I2CQ_DONE)
+  {
+    error = SHT3X_CheckCrc(SHT3X_MeasData, 2, SHT3X_MeasData[2]);
+    error |= SHT3X_CheckCrc(&SHT3X_MeasData[3], 2, SHT3X_MeasData[5]);
+
+    if (error == SHT_OK)
+    {
+      *temperature = SHT3X_CalcTemperature((SHT3X_MeasData[0] << 8) + SHT3X_MeasData[1]);
+      *humidity = SHT3X_CalcHumidity((SHT3X_MeasData[3] << 8) + SHT3X_MeasData[4]);
+      return SHT_OK;
+    }
+  }
+
+  /** Not queued, not ready or corrupt.  Measure the slow way */
+  I2CQ_Flush(SHT35_I2C_QUEUE);
+  if (result != I2CQ_PENDING)
+  {
+    Error(ERROR_MSG_00400200, result);
+    if (result != I2CQ_DONE)
+    {
+      BSP_I2C_Fault(&SHT35.I2C, I2CQ_Fault(result));
+    }
+  }
+
+  return SHT3X_GetTempAndHumidity(temperature, humidity, SHT3X_MeasRepeat, MODE_POLLING, 10);
+}
+
 /***********************************************************************/
 eSHTError_t SHT3X_StartPeriodicMeasurement(etRepeatability repeatability,
                                            etFrequency frequency)
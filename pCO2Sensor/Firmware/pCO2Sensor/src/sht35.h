@@ -51,6 +51,7 @@
  ************************************************************************/
 #include "bsp.h"
 #include "logging.h"
+#include "i2cq.h"
 
 /************************************************************************
  *			Structs & Enums
@@ -203,6 +204,12 @@ typedef struct
   uint32_t serial_number; /**< SHT35 Serial Number */
 } sSHT3X_t;
 
+#ifdef UNIT_TESTING
+extern PERSISTENT sSHT3X_t SHT35;
+#endif
+
+extern sSHT3X_t SHT35;
+
 /************************************************************************
  *			Function Prototypes
  ************************************************************************/
@@ -325,6 +332,44 @@ eSHTError_t SHT3X_GetTempAndHumidityPolling(float *temperature,
                                             float *humidity,
                                             etRepeatability repeatability,
                                             uint8_t timeout);
+/** @brief Start Queued Measurement
+ *
+ * Queue the polling mode measurement command on the RH I2C queue and
+ * return.  The sensor needs up to 15ms (high repeatability) before the
+ * result can be fetched.
+ *
+ * @param repeatability Repeatability for the measurement (low, medium or high)
+ *
+ * @return eSHTError_t Error:     PARAM_ERROR = Bad repeatability
+ *                            FAIL = Queue full
+ *                            NO_ERROR  = No Error
+ */
+eSHTError_t SHT3X_Measure_Start(etRepeatability repeatability);
+/** @brief Fetch Queued Measurement
+ *
+ * Queue the read of the measurement started by SHT3X_Measure_Start.
+ *
+ * @param None
+ *
+ * @return eSHTError_t Error:     FAIL = Nothing started or queue full
+ *                            NO_ERROR  = No Error
+ */
+eSHTError_t SHT3X_Measure_Fetch(void);
+/** @brief Queued Measurement Result
+ *
+ * Wait for the read queued by SHT3X_Measure_Fetch and convert it.  If
+ * it was not queued, NACK'd or failed the CRC, a polling measurement is
+ * made instead.
+ *
+ * @param *temperature Pointer to temperature
+ * @param *humidity Pointer to humidity
+ *
+ * @return eSHTError_t Error:     ACK_ERROR = No Acknowledgement from sensor
+ *                            CHECKSUM_ERROR = Checksum Mismatch
+ *                            TIMEOUT_ERROR = Timeout
+ *                            NO_ERROR  = No Error
+ */
+eSHTError_t SHT3X_Measure_Result(float *temperature, float *humidity);
 /** @brief Start periodic measurement.
  *
  * Stats the SHT35 on periodic measurements.
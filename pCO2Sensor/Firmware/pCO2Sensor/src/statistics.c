@@ -67,6 +67,56 @@ void STATS_Compute(sStats_F_t *s)
   s->std = sqrt(var);
 }
 
+float STATS_SEM(const sStats_F_t *s)
+{
+  float n = (float)s->numSamples;
+
+  if (s->numSamples < 2u)
+  {
+    return INFINITY;
+  }
+
+  return sqrt(s->M2 / (n * (n - 1.0f)));
+}
+
+bool STATS_LinearFit(const float *x, const float *y, uint16_t n, float *slope, float *intercept)
+{
+  float xmean = 0.0f;
+  float ymean = 0.0f;
+  float sxx = 0.0f;
+  float sxy = 0.0f;
+  uint16_t i;
+
+  if (n < 2u)
+  {
+    return false;
+  }
+
+  /** Center the data first to keep the sums well conditioned in float */
+  for (i = 0; i < n; i++)
+  {
+    xmean += x[i];
+    ymean += y[i];
+  }
+  xmean /= n;
+  ymean /= n;
+
+  for (i = 0; i < n; i++)
+  {
+    sxx += (x[i] - xmean) * (x[i] - xmean);
+    sxy += (x[i] - xmean) * (y[i] - ymean);
+  }
+
+  if (sxx <= 0.0f)
+  {
+    return false;
+  }
+
+  *slope = sxy / sxx;
+  *intercept = ymean - (*slope * xmean);
+  return true;
+}
+
 void STATS_AddSample_I16(sStats_I16_t *var, int16_t newSample)
 {
 
@@ -39,6 +39,7 @@
  *						STANDARD LIBRARIES
  ************************************************************************/
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #ifndef UNIT_TESTING
 #include <stdlib.h>
@@ -228,4 +229,31 @@ void STATS_AddSample_I16(sStats_I16_t *var, int16_t newSample);
  */
 void STATS_Compute_I16(sStats_I16_t *s);
 
+/** @brief Standard Error of the Mean
+ *
+ *  Compute the standard error of the mean from the running (Welford)
+ *  sums without finalizing the struct.  Uses the sample variance
+ *  M2 / (n - 1), so at least two samples are required.
+ *
+ *  @param *s Pointer to the float struct
+ *
+ *  @return Standard error of the mean (INFINITY if fewer than 2 samples)
+ */
+float STATS_SEM(const sStats_F_t *s);
+
+/** @brief Least Squares Line Fit
+ *
+ *  Fit y = slope * x + intercept to n points.  Point order does not
+ *  matter, so the arrays may be used as a ring.
+ *
+ *  @param *x Pointer to the x values
+ *  @param *y Pointer to the y values
+ *  @param n Number of points
+ *  @param *slope Pointer to the fitted slope
+ *  @param *intercept Pointer to the fitted intercept
+ *
+ *  @return true if fit, false if fewer than 2 points or all x equal
+ */
+bool STATS_LinearFit(const float *x, const float *y, uint16_t n, float *slope, float *intercept);
+
 #endif // _STATISTICS_H
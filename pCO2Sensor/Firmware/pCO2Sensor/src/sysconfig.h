@@ -206,6 +206,49 @@
 #define DEFAULT_PCO2_SPAN2 (2000.0)
 #define DEFAULT_PCO2_SAMPLE_FREQ (2)
 
+/** Sample window convergence (early stop) */
+#define DEFAULT_PCO2_CONVERGE_ENABLE (0)
+#define DEFAULT_PCO2_CONVERGE_MIN_SAMPLES (20)
+#define DEFAULT_PCO2_CONVERGE_CO2_SEM (0.05)
+#define DEFAULT_PCO2_CONVERGE_PRES_SEM (0.0)
+
+/** Equilibration slope end point */
+#define DEFAULT_PCO2_EQSLOPE_ENABLE (0)
+#define DEFAULT_PCO2_EQSLOPE_MINIMUM (180)
+#define DEFAULT_PCO2_EQSLOPE_DWELL (60)
+#define DEFAULT_PCO2_EQSLOPE_RATE (0.5)
+#define PCO2_EQSLOPE_INTERVAL (5)
+#define PCO2_EQSLOPE_POINTS (12)
+
+/** Licor warmup stability check */
+#define DEFAULT_PCO2_LIWARM_ENABLE (0)
+#define DEFAULT_PCO2_LIWARM_TEMP_TOL (0.1)
+#define DEFAULT_PCO2_LIWARM_PRES_TOL (0.05)
+#define PCO2_LIWARM_INTERVAL (2)
+#define PCO2_LIWARM_POINTS (5)
+
+/** Overlap Licor warmup with the zero pump on */
+#define DEFAULT_PCO2_OVERLAP (0)
+
+/** Licor streams at the sample rate instead of being polled */
+#define DEFAULT_PCO2_STREAM (0)
+#define PCO2_STREAM_TICK_MS (125)
+
+/** Sample window statistics, Q31 count of the float channels */
+#define PCO2_VSTATS_LSB (0.0001f)
+
+/** Run sequence (PCO2_STEP_END terminated) */
+#define DEFAULT_PCO2_SEQUENCE {PCO2_STEP_ZERO, PCO2_STEP_SPAN, PCO2_STEP_EQUIL, PCO2_STEP_AIR, PCO2_STEP_END}
+
+/** Calibration cadence policy */
+#define DEFAULT_PCO2_CALPOL_ENABLE (0)
+#define DEFAULT_PCO2_CALPOL_ZERO_RUNS (2)
+#define DEFAULT_PCO2_CALPOL_SPAN_RUNS (4)
+#define DEFAULT_PCO2_CALPOL_SPAN_HOURS (24)
+#define DEFAULT_PCO2_CALPOL_SPAN_ERR (2.0)
+#define DEFAULT_PCO2_CALPOL_TEMP (1.0)
+#define PCO2_CALPOL_MAX_HOURS (720)
+
 /** Scheduler */
 //#define INCLUDE_SCHEDULER_COMMANDS
 
@@ -342,6 +385,16 @@
 #define SMCLK_SRC (CS_HFXTCLK_SELECT)
 #define SMCLK_FREQ (HFXT_FREQ / 1)
 
+/** Clock Profiles.  MCLK is divided down from HFXT per profile, SMCLK */
+/** stays at SMCLK_DIV so the UART/I2C/SPI dividers stay valid.  NORMAL */
+/** matches MCLK_DIV.  IDLE stays fast enough for the console UART ISR */
+#define CLK_IDLE_MCLK_DIV (CS_CLOCK_DIVIDER_4)
+#define CLK_IDLE_MCLK_DIVIDE (4)
+#define CLK_NORMAL_MCLK_DIV (MCLK_DIV)
+#define CLK_NORMAL_MCLK_DIVIDE (2)
+#define CLK_FULL_MCLK_DIV (CS_CLOCK_DIVIDER_1)
+#define CLK_FULL_MCLK_DIVIDE (1)
+
 /** Auxiliary Clock */
 #define ACLK_DIV (CS_CLOCK_DIVIDER_1)
 #define ACLK_SRC (CS_VLOCLK_SELECT)
@@ -623,6 +676,14 @@
 /** Licor UART Buffer */
 #define LICOR_BUFFER_LEN (2048)
 
+/** Licor parse substring and batched config message */
+#define LICOR_SUBSTR_LEN (512)
+#define LICOR_CFG_MSG_LEN (768)
+
+/** Licor streaming frame ring (LICOR_FRAME_CNT a power of two) */
+#define LICOR_FRAME_LEN (256)
+#define LICOR_FRAME_CNT (4)
+
 /************************************************************************
  *							    Datalogger
  ************************************************************************/
@@ -685,6 +746,7 @@
 #define SHT35_I2C_MODE (RH_I2C_MODE)
 #define SHT35_I2C_SLAVE_ADDR (RH_I2C_SLAVE_ADDR)
 #define SHT35_I2C_TIMEOUT (RH_I2C_TIMEOUT)
+#define SHT35_I2C_QUEUE (&I2CQ_B1)
 
 /************************************************************************
  *							   SPI->UART Controller
@@ -729,6 +791,7 @@
  *							   RTC
  ************************************************************************/
 /** AMBIQ RTC -> MICROCONTROLLER SYSTICK FREQUENCY */
+/** Keep AMBIQ_RTC_SYSTICK_FREQ (Hz) in step with AMBIQ_RTC_SQW_SETTING */
 #define AMBIQ_RTC_SYSTICK_FREQ (16)
 #define AMBIQ_RTC_SQW_SETTING (SQFS_16)
 
@@ -770,6 +833,7 @@
 #define AMBIQ_RTC_I2C_AUTOSTOP (EUSCI_B_I2C_NO_AUTO_STOP)
 #define AMBIQ_RTC_I2C_SLAVE_ADDR (0xD2)
 #define AMBIQ_RTC_I2C_TIMEOUT (0x000FFFFF)
+#define AMBIQ_RTC_I2C_QUEUE (&I2CQ_B0)
 #define SYSTEM_RTC_TIMEOUT_MS (250)
 #define SYSTEM_RTC_ALARM_PIN (AM08X5_OUTPUT_NIRQ1)
 #define SYSTEM_RTC_TIMER_PIN (AM08X5_OUTPUT_TIRQ)
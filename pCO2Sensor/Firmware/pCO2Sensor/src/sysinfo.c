@@ -34,6 +34,10 @@ PERSISTENT sSystem_t sysinfo = {
                .tFlag = false},
     .timer2 = {.tCounter = 0,
                .tFlag = false},
+    .timer3 = {.tCounter = 0,
+               .tFlag = false},
+    .rxTimer = {.tCounter = 0,
+                .tFlag = false},
     .sampleTimer = {.tCounter = 0,
                     .tFlag = false},
 
@@ -44,6 +48,10 @@ PERSISTENT volatile char SYS_MS_Flag;
 PERSISTENT volatile eSysMode_t SysMode = SYS_Watchdog;
 PERSISTENT volatile eConsoleMode_t ConsoleMode = SYS_Console_None;
 
+/** Console and Command line-ready events */
+volatile uint8_t ConsoleRxEvent = 0;
+volatile uint8_t CommandRxEvent = 0;
+
 /** Console Buffer */
 PERSISTENT volatile char ConsoleRxBuffer[SYSTEM_CONSOLE_RX_BUFFER_LEN];
 PERSISTENT volatile char *pConsoleRxBuffer = &ConsoleRxBuffer[0];
@@ -58,6 +66,7 @@ volatile uint8_t CommandTimeoutSuppress = false;
 PERSISTENT volatile char LicorRxBuffer[LICOR_BUFFER_LEN];
 PERSISTENT volatile char *pLicorRxBuffer = &LicorRxBuffer[0];
 volatile bool LicorRxFlag = false;
+volatile bool LicorStreamActive = false;
 volatile sUartPassthrough_t UartPassthrough = SYS_UART_BLOCK;
 
 /** I2C B0 Transfer Data */
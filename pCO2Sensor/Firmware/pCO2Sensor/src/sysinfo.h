@@ -59,7 +59,7 @@ typedef enum
   SYS_Console = 0x01u, /** Console Mode */
   SYS_Command = 0x02u, /** Command Mode */
   SYS_Sample = 0x04u,  /** Sample Routine */
-  SYS_Watchdog = 0x08u /** Watchdog mode (Wakes every ~25 seconds to hit watchdog) */
+  SYS_Watchdog = 0x08u /** Watchdog mode (Idle, TA0 tick hits watchdog without waking) */
 } eSysMode_t;
 
 typedef enum
@@ -84,6 +84,10 @@ typedef enum
 
 } sUartPassthrough_t;
 
+/** Receive events raised by the Console and Command UART ISRs */
+#define SYS_RX_EVENT_BYTE (0x01u) /**< First byte of a new line received */
+#define SYS_RX_EVENT_LINE (0x02u) /**< LF terminated line received */
+
 typedef struct
 {
   volatile int16_t tCounter;
@@ -101,6 +105,8 @@ typedef struct
   uint32_t I2CFailures;      /**< Number of I2C Failure system restarts */
   sSysTimer_t timer1;        /**< 1 Second Timer (AM08X5 RTC) */
   sSysTimer_t timer2;        /**< 1 Second Timer (AM08X5 RTC) */
+  sSysTimer_t timer3;        /**< 1 Second Timer (AM08X5 RTC) */
+  sSysTimer_t rxTimer;       /**< 1 Second Console/Command Rx Wait Timer (AM08X5 RTC) */
   sSysTimer_t sampleTimer;   /**< 1ms Sensor Sampling Timer (uC RTC) */
   const int32_t gps;         /**< GPS value (-2 for Datalogger) */
   eConsoleSubmode_t Submode; /**< Normal or Test Mode */
@@ -131,6 +137,9 @@ extern char TELOS_IRID_BUF[SYS_IRIDIUM_BUFFER_LENGTH];
 extern char *pTELOS_IRID_BUF;
 extern uint16_t TELOS_IRID_BUF_Len;
 
+extern volatile uint8_t ConsoleRxEvent;
+extern volatile uint8_t CommandRxEvent;
+
 extern volatile char ConsoleRxBuffer[SYSTEM_CONSOLE_RX_BUFFER_LEN];
 extern volatile char *pConsoleRxBuffer;
 extern volatile uint8_t ConsoleTimeoutSuppress;
@@ -142,6 +151,7 @@ extern volatile uint8_t CommandTimeoutSuppress;
 extern volatile char LicorRxBuffer[LICOR_BUFFER_LEN];
 extern volatile char *pLicorRxBuffer;
 extern volatile bool LicorRxFlag;
+extern volatile bool LicorStreamActive;
 
 extern volatile sUartPassthrough_t UartPassthrough;
 
@@ -0,0 +1,294 @@
+/** @file vecstats.c
+ *  @brief Vector statistics kernels for sample windows
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note
+ *
+ *  @bug  No known bugs
+ */
+#include "vecstats.h"
+
+/************************************************************************
+ *					   STATIC Functions Prototypes
+ ************************************************************************/
+STATIC int32_t VSTATS_Quantize(float val, float offset, float lsb, int32_t lo, int32_t hi, bool *sat);
+STATIC int32_t VSTATS_RoundDiv(int64_t num, uint16_t den);
+
+/************************************************************************
+ *					         Functions
+ ************************************************************************/
+uint16_t VSTATS_ToQ15(const float *src, int16_t *dst, uint16_t n, float offset, float lsb)
+{
+  uint16_t i;
+  uint16_t cnt = 0;
+  bool sat;
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = (int16_t)VSTATS_Quantize(src[i], offset, lsb, VSTATS_Q15_MIN, VSTATS_Q15_MAX, &sat);
+    cnt += (true == sat);
+  }
+
+  return cnt;
+}
+
+uint16_t VSTATS_ToQ31(const float *src, int32_t *dst, uint16_t n, float offset, float lsb)
+{
+  uint16_t i;
+  uint16_t cnt = 0;
+  bool sat;
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = VSTATS_Quantize(src[i], offset, lsb, VSTATS_Q31_MIN, VSTATS_Q31_MAX, &sat);
+    cnt += (true == sat);
+  }
+
+  return cnt;
+}
+
+void VSTATS_Window_Q15(const int16_t *x, uint16_t n, sVStats_Q15_t *s)
+{
+  uint16_t i;
+  bool minmax = false;
+
+  s->n = n;
+  s->sum = 0;
+  s->sumsq = 0;
+  s->min = 0;
+  s->max = 0;
+
+  if (n == 0)
+  {
+    return;
+  }
+
+#ifdef VSTATS_USE_LEA
+  /** LEA vector commands need an even length and x in LEA RAM.  DSPLib
+   *  rejects anything else, then the scalar loop below does min/max. */
+  if ((n & 1u) == 0u)
+  {
+    msp_max_q15_params maxParams = {.length = n};
+    msp_min_q15_params minParams = {.length = n};
+    uint16_t idx;
+
+    minmax = ((MSP_SUCCESS == msp_max_q15(&maxParams, x, &s->max, &idx)) &&
+              (MSP_SUCCESS == msp_min_q15(&minParams, x, &s->min, &idx)));
+  }
+#endif
+
+  if (false == minmax)
+  {
+    s->min = x[0];
+    s->max = x[0];
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    s->sum += x[i];
+    s->sumsq += (int32_t)x[i] * x[i];
+    if (false == minmax)
+    {
+      if (x[i] < s->min)
+      {
+        s->min = x[i];
+      }
+      if (x[i] > s->max)
+      {
+        s->max = x[i];
+      }
+    }
+  }
+}
+
+void VSTATS_Window_Q31(const int32_t *x, uint16_t n, sVStats_Q31_t *s)
+{
+  uint16_t i;
+  int64_t dev;
+  bool minmax = false;
+
+  s->n = n;
+  s->sum = 0;
+  s->mean = 0;
+  s->M2 = 0;
+  s->min = 0;
+  s->max = 0;
+
+  if (n == 0)
+  {
+    return;
+  }
+
+#ifdef VSTATS_USE_LEA
+  /** Same LEA constraints as the Q15 window */
+  if ((n & 1u) == 0u)
+  {
+    msp_max_iq31_params maxParams = {.length = n};
+    msp_min_iq31_params minParams = {.length = n};
+    uint16_t idx;
+
+    minmax = ((MSP_SUCCESS == msp_max_iq31(&maxParams, x, &s->max, &idx)) &&
+              (MSP_SUCCESS == msp_min_iq31(&minParams, x, &s->min, &idx)));
+  }
+#endif
+
+  if (false == minmax)
+  {
+    s->min = x[0];
+    s->max = x[0];
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    s->sum += x[i];
+    if (false == minmax)
+    {
+      if (x[i] < s->min)
+      {
+        s->min = x[i];
+      }
+      if (x[i] > s->max)
+      {
+        s->max = x[i];
+      }
+    }
+  }
+
+  /** Deviations from the rounded mean stay within the window span */
+  s->mean = VSTATS_RoundDiv(s->sum, n);
+  for (i = 0; i < n; i++)
+  {
+    dev = (int64_t)x[i] - s->mean;
+    s->M2 += (uint64_t)(dev * dev);
+  }
+}
+
+float VSTATS_Mean_Q15(const sVStats_Q15_t *s, float offset, float lsb)
+{
+  if (s->n == 0)
+  {
+    return NAN;
+  }
+
+  return ((float)s->sum / (float)s->n) * lsb + offset;
+}
+
+float VSTATS_Var_Q15(const sVStats_Q15_t *s, float lsb)
+{
+  int64_t num;
+  float n;
+
+  if (s->n == 0)
+  {
+    return NAN;
+  }
+
+  /** n * M2 = n * sum(x^2) - sum(x)^2, exact in int64 */
+  num = ((int64_t)s->n * s->sumsq) - ((int64_t)s->sum * s->sum);
+  n = (float)s->n;
+
+  return ((float)num / (n * n)) * lsb * lsb;
+}
+
+float VSTATS_Mean_Q31(const sVStats_Q31_t *s, float offset, float lsb)
+{
+  if (s->n == 0)
+  {
+    return NAN;
+  }
+
+  return ((float)s->sum / (float)s->n) * lsb + offset;
+}
+
+float VSTATS_Var_Q31(const sVStats_Q31_t *s, float lsb)
+{
+  float n;
+  float d;
+  float var;
+
+  if (s->n == 0)
+  {
+    return NAN;
+  }
+
+  /** Correct M2 for the rounded mean: M2 = sum((x - mu)^2) + n * d^2 */
+  n = (float)s->n;
+  d = (float)(s->sum - ((int64_t)s->mean * s->n)) / n;
+  var = ((float)s->M2 / n) - (d * d);
+  if (var < 0.0f)
+  {
+    var = 0.0f;
+  }
+
+  return var * lsb * lsb;
+}
+
+/************************************************************************
+ *					   Static Functions
+ ************************************************************************/
+/** @brief Quantize a sample
+ *
+ * round((val - offset) / lsb) saturated to [lo, hi]
+ *
+ * @param val Sample
+ * @param offset Value mapped to 0
+ * @param lsb Value of one count
+ * @param lo Lowest count
+ * @param hi Highest count
+ * @param *sat Set true if the sample was saturated or NaN
+ *
+ * @return Count
+ */
+STATIC int32_t VSTATS_Quantize(float val, float offset, float lsb, int32_t lo, int32_t hi, bool *sat)
+{
+  float q;
+
+  *sat = false;
+  if (isnan(val) || (lsb == 0.0f))
+  {
+    *sat = true;
+    return 0;
+  }
+
+  q = (val - offset) / lsb;
+  q = (q >= 0.0f) ? floorf(q + 0.5f) : ceilf(q - 0.5f);
+
+  if (q >= (float)hi)
+  {
+    *sat = (q > (float)hi);
+    return hi;
+  }
+  if (q <= (float)lo)
+  {
+    *sat = (q < (float)lo);
+    return lo;
+  }
+
+  return (int32_t)q;
+}
+
+/** @brief Rounded division
+ *
+ * num / den rounded to nearest, halves away from zero
+ *
+ * @param num Numerator
+ * @param den Denominator (> 0)
+ *
+ * @return Quotient
+ */
+STATIC int32_t VSTATS_RoundDiv(int64_t num, uint16_t den)
+{
+  if (num >= 0)
+  {
+    return (int32_t)((num + (den / 2)) / den);
+  }
+
+  return (int32_t)-((-num + (den / 2)) / den);
+}
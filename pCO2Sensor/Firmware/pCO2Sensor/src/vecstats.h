@@ -0,0 +1,203 @@
+/** @file vecstats.h
+ *  @brief Vector statistics kernels for sample windows
+ *
+ *  @author Matt Casari, matthew.casari@noaa.gov
+ *  @date October 19, 2026
+ *  @version 1.0.0
+ *
+ *  @copyright National Oceanic and Atmospheric Administration
+ *  @copyright Pacific Marine Environmental Lab
+ *  @copyright Engineering Development Division
+ *
+ *	@note One-shot mean, variance and min/max over a whole window.
+ *  @note A float channel (e.g. run_data CO2[]) is first copied to Q15 or
+ *  @note Q31 as (value - offset) / lsb, and the kernels then work on
+ *  @note integers only.  Sums are exact (int32/int64), so the results do
+ *  @note not depend on sample order or accumulated float rounding.
+ *  @note
+ *  @note With VSTATS_USE_LEA defined (set by pCO2Sensor.ewp, with TI
+ *  @note DSPLib in the project DSPLib folder) min/max of even length Q15
+ *  @note and Q31 windows run on the Low Energy Accelerator.  Those
+ *  @note buffers must be in LEA RAM (VSTATS_LEA_DATA).  Everything else,
+ *  @note and the host tests, use the portable C, which gives the same
+ *  @note integer results.
+ *
+ *  @bug  No known bugs
+ */
+#ifndef _VECSTATS_H
+#define _VECSTATS_H
+
+/** Remove STATIC and PERSISTENT values if running TEST */
+/** Add the actual values if running release */
+#ifdef UNIT_TESTING
+#ifndef STATIC
+#define STATIC
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT
+#endif
+#else
+#ifndef STATIC
+#define STATIC static
+#endif
+#ifndef PERSISTENT
+#define PERSISTENT __persistent
+#endif
+#endif
+
+/************************************************************************
+ *						STANDARD LIBRARIES
+ ************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#ifdef VSTATS_USE_LEA
+#include "DSPLib.h"
+#endif
+
+/************************************************************************
+ *							MACROS
+ ************************************************************************/
+#define VSTATS_Q15_MAX (32767)
+#define VSTATS_Q15_MIN (-32768)
+#define VSTATS_Q31_MAX (2147483647L)
+#define VSTATS_Q31_MIN (-2147483647L - 1L)
+
+/** Place a window buffer in LEA RAM when the LEA kernels are built */
+#ifdef VSTATS_USE_LEA
+#define VSTATS_LEA_DATA(var) DSPLIB_DATA(var, 4)
+#else
+#define VSTATS_LEA_DATA(var)
+#endif
+
+/************************************************************************
+ *							Structs & Enums
+ ************************************************************************/
+/**
+ * @struct Q15 Window Statistics
+ * @brief Exact integer sums of a Q15 window
+ */
+typedef struct
+{
+  uint16_t n;    /**< Number of samples */
+  int32_t sum;   /**< Sum of samples */
+  int64_t sumsq; /**< Sum of squared samples */
+  int16_t min;   /**< Minimum sample */
+  int16_t max;   /**< Maximum sample */
+} sVStats_Q15_t;
+
+/**
+ * @struct Q31 Window Statistics
+ * @brief Exact integer sums of a Q31 window
+ */
+typedef struct
+{
+  uint16_t n;   /**< Number of samples */
+  int64_t sum;  /**< Sum of samples */
+  int32_t mean; /**< Mean, rounded to nearest */
+  uint64_t M2;  /**< Sum of squared deviations from mean */
+  int32_t min;  /**< Minimum sample */
+  int32_t max;  /**< Maximum sample */
+} sVStats_Q31_t;
+
+/************************************************************************
+ *					   Functions Prototypes
+ ************************************************************************/
+/** @brief Copy a float window to Q15
+ *
+ *  dst[i] = round((src[i] - offset) / lsb), saturated to int16.  NaN
+ *  samples are stored as 0 and counted as saturated.
+ *
+ *  @param *src Float samples
+ *  @param *dst Q15 copy
+ *  @param n Number of samples
+ *  @param offset Value mapped to 0
+ *  @param lsb Value of one count
+ *
+ *  @return Number of samples that were saturated
+ */
+uint16_t VSTATS_ToQ15(const float *src, int16_t *dst, uint16_t n, float offset, float lsb);
+
+/** @brief Copy a float window to Q31
+ *
+ *  Same as VSTATS_ToQ15 with int32 saturation.
+ *
+ *  @param *src Float samples
+ *  @param *dst Q31 copy
+ *  @param n Number of samples
+ *  @param offset Value mapped to 0
+ *  @param lsb Value of one count
+ *
+ *  @return Number of samples that were saturated
+ */
+uint16_t VSTATS_ToQ31(const float *src, int32_t *dst, uint16_t n, float offset, float lsb);
+
+/** @brief Q15 Window Statistics
+ *
+ *  Compute sum, sum of squares, min and max in one pass.
+ *
+ *  @param *x Q15 window
+ *  @param n Number of samples
+ *  @param *s Result
+ *
+ *  @return None
+ */
+void VSTATS_Window_Q15(const int16_t *x, uint16_t n, sVStats_Q15_t *s);
+
+/** @brief Q31 Window Statistics
+ *
+ *  Compute sum, mean, min and max, then the squared deviations from the
+ *  mean in a second pass so large offsets cannot overflow.
+ *
+ *  @param *x Q31 window
+ *  @param n Number of samples
+ *  @param *s Result
+ *
+ *  @return None
+ */
+void VSTATS_Window_Q31(const int32_t *x, uint16_t n, sVStats_Q31_t *s);
+
+/** @brief Q15 Mean
+ *
+ *  @param *s Window statistics
+ *  @param offset Offset used for the Q15 copy
+ *  @param lsb LSB used for the Q15 copy
+ *
+ *  @return Mean in engineering units (NAN if empty)
+ */
+float VSTATS_Mean_Q15(const sVStats_Q15_t *s, float offset, float lsb);
+
+/** @brief Q15 Variance
+ *
+ *  Population variance (M2 / n), matching STATS_Compute.
+ *
+ *  @param *s Window statistics
+ *  @param lsb LSB used for the Q15 copy
+ *
+ *  @return Variance in engineering units squared (NAN if empty)
+ */
+float VSTATS_Var_Q15(const sVStats_Q15_t *s, float lsb);
+
+/** @brief Q31 Mean
+ *
+ *  @param *s Window statistics
+ *  @param offset Offset used for the Q31 copy
+ *  @param lsb LSB used for the Q31 copy
+ *
+ *  @return Mean in engineering units (NAN if empty)
+ */
+float VSTATS_Mean_Q31(const sVStats_Q31_t *s, float offset, float lsb);
+
+/** @brief Q31 Variance
+ *
+ *  Population variance (M2 / n), matching STATS_Compute.
+ *
+ *  @param *s Window statistics
+ *  @param lsb LSB used for the Q31 copy
+ *
+ *  @return Variance in engineering units squared (NAN if empty)
+ */
+float VSTATS_Var_Q31(const sVStats_Q31_t *s, float lsb);
+
+#endif // _VECSTATS_H
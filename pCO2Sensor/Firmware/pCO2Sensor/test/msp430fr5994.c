@@ -39,6 +39,26 @@ uint16_t UCA3TXBUF = 0;
 uint16_t UCA3RXBUF = 0;
 
 
+/** I2C Ports */
+uint16_t UCB0CTLW0 = 0;
+uint16_t UCB0CTLW1 = 0;
+uint16_t UCB0I2CSA = 0;
+uint16_t UCB0IE = 0;
+uint16_t UCB0IFG = 0;
+uint16_t UCB0IV = 0;
+uint16_t UCB0TXBUF = 0;
+uint16_t UCB0RXBUF = 0;
+
+uint16_t UCB1CTLW0 = 0;
+uint16_t UCB1CTLW1 = 0;
+uint16_t UCB1I2CSA = 0;
+uint16_t UCB1IE = 0;
+uint16_t UCB1IFG = 0;
+uint16_t UCB1IV = 0;
+uint16_t UCB1TXBUF = 0;
+uint16_t UCB1RXBUF = 0;
+
+
 /** GPIO Ports and Settings */
 uint16_t P1OUT = 0;
 uint16_t P2OUT = 0;
@@ -3150,6 +3150,58 @@ extern uint16_t P8IE;
 
 
 
+/* UCBxCTLW1 Control Bits */
+#define UCASTP0                          (0x0004)        /* Automatic STOP condition generation */
+#define UCASTP1                          (0x0008)        /* Automatic STOP condition generation */
+
+/* UCBxSTATW Control Bits */
+#define UCBBUSY                          (0x0010)        /* Bus busy */
+
+/* UCBxIE / UCBxIFG I2C Bits */
+#define UCRXIE0                          (0x0001)        /* Receive interrupt enable 0 */
+#define UCTXIE0                          (0x0002)        /* Transmit interrupt enable 0 */
+#define UCSTTIE                          (0x0004)        /* START condition interrupt enable */
+#define UCSTPIE                          (0x0008)        /* STOP condition interrupt enable */
+#define UCALIE                           (0x0010)        /* Arbitration lost interrupt enable */
+#define UCNACKIE                         (0x0020)        /* Not-acknowledge interrupt enable */
+#define UCRXIFG0                         (0x0001)        /* eUSCI_B receive interrupt flag 0 */
+#define UCTXIFG0                         (0x0002)        /* eUSCI_B transmit interrupt flag 0 */
+#define UCSTTIFG                         (0x0004)        /* START condition interrupt flag */
+#define UCSTPIFG                         (0x0008)        /* STOP condition interrupt flag */
+#define UCALIFG                          (0x0010)        /* Arbitration lost interrupt flag */
+#define UCNACKIFG                        (0x0020)        /* Not-acknowledge received interrupt flag */
+
+/* USCI I2C Definitions */
+#define USCI_NONE                        (0x0000)        /* No Interrupt pending */
+#define USCI_I2C_UCALIFG                 (0x0002)        /* Interrupt Vector: I2C Mode: UCALIFG */
+#define USCI_I2C_UCNACKIFG               (0x0004)        /* Interrupt Vector: I2C Mode: UCNACKIFG */
+#define USCI_I2C_UCSTTIFG                (0x0006)        /* Interrupt Vector: I2C Mode: UCSTTIFG*/
+#define USCI_I2C_UCSTPIFG                (0x0008)        /* Interrupt Vector: I2C Mode: UCSTPIFG*/
+#define USCI_I2C_UCRXIFG0                (0x0016)        /* Interrupt Vector: I2C Mode: UCRXIFG0 */
+#define USCI_I2C_UCTXIFG0                (0x0018)        /* Interrupt Vector: I2C Mode: UCTXIFG0 */
+#define USCI_I2C_UCBCNTIFG               (0x001A)        /* Interrupt Vector: I2C Mode: UCBCNTIFG */
+#define USCI_I2C_UCCLTOIFG               (0x001C)        /* Interrupt Vector: I2C Mode: UCCLTOIFG */
+#define USCI_I2C_UCBIT9IFG               (0x001E)        /* Interrupt Vector: I2C Mode: UCBIT9IFG */
+
+/** I2C Ports */
+extern uint16_t UCB0CTLW0;
+extern uint16_t UCB0CTLW1;
+extern uint16_t UCB0I2CSA;
+extern uint16_t UCB0IE;
+extern uint16_t UCB0IFG;
+extern uint16_t UCB0IV;
+extern uint16_t UCB0TXBUF;
+extern uint16_t UCB0RXBUF;
+
+extern uint16_t UCB1CTLW0;
+extern uint16_t UCB1CTLW1;
+extern uint16_t UCB1I2CSA;
+extern uint16_t UCB1IE;
+extern uint16_t UCB1IFG;
+extern uint16_t UCB1IV;
+extern uint16_t UCB1TXBUF;
+extern uint16_t UCB1RXBUF;
+
 #define UCASTP_0     0x00
 #define UCASTP_1    0x01
 #define UCASTP_2    0x02
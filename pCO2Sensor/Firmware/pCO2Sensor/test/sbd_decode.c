@@ -0,0 +1,129 @@
+#include "sbd_decode.h"
+#include <math.h>
+#include <string.h>
+
+/** Big endian unsigned, all ones is no value */
+static float get_u(const uint8_t **p, uint8_t bytes, float lsb)
+{
+    uint32_t val = 0;
+    uint32_t nodata = (1UL << (8u * bytes)) - 1u;
+    uint8_t i;
+
+    for (i = 0; i < bytes; i++)
+    {
+        val = (val << 8) | *(*p)++;
+    }
+
+    return (val == nodata) ? NAN : (float)val * lsb;
+}
+
+static uint32_t get_raw(const uint8_t **p, uint8_t bytes)
+{
+    uint32_t val = 0;
+
+    while (bytes-- > 0u)
+    {
+        val = (val << 8) | *(*p)++;
+    }
+
+    return val;
+}
+
+/** Big endian two's complement, most negative value is no value */
+static float get_i(const uint8_t **p, uint8_t bytes, float lsb)
+{
+    uint32_t sign = 1UL << ((8u * bytes) - 1u);
+    uint32_t raw = get_raw(p, bytes);
+    int32_t val = (int32_t)(raw ^ sign) - (int32_t)sign;
+
+    return (raw == sign) ? NAN : (float)val * lsb;
+}
+
+static float get_f32(const uint8_t **p)
+{
+    uint32_t bits = get_raw(p, 4);
+    float val;
+
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+uint16_t SBD_Decode_Crc(const uint8_t *buf, uint16_t len)
+{
+    uint16_t crc = 0;
+    uint8_t i;
+
+    while (len-- > 0u)
+    {
+        crc ^= (uint16_t)(*buf++) << 8;
+        for (i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ 0x1021u) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+eSbdDecodeStatus_t SBD_Decode(const uint8_t *buf, uint16_t len, sSbdDecode_t *out)
+{
+    const uint8_t *p = buf;
+    const uint8_t *crc = &buf[SBD_DECODE_LEN - 2];
+    sSbdDecodeMode_t *m;
+    uint8_t flags;
+    uint8_t n;
+    uint8_t i;
+
+    if (SBD_DECODE_LEN != len)
+    {
+        return SBD_DECODE_LENGTH;
+    }
+    if (SBD_Decode_Crc(buf, SBD_DECODE_LEN - 2) != get_raw(&crc, 2))
+    {
+        return SBD_DECODE_CRC;
+    }
+
+    out->version = (uint8_t)get_raw(&p, 1);
+    if (SBD_DECODE_VERSION != out->version)
+    {
+        return SBD_DECODE_VER;
+    }
+    out->run = (uint16_t)get_raw(&p, 2);
+    out->epoch = get_raw(&p, 4);
+    flags = (uint8_t)get_raw(&p, 1);
+    out->zero = (0u != (flags & 0x01u));
+    out->span = (0u != (flags & 0x02u));
+    out->equil = (0u != (flags & 0x04u));
+
+    for (i = 0; i < SBD_DECODE_MODES; i++)
+    {
+        m = &out->mode[i];
+        n = (uint8_t)get_raw(&p, 1);
+        m->n = n & 0x7Fu;
+        m->converged = (0u != (n & 0x80u));
+        m->temp = get_i(&p, 2, 0.01f);
+        m->temp_sd = get_u(&p, 1, 0.01f);
+        m->pres = get_u(&p, 2, 0.01f);
+        m->pres_sd = get_u(&p, 1, 0.01f);
+        m->co2 = get_i(&p, 3, 0.001f);
+        m->co2_sd = get_u(&p, 2, 0.001f);
+        m->o2 = get_u(&p, 2, 0.001f);
+        m->o2_sd = get_u(&p, 1, 0.01f);
+        m->rh = get_u(&p, 2, 0.01f);
+        m->rh_sd = get_u(&p, 1, 0.01f);
+        m->rh_temp = get_i(&p, 2, 0.01f);
+        m->rh_temp_sd = get_u(&p, 1, 0.01f);
+        m->raw1 = get_u(&p, 3, 1.0f);
+        m->raw1_sd = get_u(&p, 2, 1.0f);
+        m->raw2 = get_u(&p, 3, 1.0f);
+        m->raw2_sd = get_u(&p, 2, 1.0f);
+    }
+
+    out->co2kzero = get_f32(&p);
+    out->co2kspan = get_f32(&p);
+    out->co2kspan2 = get_f32(&p);
+    out->sw_xco2 = get_u(&p, 3, 0.001f);
+    out->air_xco2 = get_u(&p, 3, 0.001f);
+
+    return SBD_DECODE_OK;
+}
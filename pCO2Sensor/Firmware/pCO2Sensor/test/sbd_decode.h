@@ -0,0 +1,57 @@
+/** @file sbd_decode.h
+ *  @brief Reference decoder for the binary SBD idata message
+ *
+ *  Host side, no firmware headers.  Layout is in src/sbd.h.
+ */
+#ifndef _SBD_DECODE_H
+#define _SBD_DECODE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SBD_DECODE_VERSION (2u)
+#define SBD_DECODE_MODES (10)
+#define SBD_DECODE_LEN (338)
+
+typedef enum
+{
+    SBD_DECODE_OK = 0u,
+    SBD_DECODE_LENGTH = 1u,  /**< Wrong message length */
+    SBD_DECODE_CRC = 2u,     /**< CRC mismatch */
+    SBD_DECODE_VER = 3u      /**< Unknown version */
+} eSbdDecodeStatus_t;
+
+typedef struct
+{
+    uint8_t n;
+    bool converged;
+    float temp, temp_sd;
+    float pres, pres_sd;
+    float co2, co2_sd;
+    float o2, o2_sd;
+    float rh, rh_sd;
+    float rh_temp, rh_temp_sd;
+    float raw1, raw1_sd;
+    float raw2, raw2_sd;
+} sSbdDecodeMode_t;
+
+typedef struct
+{
+    uint8_t version;
+    uint16_t run;
+    uint32_t epoch;
+    bool zero;
+    bool span;
+    bool equil;
+    sSbdDecodeMode_t mode[SBD_DECODE_MODES]; /**< ZPON, ZPOFF, ... APOFF */
+    float co2kzero, co2kspan, co2kspan2;
+    float sw_xco2, air_xco2;
+} sSbdDecode_t;
+
+/** CRC16 XMODEM (poly 0x1021, init 0) */
+uint16_t SBD_Decode_Crc(const uint8_t *buf, uint16_t len);
+
+/** Decode one message.  Fields with no value come back NAN. */
+eSbdDecodeStatus_t SBD_Decode(const uint8_t *buf, uint16_t len, sSbdDecode_t *out);
+
+#endif // _SBD_DECODE_H
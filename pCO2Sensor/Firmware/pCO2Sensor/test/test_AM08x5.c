@@ -1,7 +1,6 @@
 #include "unity.h"
 #include "AM08x5.h"
 #include "mock_bsp.h"
-#include "mock_buffer8.h"
 #include "mock_errors.h"
 void setUp(void)
 {
@@ -43,7 +42,7 @@ void test_AM08X5_WriteReg_should_ReportError_for_BadI2CTx(void){
 
     /** Mock the called functions */
     BSP_I2C_put_ExpectAndReturn(&RTC.I2C,data,BSP_FAIL);
-    Error_Expect(ERROR_MSG_3900,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_3900, 0);
 
 
     /** Run the test */
@@ -138,7 +137,7 @@ void ignore_writereg(uint8_t addr, uint8_t data, eBSPStatus_t bsp_stat){
 
 }
 
-void ignore_readreg(uint8_t addr, uint8_t value, eBuffer8Status_t buf_stat, eBSPStatus_t bsp_stat){
+void ignore_readreg(uint8_t addr, uint8_t value, eBufferCStatus_t buf_stat, eBSPStatus_t bsp_stat){
     BSP_I2C_get_IgnoreAndReturn(value);
 }
 
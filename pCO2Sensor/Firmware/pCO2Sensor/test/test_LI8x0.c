@@ -73,7 +73,7 @@ void test_LIx80_Level1Str_should_ProduceError_and_ReturnInvalid_for_InvalidType(
     uint16_t slen=0;
     uint16_t elen=0;
 
-    Error_Expect(ERROR_MSG_7100,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7100, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Level1Str(LVL,psstr,&slen,pestr,&elen));
 
     TEST_ASSERT_EQUAL_STRING("",sstr);
@@ -120,7 +120,7 @@ void test_LIx80_Level2Str_should_ProduceError_and_ReturnInvalid_for_InvalidType(
     uint16_t slen=0;
     uint16_t elen=0;
 
-    Error_Expect(ERROR_MSG_7101,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7101, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Level2Str(LVL,psstr,&slen,pestr,&elen));
 
     TEST_ASSERT_EQUAL_STRING("",sstr);
@@ -166,7 +166,7 @@ void test_LIx80_Level3Str_should_ProduceError_and_ReturnInvalid_for_InvalidType(
     uint16_t slen=0;
     uint16_t elen=0;
 
-    Error_Expect(ERROR_MSG_7102,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7102, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Level3Str(LVL,psstr,&slen,pestr,&elen));
 
     TEST_ASSERT_EQUAL_STRING("",sstr);
@@ -211,7 +211,7 @@ void test_LIx80_Level4Str_should_ProduceError_and_ReturnInvalid_for_InvalidType(
     uint16_t slen=0;
     uint16_t elen=0;
 
-    Error_Expect(ERROR_MSG_7103,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7103, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Level4Str(LVL,psstr,&slen,pestr,&elen));
 
     TEST_ASSERT_EQUAL_STRING("",sstr);
@@ -247,7 +247,7 @@ void test_LI8x0_ValidateXML_should_ReturnInvalid_AndError_for_InvalidSetofNone(v
                         .LVL4 = LICOR_XML_LVL4_NONE };
 
 
-    Error_Expect(ERROR_MSG_7110,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7110, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_ValidateXML(&XML));
 
 }
@@ -259,7 +259,7 @@ void test_LI8x0_ValidateXML_should_ReturnInvalid_AndError_for_H2O_in_LI820(void)
                         .LVL3 = LICOR_XML_LVL3_H2OSPAN,
                         .LVL4 = LICOR_XML_LVL4_NONE };
 
-    Error_Expect(ERROR_MSG_7121, LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7121, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_ValidateXML(&XML));
 }
 
@@ -279,7 +279,7 @@ void test_LI8x0_ValidXML_Level3_should_ReturnInvalid_for_InvalidSource(void){
                         .LVL3 = LICOR_XML_LVL3_SOURCE,
                         .LVL4 = LICOR_XML_LVL4_CO2 };
 
-    Error_Expect(ERROR_MSG_7114,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7114, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_ValidXML_Level3(&XML));
 
 }
@@ -301,7 +301,7 @@ void test_LI8x0_ValidXML_Level3_should_ReturnInvalid_for_Invalid_Pump(void){
                         .LVL3 = LICOR_XML_LVL3_PUMP,
                         .LVL4 = LICOR_XML_LVL4_CO2 };
 
-    Error_Expect(ERROR_MSG_7114,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7114, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_ValidXML_Level3(&XML));
 
 }
@@ -329,7 +329,7 @@ void test_LI8x0_ValidXML_Level3_should_returnInValid_for_InValid_CO2(void){
                         .LVL3 = LICOR_XML_LVL3_CO2,
                         .LVL4 = LICOR_XML_LVL4_A1 };
 
-    Error_Expect(ERROR_MSG_7114,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7114, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_ValidXML_Level3(&XML));
 
 
@@ -357,7 +357,7 @@ void test_LI8x0_ValidXML_Level3_should_returnInValid_for_InValid_H2O(void){
                         .LVL3 = LICOR_XML_LVL3_H2O,
                         .LVL4 = LICOR_XML_LVL4_A3 };
 
-    Error_Expect(ERROR_MSG_7114,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_7114, 0);
     TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_ValidXML_Level3(&XML));
 
 
@@ -0,0 +1,157 @@
+#include "unity.h"
+#include "LI8x0.h"
+#include "buffer_c.h"
+#include "mock_bsp.h"
+#include "mock_AM08x5.h"
+#include "mock_logging.h"
+
+#define TEST_CFG_RS232 "<rs232><flowrate>false</flowrate><co2>true</co2><co2abs>false</co2abs>" \
+                       "<celltemp>true</celltemp><cellpres>true</cellpres><ivolt>true</ivolt>"  \
+                       "<raw>true</raw><echo>false</echo><strip>false</strip></rs232>"
+#define TEST_CFG_ALARMS "<alarms><logic>ttl</logic><source>co2</source><enabled>false</enabled></alarms>"
+
+/** Licor UART receive state normally owned by sysinfo.c */
+volatile char LicorRxBuffer[LICOR_BUFFER_LEN];
+volatile char *pLicorRxBuffer = &LicorRxBuffer[0];
+volatile bool LicorRxFlag = false;
+volatile bool LicorStreamActive = false;
+
+void __delay_cycles(unsigned long cycles)
+{
+  (void)cycles;
+}
+
+/** Licor stand-in: answers the query with InfoReply and anything else */
+/** with AckReply */
+static const char *InfoReply;
+static const char *AckReply;
+static uint16_t MsgCount;
+static char LastMsg[LICOR_CFG_MSG_LEN];
+
+static void Licor_Reply(const char *reply)
+{
+  if (reply == NULL)
+  {
+    return;
+  }
+  strcpy((char *)LicorRxBuffer, reply);
+  pLicorRxBuffer = &LicorRxBuffer[strlen(reply)];
+  LicorRxFlag = true;
+}
+
+static void Licor_Puts(sUART_t *UART, const char *val, uint16_t length, int cmock_num_calls)
+{
+  (void)UART;
+  (void)cmock_num_calls;
+
+  MsgCount++;
+  memset(LastMsg, 0, sizeof(LastMsg));
+  strncpy(LastMsg, val, length);
+
+  if (strstr(LastMsg, ">?<") != NULL)
+  {
+    Licor_Reply(InfoReply);
+  }
+  else
+  {
+    Licor_Reply(AckReply);
+  }
+}
+
+void setUp(void)
+{
+  pLicor1->type = LICOR_LI830;
+  memset(&pLicor1->readconfig, 0, sizeof(sLicorTags_t));
+  memset(&pLicor1->sysconfig, 0, sizeof(sLicorTags_t));
+
+  InfoReply = "<li830>" TEST_CFG_RS232 "<cfg><outrate>0</outrate><heater>false</heater>"
+              "<pcomp>true</pcomp><filter>0</filter><bench>14</bench><span>0</span>" TEST_CFG_ALARMS
+              "</cfg></li830>\n";
+  AckReply = "<li830><ack>true</ack></li830>\n";
+  MsgCount = 0;
+  memset(LastMsg, 0, sizeof(LastMsg));
+
+  BSP_UART_puts_StubWithCallback(Licor_Puts);
+  _delay_ms_Ignore();
+  _delay_us_Ignore();
+  Log_Ignore();
+}
+
+void tearDown(void)
+{
+}
+
+void test_LI8x0_Config_should_OnlyQuery_when_SettingsMatch(void){
+
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Config());
+
+  TEST_ASSERT_EQUAL(1,MsgCount);
+  TEST_ASSERT_EQUAL_STRING("<LI830>?</LI830>\r\n",LastMsg);
+  TEST_ASSERT_EQUAL(true,pLicor1->sysconfig.rs232.co2);
+  TEST_ASSERT_EQUAL(14,pLicor1->sysconfig.cfg.bench);
+}
+
+void test_LI8x0_Config_should_SendOnlyChangedTags_in_OneMessage(void){
+
+  InfoReply = "<li830>" TEST_CFG_RS232 "<cfg><outrate>1</outrate><heater>true</heater>"
+              "<pcomp>true</pcomp><filter>0</filter><bench>14</bench><span>0</span>" TEST_CFG_ALARMS
+              "</cfg></li830>\n";
+
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Config());
+
+  TEST_ASSERT_EQUAL(2,MsgCount);
+  TEST_ASSERT_EQUAL_STRING("<LI830><CFG><OUTRATE>0.0</OUTRATE><HEATER>FALSE</HEATER></CFG></LI830>",LastMsg);
+
+  /** Both copies now hold what was sent */
+  TEST_ASSERT_EQUAL(false,pLicor1->readconfig.cfg.heater);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f,pLicor1->readconfig.cfg.outrate);
+  TEST_ASSERT_EQUAL(false,pLicor1->sysconfig.cfg.heater);
+}
+
+void test_LI8x0_Config_should_GroupRS232_and_CFG_Tags(void){
+
+  InfoReply = "<li830><rs232><flowrate>true</flowrate><co2>true</co2><co2abs>false</co2abs>"
+              "<celltemp>true</celltemp><cellpres>true</cellpres><ivolt>true</ivolt>"
+              "<raw>false</raw><echo>false</echo><strip>false</strip></rs232>"
+              "<cfg><outrate>0</outrate><heater>false</heater><pcomp>true</pcomp><filter>0</filter>"
+              "<bench>14</bench><span>0</span><alarms><enabled>true</enabled></alarms></cfg></li830>\n";
+
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Config());
+
+  TEST_ASSERT_EQUAL(2,MsgCount);
+  TEST_ASSERT_EQUAL_STRING("<LI830><RS232><FLOWRATE>FALSE</FLOWRATE><RAW>TRUE</RAW></RS232>"
+                           "<CFG><ALARMS><ENABLED>FALSE</ENABLED></ALARMS></CFG></LI830>",LastMsg);
+}
+
+void test_LI8x0_Config_should_SendAllTags_when_QueryFails(void){
+  const char *all = "<LI830><RS232><FLOWRATE>FALSE</FLOWRATE><CO2>TRUE</CO2><CELLTEMP>TRUE</CELLTEMP>"
+                    "<CELLPRES>TRUE</CELLPRES><IVOLT>TRUE</IVOLT><CO2ABS>FALSE</CO2ABS><ECHO>FALSE</ECHO>"
+                    "<STRIP>FALSE</STRIP><RAW>TRUE</RAW></RS232><CFG><OUTRATE>0.0</OUTRATE>"
+                    "<HEATER>FALSE</HEATER><PCOMP>TRUE</PCOMP><FILTER>0</FILTER><BENCH>14</BENCH>"
+                    "<SPAN>0</SPAN><ALARMS><ENABLED>FALSE</ENABLED></ALARMS></CFG></LI830>";
+
+  InfoReply = NULL;
+
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Config());
+
+  TEST_ASSERT_EQUAL(2,MsgCount);
+  TEST_ASSERT_EQUAL_STRING(all,LastMsg);
+  TEST_ASSERT_TRUE(strlen(all) < LICOR_CFG_MSG_LEN);
+}
+
+void test_LI8x0_Config_should_Fail_when_NotAcked(void){
+
+  InfoReply = NULL;
+  AckReply = NULL;
+
+  TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Config());
+  TEST_ASSERT_EQUAL(2,MsgCount);
+}
+
+void test_LI8x0_Config_should_Fail_when_Nacked(void){
+
+  InfoReply = NULL;
+  AckReply = "<li830><ack>false</ack></li830>\n";
+
+  TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Config());
+}
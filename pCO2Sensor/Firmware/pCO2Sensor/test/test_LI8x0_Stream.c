@@ -0,0 +1,285 @@
+#include "unity.h"
+#include "LI8x0.h"
+#include "buffer_c.h"
+#include "mock_bsp.h"
+#include "mock_AM08x5.h"
+#include "mock_logging.h"
+
+#define TEST_HAMMER_FRAMES (3000u)
+
+/** Licor UART receive state normally owned by sysinfo.c */
+volatile char LicorRxBuffer[LICOR_BUFFER_LEN];
+volatile char *pLicorRxBuffer = &LicorRxBuffer[0];
+volatile bool LicorRxFlag = false;
+volatile bool LicorStreamActive = false;
+
+void __delay_cycles(unsigned long cycles)
+{
+  (void)cycles;
+}
+
+/** Recorded LI-820 output at outrate 0.5 */
+static const char *Recorded[] = {
+    "<li820><data><celltemp>5.1464e1</celltemp><cellpres>1.0077e2</cellpres><co2>4.0163e2</co2><co2abs>8.6714e-2</co2abs><ivolt>1.8412e1</ivolt><raw><co2>3733290</co2><co2ref>3870133</co2ref></raw></data></li820>\r\n",
+    "<li820><data><celltemp>5.1464e1</celltemp><cellpres>1.0077e2</cellpres><co2>4.0159e2</co2><co2abs>8.6706e-2</co2abs><ivolt>1.8412e1</ivolt><raw><co2>3733301</co2><co2ref>3870129</co2ref></raw></data></li820>\r\n",
+    "<li820><data><celltemp>5.1465e1</celltemp><cellpres>1.0078e2</cellpres><co2>4.0171e2</co2><co2abs>8.6731e-2</co2abs><ivolt>1.8411e1</ivolt><raw><co2>3733312</co2><co2ref>3870140</co2ref></raw></data></li820>\r\n",
+    "<li820><data><celltemp>5.1465e1</celltemp><cellpres>1.0077e2</cellpres><co2>4.0166e2</co2><co2abs>8.6720e-2</co2abs><ivolt>1.8412e1</ivolt><raw><co2>3733324</co2><co2ref>3870136</co2ref></raw></data></li820>\r\n",
+    "<li820><data><celltemp>5.1466e1</celltemp><cellpres>1.0077e2</cellpres><co2>4.0160e2</co2><co2abs>8.6708e-2</co2abs><ivolt>1.8411e1</ivolt><raw><co2>3733335</co2><co2ref>3870131</co2ref></raw></data></li820>\r\n",
+};
+#define RECORDED_CNT (sizeof(Recorded) / sizeof(Recorded[0]))
+static const uint32_t RecordedRaw[RECORDED_CNT] = {3733290, 3733301, 3733312, 3733324, 3733335};
+
+static const char *AckReply = "<li820><ack>true</ack></li820>\r\n";
+static const char *PendingReply;
+static char LastMsg[128];
+
+/** Simulated ISR: feed a string a character at a time */
+static uint16_t Feed(const char *str)
+{
+  uint16_t published = 0;
+
+  while (*str != 0)
+  {
+    published += LI8x0_Stream_RxChar(*str++);
+  }
+  return published;
+}
+
+static void Licor_Reply(const char *reply)
+{
+  strcpy((char *)LicorRxBuffer, reply);
+  pLicorRxBuffer = &LicorRxBuffer[strlen(reply)];
+  LicorRxFlag = true;
+}
+
+/** Licor stand-in: a data frame already on the wire, then the ACK */
+static void Licor_Puts(sUART_t *UART, const char *val, uint16_t length, int cmock_num_calls)
+{
+  (void)UART;
+  (void)cmock_num_calls;
+
+  memset(LastMsg, 0, sizeof(LastMsg));
+  strncpy(LastMsg, val, length);
+  Licor_Reply(Recorded[0]);
+  PendingReply = AckReply;
+}
+
+static void Licor_Delay(uint32_t ms, int cmock_num_calls)
+{
+  (void)ms;
+  (void)cmock_num_calls;
+
+  if ((PendingReply != NULL) && (LicorRxFlag == false))
+  {
+    Licor_Reply(PendingReply);
+    PendingReply = NULL;
+  }
+}
+
+void setUp(void)
+{
+  pLicor1->type = LICOR_LI820;
+  PendingReply = NULL;
+
+  BSP_UART_puts_StubWithCallback(Licor_Puts);
+  _delay_ms_StubWithCallback(Licor_Delay);
+  _delay_us_Ignore();
+  BSP_Clock_GetProfile_IgnoreAndReturn(BSP_CLK_IDLE);
+  BSP_Clock_SetProfile_IgnoreAndReturn(BSP_OK);
+  Log_Ignore();
+
+  TEST_ASSERT_EQUAL(LICOR_OK, LI8x0_Stream_Start(0.5f));
+}
+
+void tearDown(void)
+{
+}
+
+void test_LI8x0_Stream_Start_should_SetOutrate_and_RouteIsrToRing(void){
+  sLicorStreamStats_t stats;
+
+  TEST_ASSERT_EQUAL_STRING("<LI820><CFG><OUTRATE>0.5</OUTRATE></CFG></LI820>",LastMsg);
+  TEST_ASSERT_TRUE(LicorStreamActive);
+  TEST_ASSERT_EQUAL_FLOAT(0.5f,pLicor1->readconfig.cfg.outrate);
+
+  LI8x0_Stream_GetStats(&stats);
+  TEST_ASSERT_EQUAL(0,stats.frames);
+}
+
+void test_LI8x0_Stream_Stop_should_SkipFrameOnWire_and_AcceptAck(void){
+
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Stream_Stop());
+
+  TEST_ASSERT_EQUAL_STRING("<LI820><CFG><OUTRATE>0.0</OUTRATE></CFG></LI820>",LastMsg);
+  TEST_ASSERT_FALSE(LicorStreamActive);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f,pLicor1->readconfig.cfg.outrate);
+}
+
+void test_LI8x0_Stream_Read_should_ReturnEachFrameOnce_when_SplitAnywhere(void){
+  sLicorData_t data;
+  sLicorStreamStats_t stats;
+  char wire[RECORDED_CNT * 256];
+  char chunk[8];
+  uint16_t got = 0;
+  uint16_t i;
+  uint16_t len;
+
+  wire[0] = 0;
+  for(i=0;i<RECORDED_CNT;i++){
+    strcat(wire,Recorded[i]);
+  }
+
+  /** 7 byte UART bursts, main loop checks after every burst */
+  len = strlen(wire);
+  for(i=0;i<len;i+=7){
+    memset(chunk,0,sizeof(chunk));
+    strncpy(chunk,&wire[i],7);
+    Feed(chunk);
+    if(LICOR_OK == LI8x0_Stream_Read(&data)){
+      TEST_ASSERT_TRUE(got < RECORDED_CNT);
+      TEST_ASSERT_EQUAL_UINT32(RecordedRaw[got],data.raw.co2);
+      got++;
+    }
+  }
+
+  TEST_ASSERT_EQUAL(RECORDED_CNT,got);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f,401.60f,data.co2);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f,100.77f,data.cellpres);
+  TEST_ASSERT_EQUAL_UINT32(3870131,data.raw.co2ref);
+
+  LI8x0_Stream_GetStats(&stats);
+  TEST_ASSERT_EQUAL(RECORDED_CNT,stats.frames);
+  TEST_ASSERT_EQUAL(RECORDED_CNT,stats.read);
+  TEST_ASSERT_EQUAL(0,stats.skipped);
+  TEST_ASSERT_EQUAL(0,stats.overrun);
+  TEST_ASSERT_EQUAL(RECORDED_CNT,stats.lastSeq);
+}
+
+void test_LI8x0_Stream_Read_should_TakeNewest_and_CountSkipped(void){
+  sLicorData_t data;
+  sLicorStreamStats_t stats;
+
+  TEST_ASSERT_EQUAL(1,Feed(Recorded[0]));
+  TEST_ASSERT_EQUAL(1,Feed(Recorded[1]));
+  TEST_ASSERT_EQUAL(1,Feed(Recorded[2]));
+
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Stream_Read(&data));
+  TEST_ASSERT_EQUAL_UINT32(RecordedRaw[2],data.raw.co2);
+
+  /** Nothing new, nothing returned twice */
+  TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Stream_Read(&data));
+
+  LI8x0_Stream_GetStats(&stats);
+  TEST_ASSERT_EQUAL(3,stats.frames);
+  TEST_ASSERT_EQUAL(1,stats.read);
+  TEST_ASSERT_EQUAL(2,stats.skipped);
+  TEST_ASSERT_EQUAL(3,stats.lastSeq);
+}
+
+void test_LI8x0_Stream_RxChar_should_DropFrames_when_RingFull(void){
+  sLicorData_t data;
+  sLicorStreamStats_t stats;
+  uint16_t i;
+
+  for(i=0;i<LICOR_FRAME_CNT;i++){
+    TEST_ASSERT_EQUAL(1,Feed(Recorded[i % RECORDED_CNT]));
+  }
+  TEST_ASSERT_EQUAL(0,Feed(Recorded[4]));
+  TEST_ASSERT_EQUAL(0,Feed(Recorded[4]));
+
+  /** The newest frame that fit is returned */
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Stream_Read(&data));
+  TEST_ASSERT_EQUAL_UINT32(RecordedRaw[(LICOR_FRAME_CNT - 1) % RECORDED_CNT],data.raw.co2);
+
+  LI8x0_Stream_GetStats(&stats);
+  TEST_ASSERT_EQUAL(LICOR_FRAME_CNT,stats.frames);
+  TEST_ASSERT_EQUAL(2,stats.overrun);
+  TEST_ASSERT_EQUAL(LICOR_FRAME_CNT - 1,stats.skipped);
+
+  /** Room again */
+  TEST_ASSERT_EQUAL(1,Feed(Recorded[1]));
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Stream_Read(&data));
+  TEST_ASSERT_EQUAL_UINT32(RecordedRaw[1],data.raw.co2);
+}
+
+void test_LI8x0_Stream_RxChar_should_DropFrame_when_TooLong(void){
+  sLicorData_t data;
+  sLicorStreamStats_t stats;
+  uint16_t i;
+
+  for(i=0;i<LICOR_FRAME_LEN;i++){
+    TEST_ASSERT_FALSE(LI8x0_Stream_RxChar('x'));
+  }
+  TEST_ASSERT_FALSE(LI8x0_Stream_RxChar('\n'));
+  TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Stream_Read(&data));
+
+  TEST_ASSERT_EQUAL(1,Feed(Recorded[3]));
+  TEST_ASSERT_EQUAL(LICOR_OK,LI8x0_Stream_Read(&data));
+  TEST_ASSERT_EQUAL_UINT32(RecordedRaw[3],data.raw.co2);
+
+  LI8x0_Stream_GetStats(&stats);
+  TEST_ASSERT_EQUAL(1,stats.overrun);
+  TEST_ASSERT_EQUAL(1,stats.frames);
+}
+
+void test_LI8x0_Stream_Read_should_IgnoreNonDataFrames(void){
+  sLicorData_t data;
+
+  TEST_ASSERT_EQUAL(1,Feed(AckReply));
+  TEST_ASSERT_EQUAL(LICOR_FAIL,LI8x0_Stream_Read(&data));
+}
+
+/** Main loop: one read, checking order against the last frame read */
+static void hammer_read(uint32_t *last, uint32_t *errors, uint32_t *got)
+{
+  sLicorData_t data;
+
+  if(LICOR_OK == LI8x0_Stream_Read(&data)){
+    *errors += (data.raw.co2 <= *last);
+    *errors += (data.raw.co2ref != (data.raw.co2 + 999999ul));
+    *last = data.raw.co2;
+    (*got)++;
+  }
+}
+
+/** Simulated ISR and main loop interleaved: the main loop reads after */
+/** a pseudo-random number of received chars, anywhere in a frame, and */
+/** sometimes only after several frames have arrived */
+void test_LI8x0_Stream_should_NeverDuplicateOrReorder_between_ISR_and_MainLoop(void){
+  char frame[256];
+  const char *p;
+  sLicorStreamStats_t stats;
+  uint32_t seed = 12345u;
+  uint16_t gap = 1;
+  uint32_t last = 0;
+  uint32_t errors = 0;
+  uint32_t got = 0;
+  uint32_t i;
+
+  for(i=0;i<TEST_HAMMER_FRAMES;i++){
+    sprintf(frame,"<li820><data><co2>4.0%04lue2</co2><raw><co2>%lu</co2><co2ref>%lu</co2ref></raw></data></li820>\r\n",
+            (unsigned long)(i % 10000), (unsigned long)(i + 1), (unsigned long)(i + 1000000));
+    for(p=frame;*p!=0;p++){
+      LI8x0_Stream_RxChar(*p);
+      if(--gap == 0){
+        hammer_read(&last,&errors,&got);
+        seed = (seed * 1103515245u) + 12345u;
+        gap = 1 + (uint16_t)((seed >> 16) % 600u);
+      }
+    }
+  }
+  hammer_read(&last,&errors,&got);
+
+  LI8x0_Stream_GetStats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(0,errors);
+  TEST_ASSERT_EQUAL_UINT32(got,stats.read);
+
+  /** Every frame sent was read, replaced by a newer one, or dropped */
+  TEST_ASSERT_EQUAL_UINT32(TEST_HAMMER_FRAMES,(uint32_t)stats.frames + stats.overrun);
+  TEST_ASSERT_EQUAL_UINT32(stats.frames,(uint32_t)stats.read + stats.skipped);
+  TEST_ASSERT_TRUE(stats.skipped > 0);
+  TEST_ASSERT_TRUE(stats.overrun > 0);
+
+  /** The last read took the newest frame */
+  TEST_ASSERT_EQUAL_UINT32(stats.frames,stats.lastSeq);
+}
@@ -1,7 +1,6 @@
 #include "unity.h"
 #include "MAX310x.h"
 #include "mock_bsp.h"
-#include "mock_buffer8.h"
 
 sMAX310X_t MAX310X = {  .cs = { .port = MAX310X_CS_PORT,
                                 .pin = MAX310X_CS_PIN,
@@ -49,7 +48,6 @@ void mock_max_write(sMAX310X_t *MAX, uint8_t reg, uint8_t val){
     uint8_t reg_with_writebit = (0x80 | reg) ;
     reg_with_writebit |= (MAX->Port << 5);
     
-    Buffer8_Clear_Expect(&MAX->SPI.Tx);  
     BSP_GPIO_SetPin_Expect((sGPIO_t *)&MAX->cs);
     BSP_SPI_put_Expect(&MAX->SPI,val);
 
@@ -10,7 +10,6 @@
 #include "mock_timer_a.h"
 #include "mock_timer_b.h"
 
-#include "buffer8.h"
 #include "sysconfig.h"
 
 
@@ -892,26 +891,6 @@ void test_BSP_I2C_gets_should_ReadBytes_and_ReturnValues(void){
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedVal,value,len);
 }
 
-void test_BSP_I2C_SendMultiBytes_should_StartMultipleByteTransfer(void){
-    uint16_t baseAddr = 0x1C0A;
-    uint8_t values[16];
-    uint8_t i;
-    sI2C_t Test = {.baseAddress = EUSCI_B0_BASE};
-    /** Populate the tx buffer */
-    for(i=0;i<16;i++){
-        Buffer8_put(&Test.Tx,i*2);
-    }
-
-    EUSCI_B_I2C_setMode_Expect(EUSCI_B0_BASE,EUSCI_B_I2C_TRANSMIT_MODE);
-    EUSCI_B_I2C_masterSendStart_Expect(EUSCI_B0_BASE);
-
-    BSP_I2C_SendBytes(&Test);
-
-    for(i=0;i<16;i++){
-        TEST_ASSERT_EQUAL(i*2,EUSCI_B0.Tx.buf[i]);
-    }
-}
-
 void test_BSP_I2C_put_should_SendOneByte_and_ReturnValid(void){
     uint16_t baseAddr = 0x1C0A;
     uint8_t value = 0x16;
@@ -1,15 +0,0 @@
-#include "unity.h"
-#include "buffer32.h"
-
-void setUp(void)
-{
-}
-
-void tearDown(void)
-{
-}
-
-void test_buffer32_NeedToImplement(void)
-{
-    TEST_IGNORE_MESSAGE("Need to Implement buffer32");
-}
@@ -189,14 +189,14 @@ void test_BufferC_puts_should_Block_StringsOverLength(void){
 }
 
 
-void test_BufferC_Scan_should_ReturnValidIndex(void){
-	uint16_t i;
-	char teststr[] = "AAAAAAAAAAAAAAAAAAAABAAAAAAAAAA";
+void test_BufferC_PeekLine_should_ReturnValidIndex(void){
+	sBufferCSpan_t span[2];
+	char teststr[] = "AAAAAAAAAAAAAAAAAAAA\nAAAAAAAAAA";
 	uint16_t testlen = sizeof(teststr)/sizeof(teststr[0]);
 	
 	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_puts(&TestBuf,&teststr[0],testlen));
 
-	TEST_ASSERT_EQUAL(21,BufferC_Scan(&TestBuf,'B'));
+	TEST_ASSERT_EQUAL(21,BufferC_PeekLine(&TestBuf,span));
 
 }
 
@@ -240,4 +240,70 @@ void test_BufferC_gets_Should_ReturnInvalid_if_CharDoesntExist(void){
 	TEST_ASSERT_EQUAL(BUFFER_C_NO_STRING,BufferC_gets(&TestBuf,&retstr[0],retlen));
 	
 
-}
\ No newline at end of file
+}
+
+void test_BufferC_Lines_should_CountCompleteLines(void){
+	char teststr[] = "TEST1\r\nTEST2\r\nTES";
+	char retstr[64] = "";
+
+	TEST_ASSERT_EQUAL(0,BufferC_Lines(&TestBuf));
+	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_puts(&TestBuf,&teststr[0],strlen(teststr)));
+	TEST_ASSERT_EQUAL(2,BufferC_Lines(&TestBuf));
+
+	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_gets(&TestBuf,&retstr[0],64));
+	TEST_ASSERT_EQUAL(1,BufferC_Lines(&TestBuf));
+
+	/** Backspacing over a line end removes the line */
+	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_putc(&TestBuf,'\n'));
+	TEST_ASSERT_EQUAL(2,BufferC_Lines(&TestBuf));
+	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_Backspace(&TestBuf));
+	TEST_ASSERT_EQUAL(1,BufferC_Lines(&TestBuf));
+}
+
+void test_BufferC_PeekLine_should_ReturnTwoSpans_across_Wrap(void){
+	sBufferCSpan_t span[2];
+	char teststr[] = "ABCDEFGH\n";
+
+	/** Start 4 short of the end of the storage */
+	TestBuf.write = BUFFER_C_SIZE-4;
+	TestBuf.read = BUFFER_C_SIZE-4;
+
+	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_puts(&TestBuf,&teststr[0],strlen(teststr)));
+	TEST_ASSERT_EQUAL(9,BufferC_PeekLine(&TestBuf,span));
+	TEST_ASSERT_EQUAL(4,span[0].len);
+	TEST_ASSERT_EQUAL_MEMORY("ABCD",span[0].data,4);
+	TEST_ASSERT_EQUAL(5,span[1].len);
+	TEST_ASSERT_EQUAL_MEMORY("EFGH\n",span[1].data,5);
+
+	/** Peek leaves the data in place */
+	TEST_ASSERT_EQUAL(9,TestBuf.size);
+	TEST_ASSERT_EQUAL(1,BufferC_Lines(&TestBuf));
+
+	BufferC_Commit(&TestBuf,9);
+	TEST_ASSERT_EQUAL(0,TestBuf.size);
+	TEST_ASSERT_EQUAL(0,BufferC_Lines(&TestBuf));
+	TEST_ASSERT_EQUAL(0,BufferC_PeekLine(&TestBuf,span));
+}
+
+void test_BufferC_PeekLine_should_ReturnZero_for_PartialLine(void){
+	sBufferCSpan_t span[2];
+	char teststr[] = "PARTIAL";
+
+	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_puts(&TestBuf,&teststr[0],strlen(teststr)));
+	TEST_ASSERT_EQUAL(0,BufferC_PeekLine(&TestBuf,span));
+	TEST_ASSERT_EQUAL(7,BufferC_Peek(&TestBuf,span));
+	TEST_ASSERT_EQUAL(7,span[0].len);
+	TEST_ASSERT_EQUAL(0,span[1].len);
+}
+
+void test_BufferC_Clear_should_ResetIndexes(void){
+	char teststr[] = "TEST1\r\n";
+
+	TEST_ASSERT_EQUAL(BUFFER_C_OK,BufferC_puts(&TestBuf,&teststr[0],strlen(teststr)));
+	BufferC_Clear(&TestBuf);
+
+	TEST_ASSERT_EQUAL(0,TestBuf.size);
+	TEST_ASSERT_EQUAL(0,TestBuf.read);
+	TEST_ASSERT_EQUAL(0,TestBuf.write);
+	TEST_ASSERT_EQUAL(0,BufferC_Lines(&TestBuf));
+}
@@ -30,7 +30,7 @@ void test_CONSOLEIO_Init_should_Fail_if_Console_doesnt_Init(void){
 
     /* Expect */
     BSP_UART_Init_ExpectAndReturn(&Console,BSP_FAIL);
-    Error_Expect(ERROR_MSG_0010,LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0010, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(CONSOLEIO_FAIL, CONSOLEIO_Init(&Console));
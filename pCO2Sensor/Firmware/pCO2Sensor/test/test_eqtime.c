@@ -0,0 +1,68 @@
+#include "unity.h"
+#include "eqtime.h"
+
+sEqTime_t Eq;
+
+void setUp(void)
+{
+	/** 10 minute equilibration, 2 minute Licor warmup */
+	Eq.equil = 600;
+	Eq.warmup = 120;
+	Eq.slope = false;
+	Eq.minimum = 300;
+}
+
+void tearDown(void)
+{
+}
+
+void test_EQTIME_Target_should_UseMinimum_onlyWithSlope(void){
+	TEST_ASSERT_EQUAL_UINT16(600,EQTIME_Target(&Eq));
+	Eq.slope = true;
+	TEST_ASSERT_EQUAL_UINT16(300,EQTIME_Target(&Eq));
+	Eq.minimum = 900;
+	TEST_ASSERT_EQUAL_UINT16(600,EQTIME_Target(&Eq));
+}
+
+void test_EQTIME_Prequil_should_SubtractWarmup(void){
+	TEST_ASSERT_EQUAL_UINT16(480,EQTIME_Prequil(&Eq));
+	Eq.slope = true;
+	TEST_ASSERT_EQUAL_UINT16(180,EQTIME_Prequil(&Eq));
+
+	/** Warmup as long as the target leaves the whole target Licor-off */
+	Eq.warmup = 600;
+	Eq.slope = false;
+	TEST_ASSERT_EQUAL_UINT16(600,EQTIME_Prequil(&Eq));
+}
+
+void test_EQTIME_Hold_should_BeZero_forFullWarmup(void){
+	TEST_ASSERT_EQUAL_UINT16(0,EQTIME_Hold(&Eq,EQTIME_Prequil(&Eq),Eq.warmup));
+}
+
+void test_EQTIME_Hold_should_FillEquil_whenWarmupEndsEarly(void){
+	uint16_t prequil = EQTIME_Prequil(&Eq);
+	uint16_t warm;
+
+	for(warm=0;warm<=Eq.warmup;warm+=15){
+		uint16_t hold = EQTIME_Hold(&Eq,prequil,warm);
+		TEST_ASSERT_TRUE(((uint32_t)prequil + warm + hold) >= Eq.equil);
+		TEST_ASSERT_EQUAL_UINT16(Eq.warmup - warm,hold);
+	}
+}
+
+void test_EQTIME_Hold_should_FillMinimum_withSlope(void){
+	uint16_t prequil;
+	uint16_t warm;
+
+	Eq.slope = true;
+	prequil = EQTIME_Prequil(&Eq);
+	for(warm=0;warm<=Eq.warmup;warm+=15){
+		uint16_t hold = EQTIME_Hold(&Eq,prequil,warm);
+		TEST_ASSERT_EQUAL_UINT32(Eq.minimum,(uint32_t)prequil + warm + hold);
+	}
+}
+
+void test_EQTIME_Hold_should_BeZero_whenPumpedPastTarget(void){
+	TEST_ASSERT_EQUAL_UINT16(0,EQTIME_Hold(&Eq,600,120));
+	TEST_ASSERT_EQUAL_UINT16(0,EQTIME_Hold(&Eq,0xFFFF,0xFFFF));
+}
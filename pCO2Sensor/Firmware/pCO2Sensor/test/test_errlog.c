@@ -0,0 +1,126 @@
+#include "unity.h"
+#include "errlog.h"
+#include <string.h>
+
+static sErrLog_t Log;
+
+void setUp(void)
+{
+    memset(&Log, 0, sizeof(Log));
+}
+
+void tearDown(void)
+{
+}
+
+void test_ERRLOG_Id_and_Text_should_Follow_Table(void)
+{
+    TEST_ASSERT_EQUAL_HEX32(0x01010001, ERRLOG_Id(ERROR_MSG_01010001));
+    TEST_ASSERT_EQUAL_STRING("Startup Error", ERRLOG_Text(ERROR_MSG_01010001));
+
+    TEST_ASSERT_EQUAL_HEX32(0x00010A05, ERRLOG_Id(ERROR_MSG_00010A05));
+    TEST_ASSERT_EQUAL_STRING("PCO2 PRG5 Fail", ERRLOG_Text(ERROR_MSG_00010A05));
+
+    TEST_ASSERT_EQUAL_HEX32(0x00400200, ERRLOG_Id(ERROR_MSG_00400200));
+    TEST_ASSERT_EQUAL_STRING("RH I2C Failure", ERRLOG_Text(ERROR_MSG_00400200));
+
+    TEST_ASSERT_EQUAL_HEX32(0x00801000, ERRLOG_Id(ERROR_MSG_00801000));
+    TEST_ASSERT_EQUAL_STRING("No Pump", ERRLOG_Text(ERROR_MSG_00801000));
+
+    TEST_ASSERT_EQUAL_HEX32(0, ERRLOG_Id(ERROR_CNT));
+    TEST_ASSERT_EQUAL_STRING("Unknown Error", ERRLOG_Text(ERROR_CNT));
+}
+
+void test_ERRLOG_Flag_should_Set_GroupWord(void)
+{
+    uint16_t flags[ERRLOG_FLAG_CNT];
+
+    memset(flags, 0, sizeof(flags));
+    ERRLOG_Flag(ERROR_MSG_00010020, flags);
+    ERRLOG_Flag(ERROR_MSG_00010A00, flags);
+    ERRLOG_Flag(ERROR_MSG_00200800, flags);
+    TEST_ASSERT_EQUAL_HEX16(0x0A20, flags[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0800, flags[5]);
+
+    /** Latest only in the top two groups */
+    ERRLOG_Flag(ERROR_MSG_00400010, flags);
+    ERRLOG_Flag(ERROR_MSG_00400200, flags);
+    TEST_ASSERT_EQUAL_HEX16(0x0200, flags[6]);
+
+    /** System and short ids are not flagged */
+    ERRLOG_Flag(ERROR_MSG_01010030, flags);
+    ERRLOG_Flag(ERROR_MSG_0130, flags);
+    TEST_ASSERT_EQUAL_HEX16(0x0A20, flags[0]);
+    TEST_ASSERT_EQUAL_HEX16(0, flags[1]);
+}
+
+void test_ERRLOG_Add_should_Keep_Order(void)
+{
+    sErrLogEntry_t e;
+
+    ERRLOG_NewRun(&Log);
+    ERRLOG_Add(&Log, ERROR_MSG_00400010, 3, 1000);
+    ERRLOG_Add(&Log, ERROR_MSG_00010002, 0, 1005);
+
+    TEST_ASSERT_EQUAL(2, ERRLOG_Count(&Log));
+    TEST_ASSERT_TRUE(ERRLOG_Get(&Log, 0, &e));
+    TEST_ASSERT_EQUAL(ERROR_MSG_00400010, e.code);
+    TEST_ASSERT_EQUAL(3, e.arg);
+    TEST_ASSERT_EQUAL(1000, e.epoch);
+    TEST_ASSERT_EQUAL(1, e.run);
+    TEST_ASSERT_TRUE(ERRLOG_Get(&Log, 1, &e));
+    TEST_ASSERT_EQUAL(ERROR_MSG_00010002, e.code);
+    TEST_ASSERT_FALSE(ERRLOG_Get(&Log, 2, &e));
+}
+
+void test_ERRLOG_Add_should_Overwrite_Oldest_on_Wrap(void)
+{
+    sErrLogEntry_t e;
+    uint16_t i;
+
+    for (i = 0; i < (ERRLOG_SIZE + 5); i++)
+    {
+        if ((i % 10) == 0)
+        {
+            ERRLOG_NewRun(&Log);
+        }
+        ERRLOG_Add(&Log, ERROR_MSG_00400010, i, 2000 + i);
+    }
+
+    TEST_ASSERT_EQUAL(ERRLOG_SIZE, ERRLOG_Count(&Log));
+    for (i = 0; i < ERRLOG_SIZE; i++)
+    {
+        TEST_ASSERT_TRUE(ERRLOG_Get(&Log, i, &e));
+        TEST_ASSERT_EQUAL(i + 5, e.arg);
+        TEST_ASSERT_EQUAL(2000 + i + 5, e.epoch);
+        TEST_ASSERT_EQUAL(((i + 5) / 10) + 1, e.run);
+    }
+}
+
+void test_ERRLOG_Clear_should_Keep_RunNumber(void)
+{
+    sErrLogEntry_t e;
+
+    ERRLOG_NewRun(&Log);
+    ERRLOG_NewRun(&Log);
+    ERRLOG_Add(&Log, ERROR_MSG_00400010, 0, 0);
+    ERRLOG_Clear(&Log);
+    TEST_ASSERT_EQUAL(0, ERRLOG_Count(&Log));
+    TEST_ASSERT_FALSE(ERRLOG_Get(&Log, 0, &e));
+
+    ERRLOG_Add(&Log, ERROR_MSG_00400020, 0, 0);
+    TEST_ASSERT_TRUE(ERRLOG_Get(&Log, 0, &e));
+    TEST_ASSERT_EQUAL(2, e.run);
+}
+
+void test_ERRLOG_should_Clear_Corrupt_History(void)
+{
+    Log.head = ERRLOG_SIZE + 3;
+    Log.count = 7;
+    TEST_ASSERT_EQUAL(0, ERRLOG_Count(&Log));
+
+    Log.head = 0;
+    Log.count = ERRLOG_SIZE + 1;
+    ERRLOG_Add(&Log, ERROR_MSG_00400010, 0, 0);
+    TEST_ASSERT_EQUAL(1, ERRLOG_Count(&Log));
+}
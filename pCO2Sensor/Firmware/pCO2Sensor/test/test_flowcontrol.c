@@ -48,7 +48,7 @@ void test_FLOW_Startup_should_Fail_forInvalidBaudSetup(void){
     mock_power_on(&Flow.Power);
     MAX310X_Wakeup_Expect(&Flow.UART);
     MAX310X_SetBaudrate_ExpectAndReturn(&Flow.UART,9600,MAX310X_FAIL);
-    Error_Expect(ERROR_MSG_4000,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_4000, 0);
 
     // Act
     TEST_ASSERT_EQUAL(FLOW_FAIL,FLOW_Startup(&Flow));
@@ -74,8 +74,8 @@ void test_FLOW_Init_should_Fail_for_BadStartup(void){
     mock_power_on(&Flow.Power);
     MAX310X_Wakeup_Expect(&Flow.UART);
     MAX310X_SetBaudrate_ExpectAndReturn(&Flow.UART,9600,MAX310X_FAIL);
-    Error_Expect(ERROR_MSG_4000,LOG_Priority_Med);
-    Error_Expect(ERROR_MSG_4001,LOG_Priority_High);
+    Error_Expect(ERROR_MSG_4000, 0);
+    Error_Expect(ERROR_MSG_4001, 0);
     // Act
     TEST_ASSERT_EQUAL(FLOW_FAIL,FLOW_Init());
 }
@@ -138,7 +138,7 @@ void test_FLOW_SetMode_should_Fail_with_Error_for_BadSend(void){
 
     // Expect
     MAX310X_Send_ExpectAndReturn(&Flow.UART,mode,len,MAX310X_FAIL);
-    Error_Expect(ERROR_MSG_4011,LOG_Priority_High);
+    Error_Expect(ERROR_MSG_4011, 0);
 
     // Act
     TEST_ASSERT_EQUAL(FLOW_FAIL,FLOW_SetMode(state));
@@ -155,7 +155,7 @@ void test_FLOW_SetMode_should_Fail_with_Error_for_BadResponse(void){
     MAX310X_Send_ExpectAndReturn(&Flow.UART,mode,len,MAX310X_OK);
     _delay_ms_Expect(100);
     MAX310X_Read_IgnoreAndReturn(UART_NACK);
-    Error_Expect(ERROR_MSG_4012,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_4012, 0);
 
     // Act
     TEST_ASSERT_EQUAL(FLOW_FAIL,FLOW_SetMode(state));
@@ -184,7 +184,7 @@ void test_FLOW_GetMode_should_FailWithError_if_MsgDoesNotSend(void){
 
     // Expect
     MAX310X_Send_ExpectAndReturn(&Flow.UART,str,strlen(str),MAX310X_FAIL);
-    Error_Expect(ERROR_MSG_4013,LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_4013, 0);
     // Act
     TEST_ASSERT_EQUAL(FLOW_FAIL,FLOW_GetMode());
 }
@@ -201,7 +201,7 @@ void test_FLOW_GetMode_should_FailWithError_if_NoData_is_read(void){
         MAX310X_Read_IgnoreAndReturn(MAX310X_FAIL);
     }
     
-    Error_Expect(ERROR_MSG_4014,LOG_Priority_High);
+    Error_Expect(ERROR_MSG_4014, 0);
     // Act
     TEST_ASSERT_EQUAL(FLOW_FAIL,FLOW_GetMode());
 }
\ No newline at end of file
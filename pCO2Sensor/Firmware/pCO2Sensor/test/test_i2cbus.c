@@ -0,0 +1,244 @@
+#include "unity.h"
+#include "i2cbus.h"
+#include "mock_gpio.h"
+#include <string.h>
+
+#define TEST_FOREVER (0xFFu)
+
+/** Open drain pin model */
+typedef struct
+{
+    bool out;      /**< Master driving it */
+    bool low;      /**< Output latch low */
+    bool periph;   /**< Back on the eUSCI */
+    uint8_t func;  /**< Function it was handed back with */
+} sTestPin_t;
+
+static const sI2CBusPins_t Pins = {.sdaPort = I2C_B0_SDA_PORT,
+                                   .sdaPin = I2C_B0_SDA_PIN,
+                                   .sclPort = I2C_B0_SCL_PORT,
+                                   .sclPin = I2C_B0_SCL_PIN,
+                                   .function = I2C_B0_FUNCTION};
+
+static sTestPin_t Sda;
+static sTestPin_t Scl;
+
+/** Slave: holds SDA low for this many more clocks, or SCL low */
+static uint8_t HoldSda;
+static bool HoldScl;
+
+/** Wire: SCL rising edges and STOP conditions seen */
+static uint8_t Clocks;
+static uint8_t Stops;
+static bool SdaLevel;
+static bool SclLevel;
+
+static sTestPin_t *Pin(uint8_t port, uint16_t pin)
+{
+    if ((port == Pins.sdaPort) && (pin == Pins.sdaPin))
+    {
+        return &Sda;
+    }
+    TEST_ASSERT_EQUAL(Pins.sclPort, port);
+    TEST_ASSERT_EQUAL_HEX16(Pins.sclPin, pin);
+    return &Scl;
+}
+
+static bool Line(sTestPin_t *p, bool held)
+{
+    return !((p->out && p->low) || held);
+}
+
+/** Settle the wire and look for edges */
+static void Update(void)
+{
+    bool scl = Line(&Scl, HoldScl);
+    bool sda;
+
+    /** The slave moves SDA while SCL is low */
+    if ((SclLevel == true) && (scl == false) && (HoldSda > 0) && (HoldSda != TEST_FOREVER))
+    {
+        HoldSda--;
+    }
+    if ((SclLevel == false) && (scl == true))
+    {
+        Clocks++;
+    }
+
+    sda = Line(&Sda, HoldSda > 0);
+    if ((SdaLevel == false) && (sda == true) && (scl == true))
+    {
+        Stops++;
+    }
+
+    SclLevel = scl;
+    SdaLevel = sda;
+}
+
+static void Gpio_Input(uint8_t port, uint16_t pin, int cmock_num_calls)
+{
+    sTestPin_t *p = Pin(port, pin);
+    (void)cmock_num_calls;
+
+    p->out = false;
+    p->periph = false;
+    Update();
+}
+
+static void Gpio_Output(uint8_t port, uint16_t pin, int cmock_num_calls)
+{
+    sTestPin_t *p = Pin(port, pin);
+    (void)cmock_num_calls;
+
+    /** Driving high would fight the slave */
+    TEST_ASSERT_TRUE(p->low);
+    p->out = true;
+    p->periph = false;
+    Update();
+}
+
+static void Gpio_Low(uint8_t port, uint16_t pin, int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    Pin(port, pin)->low = true;
+    Update();
+}
+
+static uint8_t Gpio_Read(uint8_t port, uint16_t pin, int cmock_num_calls)
+{
+    sTestPin_t *p = Pin(port, pin);
+    (void)cmock_num_calls;
+
+    return Line(p, (p == &Sda) ? (HoldSda > 0) : HoldScl) ? GPIO_INPUT_PIN_HIGH : GPIO_INPUT_PIN_LOW;
+}
+
+static void Gpio_Periph(uint8_t port, uint16_t pin, uint8_t mode, int cmock_num_calls)
+{
+    sTestPin_t *p = Pin(port, pin);
+    (void)cmock_num_calls;
+
+    p->out = false;
+    p->periph = true;
+    p->func = mode;
+    Update();
+}
+
+void setUp(void)
+{
+    memset(&Sda, 0, sizeof(Sda));
+    memset(&Scl, 0, sizeof(Scl));
+    Sda.periph = true;
+    Scl.periph = true;
+    HoldSda = 0;
+    HoldScl = false;
+    Clocks = 0;
+    Stops = 0;
+    SdaLevel = true;
+    SclLevel = true;
+
+    GPIO_setAsInputPin_StubWithCallback(Gpio_Input);
+    GPIO_setAsOutputPin_StubWithCallback(Gpio_Output);
+    GPIO_setOutputLowOnPin_StubWithCallback(Gpio_Low);
+    GPIO_getInputPinValue_StubWithCallback(Gpio_Read);
+    GPIO_setAsPeripheralModuleFunctionOutputPin_StubWithCallback(Gpio_Periph);
+}
+
+void tearDown(void)
+{
+}
+
+static void Assert_PinsReturned(void)
+{
+    TEST_ASSERT_TRUE(Sda.periph);
+    TEST_ASSERT_TRUE(Scl.periph);
+    TEST_ASSERT_EQUAL(I2C_B0_FUNCTION, Sda.func);
+    TEST_ASSERT_EQUAL(I2C_B0_FUNCTION, Scl.func);
+}
+
+void test_I2CBUS_Recover_should_Stop_FreeBus(void)
+{
+    TEST_ASSERT_EQUAL(I2CBUS_OK, I2CBUS_Recover(&Pins));
+
+    /** Just the STOP */
+    TEST_ASSERT_EQUAL(1, Clocks);
+    TEST_ASSERT_EQUAL(1, Stops);
+    Assert_PinsReturned();
+}
+
+void test_I2CBUS_Recover_should_ClockOut_HeldSda(void)
+{
+    const uint8_t held[] = {1, 5, I2CBUS_MAX_CLOCKS};
+    uint8_t i;
+
+    for (i = 0; i < sizeof(held); i++)
+    {
+        setUp();
+        HoldSda = held[i];
+
+        TEST_ASSERT_EQUAL(I2CBUS_OK, I2CBUS_Recover(&Pins));
+        TEST_ASSERT_EQUAL(0, HoldSda);
+        TEST_ASSERT_FALSE(I2CBUS_Stuck(&Pins));
+
+        /** One clock per held bit, then the STOP */
+        TEST_ASSERT_EQUAL(held[i] + 1, Clocks);
+        TEST_ASSERT_EQUAL(1, Stops);
+        Assert_PinsReturned();
+    }
+}
+
+void test_I2CBUS_Recover_should_GiveUp_after_MaxClocks(void)
+{
+    HoldSda = TEST_FOREVER;
+
+    TEST_ASSERT_EQUAL(I2CBUS_FAIL, I2CBUS_Recover(&Pins));
+    TEST_ASSERT_EQUAL(I2CBUS_MAX_CLOCKS + 1, Clocks);
+    TEST_ASSERT_EQUAL(0, Stops);
+    Assert_PinsReturned();
+}
+
+void test_I2CBUS_Recover_should_Fail_on_HeldScl(void)
+{
+    HoldScl = true;
+    SclLevel = false;
+
+    TEST_ASSERT_EQUAL(I2CBUS_FAIL, I2CBUS_Recover(&Pins));
+    TEST_ASSERT_EQUAL(0, Clocks);
+    Assert_PinsReturned();
+}
+
+void test_I2CBUS_Classify_should_Prefer_StuckLines_then_Flags(void)
+{
+    TEST_ASSERT_EQUAL(I2C_FAULT_NACK, I2CBUS_Classify(UCNACKIFG, &Pins));
+    TEST_ASSERT_EQUAL(I2C_FAULT_ARBLOST, I2CBUS_Classify(UCALIFG | UCNACKIFG, &Pins));
+    TEST_ASSERT_EQUAL(I2C_FAULT_TIMEOUT, I2CBUS_Classify(0, &Pins));
+
+    HoldSda = TEST_FOREVER;
+    TEST_ASSERT_EQUAL(I2C_FAULT_STUCK, I2CBUS_Classify(UCNACKIFG, &Pins));
+
+    HoldSda = 0;
+    HoldScl = true;
+    TEST_ASSERT_EQUAL(I2C_FAULT_STUCK, I2CBUS_Classify(0, &Pins));
+}
+
+void test_I2CBUS_Count_should_Saturate(void)
+{
+    sI2CFaults_t faults;
+
+    memset(&faults, 0, sizeof(faults));
+    I2CBUS_Count(&faults, I2C_FAULT_NACK);
+    I2CBUS_Count(&faults, I2C_FAULT_STUCK);
+    I2CBUS_Count(&faults, I2C_FAULT_STUCK);
+    I2CBUS_Count(&faults, I2C_FAULT_CNT);
+    TEST_ASSERT_EQUAL(1, faults.count[I2C_FAULT_NACK]);
+    TEST_ASSERT_EQUAL(0, faults.count[I2C_FAULT_ARBLOST]);
+    TEST_ASSERT_EQUAL(2, faults.count[I2C_FAULT_STUCK]);
+    TEST_ASSERT_EQUAL(0, faults.count[I2C_FAULT_TIMEOUT]);
+
+    faults.count[I2C_FAULT_TIMEOUT] = UINT16_MAX;
+    I2CBUS_Count(&faults, I2C_FAULT_TIMEOUT);
+    TEST_ASSERT_EQUAL(UINT16_MAX, faults.count[I2C_FAULT_TIMEOUT]);
+
+    TEST_ASSERT_EQUAL_STRING("STUCK", I2CBUS_FaultName(I2C_FAULT_STUCK));
+    TEST_ASSERT_EQUAL_STRING("?", I2CBUS_FaultName(I2C_FAULT_CNT));
+}
@@ -0,0 +1,467 @@
+#include "unity.h"
+#include "i2cq.h"
+#include <stdio.h>
+
+#define TEST_LOG_LEN (256)
+#define TEST_DONE_MAX (16)
+#define TEST_NONE (0xFFu)
+#define TEST_TXBUF_EMPTY (0xFFFFu)
+
+/** eUSCI_B register model */
+typedef struct
+{
+    uint16_t CTLW0;
+    uint16_t CTLW1;
+    uint16_t I2CSA;
+    uint16_t IE;
+    uint16_t IFG;
+    uint16_t IV;
+    uint16_t TXBUF;
+    uint16_t RXBUF;
+} sTestBus_t;
+
+/** Register slave on the bus: first byte written sets the pointer */
+typedef struct
+{
+    uint8_t addr;
+    uint8_t mem[32];
+    uint8_t ptr;
+    bool addressed;
+    bool nackAddr;
+    uint8_t nackAt;
+    bool stall;
+} sTestSlave_t;
+
+typedef enum
+{
+    BUS_IDLE,
+    BUS_TX,
+    BUS_RX
+} eTestBusMode_t;
+
+static sTestBus_t Bus;
+static sTestSlave_t Slave;
+static eTestBusMode_t Mode;
+static uint8_t TxCount;
+static char Wire[TEST_LOG_LEN];
+static uint8_t Wakes;
+
+static sI2CQ_t Q = {.Reg = {.CTLW0 = &Bus.CTLW0,
+                            .CTLW1 = &Bus.CTLW1,
+                            .I2CSA = &Bus.I2CSA,
+                            .IE = &Bus.IE,
+                            .IFG = &Bus.IFG,
+                            .IV = &Bus.IV,
+                            .TXBUF = &Bus.TXBUF,
+                            .RXBUF = &Bus.RXBUF}};
+
+/** Completion record */
+static uintptr_t DoneId[TEST_DONE_MAX];
+static eI2CQResult_t DoneResult[TEST_DONE_MAX];
+static uint8_t DoneCnt;
+
+static void Record(eI2CQResult_t result, void *ctx)
+{
+    if (DoneCnt < TEST_DONE_MAX)
+    {
+        DoneId[DoneCnt] = (uintptr_t)ctx;
+        DoneResult[DoneCnt] = result;
+        DoneCnt++;
+    }
+}
+
+static void Log(const char *fmt, unsigned val)
+{
+    char str[16];
+
+    sprintf(str, fmt, val);
+    strncat(Wire, str, TEST_LOG_LEN - strlen(Wire) - 1);
+}
+
+static void Irq(uint16_t iv)
+{
+    Bus.IV = iv;
+    if (true == I2CQ_ISR(&Q))
+    {
+        Wakes++;
+    }
+}
+
+/** Bus condition: START, repeated START or STOP on the wire */
+static void Bus_Start(void)
+{
+    bool read = (0 == (Bus.CTLW0 & UCTR));
+
+    Bus.CTLW0 &= ~UCTXSTT;
+    Log((Mode == BUS_IDLE) ? " S%02X" : " Sr%02X", Bus.I2CSA);
+    Log(read ? "R" : "W", 0);
+
+    if ((Bus.I2CSA != Slave.addr) || (true == Slave.nackAddr))
+    {
+        Log(" N", 0);
+        Mode = BUS_TX;
+        Irq(USCI_I2C_UCNACKIFG);
+        return;
+    }
+
+    Mode = read ? BUS_RX : BUS_TX;
+    TxCount = 0;
+    Slave.addressed = false;
+}
+
+static void Bus_Stop(void)
+{
+    Bus.CTLW0 &= ~UCTXSTP;
+    Mode = BUS_IDLE;
+    Log(" P", 0);
+    Irq(USCI_I2C_UCSTPIFG);
+}
+
+/** One transmit slot: TXIFG, then the byte written (if any) goes out */
+static bool Bus_Tx(void)
+{
+    uint8_t val;
+
+    Bus.TXBUF = TEST_TXBUF_EMPTY;
+    Irq(USCI_I2C_UCTXIFG0);
+    if (Bus.TXBUF == TEST_TXBUF_EMPTY)
+    {
+        return false;
+    }
+
+    val = (uint8_t)Bus.TXBUF;
+    Log(" %02X", val);
+    if (TxCount++ == Slave.nackAt)
+    {
+        Log(" N", 0);
+        Irq(USCI_I2C_UCNACKIFG);
+        return true;
+    }
+
+    if (false == Slave.addressed)
+    {
+        Slave.ptr = val;
+        Slave.addressed = true;
+    }
+    else
+    {
+        Slave.mem[Slave.ptr++ & 0x1Fu] = val;
+    }
+    return true;
+}
+
+/** One receive slot: STOP set before the byte ends makes it the last */
+static void Bus_Rx(void)
+{
+    bool last = (0 != (Bus.CTLW0 & UCTXSTP));
+
+    Bus.RXBUF = Slave.mem[Slave.ptr++ & 0x1Fu];
+    Log(" .%02X", Bus.RXBUF);
+    Irq(USCI_I2C_UCRXIFG0);
+    if (true == last)
+    {
+        Bus_Stop();
+    }
+}
+
+/** Clock the bus until it has nothing left to do */
+static void Bus_Run(void)
+{
+    uint16_t guard;
+
+    for (guard = 0; guard < 500; guard++)
+    {
+        if ((Bus.CTLW0 & UCSWRST) || (true == Slave.stall))
+        {
+            return;
+        }
+        if (Bus.CTLW0 & UCTXSTT)
+        {
+            Bus_Start();
+        }
+        else if (Mode == BUS_RX)
+        {
+            Bus_Rx();
+        }
+        else if (Bus.CTLW0 & UCTXSTP)
+        {
+            Bus_Stop();
+        }
+        else if (Mode == BUS_TX)
+        {
+            /** Nothing written and no START/STOP asked for: bus waits */
+            if ((false == Bus_Tx()) && (0 == (Bus.CTLW0 & (UCTXSTT | UCTXSTP))))
+            {
+                return;
+            }
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+static sI2CQXfer_t Xfer(uint8_t addr, const uint8_t *tx, uint8_t txLen, uint8_t *rx, uint8_t rxLen, uintptr_t id)
+{
+    sI2CQXfer_t x = {.addr = addr, .tx = tx, .txLen = txLen, .rx = rx, .rxLen = rxLen, .done = Record, .ctx = (void *)id};
+    return x;
+}
+
+void setUp(void)
+{
+    uint8_t i;
+
+    memset(&Bus, 0, sizeof(Bus));
+    memset(&Slave, 0, sizeof(Slave));
+    Bus.CTLW0 = UCSWRST;
+    Bus.CTLW1 = UCASTP1;
+    Slave.addr = 0x69;
+    Slave.nackAt = TEST_NONE;
+    for (i = 0; i < sizeof(Slave.mem); i++)
+    {
+        Slave.mem[i] = (uint8_t)(0x40 + i);
+    }
+    Mode = BUS_IDLE;
+    Wire[0] = '\0';
+    Wakes = 0;
+    DoneCnt = 0;
+
+    I2CQ_Init(&Q);
+}
+
+void tearDown(void)
+{
+}
+
+void test_I2CQ_Submit_should_TakeBus_and_ReadRegisters(void)
+{
+    const uint8_t reg = 0x02;
+    uint8_t rx[3] = {0};
+    sI2CQXfer_t x = Xfer(0x69, &reg, 1, rx, 3, 1);
+
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &x));
+
+    /** Out of reset, no auto STOP, queue interrupts, START sent */
+    TEST_ASSERT_TRUE(I2CQ_Busy(&Q));
+    TEST_ASSERT_EQUAL_HEX16(0, Bus.CTLW0 & UCSWRST);
+    TEST_ASSERT_EQUAL_HEX16(0, Bus.CTLW1 & (UCASTP0 | UCASTP1));
+    TEST_ASSERT_EQUAL_HEX16(0x69, Bus.I2CSA);
+    TEST_ASSERT_EQUAL_HEX16(I2CQ_IE, Bus.IE);
+    TEST_ASSERT_EQUAL_HEX16(UCTR | UCTXSTT, Bus.CTLW0 & (UCTR | UCTXSTT));
+
+    Bus_Run();
+
+    TEST_ASSERT_EQUAL_STRING(" S69W 02 Sr69R .42 .43 .44 P", Wire);
+    TEST_ASSERT_EQUAL_HEX8(0x42, rx[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x43, rx[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x44, rx[2]);
+    TEST_ASSERT_EQUAL(1, DoneCnt);
+    TEST_ASSERT_EQUAL(I2CQ_DONE, DoneResult[0]);
+    TEST_ASSERT_EQUAL(1, Wakes);
+    TEST_ASSERT_EQUAL(1, Q.done);
+    TEST_ASSERT_FALSE(I2CQ_Busy(&Q));
+
+    /** Bus handed back with the queue interrupts off */
+    TEST_ASSERT_EQUAL_HEX16(0, Bus.IE);
+}
+
+void test_I2CQ_should_Run_Transfers_in_SubmitOrder(void)
+{
+    const uint8_t wr[3] = {0x10, 0xAA, 0xBB};
+    const uint8_t reg = 0x10;
+    uint8_t rx[2] = {0};
+    sI2CQXfer_t a = Xfer(0x69, wr, 3, NULL, 0, 1);
+    sI2CQXfer_t b = Xfer(0x69, &reg, 1, rx, 2, 2);
+    sI2CQXfer_t c = Xfer(0x69, NULL, 0, rx, 2, 3);
+
+    /** Bus holds the first one until all three are queued */
+    Slave.stall = true;
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &a));
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &b));
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &c));
+    TEST_ASSERT_EQUAL(0, DoneCnt);
+
+    Slave.stall = false;
+    Bus_Run();
+
+    TEST_ASSERT_EQUAL_STRING(" S69W 10 AA BB P S69W 10 Sr69R .AA .BB P S69R .52 .53 P", Wire);
+    TEST_ASSERT_EQUAL(3, DoneCnt);
+    TEST_ASSERT_EQUAL(1, DoneId[0]);
+    TEST_ASSERT_EQUAL(2, DoneId[1]);
+    TEST_ASSERT_EQUAL(3, DoneId[2]);
+    TEST_ASSERT_EQUAL(3, Q.done);
+    TEST_ASSERT_EQUAL(3, Wakes);
+}
+
+void test_I2CQ_should_Report_AddressNack_and_Continue(void)
+{
+    const uint8_t cmd[2] = {0x24, 0x00};
+    const uint8_t reg = 0x00;
+    uint8_t rx[1] = {0};
+    sI2CQXfer_t a = Xfer(0x44, cmd, 2, NULL, 0, 1);
+    sI2CQXfer_t b = Xfer(0x69, &reg, 1, rx, 1, 2);
+
+    Slave.stall = true;
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &a));
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &b));
+    Slave.stall = false;
+    Bus_Run();
+
+    TEST_ASSERT_EQUAL_STRING(" S44W N P S69W 00 Sr69R .40 P", Wire);
+    TEST_ASSERT_EQUAL(2, DoneCnt);
+    TEST_ASSERT_EQUAL(I2CQ_NACK, DoneResult[0]);
+    TEST_ASSERT_EQUAL(I2CQ_DONE, DoneResult[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x40, rx[0]);
+    TEST_ASSERT_EQUAL(1, Q.nack);
+    TEST_ASSERT_EQUAL(1, Q.done);
+}
+
+void test_I2CQ_should_Finish_on_ArbitrationLost(void)
+{
+    const uint8_t wr[2] = {0x00, 0x01};
+    sI2CQXfer_t a = Xfer(0x69, wr, 2, NULL, 0, 1);
+    sI2CQXfer_t b = Xfer(0x69, wr, 2, NULL, 0, 2);
+
+    Slave.stall = true;
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &a));
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &b));
+
+    /** Another master won the address byte: no STOP comes */
+    Irq(USCI_I2C_UCALIFG);
+    TEST_ASSERT_EQUAL(1, DoneCnt);
+    TEST_ASSERT_EQUAL(I2CQ_ARBLOST, DoneResult[0]);
+    TEST_ASSERT_EQUAL(1, Q.arblost);
+    TEST_ASSERT_EQUAL(1, Wakes);
+
+    /** Next one goes straight out */
+    Slave.stall = false;
+    Bus_Run();
+    TEST_ASSERT_EQUAL(2, DoneCnt);
+    TEST_ASSERT_EQUAL(I2CQ_DONE, DoneResult[1]);
+}
+
+void test_I2CQ_Fault_should_Map_Results(void)
+{
+    TEST_ASSERT_EQUAL(I2C_FAULT_NACK, I2CQ_Fault(I2CQ_NACK));
+    TEST_ASSERT_EQUAL(I2C_FAULT_ARBLOST, I2CQ_Fault(I2CQ_ARBLOST));
+    TEST_ASSERT_EQUAL(I2C_FAULT_TIMEOUT, I2CQ_Fault(I2CQ_TIMEOUT));
+    TEST_ASSERT_EQUAL(I2C_FAULT_TIMEOUT, I2CQ_Fault(I2CQ_PENDING));
+}
+
+void test_I2CQ_should_Stop_on_DataNack(void)
+{
+    const uint8_t wr[4] = {0x00, 0x01, 0x02, 0x03};
+    sI2CQXfer_t x = Xfer(0x69, wr, 4, NULL, 0, 1);
+
+    Slave.nackAt = 1;
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &x));
+    Bus_Run();
+
+    /** No more bytes after the NACK */
+    TEST_ASSERT_EQUAL_STRING(" S69W 00 01 N P", Wire);
+    TEST_ASSERT_EQUAL(1, DoneCnt);
+    TEST_ASSERT_EQUAL(I2CQ_NACK, DoneResult[0]);
+}
+
+void test_I2CQ_should_Stop_after_SingleByteRead(void)
+{
+    uint8_t rx[2] = {0};
+    sI2CQXfer_t x = Xfer(0x69, NULL, 0, rx, 1, 1);
+
+    Slave.ptr = 0x05;
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &x));
+
+    /** STOP is already requested with the START */
+    TEST_ASSERT_EQUAL_HEX16(UCTXSTT | UCTXSTP, Bus.CTLW0 & (UCTXSTT | UCTXSTP));
+    TEST_ASSERT_EQUAL_HEX16(0, Bus.CTLW0 & UCTR);
+
+    Bus_Run();
+    TEST_ASSERT_EQUAL_STRING(" S69R .45 P", Wire);
+    TEST_ASSERT_EQUAL_HEX8(0x45, rx[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, rx[1]);
+}
+
+void test_I2CQ_Tick_should_TimeOut_StuckTransfer_and_StartNext(void)
+{
+    const uint8_t reg = 0x00;
+    uint8_t rx[2] = {0};
+    sI2CQXfer_t a = Xfer(0x69, &reg, 1, rx, 2, 1);
+    sI2CQXfer_t b = Xfer(0x69, &reg, 1, rx, 2, 2);
+
+    /** Idle bus never times out */
+    TEST_ASSERT_FALSE(I2CQ_Tick(&Q));
+
+    Slave.stall = true;
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &a));
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &b));
+
+    TEST_ASSERT_FALSE(I2CQ_Tick(&Q));
+    TEST_ASSERT_TRUE(I2CQ_Tick(&Q));
+    TEST_ASSERT_EQUAL(1, DoneCnt);
+    TEST_ASSERT_EQUAL(I2CQ_TIMEOUT, DoneResult[0]);
+    TEST_ASSERT_EQUAL(1, Q.timeout);
+
+    /** The next one restarts with a fresh timeout and completes */
+    TEST_ASSERT_TRUE(I2CQ_Busy(&Q));
+    TEST_ASSERT_EQUAL_HEX16(I2CQ_IE, Bus.IE);
+    TEST_ASSERT_FALSE(I2CQ_Tick(&Q));
+
+    Slave.stall = false;
+    Mode = BUS_IDLE;
+    Bus_Run();
+    TEST_ASSERT_EQUAL(2, DoneCnt);
+    TEST_ASSERT_EQUAL(2, DoneId[1]);
+    TEST_ASSERT_EQUAL(I2CQ_DONE, DoneResult[1]);
+}
+
+void test_I2CQ_Submit_should_Refuse_when_Full_or_Empty(void)
+{
+    const uint8_t reg = 0x00;
+    sI2CQXfer_t x = Xfer(0x69, &reg, 1, NULL, 0, 1);
+    sI2CQXfer_t none = Xfer(0x69, NULL, 0, NULL, 0, 1);
+    uint8_t i;
+
+    TEST_ASSERT_EQUAL(I2CQ_FAIL, I2CQ_Submit(&Q, &none));
+    TEST_ASSERT_FALSE(I2CQ_Busy(&Q));
+
+    /** One on the bus plus I2CQ_DEPTH waiting */
+    Slave.stall = true;
+    for (i = 0; i < (I2CQ_DEPTH + 1); i++)
+    {
+        TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &x));
+    }
+    TEST_ASSERT_EQUAL(I2CQ_FULL, I2CQ_Submit(&Q, &x));
+
+    Slave.stall = false;
+    Bus_Run();
+    TEST_ASSERT_EQUAL(I2CQ_DEPTH + 1, DoneCnt);
+}
+
+void test_I2CQ_Wait_should_Return_Result_of_Transfer(void)
+{
+    const uint8_t reg = 0x00;
+    uint8_t rx[1];
+    sI2CQDone_t d = {.busy = true, .result = I2CQ_PENDING};
+    sI2CQDone_t never = {.busy = true, .result = I2CQ_PENDING};
+    sI2CQXfer_t x = Xfer(0x69, &reg, 1, rx, 1, 0);
+
+    x.done = I2CQ_Done;
+    x.ctx = &d;
+
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &x));
+    Bus_Run();
+    TEST_ASSERT_EQUAL(I2CQ_DONE, I2CQ_Wait(&Q, &d));
+    TEST_ASSERT_FALSE(d.busy);
+
+    /** Nothing queued for it, does not hang */
+    TEST_ASSERT_EQUAL(I2CQ_PENDING, I2CQ_Wait(&Q, &never));
+
+    /** A stuck one ends in a timeout */
+    d.busy = true;
+    Slave.stall = true;
+    TEST_ASSERT_EQUAL(I2CQ_OK, I2CQ_Submit(&Q, &x));
+    TEST_ASSERT_EQUAL(I2CQ_TIMEOUT, I2CQ_Wait(&Q, &d));
+    I2CQ_Flush(&Q);
+    TEST_ASSERT_FALSE(I2CQ_Busy(&Q));
+}
@@ -0,0 +1,233 @@
+#include "unity.h"
+#include "param.h"
+#include "mock_pco2.h"
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+sPCO2_t pco2;
+
+/** Value string for v as the parameter type takes it */
+static void param_str(const sParam_t *p, double v, char *str)
+{
+    if (PARAM_FLOAT == p->type)
+    {
+        sprintf(str, "%.*f", p->decimals + 2, v);
+    }
+    else
+    {
+        sprintf(str, "%ld", (long)v);
+    }
+}
+
+/** Step to just outside v */
+static double param_step(const sParam_t *p, double v)
+{
+    return (PARAM_FLOAT == p->type) ? ((fabs(v) * 0.0001) + 0.0001) : 1.0;
+}
+
+static void param_ignore_apply(void)
+{
+    PCO2_ApplyHeater_Ignore();
+    PCO2_ApplyCalPolicy_Ignore();
+}
+
+void setUp(void)
+{
+    memset(&pco2, 0, sizeof(pco2));
+}
+
+void tearDown(void)
+{
+}
+
+void test_PARAM_Find_should_Stop_at_Separator(void)
+{
+    TEST_ASSERT_EQUAL_PTR(PARAM_Entry(0), PARAM_Find("span"));
+    TEST_ASSERT_EQUAL_STRING("span", PARAM_Find("span= 400")->name);
+    TEST_ASSERT_EQUAL_STRING("span2", PARAM_Find("span2=400")->name);
+    TEST_ASSERT_EQUAL_STRING("calzero", PARAM_Find("calzero\r\n")->name);
+    TEST_ASSERT_NULL(PARAM_Find("spa"));
+    TEST_ASSERT_NULL(PARAM_Find("spanx"));
+    TEST_ASSERT_NULL(PARAM_Find(""));
+    TEST_ASSERT_NULL(PARAM_Entry(PARAM_Count()));
+}
+
+void test_PARAM_Table_should_be_Unique_and_Sane(void)
+{
+    uint16_t i, j;
+    const sParam_t *p;
+
+    for (i = 0; i < PARAM_Count(); i++)
+    {
+        p = PARAM_Entry(i);
+        TEST_ASSERT_NOT_NULL(p->value);
+        TEST_ASSERT_NOT_NULL(p->unit);
+        TEST_ASSERT_NOT_NULL(p->help);
+        TEST_ASSERT_TRUE_MESSAGE(p->min <= p->max, p->name);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(p, PARAM_Find(p->name), p->name);
+        for (j = i + 1; j < PARAM_Count(); j++)
+        {
+            TEST_ASSERT_TRUE_MESSAGE(p->value != PARAM_Entry(j)->value, p->name);
+        }
+    }
+}
+
+void test_PARAM_Set_should_Enforce_Range_for_Every_Entry(void)
+{
+    uint16_t i;
+    const sParam_t *p;
+    char str[32];
+    char msg[48];
+
+    param_ignore_apply();
+
+    for (i = 0; i < PARAM_Count(); i++)
+    {
+        p = PARAM_Entry(i);
+        sprintf(msg, "%s", p->name);
+
+        if (0u != (p->flags & PARAM_READONLY))
+        {
+            param_str(p, p->min, str);
+            TEST_ASSERT_EQUAL_MESSAGE(PARAM_READ_ONLY, PARAM_Set(p, str), msg);
+            continue;
+        }
+
+        /** Both ends are allowed */
+        param_str(p, p->min, str);
+        TEST_ASSERT_EQUAL_MESSAGE(PARAM_OK, PARAM_Set(p, str), msg);
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(p->min, PARAM_Value(p), msg);
+
+        param_str(p, p->max, str);
+        TEST_ASSERT_EQUAL_MESSAGE(PARAM_OK, PARAM_Set(p, str), msg);
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(p->max, PARAM_Value(p), msg);
+
+        /** Just outside is not, and the value is kept */
+        param_str(p, (double)p->max + param_step(p, p->max), str);
+        TEST_ASSERT_EQUAL_MESSAGE(PARAM_RANGE, PARAM_Set(p, str), msg);
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(p->max, PARAM_Value(p), msg);
+
+        param_str(p, (double)p->min - param_step(p, p->min), str);
+        if ((PARAM_FLOAT != p->type) && (p->min < 1.0f))
+        {
+            /** No sign on an integer */
+            TEST_ASSERT_EQUAL_MESSAGE(PARAM_FAIL, PARAM_Set(p, str), msg);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_MESSAGE(PARAM_RANGE, PARAM_Set(p, str), msg);
+        }
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(p->max, PARAM_Value(p), msg);
+
+        /** Not a number */
+        TEST_ASSERT_EQUAL_MESSAGE(PARAM_FAIL, PARAM_Set(p, "x"), msg);
+        TEST_ASSERT_EQUAL_MESSAGE(PARAM_FAIL, PARAM_Set(p, "1x"), msg);
+        TEST_ASSERT_EQUAL_MESSAGE(PARAM_FAIL, PARAM_Set(p, ""), msg);
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(p->max, PARAM_Value(p), msg);
+    }
+}
+
+void test_PARAM_Set_should_Write_Type(void)
+{
+    TEST_ASSERT_EQUAL(PARAM_OK, PARAM_Set(PARAM_Find("equil"), "120\r\n"));
+    TEST_ASSERT_EQUAL_UINT16(120, pco2.equil.equil);
+
+    TEST_ASSERT_EQUAL(PARAM_OK, PARAM_Set(PARAM_Find("convco2"), "0.25"));
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, pco2.converge.co2);
+
+    TEST_ASSERT_EQUAL(PARAM_OK, PARAM_Set(PARAM_Find("overlap"), "1"));
+    TEST_ASSERT_EQUAL_UINT8(1, pco2.overlap);
+    TEST_ASSERT_EQUAL(PARAM_FAIL, PARAM_Set(PARAM_Find("overlap"), "0.5"));
+
+    TEST_ASSERT_EQUAL(PARAM_RANGE, PARAM_Set(PARAM_Find("convco2"), "nan"));
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, pco2.converge.co2);
+}
+
+void test_PARAM_Set_should_Call_Apply_with_Previous(void)
+{
+    pco2.calpol.enable = 0;
+    PCO2_ApplyCalPolicy_Expect(0.0f);
+    TEST_ASSERT_EQUAL(PARAM_OK, PARAM_Set(PARAM_Find("calpol"), "1"));
+    TEST_ASSERT_EQUAL_UINT8(1, pco2.calpol.enable);
+
+    PCO2_ApplyHeater_Expect(0.0f);
+    TEST_ASSERT_EQUAL(PARAM_OK, PARAM_Set(PARAM_Find("heater"), "1"));
+
+    /** No write, no apply */
+    TEST_ASSERT_EQUAL(PARAM_RANGE, PARAM_Set(PARAM_Find("heater"), "2"));
+}
+
+void test_PARAM_Format_should_Match_Console(void)
+{
+    char str[48];
+
+    pco2.span = 400.0f;
+    PARAM_Format(PARAM_Find("span"), str);
+    TEST_ASSERT_EQUAL_STRING("span= 400.00", str);
+
+    pco2.converge.co2 = 0.1f;
+    PARAM_Format(PARAM_Find("convco2"), str);
+    TEST_ASSERT_EQUAL_STRING("convco2= 0.1000", str);
+
+    pco2.calpol.zero_runs = 24;
+    PARAM_Format(PARAM_Find("calzero"), str);
+    TEST_ASSERT_EQUAL_STRING("calzero= 24", str);
+}
+
+void test_PARAM_SetMany_should_Write_All(void)
+{
+    sParamSet_t set;
+
+    TEST_ASSERT_EQUAL(PARAM_OK, PARAM_SetMany(" equil=90 span=500.5  calzero=12\r\n", &set));
+    TEST_ASSERT_EQUAL(3, set.cnt);
+    TEST_ASSERT_NULL(set.bad);
+    TEST_ASSERT_EQUAL_PTR(PARAM_Find("span"), set.param[1]);
+    TEST_ASSERT_EQUAL_UINT16(90, pco2.equil.equil);
+    TEST_ASSERT_EQUAL_FLOAT(500.5f, pco2.span);
+    TEST_ASSERT_EQUAL_UINT16(12, pco2.calpol.zero_runs);
+}
+
+void test_PARAM_SetMany_should_Write_Nothing_on_any_Failure(void)
+{
+    sParamSet_t set;
+    const char *args;
+
+    pco2.equil.equil = 5;
+    pco2.span = 1.0f;
+
+    /** Out of range last */
+    args = "equil=90 span=500 calzero=0";
+    TEST_ASSERT_EQUAL(PARAM_RANGE, PARAM_SetMany(args, &set));
+    TEST_ASSERT_EQUAL_PTR(strstr(args, "calzero"), set.bad);
+    TEST_ASSERT_EQUAL_UINT16(5, pco2.equil.equil);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, pco2.span);
+
+    /** Unknown name */
+    args = "equil=90 spam=500";
+    TEST_ASSERT_EQUAL(PARAM_UNKNOWN, PARAM_SetMany(args, &set));
+    TEST_ASSERT_EQUAL_PTR(strstr(args, "spam"), set.bad);
+    TEST_ASSERT_EQUAL_UINT16(5, pco2.equil.equil);
+
+    /** Missing '=', bad number, read only, nothing */
+    TEST_ASSERT_EQUAL(PARAM_FAIL, PARAM_SetMany("equil=90 span 500", &set));
+    TEST_ASSERT_EQUAL(PARAM_FAIL, PARAM_SetMany("equil=9o", &set));
+    TEST_ASSERT_EQUAL(PARAM_READ_ONLY, PARAM_SetMany("equil=90 sample=2", &set));
+    TEST_ASSERT_EQUAL(PARAM_FAIL, PARAM_SetMany("  \r\n", &set));
+    TEST_ASSERT_EQUAL_UINT16(5, pco2.equil.equil);
+}
+
+void test_PARAM_SetMany_should_Limit_Count(void)
+{
+    sParamSet_t set;
+    char args[PARAM_SET_MAX * 10 + 16];
+    uint8_t i;
+
+    args[0] = '\0';
+    for (i = 0; i <= PARAM_SET_MAX; i++)
+    {
+        strcat(args, "equil=1 ");
+    }
+    TEST_ASSERT_EQUAL(PARAM_FAIL, PARAM_SetMany(args, &set));
+    TEST_ASSERT_EQUAL_UINT16(0, pco2.equil.equil);
+}
@@ -52,7 +52,7 @@ void test_PCO2_SetMode_should_Fail_if_NonValid_mode(void)
     ePCO2Mode_t mode = 0xFF;
 
     /* Expect */
-    Error_Expect(ERROR_MSG_0122, LOG_Priority_Low);
+    Error_Expect(ERROR_MSG_0122, 0);
     Log_Expect("PCO2 Mode: FAIL", LOG_Priority_Low);
 
     /* Act */
@@ -202,7 +202,7 @@ void mock_setmode(ePCO2Mode_t mode, eFLOWState_t status, char *mstr)
         break;
 
     default:
-        Error_Expect(ERROR_MSG_0122, LOG_Priority_Low);
+        Error_Expect(ERROR_MSG_0122, 0);
         break;
     }
 
@@ -247,7 +247,7 @@ void test_PCO2_State_Rest_should_ReportError_but_still_shut_Licor(void)
     // FLOW_SetMode_ExpectAndReturn(FLOW_STATE_REST,FLOW_FAIL);
     Log_Expect("PCO2 Rest", LOG_Priority_Low);
     mock_setmode(MODE_REST, FLOW_FAIL, mstr);
-    Error_Expect(ERROR_MSG_0120, LOG_Priority_Med);
+    Error_Expect(ERROR_MSG_0120, 0);
     LI8x0_PowerOFF_Expect();
 
     /* Act */
@@ -261,7 +261,7 @@ void test_PCO2_Calibrate_should_Fail_if_CalState_IsBad(void)
 
     /* Expect */
     Log_Expect("PCO2 Cal: FAIL", LOG_Priority_Low);
-    Error_Expect(ERROR_MSG_0130, LOG_Priority_Low);
+    Error_Expect(ERROR_MSG_0130, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Calibrate(cal));
@@ -289,7 +289,7 @@ void test_PCO2_Calibrate_should_Fail_if_Default_ZeroFails(void)
     /* Expect */
     Log_Expect("PCO2 Cal: Zero", LOG_Priority_Low);
     LI8x0_Zero_ExpectAndReturn(LICOR_FAIL);
-    Error_Expect(ERROR_MSG_0131, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0131, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Calibrate(cal));
@@ -317,7 +317,7 @@ void test_PCO2_Calibrate_should_Fail_if_Default_SpanFails(void)
     /* Expect */
     Log_Expect("PCO2 Cal: Span", LOG_Priority_Low);
     LI8x0_Span_ExpectAndReturn(LICOR_FAIL);
-    Error_Expect(ERROR_MSG_0132, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0132, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Calibrate(cal));
@@ -345,7 +345,7 @@ void test_PCO2_Calibrate_should_Fail_if_Default_Span2Fails(void)
     /* Expect */
     Log_Expect("PCO2 Cal: Span2", LOG_Priority_Low);
     LI8x0_Span2_ExpectAndReturn(LICOR_FAIL);
-    Error_Expect(ERROR_MSG_0133, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0133, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Calibrate(cal));
@@ -464,7 +464,7 @@ void mock_calibrate_zero_fail(void)
 {
     Log_Expect("PCO2 Cal: Zero", LOG_Priority_Low);
     LI8x0_Zero_ExpectAndReturn(LICOR_FAIL);
-    Error_Expect(ERROR_MSG_0131, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0131, 0);
 }
 
 void test_PCO2_Zero_should_RunState_and_ReturnValid(void)
@@ -554,7 +554,7 @@ void test_PCO2_Zero_should_RunState_and_Fail_If_BadZEON_Set(void)
     // FLOW_SetMode_ExpectAndReturn(FLOW_STATE_ZERO_PUMP_ON,FLOW_FAIL);
     Log_Expect("PCO2 Zero", LOG_Priority_Low);
     mock_setmode(MODE_ZERO_PUMP_ON, FLOW_FAIL, mstr);
-    Error_Expect(ERROR_MSG_0150, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0150, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Zero());
@@ -594,7 +594,7 @@ void test_PCO2_Zero_should_RunState_and_Fail_If_BadZEOFF_Set(void)
     mock_setmode(MODE_ZERO_PUMP_ON, FLOW_OK, mstr);
     mock_sample(o2data, &li_data, &rh_data, dl_temp, runNum, "ZEON");
     mock_setmode(MODE_ZERO_PUMP_OFF, FLOW_FAIL, mstr);
-    Error_Expect(ERROR_MSG_0152, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0152, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Zero());
@@ -635,7 +635,7 @@ void test_PCO2_Zero_should_RunState_and_Fail_If_BadZEOFF2_Set(void)
     mock_sample(o2data, &li_data, &rh_data, dl_temp, runNum, "ZEON");
     mock_setmode(MODE_ZERO_PUMP_OFF, FLOW_OK, mstr);
     mock_setmode(MODE_ZERO_PRE_CAL, FLOW_FAIL, mstr);
-    Error_Expect(ERROR_MSG_0153, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0153, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Zero());
@@ -677,7 +677,7 @@ void test_PCO2_Zero_should_RunState_and_Fail_If_BadCAL(void)
     mock_setmode(MODE_ZERO_PRE_CAL, FLOW_OK, mstr);
     mock_sample(o2data, &li_data, &rh_data, dl_temp, runNum, "ZEOFF");
     mock_calibrate_zero_fail();
-    Error_Expect(ERROR_MSG_0155, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0155, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Zero());
@@ -694,7 +694,7 @@ void mock_calibrate_span_fail(void)
 {
     Log_Expect("PCO2 Cal: Span", LOG_Priority_Low);
     LI8x0_Span_ExpectAndReturn(LICOR_FAIL);
-    Error_Expect(ERROR_MSG_0132, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0132, 0);
 }
 
 void test_PCO2_Span_should_RunState_and_ReturnValid(void)
@@ -784,7 +784,7 @@ void test_PCO2_Span_should_RunState_and_Fail_If_BadZEON_Set(void)
     // FLOW_SetMode_ExpectAndReturn(FLOW_STATE_ZERO_PUMP_ON,FLOW_FAIL);
     Log_Expect("PCO2 Span", LOG_Priority_Low);
     mock_setmode(MODE_SPAN_PUMP_ON, FLOW_FAIL, mstr);
-    Error_Expect(ERROR_MSG_0160, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0160, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Span());
@@ -824,7 +824,7 @@ void test_PCO2_Span_should_RunState_and_Fail_If_BadZEOFF_Set(void)
     mock_setmode(MODE_SPAN_PUMP_ON, FLOW_OK, mstr);
     mock_sample(o2data, &li_data, &rh_data, dl_temp, runNum, "SPON");
     mock_setmode(MODE_SPAN_PUMP_OFF, FLOW_FAIL, mstr);
-    Error_Expect(ERROR_MSG_0162, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0162, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Span());
@@ -865,7 +865,7 @@ void test_PCO2_Span_should_RunState_and_Fail_If_BadZEOFF2_Set(void)
     mock_sample(o2data, &li_data, &rh_data, dl_temp, runNum, "SPON");
     mock_setmode(MODE_SPAN_PUMP_OFF, FLOW_OK, mstr);
     mock_setmode(MODE_SPAN_PRE_CAL, FLOW_FAIL, mstr);
-    Error_Expect(ERROR_MSG_0163, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0163, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Span());
@@ -907,7 +907,7 @@ void test_PCO2_Span_should_RunState_and_Fail_If_BadCAL(void)
     mock_setmode(MODE_SPAN_PRE_CAL, FLOW_OK, mstr);
     mock_sample(o2data, &li_data, &rh_data, dl_temp, runNum, "SPOFF");
     mock_calibrate_span_fail();
-    Error_Expect(ERROR_MSG_0165, LOG_Priority_High);
+    Error_Expect(ERROR_MSG_0165, 0);
 
     /* Act */
     TEST_ASSERT_EQUAL(PCO2_FAIL, PCO2_State_Span());
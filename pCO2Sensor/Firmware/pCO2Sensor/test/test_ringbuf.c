@@ -0,0 +1,181 @@
+#include "unity.h"
+#include "ringbuf.h"
+
+#define TEST_RING_SIZE (64)
+#define TEST_HAMMER_COUNT (200000ul)
+
+RINGBUF_DECLARE(TestRing, uint8_t, TEST_RING_SIZE)
+RINGBUF_DECLARE(TestRing32, uint32_t, TEST_RING_SIZE)
+
+sTestRing_t TestBuf;
+sTestRing32_t TestBuf32;
+
+void setUp(void)
+{
+	TestRing_Clear(&TestBuf);
+	TestRing32_Clear(&TestBuf32);
+}
+
+void tearDown(void)
+{
+}
+
+void test_Ring_Put_should_AddData_until_Full(void){
+	uint16_t i;
+
+	for(i=0;i<TEST_RING_SIZE;i++){
+		TEST_ASSERT_TRUE(TestRing_Put(&TestBuf,(uint8_t)i));
+		TEST_ASSERT_EQUAL(i+1,TestRing_Count(&TestBuf));
+	}
+
+	/** Full buffer uses every slot and then blocks */
+	TEST_ASSERT_EQUAL(0,TestRing_Free(&TestBuf));
+	TEST_ASSERT_FALSE(TestRing_Put(&TestBuf,0xAA));
+	TEST_ASSERT_EQUAL(TEST_RING_SIZE,TestRing_Count(&TestBuf));
+}
+
+void test_Ring_Get_should_ReturnDataInOrder_and_FailWhenEmpty(void){
+	uint16_t i;
+	uint8_t val;
+
+	TEST_ASSERT_FALSE(TestRing_Get(&TestBuf,&val));
+
+	/** Walk the indexes around the buffer several times */
+	for(i=0;i<(TEST_RING_SIZE*5);i++){
+		TEST_ASSERT_TRUE(TestRing_Put(&TestBuf,(uint8_t)i));
+		TEST_ASSERT_TRUE(TestRing_Get(&TestBuf,&val));
+		TEST_ASSERT_EQUAL_HEX8((uint8_t)i,val);
+	}
+
+	TEST_ASSERT_EQUAL(0,TestRing_Count(&TestBuf));
+	TEST_ASSERT_FALSE(TestRing_Get(&TestBuf,&val));
+}
+
+void test_Ring_Count_should_Survive_IndexRollover(void){
+	uint8_t val;
+
+	/** Place the indexes just below the 16-bit rollover */
+	TestBuf.read = 0xFFFE;
+	TestBuf.write = 0xFFFE;
+
+	TEST_ASSERT_TRUE(TestRing_Put(&TestBuf,1));
+	TEST_ASSERT_TRUE(TestRing_Put(&TestBuf,2));
+	TEST_ASSERT_TRUE(TestRing_Put(&TestBuf,3));
+	TEST_ASSERT_EQUAL(3,TestRing_Count(&TestBuf));
+
+	TEST_ASSERT_TRUE(TestRing_Get(&TestBuf,&val));
+	TEST_ASSERT_EQUAL(1,val);
+	TEST_ASSERT_TRUE(TestRing_Get(&TestBuf,&val));
+	TEST_ASSERT_EQUAL(2,val);
+	TEST_ASSERT_TRUE(TestRing_Get(&TestBuf,&val));
+	TEST_ASSERT_EQUAL(3,val);
+	TEST_ASSERT_EQUAL(0,TestRing_Count(&TestBuf));
+}
+
+void test_Ring_Write_should_CopyAcrossWrap(void){
+	uint8_t src[TEST_RING_SIZE];
+	uint8_t dst[TEST_RING_SIZE];
+	uint16_t i;
+
+	for(i=0;i<TEST_RING_SIZE;i++){
+		src[i] = (uint8_t)(i + 0x40);
+	}
+
+	/** Start 10 short of the end of the storage */
+	TestBuf.read = TEST_RING_SIZE - 10;
+	TestBuf.write = TEST_RING_SIZE - 10;
+
+	TEST_ASSERT_EQUAL(30,TestRing_Write(&TestBuf,src,30));
+	TEST_ASSERT_EQUAL_HEX8(src[0],TestBuf.buffer[TEST_RING_SIZE-10]);
+	TEST_ASSERT_EQUAL_HEX8(src[10],TestBuf.buffer[0]);
+
+	memset(dst,0,sizeof(dst));
+	TEST_ASSERT_EQUAL(30,TestRing_Read(&TestBuf,dst,30));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(src,dst,30);
+	TEST_ASSERT_EQUAL(0,TestRing_Count(&TestBuf));
+}
+
+void test_Ring_Write_should_StopAtFree_and_Read_StopAtCount(void){
+	uint8_t src[TEST_RING_SIZE+8];
+	uint8_t dst[TEST_RING_SIZE+8];
+
+	memset(src,0x5A,sizeof(src));
+
+	TEST_ASSERT_EQUAL(TEST_RING_SIZE,TestRing_Write(&TestBuf,src,sizeof(src)));
+	TEST_ASSERT_EQUAL(0,TestRing_Write(&TestBuf,src,1));
+
+	TEST_ASSERT_EQUAL(TEST_RING_SIZE,TestRing_Read(&TestBuf,dst,sizeof(dst)));
+	TEST_ASSERT_EQUAL(0,TestRing_Read(&TestBuf,dst,1));
+}
+
+void test_Ring_Clear_should_EmptyBuffer(void){
+	TEST_ASSERT_TRUE(TestRing_Put(&TestBuf,1));
+	TEST_ASSERT_TRUE(TestRing_Put(&TestBuf,2));
+
+	TestRing_Clear(&TestBuf);
+
+	TEST_ASSERT_EQUAL(0,TestRing_Count(&TestBuf));
+	TEST_ASSERT_EQUAL(TEST_RING_SIZE,TestRing_Free(&TestBuf));
+}
+
+/** Simulated ISR: pushes the next burst of a counting sequence, mixing */
+/** single and bulk writes.  A full ring ends the burst early */
+static uint32_t isr_producer(uint32_t next, uint16_t burst)
+{
+	uint32_t chunk[5];
+	uint16_t i;
+
+	while((burst-- > 0) && (next < TEST_HAMMER_COUNT)){
+		if((next & 0x7) == 0){
+			for(i=0;(i<5) && ((next+i)<TEST_HAMMER_COUNT);i++){
+				chunk[i] = next + i;
+			}
+			if(0 == (i = TestRing32_Write(&TestBuf32,chunk,i))){
+				break;
+			}
+			next += i;
+		} else if(true == TestRing32_Put(&TestBuf32,next)){
+			next++;
+		} else {
+			break;
+		}
+	}
+	return next;
+}
+
+void test_Ring_should_PassSequenceIntact_between_ISR_and_MainLoop(void){
+	uint32_t next = 0;
+	uint32_t expect = 0;
+	uint32_t val;
+	uint32_t chunk[7];
+	uint32_t errors = 0;
+	uint32_t seed = 12345u;
+	uint16_t gap = 1;
+	uint16_t n;
+	uint16_t i;
+
+	/** Main loop consumer, mixing single and bulk reads.  The ISR fires */
+	/** bursts at pseudo-random points between consumer calls */
+	while(expect < TEST_HAMMER_COUNT){
+		if(--gap == 0){
+			seed = (seed * 1103515245u) + 12345u;
+			gap = 1 + (uint16_t)((seed >> 16) % 8u);
+			next = isr_producer(next,1 + (uint16_t)((seed >> 8) % (TEST_RING_SIZE + 8u)));
+		}
+		if((expect & 0x3) == 0){
+			n = TestRing32_Read(&TestBuf32,chunk,7);
+			for(i=0;i<n;i++){
+				errors += (chunk[i] != expect);
+				expect++;
+			}
+		} else if(true == TestRing32_Get(&TestBuf32,&val)){
+			errors += (val != expect);
+			expect++;
+		}
+		errors += (TestRing32_Count(&TestBuf32) > TEST_RING_SIZE);
+	}
+
+	TEST_ASSERT_EQUAL_UINT32(0,errors);
+	TEST_ASSERT_EQUAL_UINT32(TEST_HAMMER_COUNT,next);
+	TEST_ASSERT_EQUAL(0,TestRing32_Count(&TestBuf32));
+}
@@ -0,0 +1,211 @@
+#include "unity.h"
+#include "sbd.h"
+#include "crc.h"
+#include "sbd_decode.h"
+#include "mock_pco2.h"
+#include <math.h>
+#include <string.h>
+
+static sPCO2_idata_t idata;
+static uint8_t msg[SBD_MO_MAX];
+static sSbdDecode_t dec;
+
+/** Mode in idata order */
+static sPCO2_idata_mode_t *sbd_mode(uint8_t m)
+{
+    sPCO2_idata_mode_t *const modes[SBD_MODES] = {
+        &idata.ZPON, &idata.ZPOFF, &idata.ZPPCAL,
+        &idata.SPON, &idata.SPOFF, &idata.SPPCAL,
+        &idata.EPON, &idata.EPOFF, &idata.APON, &idata.APOFF};
+
+    return modes[m];
+}
+
+/** Plausible cycle, different in every mode */
+static void sbd_fill(void)
+{
+    sPCO2_idata_mode_t *d;
+    uint8_t m;
+
+    for (m = 0; m < SBD_MODES; m++)
+    {
+        d = sbd_mode(m);
+        d->co2.numSamples = 30 + m;
+        d->converged = (0 == (m % 3));
+        d->temperature.mean = 49.987f + m;
+        d->temperature.std = 0.013f;
+        d->pressure.mean = 101.325f - m;
+        d->pressure.std = 0.052f;
+        d->co2.mean = (m < 3) ? 0.517f - (m * 0.5f) : 398.4567f + (m * 12.3f);
+        d->co2.std = 0.4321f;
+        d->o2.mean = 20.946f;
+        d->o2.std = 0.02f;
+        d->rh.mean = 3.47f + m;
+        d->rh.std = 0.11f;
+        d->rh_temperature.mean = -1.25f + m;
+        d->rh_temperature.std = 0.03f;
+        d->raw1.mean = 3712345.0f + m;
+        d->raw1.std = 123.0f;
+        d->raw2.mean = 3654321.0f - m;
+        d->raw2.std = 456.0f;
+    }
+
+    idata.COEFF.co2kzero = 0.91234567f;
+    idata.COEFF.co2kspan = 1.00123456f;
+    idata.COEFF.co2kspan2 = -0.00012345f;
+    idata.sw_xco2 = 412.345f;
+    idata.air_xco2 = 409.876f;
+    idata.CAL.zero = true;
+    idata.CAL.span = false;
+    idata.EQUIL.detected = true;
+}
+
+void setUp(void)
+{
+    memset(&idata, 0, sizeof(idata));
+    memset(msg, 0, sizeof(msg));
+    memset(&dec, 0, sizeof(dec));
+}
+
+void tearDown(void)
+{
+}
+
+void test_SBD_Pack_should_Fit_one_SBD_Message(void)
+{
+    TEST_ASSERT_TRUE(SBD_LEN <= SBD_MO_MAX);
+    TEST_ASSERT_EQUAL(SBD_DECODE_LEN, SBD_LEN);
+    TEST_ASSERT_EQUAL_UINT16(SBD_LEN, SBD_Pack(&idata, 1, 0, msg, SBD_LEN));
+    TEST_ASSERT_EQUAL_UINT16(0, SBD_Pack(&idata, 1, 0, msg, SBD_LEN - 1));
+}
+
+void test_SBD_Crc_should_be_XMODEM(void)
+{
+    char check[] = "123456789";
+
+    TEST_ASSERT_EQUAL_HEX16(0x31C3, CRC_Calc(check, 9));
+    TEST_ASSERT_EQUAL_HEX16(0x31C3, SBD_Decode_Crc((const uint8_t *)check, 9));
+}
+
+void test_SBD_should_Round_Trip_a_Full_Cycle(void)
+{
+    sPCO2_idata_mode_t *d;
+    sSbdDecodeMode_t *r;
+    uint8_t m;
+
+    sbd_fill();
+    TEST_ASSERT_EQUAL_UINT16(SBD_LEN, SBD_Pack(&idata, 4321, 1760000000u, msg, sizeof(msg)));
+    TEST_ASSERT_EQUAL(SBD_DECODE_OK, SBD_Decode(msg, SBD_LEN, &dec));
+
+    TEST_ASSERT_EQUAL_UINT8(SBD_VERSION, dec.version);
+    TEST_ASSERT_EQUAL_UINT16(4321, dec.run);
+    TEST_ASSERT_EQUAL_UINT32(1760000000u, dec.epoch);
+    TEST_ASSERT_TRUE(dec.zero);
+    TEST_ASSERT_FALSE(dec.span);
+    TEST_ASSERT_TRUE(dec.equil);
+
+    /** Within half a count of each field */
+    for (m = 0; m < SBD_MODES; m++)
+    {
+        d = sbd_mode(m);
+        r = &dec.mode[m];
+        TEST_ASSERT_EQUAL_UINT8(d->co2.numSamples, r->n);
+        TEST_ASSERT_EQUAL(d->converged, r->converged);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->temperature.mean, r->temp);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->temperature.std, r->temp_sd);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->pressure.mean, r->pres);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->pressure.std, r->pres_sd);
+        TEST_ASSERT_FLOAT_WITHIN(0.00051f, d->co2.mean, r->co2);
+        TEST_ASSERT_FLOAT_WITHIN(0.00051f, d->co2.std, r->co2_sd);
+        TEST_ASSERT_FLOAT_WITHIN(0.00051f, d->o2.mean, r->o2);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->o2.std, r->o2_sd);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->rh.mean, r->rh);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->rh.std, r->rh_sd);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->rh_temperature.mean, r->rh_temp);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, d->rh_temperature.std, r->rh_temp_sd);
+        TEST_ASSERT_EQUAL_FLOAT(d->raw1.mean, r->raw1);
+        TEST_ASSERT_EQUAL_FLOAT(d->raw1.std, r->raw1_sd);
+        TEST_ASSERT_EQUAL_FLOAT(d->raw2.mean, r->raw2);
+        TEST_ASSERT_EQUAL_FLOAT(d->raw2.std, r->raw2_sd);
+    }
+
+    /** Coefficients are exact */
+    TEST_ASSERT_EQUAL_HEX32(*(uint32_t *)&idata.COEFF.co2kzero, *(uint32_t *)&dec.co2kzero);
+    TEST_ASSERT_EQUAL_HEX32(*(uint32_t *)&idata.COEFF.co2kspan, *(uint32_t *)&dec.co2kspan);
+    TEST_ASSERT_EQUAL_HEX32(*(uint32_t *)&idata.COEFF.co2kspan2, *(uint32_t *)&dec.co2kspan2);
+    TEST_ASSERT_FLOAT_WITHIN(0.00051f, idata.sw_xco2, dec.sw_xco2);
+    TEST_ASSERT_FLOAT_WITHIN(0.00051f, idata.air_xco2, dec.air_xco2);
+}
+
+void test_SBD_Pack_should_Mark_Missing_and_Clamp(void)
+{
+    sbd_fill();
+    idata.ZPON.o2.mean = NAN;
+    idata.ZPON.temperature.mean = NAN;
+    idata.ZPON.rh.mean = -0.4f;
+    idata.ZPON.co2.mean = 20000.0f;
+    idata.ZPON.co2.std = 100.0f;
+    idata.ZPON.rh_temperature.mean = -400.0f;
+    idata.ZPON.co2.numSamples = 300;
+    idata.ZPON.converged = true;
+    idata.sw_xco2 = NAN;
+
+    SBD_Pack(&idata, 1, 0, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL(SBD_DECODE_OK, SBD_Decode(msg, SBD_LEN, &dec));
+
+    TEST_ASSERT_TRUE(isnan(dec.mode[0].o2));
+    TEST_ASSERT_TRUE(isnan(dec.mode[0].temp));
+    TEST_ASSERT_TRUE(isnan(dec.sw_xco2));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, dec.mode[0].rh);
+    TEST_ASSERT_FLOAT_WITHIN(0.0005f, 8388.607f, dec.mode[0].co2);
+    TEST_ASSERT_FLOAT_WITHIN(0.0005f, 65.534f, dec.mode[0].co2_sd);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, -327.67f, dec.mode[0].rh_temp);
+    TEST_ASSERT_EQUAL_UINT8(127, dec.mode[0].n);
+    TEST_ASSERT_TRUE(dec.mode[0].converged);
+
+    /** The next mode is untouched */
+    TEST_ASSERT_FLOAT_WITHIN(0.00051f, idata.ZPOFF.o2.mean, dec.mode[1].o2);
+}
+
+void test_SBD_should_Round_Trip_a_Negative_Zero_Reading(void)
+{
+    sbd_fill();
+    idata.ZPON.co2.mean = -0.734f;
+    idata.ZPOFF.co2.mean = -0.0004f;
+    idata.ZPPCAL.co2.mean = NAN;
+    idata.SPON.co2.mean = -20000.0f;
+
+    SBD_Pack(&idata, 1, 0, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL(SBD_DECODE_OK, SBD_Decode(msg, SBD_LEN, &dec));
+
+    TEST_ASSERT_FLOAT_WITHIN(0.00051f, -0.734f, dec.mode[0].co2);
+    TEST_ASSERT_FLOAT_WITHIN(0.00051f, 0.0f, dec.mode[1].co2);
+    TEST_ASSERT_TRUE(isnan(dec.mode[2].co2));
+    TEST_ASSERT_FLOAT_WITHIN(0.0005f, -8388.607f, dec.mode[3].co2);
+
+    /** Neighbouring fields are untouched */
+    TEST_ASSERT_FLOAT_WITHIN(0.0051f, idata.ZPON.pressure.std, dec.mode[0].pres_sd);
+    TEST_ASSERT_FLOAT_WITHIN(0.00051f, idata.ZPON.co2.std, dec.mode[0].co2_sd);
+}
+
+void test_SBD_Decode_should_Reject_Bad_Messages(void)
+{
+    uint16_t crc;
+
+    sbd_fill();
+    SBD_Pack(&idata, 1, 0, msg, sizeof(msg));
+
+    TEST_ASSERT_EQUAL(SBD_DECODE_LENGTH, SBD_Decode(msg, SBD_LEN - 1, &dec));
+
+    msg[100] ^= 0x10;
+    TEST_ASSERT_EQUAL(SBD_DECODE_CRC, SBD_Decode(msg, SBD_LEN, &dec));
+    msg[100] ^= 0x10;
+    TEST_ASSERT_EQUAL(SBD_DECODE_OK, SBD_Decode(msg, SBD_LEN, &dec));
+
+    /** A later layout with a good CRC */
+    msg[0] = SBD_VERSION + 1;
+    crc = SBD_Decode_Crc(msg, SBD_LEN - 2);
+    msg[SBD_LEN - 2] = (uint8_t)(crc >> 8);
+    msg[SBD_LEN - 1] = (uint8_t)crc;
+    TEST_ASSERT_EQUAL(SBD_DECODE_VER, SBD_Decode(msg, SBD_LEN, &dec));
+}
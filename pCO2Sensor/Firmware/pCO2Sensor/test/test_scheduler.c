@@ -29,10 +29,10 @@ void mock_create_task(sTimeReg_t *start, sTimeReg_t *interval, uint8_t sResult,
         AM08X5_compare_time_ExpectAndReturn(interval,start,pResult);
         AM08X5_compare_time_IgnoreArg_t2();
         if(false == pResult){
-            Error_Expect(ERROR_MSG_0021,LOG_Priority_High);
+            Error_Expect(ERROR_MSG_0021, 0);
         }
     } else {
-        Error_Expect(ERROR_MSG_0020,LOG_Priority_High);
+        Error_Expect(ERROR_MSG_0020, 0);
     }
 
 
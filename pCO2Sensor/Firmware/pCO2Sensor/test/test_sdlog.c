@@ -0,0 +1,240 @@
+#include "unity.h"
+#include "sdlog.h"
+#include "crc.h"
+#include "statistics.h"
+#include <math.h>
+#include <string.h>
+
+#define TEST_SAMPLES (120)
+
+static sSdLog_t Log;
+static float co2[TEST_SAMPLES];
+static float temp[TEST_SAMPLES];
+static float pres[TEST_SAMPLES];
+static float rh[TEST_SAMPLES];
+static float rh_temp[TEST_SAMPLES];
+static float o2[TEST_SAMPLES];
+
+/** One run: every mode filled from values that depend on the run */
+static void sdlog_run(uint16_t run, uint32_t epoch)
+{
+    sSdLogRecord_t *rec = SDLOG_Next(&Log);
+    uint16_t i;
+    uint8_t m;
+
+    for (m = 0; m < SDLOG_MODES; m++)
+    {
+        for (i = 0; i < TEST_SAMPLES; i++)
+        {
+            co2[i] = (float)run + (float)m * 10.0f + (float)(i % 2) * 0.2f;
+            temp[i] = 50.0f;
+            pres[i] = 101.3f;
+            rh[i] = 1.5f;
+            rh_temp[i] = 20.0f;
+            o2[i] = 20.9f;
+        }
+        SDLOG_SetMode(&rec->mode[m], co2, temp, pres, rh, rh_temp, o2, TEST_SAMPLES - m);
+    }
+    rec->sw_xco2 = (float)run;
+    rec->air_xco2 = 400.0f;
+
+    SDLOG_Commit(&Log, run, epoch);
+}
+
+void setUp(void)
+{
+    memset(&Log, 0, sizeof(Log));
+}
+
+void tearDown(void)
+{
+}
+
+void test_SDLOG_ModeName_should_Match_sdata(void)
+{
+    TEST_ASSERT_EQUAL_STRING("ZPON", SDLOG_ModeName(0));
+    TEST_ASSERT_EQUAL_STRING("SPPCAL", SDLOG_ModeName(5));
+    TEST_ASSERT_EQUAL_STRING("APOFF", SDLOG_ModeName(9));
+    TEST_ASSERT_EQUAL_STRING("FAIL", SDLOG_ModeName(SDLOG_MODES));
+}
+
+void test_SDLOG_SetMode_should_Summarise_and_Decimate(void)
+{
+    sSdLogMode_t mode;
+    uint16_t i;
+
+    for (i = 0; i < TEST_SAMPLES; i++)
+    {
+        co2[i] = 400.0f + (float)i;
+        temp[i] = -1.234f;
+        pres[i] = 99.996f;
+        rh[i] = (float)i;
+        rh_temp[i] = 20.0f;
+        o2[i] = NAN;
+    }
+
+    SDLOG_SetMode(&mode, co2, temp, pres, rh, rh_temp, o2, TEST_SAMPLES);
+    TEST_ASSERT_EQUAL_UINT16(TEST_SAMPLES, mode.n);
+    TEST_ASSERT_EQUAL_UINT16(SDLOG_SAMPLES, mode.kept);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 459.5f, mode.co2);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 34.64f, mode.co2_sd);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 20.0f, mode.rh_temp);
+    TEST_ASSERT_TRUE(isnan(mode.o2));
+
+    /** Every fifth sample, scaled and rounded */
+    for (i = 0; i < SDLOG_SAMPLES; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT16((400 + (i * 5)) * 10, mode.sample[i].co2);
+        TEST_ASSERT_EQUAL_INT16(-123, mode.sample[i].temp);
+        TEST_ASSERT_EQUAL_UINT16(10000, mode.sample[i].pres);
+        TEST_ASSERT_EQUAL_UINT16(i * 500, mode.sample[i].rh);
+    }
+
+    /** Fewer than kept, out of range and missing values */
+    co2[0] = 1.0e6f;
+    temp[0] = -500.0f;
+    pres[0] = -1.0f;
+    rh[0] = NAN;
+    SDLOG_SetMode(&mode, co2, temp, pres, rh, rh_temp, o2, 3);
+    TEST_ASSERT_EQUAL_UINT16(3, mode.kept);
+    TEST_ASSERT_EQUAL_UINT16(SDLOG_NODATA_U16 - 1u, mode.sample[0].co2);
+    TEST_ASSERT_EQUAL_INT16(-32767, mode.sample[0].temp);
+    TEST_ASSERT_EQUAL_UINT16(0, mode.sample[0].pres);
+    TEST_ASSERT_EQUAL_UINT16(SDLOG_NODATA_U16, mode.sample[0].rh);
+    TEST_ASSERT_EQUAL_UINT16(4020, mode.sample[2].co2);
+
+    /** Mode not run */
+    SDLOG_SetMode(&mode, co2, temp, pres, rh, rh_temp, o2, 0);
+    TEST_ASSERT_EQUAL_UINT16(0, mode.kept);
+    TEST_ASSERT_TRUE(isnan(mode.co2));
+}
+
+void test_SDLOG_should_Keep_Last_Runs_over_100_Runs(void)
+{
+    const sSdLogRecord_t *rec;
+    uint16_t run;
+    uint16_t i;
+
+    for (run = 1; run <= 100; run++)
+    {
+        sdlog_run(run, 1000000u + (uint32_t)run * 3600u);
+        TEST_ASSERT_EQUAL_UINT16((run < SDLOG_SIZE) ? run : SDLOG_SIZE, SDLOG_Count(&Log));
+    }
+
+    for (i = 0; i < SDLOG_SIZE; i++)
+    {
+        run = 100 - SDLOG_SIZE + 1 + i;
+        rec = SDLOG_Get(&Log, i);
+        TEST_ASSERT_NOT_NULL(rec);
+        TEST_ASSERT_TRUE(SDLOG_Valid(rec));
+        TEST_ASSERT_EQUAL_UINT16(run, rec->run);
+        TEST_ASSERT_EQUAL_UINT32(1000000u + (uint32_t)run * 3600u, rec->epoch);
+        TEST_ASSERT_EQUAL_FLOAT((float)run, rec->sw_xco2);
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, (float)run + 90.1f, rec->mode[9].co2);
+        TEST_ASSERT_EQUAL_UINT16(TEST_SAMPLES - 9, rec->mode[9].n);
+        TEST_ASSERT_EQUAL_UINT16(((uint16_t)run + 30u) * 10u, rec->mode[3].sample[0].co2);
+    }
+    TEST_ASSERT_NULL(SDLOG_Get(&Log, SDLOG_SIZE));
+}
+
+void test_SDLOG_Find_should_Page_by_Run_and_Epoch(void)
+{
+    uint16_t idx = 0xFFFF;
+    uint16_t run;
+
+    for (run = 1; run <= 100; run++)
+    {
+        sdlog_run(run, 1000000u + (uint32_t)run * 3600u);
+    }
+
+    TEST_ASSERT_TRUE(SDLOG_FindRun(&Log, 90, &idx));
+    TEST_ASSERT_EQUAL_UINT16(90, SDLOG_Get(&Log, idx)->run);
+    TEST_ASSERT_TRUE(SDLOG_FindRun(&Log, 100, &idx));
+    TEST_ASSERT_EQUAL_UINT16(SDLOG_SIZE - 1, idx);
+
+    /** Gone, start at the oldest held */
+    TEST_ASSERT_TRUE(SDLOG_FindRun(&Log, 3, &idx));
+    TEST_ASSERT_EQUAL_UINT16(0, idx);
+    TEST_ASSERT_FALSE(SDLOG_FindRun(&Log, 101, &idx));
+
+    /** Between two runs starts at the later one */
+    TEST_ASSERT_TRUE(SDLOG_FindEpoch(&Log, 1000000u + 95u * 3600u - 1u, &idx));
+    TEST_ASSERT_EQUAL_UINT16(95, SDLOG_Get(&Log, idx)->run);
+    TEST_ASSERT_TRUE(SDLOG_FindEpoch(&Log, 0, &idx));
+    TEST_ASSERT_EQUAL_UINT16(0, idx);
+    TEST_ASSERT_FALSE(SDLOG_FindEpoch(&Log, 1000000u + 101u * 3600u, &idx));
+}
+
+void test_SDLOG_FindRun_should_Handle_RunNumber_Wrap(void)
+{
+    uint16_t idx;
+    uint16_t i;
+
+    for (i = 0; i < 10; i++)
+    {
+        sdlog_run((uint16_t)(65530u + i), i);
+    }
+
+    TEST_ASSERT_TRUE(SDLOG_FindRun(&Log, 65534, &idx));
+    TEST_ASSERT_EQUAL_UINT16(4, idx);
+    TEST_ASSERT_TRUE(SDLOG_FindRun(&Log, 2, &idx));
+    TEST_ASSERT_EQUAL_UINT16(8, idx);
+    TEST_ASSERT_FALSE(SDLOG_FindRun(&Log, 4, &idx));
+}
+
+void test_SDLOG_Valid_should_Catch_Corruption(void)
+{
+    sSdLogRecord_t *rec;
+    uint16_t run;
+
+    for (run = 1; run <= 20; run++)
+    {
+        sdlog_run(run, run);
+    }
+
+    rec = (sSdLogRecord_t *)SDLOG_Get(&Log, 7);
+    rec->mode[4].sample[11].pres ^= 0x0100;
+    TEST_ASSERT_FALSE(SDLOG_Valid(rec));
+    TEST_ASSERT_TRUE(SDLOG_Valid(SDLOG_Get(&Log, 6)));
+    TEST_ASSERT_TRUE(SDLOG_Valid(SDLOG_Get(&Log, 8)));
+    rec->mode[4].sample[11].pres ^= 0x0100;
+    TEST_ASSERT_TRUE(SDLOG_Valid(rec));
+
+    rec->run++;
+    TEST_ASSERT_FALSE(SDLOG_Valid(rec));
+    rec->run--;
+    rec->crc ^= 1;
+    TEST_ASSERT_FALSE(SDLOG_Valid(rec));
+}
+
+void test_SDLOG_Next_should_Drop_Oldest_when_Full(void)
+{
+    uint16_t run;
+
+    for (run = 1; run <= SDLOG_SIZE; run++)
+    {
+        sdlog_run(run, run);
+    }
+
+    /** Reset before the commit: the rest are still good */
+    SDLOG_Next(&Log);
+    TEST_ASSERT_EQUAL_UINT16(SDLOG_SIZE - 1, SDLOG_Count(&Log));
+    TEST_ASSERT_EQUAL_UINT16(2, SDLOG_Get(&Log, 0)->run);
+    TEST_ASSERT_TRUE(SDLOG_Valid(SDLOG_Get(&Log, 0)));
+
+    SDLOG_Commit(&Log, 17, 17);
+    TEST_ASSERT_EQUAL_UINT16(SDLOG_SIZE, SDLOG_Count(&Log));
+    TEST_ASSERT_EQUAL_UINT16(17, SDLOG_Get(&Log, SDLOG_SIZE - 1)->run);
+}
+
+void test_SDLOG_should_Clear_Corrupt_History(void)
+{
+    Log.head = SDLOG_SIZE;
+    Log.count = 2;
+    TEST_ASSERT_EQUAL_UINT16(0, SDLOG_Count(&Log));
+
+    Log.head = 0;
+    Log.count = SDLOG_SIZE + 1;
+    TEST_ASSERT_NULL(SDLOG_Get(&Log, 0));
+    TEST_ASSERT_EQUAL_UINT16(0, Log.count);
+}
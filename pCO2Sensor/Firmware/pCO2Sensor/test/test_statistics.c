@@ -236,4 +236,57 @@ void test_STATS_AddSample_should_UpdateStruct_EasyCase(void){
         TEST_ASSERT_EQUAL(mins[i],stat.min);
         TEST_ASSERT_INT32_WITHIN(1,means[i],stat.mean);
     }
-}
\ No newline at end of file
+}
+void test_STATS_SEM_should_ReturnInfinity_ForFewerThanTwoSamples(void){
+    STATS_Clear(&Data);
+    TEST_ASSERT_FLOAT_IS_INF(STATS_SEM(&Data));
+
+    STATS_Add(&Data, 400.0f);
+    TEST_ASSERT_FLOAT_IS_INF(STATS_SEM(&Data));
+}
+
+void test_STATS_SEM_should_ComputeStandardErrorOfMean(void){
+    float nums[8] = {2.0f, 4.0f, 4.0f, 4.0f, 5.0f, 5.0f, 7.0f, 9.0f};
+    uint8_t i;
+
+    STATS_Clear(&Data);
+    for(i=0;i<8;i++){
+        STATS_Add(&Data, nums[i]);
+    }
+
+    /** Sample variance = 32/7, SEM = sqrt(32/7/8) */
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.755929f, STATS_SEM(&Data));
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, Data.mean);
+}
+
+void test_STATS_LinearFit_should_FitSlopeAndIntercept(void){
+    float x[5] = {0.0f, 10.0f, 20.0f, 30.0f, 40.0f};
+    float y[5] = {400.0f, 401.0f, 402.0f, 403.0f, 404.0f};
+    float slope = 0.0f;
+    float intercept = 0.0f;
+
+    TEST_ASSERT_TRUE(STATS_LinearFit(x, y, 5, &slope, &intercept));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.1f, slope);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 400.0f, intercept);
+}
+
+void test_STATS_LinearFit_should_IgnorePointOrder(void){
+    float x[5] = {30.0f, 40.0f, 0.0f, 10.0f, 20.0f};
+    float y[5] = {394.0f, 392.0f, 400.0f, 398.0f, 396.0f};
+    float slope = 0.0f;
+    float intercept = 0.0f;
+
+    TEST_ASSERT_TRUE(STATS_LinearFit(x, y, 5, &slope, &intercept));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, -0.2f, slope);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 400.0f, intercept);
+}
+
+void test_STATS_LinearFit_should_Fail_WithoutSpreadInX(void){
+    float x[3] = {5.0f, 5.0f, 5.0f};
+    float y[3] = {1.0f, 2.0f, 3.0f};
+    float slope = 0.0f;
+    float intercept = 0.0f;
+
+    TEST_ASSERT_FALSE(STATS_LinearFit(x, y, 1, &slope, &intercept));
+    TEST_ASSERT_FALSE(STATS_LinearFit(x, y, 3, &slope, &intercept));
+}
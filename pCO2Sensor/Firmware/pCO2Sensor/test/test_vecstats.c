@@ -0,0 +1,133 @@
+#include "unity.h"
+#include "vecstats.h"
+#include "statistics.h"
+
+#define TEST_WINDOW_LEN (60)
+
+float Window[TEST_WINDOW_LEN];
+int16_t WindowQ15[TEST_WINDOW_LEN];
+int32_t WindowQ31[TEST_WINDOW_LEN];
+
+void setUp(void)
+{
+	uint16_t i;
+
+	/** CO2 like channel, 400 ppm with a few ppm of structure */
+	for(i=0;i<TEST_WINDOW_LEN;i++){
+		Window[i] = 400.0f + 2.5f * sinf((float)i * 0.37f) + 0.001f * (float)(i % 7);
+	}
+}
+
+void tearDown(void)
+{
+}
+
+void test_VSTATS_ToQ15_should_Round_and_Saturate(void){
+	const float src[] = {1.0004f, 1.0006f, 0.9994f, 100.0f, -100.0f, NAN};
+	int16_t dst[6];
+
+	TEST_ASSERT_EQUAL(3,VSTATS_ToQ15(src,dst,6,1.0f,0.001f));
+	TEST_ASSERT_EQUAL_INT16(0,dst[0]);
+	TEST_ASSERT_EQUAL_INT16(1,dst[1]);
+	TEST_ASSERT_EQUAL_INT16(-1,dst[2]);
+	TEST_ASSERT_EQUAL_INT16(VSTATS_Q15_MAX,dst[3]);
+	TEST_ASSERT_EQUAL_INT16(VSTATS_Q15_MIN,dst[4]);
+	TEST_ASSERT_EQUAL_INT16(0,dst[5]);
+}
+
+void test_VSTATS_Window_Q15_should_ComputeExactSums(void){
+	const int16_t x[] = {1, 2, 3, 4, -10};
+	sVStats_Q15_t s;
+
+	VSTATS_Window_Q15(x,5,&s);
+	TEST_ASSERT_EQUAL(5,s.n);
+	TEST_ASSERT_EQUAL_INT32(0,s.sum);
+	TEST_ASSERT_EQUAL_INT32(130,(int32_t)s.sumsq);
+	TEST_ASSERT_EQUAL_INT16(-10,s.min);
+	TEST_ASSERT_EQUAL_INT16(4,s.max);
+	TEST_ASSERT_EQUAL_FLOAT(0.0f,VSTATS_Mean_Q15(&s,0.0f,1.0f));
+	TEST_ASSERT_EQUAL_FLOAT(26.0f,VSTATS_Var_Q15(&s,1.0f));
+}
+
+void test_VSTATS_Window_Q15_should_Match_FloatStats(void){
+	sVStats_Q15_t s;
+	sStats_F_t ref;
+	uint16_t i;
+
+	STATS_Clear(&ref);
+	ref.min = 1e9f;
+	ref.max = -1e9f;
+	for(i=0;i<TEST_WINDOW_LEN;i++){
+		STATS_Add(&ref,Window[i]);
+	}
+	STATS_Compute(&ref);
+
+	TEST_ASSERT_EQUAL(0,VSTATS_ToQ15(Window,WindowQ15,TEST_WINDOW_LEN,400.0f,0.001f));
+	VSTATS_Window_Q15(WindowQ15,TEST_WINDOW_LEN,&s);
+
+	/** Within the Q15 quantization (1 count = 0.001) */
+	TEST_ASSERT_FLOAT_WITHIN(0.001f,ref.mean,VSTATS_Mean_Q15(&s,400.0f,0.001f));
+	TEST_ASSERT_FLOAT_WITHIN(0.002f,ref.std,sqrtf(VSTATS_Var_Q15(&s,0.001f)));
+	TEST_ASSERT_FLOAT_WITHIN(0.001f,ref.min,(float)s.min * 0.001f + 400.0f);
+	TEST_ASSERT_FLOAT_WITHIN(0.001f,ref.max,(float)s.max * 0.001f + 400.0f);
+}
+
+void test_VSTATS_Window_Q15_should_NotDependOnSampleOrder(void){
+	int16_t rev[TEST_WINDOW_LEN];
+	sVStats_Q15_t fwd;
+	sVStats_Q15_t bwd;
+	uint16_t i;
+
+	VSTATS_ToQ15(Window,WindowQ15,TEST_WINDOW_LEN,400.0f,0.001f);
+	for(i=0;i<TEST_WINDOW_LEN;i++){
+		rev[i] = WindowQ15[TEST_WINDOW_LEN - 1 - i];
+	}
+
+	VSTATS_Window_Q15(WindowQ15,TEST_WINDOW_LEN,&fwd);
+	VSTATS_Window_Q15(rev,TEST_WINDOW_LEN,&bwd);
+	TEST_ASSERT_EQUAL_INT32(fwd.sum,bwd.sum);
+	TEST_ASSERT_TRUE(fwd.sumsq == bwd.sumsq);
+	TEST_ASSERT_EQUAL_INT16(fwd.min,bwd.min);
+	TEST_ASSERT_EQUAL_INT16(fwd.max,bwd.max);
+}
+
+void test_VSTATS_Window_Q31_should_Handle_LargeOffsets(void){
+	const int32_t x[] = {2000000000L, 2000000002L, 2000000004L, 2000000006L};
+	sVStats_Q31_t s;
+
+	VSTATS_Window_Q31(x,4,&s);
+	TEST_ASSERT_EQUAL_INT32(2000000003L,s.mean);
+	TEST_ASSERT_EQUAL_INT32(2000000000L,s.min);
+	TEST_ASSERT_EQUAL_INT32(2000000006L,s.max);
+	TEST_ASSERT_EQUAL_FLOAT(5.0f,VSTATS_Var_Q31(&s,1.0f));
+}
+
+void test_VSTATS_Window_Q31_should_Match_FloatStats(void){
+	sVStats_Q31_t s;
+	sStats_F_t ref;
+	uint16_t i;
+
+	STATS_Clear(&ref);
+	for(i=0;i<TEST_WINDOW_LEN;i++){
+		STATS_Add(&ref,Window[i]);
+	}
+	STATS_Compute(&ref);
+
+	TEST_ASSERT_EQUAL(0,VSTATS_ToQ31(Window,WindowQ31,TEST_WINDOW_LEN,0.0f,0.00001f));
+	VSTATS_Window_Q31(WindowQ31,TEST_WINDOW_LEN,&s);
+
+	TEST_ASSERT_FLOAT_WITHIN(0.001f,ref.mean,VSTATS_Mean_Q31(&s,0.0f,0.00001f));
+	TEST_ASSERT_FLOAT_WITHIN(0.001f,ref.std,sqrtf(VSTATS_Var_Q31(&s,0.00001f)));
+}
+
+void test_VSTATS_Empty_Window_should_ReturnNAN(void){
+	sVStats_Q15_t s;
+	sVStats_Q31_t s31;
+
+	VSTATS_Window_Q15(WindowQ15,0,&s);
+	VSTATS_Window_Q31(WindowQ31,0,&s31);
+	TEST_ASSERT_TRUE(isnan(VSTATS_Mean_Q15(&s,0.0f,1.0f)));
+	TEST_ASSERT_TRUE(isnan(VSTATS_Var_Q15(&s,1.0f)));
+	TEST_ASSERT_TRUE(isnan(VSTATS_Mean_Q31(&s31,0.0f,1.0f)));
+	TEST_ASSERT_TRUE(isnan(VSTATS_Var_Q31(&s31,1.0f)));
+}